@@ -0,0 +1,82 @@
+#!/usr/bin/python
+
+#  File:   generate_crc_tables.py
+#  Author: Taylor Robbins
+#  Date:   10\19\2026
+#  Description:
+#  	** Generates misc/misc_crc_tables.h which holds the slicing-by-8 lookup tables for
+#  	** CRC32 and CRC32C used by misc_crc.h. Table [0] is the regular byte-at-a-time table,
+#  	** table [N] advances a byte's contribution through N more zero bytes.
+#  	** The tables are constant data so there is no lazy initialization to race on between threads.
+#  Usage:
+#  	** python generate_crc_tables.py [output_path]
+#  	** Output path defaults to ../misc/misc_crc_tables.h relative to this script
+
+import os.path
+import sys
+
+# NOTE: These must match CRC32_POLYNOMIAL and CRC32C_POLYNOMIAL in misc_crc.h
+CRC32_POLYNOMIAL  = 0xEDB88320 # reflected 0x04C11DB7
+CRC32C_POLYNOMIAL = 0x82F63B78 # reflected 0x1EDC6F41
+NUM_SLICES = 8
+
+def BuildSlicingTables(polynomial):
+	tables = []
+	for byteValue in range(256):
+		crc = byteValue
+		for bitIndex in range(8):
+			crc = (crc >> 1) ^ (polynomial if (crc & 1) else 0)
+		tables.append(crc)
+	for tableIndex in range(1, NUM_SLICES):
+		for byteValue in range(256):
+			previous = tables[(tableIndex-1)*256 + byteValue]
+			tables.append((previous >> 8) ^ tables[previous & 0xFF])
+	return tables
+
+def FormatArray(outputLines, typeName, name, values):
+	outputLines.append("const %s %s[%d*256] = {" % (typeName, name, NUM_SLICES))
+	valuesPerLine = 8
+	for lineStart in range(0, len(values), valuesPerLine):
+		outputLines.append("\t" + ", ".join("0x%08X" % value for value in values[lineStart : lineStart + valuesPerLine]) + ",")
+	outputLines.append("};")
+
+def main():
+	scriptDir = os.path.dirname(os.path.abspath(__file__))
+	outputPath = sys.argv[1] if len(sys.argv) > 1 else os.path.join(scriptDir, "..", "misc", "misc_crc_tables.h")
+
+	crc32Tables = BuildSlicingTables(CRC32_POLYNOMIAL)
+	crc32cTables = BuildSlicingTables(CRC32C_POLYNOMIAL)
+
+	outputLines = []
+	outputLines.append("/*")
+	outputLines.append("File:   misc_crc_tables.h")
+	outputLines.append("Author: Taylor Robbins")
+	outputLines.append("Date:   10\\19\\2026")
+	outputLines.append("Description:")
+	outputLines.append("\t** !! This file is generated by _scripts/generate_crc_tables.py, do not edit it by hand !!")
+	outputLines.append("\t** Holds the slicing-by-8 tables used by the software fallback in misc_crc.h")
+	outputLines.append("\t** Table [0] is the regular byte-at-a-time table, table [N] advances a byte's contribution through N more zero bytes")
+	outputLines.append("*/")
+	outputLines.append("")
+	outputLines.append("#ifndef _MISC_CRC_TABLES_H")
+	outputLines.append("#define _MISC_CRC_TABLES_H")
+	outputLines.append("")
+	outputLines.append("#include \"base/base_defines_check.h\"")
+	outputLines.append("#include \"base/base_typedefs.h\"")
+	outputLines.append("")
+	outputLines.append("#if !PIG_CORE_IMPLEMENTATION")
+	outputLines.append("extern const u32 Crc32Tables[%d*256];" % NUM_SLICES)
+	outputLines.append("extern const u32 Crc32cTables[%d*256];" % NUM_SLICES)
+	outputLines.append("#else")
+	FormatArray(outputLines, "u32", "Crc32Tables", crc32Tables)
+	FormatArray(outputLines, "u32", "Crc32cTables", crc32cTables)
+	outputLines.append("#endif //PIG_CORE_IMPLEMENTATION")
+	outputLines.append("")
+	outputLines.append("#endif //  _MISC_CRC_TABLES_H")
+
+	outputFile = open(outputPath, "w", newline="\n")
+	outputFile.write("\n".join(outputLines) + "\n")
+	outputFile.close()
+	print("Wrote %s (%d bytes of tables)" % (outputPath, (len(crc32Tables) + len(crc32cTables)) * 4))
+
+main()
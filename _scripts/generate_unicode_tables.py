@@ -0,0 +1,171 @@
+#!/usr/bin/python
+
+#  File:   generate_unicode_tables.py
+#  Author: Taylor Robbins
+#  Date:   10\19\2026
+#  Description:
+#  	** Generates base/base_unicode_tables.h which holds compact multi-stage lookup tables
+#  	** for simple case folding, general category, and east asian width of every codepoint.
+#  	** The data comes from python's unicodedata module so the Unicode version of the output
+#  	** matches whatever version of python is used to run this script.
+#  	** Each table is split into 3 stages. The lowest stage is made of small blocks of values
+#  	** and identical blocks are shared, the middle stage does the same for runs of block indices,
+#  	** so large uniform regions (unassigned planes, CJK ideographs, private use) collapse to almost nothing.
+#  Usage:
+#  	** python generate_unicode_tables.py [output_path]
+#  	** Output path defaults to ../base/base_unicode_tables.h relative to this script
+
+import os.path
+import sys
+import unicodedata
+
+NUM_CODEPOINTS = 0x110000
+
+# NOTE: These must match the order of the UnicodeCategory enum in base_unicode.h
+categoryAbbreviations = [
+	"Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No",
+	"Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So",
+	"Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co",
+]
+# NOTE: These must match the order of the UnicodeEastAsianWidth enum in base_unicode.h
+eastAsianWidthAbbreviations = [ "N", "A", "H", "W", "F", "Na" ]
+EAST_ASIAN_WIDTH_SHIFT = 5
+
+# Simple case folding (CaseFolding.txt status C+S). Python only exposes full folding so when
+# the full fold is more than one codepoint we fall back to the single codepoint lowercase mapping
+def GetSimpleFold(codepoint):
+	char = chr(codepoint)
+	folded = char.casefold()
+	if len(folded) == 1: return ord(folded)
+	lowered = char.lower()
+	if len(lowered) == 1: return ord(lowered)
+	return codepoint
+
+def BuildStages(values, stage2Shift, stage3Shift):
+	stage3BlockSize = (1 << stage3Shift)
+	stage3Blocks = {}
+	stage3Indices = []
+	for blockStart in range(0, len(values), stage3BlockSize):
+		block = tuple(values[blockStart : blockStart + stage3BlockSize])
+		stage3Blocks.setdefault(block, len(stage3Blocks))
+		stage3Indices.append(stage3Blocks[block])
+	stage2BlockSize = (1 << stage2Shift)
+	stage2Blocks = {}
+	stage1 = []
+	for blockStart in range(0, len(stage3Indices), stage2BlockSize):
+		block = tuple(stage3Indices[blockStart : blockStart + stage2BlockSize])
+		stage2Blocks.setdefault(block, len(stage2Blocks))
+		stage1.append(stage2Blocks[block])
+	stage2 = [index for block in stage2Blocks for index in block]
+	stage3 = [value for block in stage3Blocks for value in block]
+	return (stage1, stage2, stage3)
+
+def GetTypeForValues(values):
+	maxValue = max(values)
+	if maxValue <= 0xFF: return ("u8", 1)
+	if maxValue <= 0xFFFF: return ("u16", 2)
+	return ("u32", 4)
+
+def GetStagesSize(stages):
+	return sum(len(stage) * GetTypeForValues(stage)[1] for stage in stages)
+
+def FindSmallestStages(values):
+	bestStages = None
+	bestShifts = None
+	for stage3Shift in range(3, 9):
+		for stage2Shift in range(2, 10):
+			stages = BuildStages(values, stage2Shift, stage3Shift)
+			if bestStages == None or GetStagesSize(stages) < GetStagesSize(bestStages):
+				bestStages = stages
+				bestShifts = (stage2Shift, stage3Shift)
+	return (bestStages, bestShifts)
+
+def FormatArray(outputLines, declPrefix, typeName, name, values):
+	outputLines.append("%sconst %s %s[%d] = {" % (declPrefix, typeName, name, len(values)))
+	valuesPerLine = 32 if typeName == "u8" else 16
+	for lineStart in range(0, len(values), valuesPerLine):
+		outputLines.append("\t" + ",".join(str(value) for value in values[lineStart : lineStart + valuesPerLine]) + ",")
+	outputLines.append("};")
+
+def main():
+	scriptDir = os.path.dirname(os.path.abspath(__file__))
+	outputPath = sys.argv[1] if len(sys.argv) > 1 else os.path.join(scriptDir, "..", "base", "base_unicode_tables.h")
+
+	properties = [0] * NUM_CODEPOINTS
+	foldDeltas = [0] * NUM_CODEPOINTS
+	for codepoint in range(NUM_CODEPOINTS):
+		char = chr(codepoint)
+		category = categoryAbbreviations.index(unicodedata.category(char))
+		eastAsianWidth = eastAsianWidthAbbreviations.index(unicodedata.east_asian_width(char))
+		properties[codepoint] = category | (eastAsianWidth << EAST_ASIAN_WIDTH_SHIFT)
+		foldDeltas[codepoint] = GetSimpleFold(codepoint) - codepoint
+
+	# The fold table stores an index into a small table of distinct deltas rather than the deltas themselves
+	# and it only covers the range of codepoints that have any folding (everything past that folds to itself)
+	distinctDeltas = sorted(set(foldDeltas), key=lambda delta: (delta != 0, delta))
+	deltaIndices = { delta: index for index, delta in enumerate(distinctDeltas) }
+	foldLimit = max(codepoint for codepoint in range(NUM_CODEPOINTS) if foldDeltas[codepoint] != 0) + 1
+	(foldStages, foldShifts) = FindSmallestStages([deltaIndices[delta] for delta in foldDeltas[0:foldLimit]])
+	(propStages, propShifts) = FindSmallestStages(properties)
+	foldLimit = len(foldStages[0]) << (foldShifts[0] + foldShifts[1]) # round up to the coverage of stage1
+
+	foldSize = GetStagesSize(foldStages) + len(distinctDeltas) * 4
+	propSize = GetStagesSize(propStages)
+
+	outputLines = []
+	outputLines.append("/*")
+	outputLines.append("File:   base_unicode_tables.h")
+	outputLines.append("Author: Taylor Robbins")
+	outputLines.append("Date:   10\\19\\2026")
+	outputLines.append("Description:")
+	outputLines.append("\t** !! This file is generated by _scripts/generate_unicode_tables.py, do not edit it by hand !!")
+	outputLines.append("\t** Holds the 3-stage lookup tables used by GetCaseFoldedCodepoint, GetCodepointCategory,")
+	outputLines.append("\t** and GetCodepointEastAsianWidth in base_unicode.h")
+	outputLines.append("\t** Generated from Unicode %s (fold tables: %d bytes, property tables: %d bytes)" % (unicodedata.unidata_version, foldSize, propSize))
+	outputLines.append("*/")
+	outputLines.append("")
+	outputLines.append("#ifndef _BASE_UNICODE_TABLES_H")
+	outputLines.append("#define _BASE_UNICODE_TABLES_H")
+	outputLines.append("")
+	outputLines.append("#include \"base/base_defines_check.h\"")
+	outputLines.append("#include \"base/base_typedefs.h\"")
+	outputLines.append("")
+	outputLines.append("#define UNICODE_TABLES_VERSION \"%s\"" % unicodedata.unidata_version)
+	outputLines.append("")
+	outputLines.append("//Codepoints >= UNICODE_FOLD_TABLE_LIMIT always fold to themselves")
+	outputLines.append("#define UNICODE_FOLD_TABLE_LIMIT   0x%05XUL" % foldLimit)
+	outputLines.append("#define UNICODE_FOLD_STAGE2_SHIFT  %d" % foldShifts[0])
+	outputLines.append("#define UNICODE_FOLD_STAGE3_SHIFT  %d" % foldShifts[1])
+	outputLines.append("#define UNICODE_PROP_STAGE2_SHIFT  %d" % propShifts[0])
+	outputLines.append("#define UNICODE_PROP_STAGE3_SHIFT  %d" % propShifts[1])
+	outputLines.append("//Property values hold the UnicodeCategory in the low bits and the UnicodeEastAsianWidth in the high bits")
+	outputLines.append("#define UNICODE_PROP_CATEGORY_MASK 0x%02X" % ((1 << EAST_ASIAN_WIDTH_SHIFT) - 1))
+	outputLines.append("#define UNICODE_PROP_WIDTH_SHIFT   %d" % EAST_ASIAN_WIDTH_SHIFT)
+	outputLines.append("")
+
+	tables = [
+		("UnicodeFoldStage1", foldStages[0]),
+		("UnicodeFoldStage2", foldStages[1]),
+		("UnicodeFoldStage3", foldStages[2]),
+		("UnicodePropStage1", propStages[0]),
+		("UnicodePropStage2", propStages[1]),
+		("UnicodePropStage3", propStages[2]),
+	]
+	outputLines.append("#if !PIG_CORE_IMPLEMENTATION")
+	for (tableName, tableValues) in tables:
+		outputLines.append("extern const %s %s[%d];" % (GetTypeForValues(tableValues)[0], tableName, len(tableValues)))
+	outputLines.append("extern const i32 UnicodeFoldDeltas[%d];" % len(distinctDeltas))
+	outputLines.append("#else")
+	for (tableName, tableValues) in tables:
+		FormatArray(outputLines, "", GetTypeForValues(tableValues)[0], tableName, tableValues)
+	FormatArray(outputLines, "", "i32", "UnicodeFoldDeltas", distinctDeltas)
+	outputLines.append("#endif //PIG_CORE_IMPLEMENTATION")
+	outputLines.append("")
+	outputLines.append("#endif //  _BASE_UNICODE_TABLES_H")
+
+	outputFile = open(outputPath, "w", newline="\n")
+	outputFile.write("\n".join(outputLines) + "\n")
+	outputFile.close()
+	print("Wrote %s (Unicode %s, %d + %d bytes)" % (outputPath, unicodedata.unidata_version, foldSize, propSize))
+
+main()
@@ -18,11 +18,15 @@ Description:
 #include "base/base_dbg_level.h"
 #include "base/base_debug_output.h"
 #include "base/base_math.h"
+#include "base/base_simd.h"
 
 #include "std/std_includes.h" //required by base_assert.h
 
 #include "base/base_assert.h"
 #include "base/base_char.h"
+#include "base/base_char_set.h"
+#include "base/base_unicode_tables.h"
+#include "base/base_unicode_convert.h"
 #include "base/base_unicode.h"
 
 #include "base/base_debug_output_impl.h"
@@ -0,0 +1,190 @@
+/*
+File:   base_char_set.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds the CharSet structure which is a precompiled set of codepoints that can
+	** be built once and then used to quickly answer "is this codepoint in the set?"
+	** or to search a buffer for the next byte that is (or isn't) in the set.
+	** Codepoints 0-255 are stored in a 256-bit bitmap, everything above that is stored
+	** as a sorted table of non-overlapping ranges that we binary search.
+	** ASCII membership is also stored as a pair of 16-entry nibble tables so a block of
+	** 16 bytes can be classified with two table lookups (SSSE3, NEON, WASM SIMD).
+	** NOTE: A ZEROED CharSet is a valid empty set. CharSets hold no allocated memory so
+	** they can be copied and stored freely. The tradeoff is a fixed maximum number of
+	** ranges (CHAR_SET_MAX_RANGES), adjacent codepoints are merged into a single range.
+	** NOTE: Functions that take Str8 (like NewCharSet and FindNextCharInSet) can be found
+	** in cross_string_and_unicode.h
+*/
+
+#ifndef _BASE_CHAR_SET_H
+#define _BASE_CHAR_SET_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_simd.h"
+#include "std/std_memset.h"
+
+#define CHAR_SET_MAX_RANGES 32
+
+//min and max are both inclusive
+typedef struct CharSetRange CharSetRange;
+struct CharSetRange
+{
+	u32 min;
+	u32 max;
+};
+
+typedef struct CharSet CharSet;
+struct CharSet
+{
+	u64 bits[4]; //one bit for each codepoint 0-255
+	//An ASCII byte is in the set when (nibbleLowTable[byte & 0x0F] & nibbleHighTable[byte >> 4]) != 0
+	//Bit N in these tables corresponds to a high nibble of N, high nibbles 8-15 are always 0
+	u8 nibbleLowTable[16];
+	u8 nibbleHighTable[16];
+	bool hasNonAscii; //true if any codepoint >= 0x80 is in the set
+	uxx numRanges;
+	CharSetRange ranges[CHAR_SET_MAX_RANGES]; //sorted, non-overlapping, non-adjacent, all >= 256
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	bool CharSetAddRangeEx(CharSet* set, u32 minCodepoint, u32 maxCodepoint, bool assertOnFull);
+	PIG_CORE_INLINE bool CharSetAddRange(CharSet* set, u32 minCodepoint, u32 maxCodepoint);
+	PIG_CORE_INLINE bool CharSetAddCodepoint(CharSet* set, u32 codepoint);
+	PIG_CORE_INLINE void CharSetAddAsciiChars(CharSet* set, const char* nullTermChars);
+	PIG_CORE_INLINE bool IsCodepointInCharSet(const CharSet* set, u32 codepoint);
+	uxx FindNextCharSetCandidate(const CharSet* set, const void* bytes, uxx numBytes, bool matchInSet);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+//Returns false if the set ran out of space for ranges (nothing above 255 is added in that case).
+//Pass assertOnFull = false when the caller has a fallback for sets that don't fit
+PEXP bool CharSetAddRangeEx(CharSet* set, u32 minCodepoint, u32 maxCodepoint, bool assertOnFull)
+{
+	NotNull(set);
+	Assert(minCodepoint <= maxCodepoint);
+	if (maxCodepoint >= 0x80) { set->hasNonAscii = true; }
+	
+	for (u32 codepoint = minCodepoint; codepoint <= maxCodepoint && codepoint < 256; codepoint++)
+	{
+		set->bits[codepoint / 64] |= (1ULL << (codepoint % 64));
+		if (codepoint < 0x80)
+		{
+			set->nibbleLowTable[codepoint & 0x0F] |= (u8)(1 << (codepoint >> 4));
+			set->nibbleHighTable[codepoint >> 4] = (u8)(1 << (codepoint >> 4));
+		}
+	}
+	if (maxCodepoint < 256) { return true; }
+	if (minCodepoint < 256) { minCodepoint = 256; }
+	
+	//Find the run of existing ranges that overlap or touch the new one and merge them all into a single range
+	uxx insertIndex = 0;
+	while (insertIndex < set->numRanges && (u64)set->ranges[insertIndex].max + 1 < minCodepoint) { insertIndex++; }
+	uxx endIndex = insertIndex;
+	while (endIndex < set->numRanges && set->ranges[endIndex].min <= (u64)maxCodepoint + 1)
+	{
+		if (set->ranges[endIndex].min < minCodepoint) { minCodepoint = set->ranges[endIndex].min; }
+		if (set->ranges[endIndex].max > maxCodepoint) { maxCodepoint = set->ranges[endIndex].max; }
+		endIndex++;
+	}
+	
+	if (endIndex == insertIndex)
+	{
+		if (set->numRanges >= CHAR_SET_MAX_RANGES)
+		{
+			if (assertOnFull) { AssertMsg(false, "CharSet ran out of space for ranges. Increase CHAR_SET_MAX_RANGES"); }
+			return false;
+		}
+		MyMemMove(&set->ranges[insertIndex+1], &set->ranges[insertIndex], (set->numRanges - insertIndex) * sizeof(CharSetRange));
+		set->numRanges++;
+	}
+	else if (endIndex > insertIndex+1)
+	{
+		MyMemMove(&set->ranges[insertIndex+1], &set->ranges[endIndex], (set->numRanges - endIndex) * sizeof(CharSetRange));
+		set->numRanges -= (endIndex - (insertIndex+1));
+	}
+	set->ranges[insertIndex].min = minCodepoint;
+	set->ranges[insertIndex].max = maxCodepoint;
+	return true;
+}
+PEXPI bool CharSetAddRange(CharSet* set, u32 minCodepoint, u32 maxCodepoint) { return CharSetAddRangeEx(set, minCodepoint, maxCodepoint, true); }
+PEXPI bool CharSetAddCodepoint(CharSet* set, u32 codepoint) { return CharSetAddRange(set, codepoint, codepoint); }
+PEXPI void CharSetAddAsciiChars(CharSet* set, const char* nullTermChars)
+{
+	NotNull(nullTermChars);
+	for (uxx cIndex = 0; nullTermChars[cIndex] != '\0'; cIndex++) { CharSetAddCodepoint(set, (u32)(u8)nullTermChars[cIndex]); }
+}
+
+PEXPI bool IsCodepointInCharSet(const CharSet* set, u32 codepoint)
+{
+	if (codepoint < 256) { return ((set->bits[codepoint / 64] & (1ULL << (codepoint % 64))) != 0); }
+	uxx lowIndex = 0;
+	uxx highIndex = set->numRanges;
+	while (lowIndex < highIndex)
+	{
+		uxx middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+		if (codepoint < set->ranges[middleIndex].min) { highIndex = middleIndex; }
+		else if (codepoint > set->ranges[middleIndex].max) { lowIndex = middleIndex + 1; }
+		else { return true; }
+	}
+	return false;
+}
+
+//Returns the index of the first ASCII byte whose membership in the set matches matchInSet.
+//Bytes >= 0x80 can't be answered without decoding, so we also stop on those unless we are looking for
+//members and the set has no non-ASCII codepoints (in which case they can never match)
+//Returns numBytes if no such byte was found
+PEXP uxx FindNextCharSetCandidate(const CharSet* set, const void* bytes, uxx numBytes, bool matchInSet)
+{
+	NotNull(set);
+	Assert(bytes != nullptr || numBytes == 0);
+	const u8* bytePntr = (const u8*)bytes;
+	bool stopOnNonAscii = (set->hasNonAscii || !matchInSet);
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_SIMD128_LOOKUP
+	SimdU8x16 lowTable = SimdLoadU8x16(&set->nibbleLowTable[0]);
+	SimdU8x16 highTable = SimdLoadU8x16(&set->nibbleHighTable[0]);
+	SimdU8x16 lowNibbleMask = SimdSplatU8x16(0x0F);
+	SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+	SimdU8x16 allOnesVec = SimdSplatU8x16(0xFF);
+	while (bIndex + 16 <= numBytes)
+	{
+		SimdU8x16 input = SimdLoadU8x16(bytePntr + bIndex);
+		SimdU8x16 classes = SimdAndU8x16(SimdLookupU8x16(lowTable, SimdAndU8x16(input, lowNibbleMask)), SimdLookupU8x16(highTable, SimdShiftRight4U8x16(input)));
+		SimdU8x16 notInSet = SimdEqualsU8x16(classes, zeroVec); //non-ASCII bytes always land here
+		SimdU8x16 flagged = matchInSet ? SimdXorU8x16(notInSet, allOnesVec) : notInSet;
+		if (matchInSet && stopOnNonAscii) { flagged = SimdOrU8x16(flagged, input); } //only the high bit is used below
+		u64 mask = SimdHighBitMaskU8x16(flagged);
+		if (mask != 0) { return bIndex + (uxx)(CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE); }
+		bIndex += 16;
+	}
+	#endif
+	
+	for (; bIndex < numBytes; bIndex++)
+	{
+		u8 byte = bytePntr[bIndex];
+		if (byte >= 0x80)
+		{
+			if (stopOnNonAscii) { return bIndex; }
+			continue;
+		}
+		bool isInSet = ((set->bits[byte / 64] & (1ULL << (byte % 64))) != 0);
+		if (isInSet == matchInSet) { return bIndex; }
+	}
+	return numBytes;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _BASE_CHAR_SET_H
@@ -15,6 +15,10 @@ Description:
 #include "base/base_typedefs.h"
 #include "base/base_macros.h"
 
+#if COMPILER_IS_MSVC
+#include <intrin.h> //needed for _umul128 and __umulh
+#endif
+
 // +--------------------------------------------------------------+
 // |                 Header Function Declarations                 |
 // +--------------------------------------------------------------+
@@ -72,6 +76,7 @@ Description:
 	PIG_CORE_INLINE i16 AbsDiffI16(i16 value1, i16 value2);
 	PIG_CORE_INLINE i32 AbsDiffI32(i32 value1, i32 value2);
 	PIG_CORE_INLINE i64 AbsDiffI64(i64 value1, i64 value2);
+	PIG_CORE_INLINE u64 MultiplyU64Wide(u64 left, u64 right, u64* highOut);
 #endif //!PIG_CORE_IMPLEMENTATION
 
 // +--------------------------------------------------------------+
@@ -173,6 +178,32 @@ PEXPI i16 AbsDiffI16(i16 value1, i16 value2) { return (value1 >= value2) ? (valu
 PEXPI i32 AbsDiffI32(i32 value1, i32 value2) { return (value1 >= value2) ? (value1 - value2) : (value2 - value1); }
 PEXPI i64 AbsDiffI64(i64 value1, i64 value2) { return (value1 >= value2) ? (value1 - value2) : (value2 - value1); }
 
+//Returns the low 64 bits of the full 128-bit product and writes the high 64 bits to highOut
+PEXPI u64 MultiplyU64Wide(u64 left, u64 right, u64* highOut)
+{
+	#if (COMPILER_IS_MSVC && defined(_M_X64))
+	return _umul128(left, right, highOut);
+	#elif (COMPILER_IS_MSVC && defined(_M_ARM64))
+	*highOut = __umulh(left, right);
+	return left * right;
+	#elif (TARGET_IS_64BIT && !COMPILER_IS_MSVC)
+	unsigned __int128 product = (unsigned __int128)left * (unsigned __int128)right;
+	*highOut = (u64)(product >> 64);
+	return (u64)product;
+	#else
+	//Schoolbook multiply on 32-bit halves
+	u64 leftLow = (u32)left, leftHigh = (left >> 32);
+	u64 rightLow = (u32)right, rightHigh = (right >> 32);
+	u64 lowLow = leftLow * rightLow;
+	u64 highLow = leftHigh * rightLow;
+	u64 lowHigh = leftLow * rightHigh;
+	u64 highHigh = leftHigh * rightHigh;
+	u64 middle = (lowLow >> 32) + (u32)highLow + lowHigh;
+	*highOut = highHigh + (highLow >> 32) + (middle >> 32);
+	return (middle << 32) | (u32)lowLow;
+	#endif
+}
+
 #endif //PIG_CORE_IMPLEMENTATION
 
 #endif //  _BASE_MATH_H
@@ -0,0 +1,753 @@
+/*
+File:   base_simd.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Checks for various #defines to determine which SIMD instruction sets we are allowed to use
+	** (based on the compiler flags, we don't do any runtime detection here) and #includes the matching
+	** intrinsics headers. Also holds a few bit-twiddling helpers that SIMD code commonly needs
+	** to turn comparison masks back into indices.
+	** NOTE: MSVC doesn't define __SSE4_2__ or __SSSE3__ so we assume those are available when __AVX__ is
+*/
+
+#ifndef _BASE_SIMD_H
+#define _BASE_SIMD_H
+
+#include "base/base_compiler_check.h"
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+
+// +--------------------------------------------------------------+
+// |                  Determine SIMD Instructions                 |
+// +--------------------------------------------------------------+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define TARGET_HAS_SSE2 1
+#else
+#define TARGET_HAS_SSE2 0
+#endif
+
+#if (defined(__SSSE3__) || (COMPILER_IS_MSVC && defined(__AVX__)))
+#define TARGET_HAS_SSSE3 1
+#else
+#define TARGET_HAS_SSSE3 0
+#endif
+
+#if (defined(__SSE4_2__) || (COMPILER_IS_MSVC && defined(__AVX__)))
+#define TARGET_HAS_SSE42 1
+#else
+#define TARGET_HAS_SSE42 0
+#endif
+
+#if defined(__AVX2__)
+#define TARGET_HAS_AVX2 1
+#else
+#define TARGET_HAS_AVX2 0
+#endif
+
+//NOTE: We only count AArch64 NEON, 32-bit ARM is missing things like vqtbl1q_u8, vmaxvq_u8 and vaddlvq_u8 that we rely on
+#if ((defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64))
+#define TARGET_HAS_NEON 1
+#else
+#define TARGET_HAS_NEON 0
+#endif
+
+#if defined(__wasm_simd128__)
+#define TARGET_HAS_WASM_SIMD 1
+#else
+#define TARGET_HAS_WASM_SIMD 0
+#endif
+
+//Any 128-bit wide integer SIMD at all, the SimdU8x16 functions below are available when this is true
+#define TARGET_HAS_SIMD128 (TARGET_HAS_SSE2 || TARGET_HAS_NEON || TARGET_HAS_WASM_SIMD)
+//SimdLookupU8x16 (a 16-entry byte table lookup, aka pshufb\tbl\swizzle) is available when this is true
+#define TARGET_HAS_SIMD128_LOOKUP (TARGET_HAS_SSSE3 || TARGET_HAS_NEON || TARGET_HAS_WASM_SIMD)
+
+#if TARGET_HAS_AVX2
+	#include <immintrin.h>
+#elif TARGET_HAS_SSE42
+	#include <nmmintrin.h>
+#elif TARGET_HAS_SSSE3
+	#include <tmmintrin.h>
+#elif TARGET_HAS_SSE2
+	#include <emmintrin.h>
+#endif
+#if TARGET_HAS_NEON
+	#include <arm_neon.h>
+#endif
+#if TARGET_HAS_WASM_SIMD
+	#include <wasm_simd128.h>
+#endif
+#if COMPILER_IS_MSVC
+	#include <intrin.h>
+#endif
+
+// +--------------------------------------------------------------+
+// |                      Portable SIMD Type                      |
+// +--------------------------------------------------------------+
+//NOTE: SimdU8x16 is a thin layer over whichever 128-bit instruction set is available so
+//      byte-oriented kernels (UTF-8 validation, char classification, etc.) can be written once
+//      SimdR32x4 and SimdU32x4 do the same for 4-wide float/integer kernels (noise, etc.)
+#if TARGET_HAS_SSE2
+typedef __m128i SimdU8x16;
+typedef __m128 SimdR32x4;
+typedef __m128i SimdU32x4;
+#elif TARGET_HAS_NEON
+typedef uint8x16_t SimdU8x16;
+typedef float32x4_t SimdR32x4;
+typedef uint32x4_t SimdU32x4;
+#elif TARGET_HAS_WASM_SIMD
+typedef v128_t SimdU8x16;
+typedef v128_t SimdR32x4;
+typedef v128_t SimdU32x4;
+#endif
+
+//The masks returned by SimdHighBitMaskU8x16 have this many bits per byte (NEON has no movemask so we use a narrowing shift)
+#if TARGET_HAS_NEON
+#define SIMD_MASK_BITS_PER_BYTE 4
+#define SIMD_MASK_BYTE_BITS     0xFULL
+#else
+#define SIMD_MASK_BITS_PER_BYTE 1
+#define SIMD_MASK_BYTE_BITS     0x1ULL
+#endif
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE u8 CountTrailingZerosU32(u32 value);
+	PIG_CORE_INLINE u8 CountTrailingZerosU64(u64 value);
+	PIG_CORE_INLINE u8 CountLeadingZerosU32(u32 value);
+	PIG_CORE_INLINE u8 CountLeadingZerosU64(u64 value);
+	PIG_CORE_INLINE u8 CountBitsSetU64(u64 value);
+	#if TARGET_HAS_SIMD128
+	PIG_CORE_INLINE SimdU8x16 SimdLoadU8x16(const void* pntr);
+	PIG_CORE_INLINE void SimdStoreU8x16(void* pntr, SimdU8x16 value);
+	PIG_CORE_INLINE SimdU8x16 SimdSplatU8x16(u8 value);
+	PIG_CORE_INLINE SimdU8x16 SimdAndU8x16(SimdU8x16 left, SimdU8x16 right);
+	PIG_CORE_INLINE SimdU8x16 SimdOrU8x16(SimdU8x16 left, SimdU8x16 right);
+	PIG_CORE_INLINE SimdU8x16 SimdXorU8x16(SimdU8x16 left, SimdU8x16 right);
+	PIG_CORE_INLINE SimdU8x16 SimdEqualsU8x16(SimdU8x16 left, SimdU8x16 right);
+	PIG_CORE_INLINE SimdU8x16 SimdAddU8x16(SimdU8x16 left, SimdU8x16 right);
+	PIG_CORE_INLINE SimdU8x16 SimdSubSatU8x16(SimdU8x16 left, SimdU8x16 right);
+	PIG_CORE_INLINE SimdU8x16 SimdShiftRight4U8x16(SimdU8x16 value);
+	PIG_CORE_INLINE SimdU8x16 SimdPrev1U8x16(SimdU8x16 current, SimdU8x16 previous);
+	PIG_CORE_INLINE SimdU8x16 SimdPrev2U8x16(SimdU8x16 current, SimdU8x16 previous);
+	PIG_CORE_INLINE SimdU8x16 SimdPrev3U8x16(SimdU8x16 current, SimdU8x16 previous);
+	PIG_CORE_INLINE bool SimdAnyNonZeroU8x16(SimdU8x16 value);
+	PIG_CORE_INLINE bool SimdAnyHighBitU8x16(SimdU8x16 value);
+	PIG_CORE_INLINE u32 SimdSumU8x16(SimdU8x16 value);
+	PIG_CORE_INLINE u64 SimdHighBitMaskU8x16(SimdU8x16 value);
+	PIG_CORE_INLINE SimdR32x4 SimdLoadR32x4(const r32* pntr);
+	PIG_CORE_INLINE void SimdStoreR32x4(r32* pntr, SimdR32x4 value);
+	PIG_CORE_INLINE SimdR32x4 SimdSplatR32x4(r32 value);
+	PIG_CORE_INLINE SimdR32x4 SimdSetR32x4(r32 value0, r32 value1, r32 value2, r32 value3);
+	PIG_CORE_INLINE SimdR32x4 SimdAddR32x4(SimdR32x4 left, SimdR32x4 right);
+	PIG_CORE_INLINE SimdR32x4 SimdSubR32x4(SimdR32x4 left, SimdR32x4 right);
+	PIG_CORE_INLINE SimdR32x4 SimdMulR32x4(SimdR32x4 left, SimdR32x4 right);
+	PIG_CORE_INLINE SimdR32x4 SimdMinR32x4(SimdR32x4 left, SimdR32x4 right);
+	PIG_CORE_INLINE SimdR32x4 SimdMaxR32x4(SimdR32x4 left, SimdR32x4 right);
+	PIG_CORE_INLINE SimdR32x4 SimdSqrtR32x4(SimdR32x4 value);
+	PIG_CORE_INLINE SimdR32x4 SimdFloorR32x4(SimdR32x4 value);
+	PIG_CORE_INLINE SimdU32x4 SimdGreaterR32x4(SimdR32x4 left, SimdR32x4 right);
+	PIG_CORE_INLINE SimdR32x4 SimdSelectR32x4(SimdU32x4 mask, SimdR32x4 ifTrue, SimdR32x4 ifFalse);
+	PIG_CORE_INLINE SimdR32x4 SimdCastU32ToR32x4(SimdU32x4 value);
+	PIG_CORE_INLINE SimdU32x4 SimdCastR32ToU32x4(SimdR32x4 value);
+	PIG_CORE_INLINE SimdR32x4 SimdConvertI32ToR32x4(SimdU32x4 value);
+	PIG_CORE_INLINE SimdU32x4 SimdConvertR32ToI32x4(SimdR32x4 value);
+	PIG_CORE_INLINE SimdU32x4 SimdSplatU32x4(u32 value);
+	PIG_CORE_INLINE SimdU32x4 SimdAddU32x4(SimdU32x4 left, SimdU32x4 right);
+	PIG_CORE_INLINE SimdU32x4 SimdMulU32x4(SimdU32x4 left, SimdU32x4 right);
+	PIG_CORE_INLINE SimdU32x4 SimdAndU32x4(SimdU32x4 left, SimdU32x4 right);
+	PIG_CORE_INLINE SimdU32x4 SimdAndNotU32x4(SimdU32x4 left, SimdU32x4 right);
+	PIG_CORE_INLINE SimdU32x4 SimdOrU32x4(SimdU32x4 left, SimdU32x4 right);
+	PIG_CORE_INLINE SimdU32x4 SimdXorU32x4(SimdU32x4 left, SimdU32x4 right);
+	PIG_CORE_INLINE SimdU32x4 SimdShiftLeftU32x4(SimdU32x4 value, u8 amount);
+	PIG_CORE_INLINE SimdU32x4 SimdShiftRightU32x4(SimdU32x4 value, u8 amount);
+	PIG_CORE_INLINE SimdU32x4 SimdCastU8ToU32x4(SimdU8x16 value);
+	PIG_CORE_INLINE SimdU8x16 SimdCastU32ToU8x16(SimdU32x4 value);
+	#endif
+	#if TARGET_HAS_SIMD128_LOOKUP
+	PIG_CORE_INLINE SimdU8x16 SimdLookupU8x16(SimdU8x16 table, SimdU8x16 indices);
+	#endif
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+//NOTE: These all return the number of bits in the type when value is 0
+PEXPI u8 CountTrailingZerosU32(u32 value)
+{
+	if (value == 0) { return 32; }
+	#if COMPILER_IS_MSVC
+	unsigned long result = 0;
+	_BitScanForward(&result, value);
+	return (u8)result;
+	#else
+	return (u8)__builtin_ctz(value);
+	#endif
+}
+PEXPI u8 CountTrailingZerosU64(u64 value)
+{
+	if (value == 0) { return 64; }
+	#if COMPILER_IS_MSVC
+	unsigned long result = 0;
+	#if TARGET_IS_64BIT
+	_BitScanForward64(&result, value);
+	#else
+	if ((u32)value != 0) { _BitScanForward(&result, (u32)value); }
+	else { _BitScanForward(&result, (u32)(value >> 32)); result += 32; }
+	#endif
+	return (u8)result;
+	#else
+	return (u8)__builtin_ctzll(value);
+	#endif
+}
+
+PEXPI u8 CountLeadingZerosU32(u32 value)
+{
+	if (value == 0) { return 32; }
+	#if COMPILER_IS_MSVC
+	unsigned long result = 0;
+	_BitScanReverse(&result, value);
+	return (u8)(31 - result);
+	#else
+	return (u8)__builtin_clz(value);
+	#endif
+}
+PEXPI u8 CountLeadingZerosU64(u64 value)
+{
+	if (value == 0) { return 64; }
+	#if COMPILER_IS_MSVC
+	unsigned long result = 0;
+	#if TARGET_IS_64BIT
+	_BitScanReverse64(&result, value);
+	#else
+	if ((u32)(value >> 32) != 0) { _BitScanReverse(&result, (u32)(value >> 32)); result += 32; }
+	else { _BitScanReverse(&result, (u32)value); }
+	#endif
+	return (u8)(63 - result);
+	#else
+	return (u8)__builtin_clzll(value);
+	#endif
+}
+
+PEXPI u8 CountBitsSetU64(u64 value)
+{
+	#if COMPILER_IS_MSVC
+	u8 result = 0;
+	while (value != 0) { value &= (value - 1); result++; }
+	return result;
+	#else
+	return (u8)__builtin_popcountll(value);
+	#endif
+}
+
+// +==============================+
+// |          SimdU8x16           |
+// +==============================+
+#if TARGET_HAS_SIMD128
+PEXPI SimdU8x16 SimdLoadU8x16(const void* pntr)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_loadu_si128((const __m128i*)pntr);
+	#elif TARGET_HAS_NEON
+	return vld1q_u8((const u8*)pntr);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_load(pntr);
+	#endif
+}
+PEXPI void SimdStoreU8x16(void* pntr, SimdU8x16 value)
+{
+	#if TARGET_HAS_SSE2
+	_mm_storeu_si128((__m128i*)pntr, value);
+	#elif TARGET_HAS_NEON
+	vst1q_u8((u8*)pntr, value);
+	#elif TARGET_HAS_WASM_SIMD
+	wasm_v128_store(pntr, value);
+	#endif
+}
+PEXPI SimdU8x16 SimdSplatU8x16(u8 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_set1_epi8((char)value);
+	#elif TARGET_HAS_NEON
+	return vdupq_n_u8(value);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_u8x16_splat(value);
+	#endif
+}
+PEXPI SimdU8x16 SimdAndU8x16(SimdU8x16 left, SimdU8x16 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_and_si128(left, right);
+	#elif TARGET_HAS_NEON
+	return vandq_u8(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_and(left, right);
+	#endif
+}
+PEXPI SimdU8x16 SimdOrU8x16(SimdU8x16 left, SimdU8x16 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_or_si128(left, right);
+	#elif TARGET_HAS_NEON
+	return vorrq_u8(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_or(left, right);
+	#endif
+}
+PEXPI SimdU8x16 SimdXorU8x16(SimdU8x16 left, SimdU8x16 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_xor_si128(left, right);
+	#elif TARGET_HAS_NEON
+	return veorq_u8(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_xor(left, right);
+	#endif
+}
+//Each byte is 0xFF where left == right and 0x00 elsewhere
+PEXPI SimdU8x16 SimdEqualsU8x16(SimdU8x16 left, SimdU8x16 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_cmpeq_epi8(left, right);
+	#elif TARGET_HAS_NEON
+	return vceqq_u8(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i8x16_eq(left, right);
+	#endif
+}
+//Wrapping addition for each byte
+PEXPI SimdU8x16 SimdAddU8x16(SimdU8x16 left, SimdU8x16 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_add_epi8(left, right);
+	#elif TARGET_HAS_NEON
+	return vaddq_u8(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i8x16_add(left, right);
+	#endif
+}
+//Unsigned saturating subtraction, max(left - right, 0) for each byte
+PEXPI SimdU8x16 SimdSubSatU8x16(SimdU8x16 left, SimdU8x16 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_subs_epu8(left, right);
+	#elif TARGET_HAS_NEON
+	return vqsubq_u8(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_u8x16_sub_sat(left, right);
+	#endif
+}
+//Upper nibble of each byte
+PEXPI SimdU8x16 SimdShiftRight4U8x16(SimdU8x16 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_and_si128(_mm_srli_epi16(value, 4), _mm_set1_epi8(0x0F));
+	#elif TARGET_HAS_NEON
+	return vshrq_n_u8(value, 4);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_u8x16_shr(value, 4);
+	#endif
+}
+//These return the 16 bytes that end N bytes before the end of current (the first N come from the end of previous)
+PEXPI SimdU8x16 SimdPrev1U8x16(SimdU8x16 current, SimdU8x16 previous)
+{
+	#if TARGET_HAS_SSSE3
+	return _mm_alignr_epi8(current, previous, 15);
+	#elif TARGET_HAS_SSE2
+	return _mm_or_si128(_mm_slli_si128(current, 1), _mm_srli_si128(previous, 15));
+	#elif TARGET_HAS_NEON
+	return vextq_u8(previous, current, 15);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i8x16_shuffle(previous, current, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30);
+	#endif
+}
+PEXPI SimdU8x16 SimdPrev2U8x16(SimdU8x16 current, SimdU8x16 previous)
+{
+	#if TARGET_HAS_SSSE3
+	return _mm_alignr_epi8(current, previous, 14);
+	#elif TARGET_HAS_SSE2
+	return _mm_or_si128(_mm_slli_si128(current, 2), _mm_srli_si128(previous, 14));
+	#elif TARGET_HAS_NEON
+	return vextq_u8(previous, current, 14);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i8x16_shuffle(previous, current, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29);
+	#endif
+}
+PEXPI SimdU8x16 SimdPrev3U8x16(SimdU8x16 current, SimdU8x16 previous)
+{
+	#if TARGET_HAS_SSSE3
+	return _mm_alignr_epi8(current, previous, 13);
+	#elif TARGET_HAS_SSE2
+	return _mm_or_si128(_mm_slli_si128(current, 3), _mm_srli_si128(previous, 13));
+	#elif TARGET_HAS_NEON
+	return vextq_u8(previous, current, 13);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i8x16_shuffle(previous, current, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28);
+	#endif
+}
+PEXPI bool SimdAnyNonZeroU8x16(SimdU8x16 value)
+{
+	#if TARGET_HAS_SSE2
+	return (_mm_movemask_epi8(_mm_cmpeq_epi8(value, _mm_setzero_si128())) != 0xFFFF);
+	#elif TARGET_HAS_NEON
+	return (vmaxvq_u8(value) != 0);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_any_true(value);
+	#endif
+}
+PEXPI bool SimdAnyHighBitU8x16(SimdU8x16 value)
+{
+	#if TARGET_HAS_SSE2
+	return (_mm_movemask_epi8(value) != 0);
+	#elif TARGET_HAS_NEON
+	return (vmaxvq_u8(value) >= 0x80);
+	#elif TARGET_HAS_WASM_SIMD
+	return (wasm_i8x16_bitmask(value) != 0);
+	#endif
+}
+//Horizontal sum of all 16 bytes
+PEXPI u32 SimdSumU8x16(SimdU8x16 value)
+{
+	#if TARGET_HAS_SSE2
+	__m128i sums = _mm_sad_epu8(value, _mm_setzero_si128());
+	return (u32)_mm_cvtsi128_si32(sums) + (u32)_mm_extract_epi16(sums, 4);
+	#elif TARGET_HAS_NEON
+	return (u32)vaddlvq_u8(value);
+	#elif TARGET_HAS_WASM_SIMD
+	v128_t sums = wasm_u32x4_extadd_pairwise_u16x8(wasm_u16x8_extadd_pairwise_u8x16(value));
+	return wasm_u32x4_extract_lane(sums, 0) + wasm_u32x4_extract_lane(sums, 1) + wasm_u32x4_extract_lane(sums, 2) + wasm_u32x4_extract_lane(sums, 3);
+	#endif
+}
+//Gathers the high bit of each byte into a mask with SIMD_MASK_BITS_PER_BYTE bits per byte (use CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE to get the first index)
+PEXPI u64 SimdHighBitMaskU8x16(SimdU8x16 value)
+{
+	#if TARGET_HAS_SSE2
+	return (u64)(u32)_mm_movemask_epi8(value);
+	#elif TARGET_HAS_NEON
+	uint8x16_t spread = vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(value), 7));
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(spread), 4)), 0);
+	#elif TARGET_HAS_WASM_SIMD
+	return (u64)wasm_i8x16_bitmask(value);
+	#endif
+}
+
+// +==============================+
+// |     SimdR32x4/SimdU32x4      |
+// +==============================+
+PEXPI SimdR32x4 SimdLoadR32x4(const r32* pntr)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_loadu_ps(pntr);
+	#elif TARGET_HAS_NEON
+	return vld1q_f32(pntr);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_load(pntr);
+	#endif
+}
+PEXPI void SimdStoreR32x4(r32* pntr, SimdR32x4 value)
+{
+	#if TARGET_HAS_SSE2
+	_mm_storeu_ps(pntr, value);
+	#elif TARGET_HAS_NEON
+	vst1q_f32(pntr, value);
+	#elif TARGET_HAS_WASM_SIMD
+	wasm_v128_store(pntr, value);
+	#endif
+}
+PEXPI SimdR32x4 SimdSplatR32x4(r32 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_set1_ps(value);
+	#elif TARGET_HAS_NEON
+	return vdupq_n_f32(value);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_splat(value);
+	#endif
+}
+//value0 goes in the lowest lane (the first element when stored to memory)
+PEXPI SimdR32x4 SimdSetR32x4(r32 value0, r32 value1, r32 value2, r32 value3)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_setr_ps(value0, value1, value2, value3);
+	#elif TARGET_HAS_NEON
+	r32 values[4] = { value0, value1, value2, value3 };
+	return vld1q_f32(&values[0]);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_make(value0, value1, value2, value3);
+	#endif
+}
+PEXPI SimdR32x4 SimdAddR32x4(SimdR32x4 left, SimdR32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_add_ps(left, right);
+	#elif TARGET_HAS_NEON
+	return vaddq_f32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_add(left, right);
+	#endif
+}
+PEXPI SimdR32x4 SimdSubR32x4(SimdR32x4 left, SimdR32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_sub_ps(left, right);
+	#elif TARGET_HAS_NEON
+	return vsubq_f32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_sub(left, right);
+	#endif
+}
+PEXPI SimdR32x4 SimdMulR32x4(SimdR32x4 left, SimdR32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_mul_ps(left, right);
+	#elif TARGET_HAS_NEON
+	return vmulq_f32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_mul(left, right);
+	#endif
+}
+PEXPI SimdR32x4 SimdMinR32x4(SimdR32x4 left, SimdR32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_min_ps(left, right);
+	#elif TARGET_HAS_NEON
+	return vminq_f32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_pmin(right, left);
+	#endif
+}
+PEXPI SimdR32x4 SimdMaxR32x4(SimdR32x4 left, SimdR32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_max_ps(left, right);
+	#elif TARGET_HAS_NEON
+	return vmaxq_f32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_pmax(right, left);
+	#endif
+}
+PEXPI SimdR32x4 SimdSqrtR32x4(SimdR32x4 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_sqrt_ps(value);
+	#elif TARGET_HAS_NEON
+	return vsqrtq_f32(value);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_sqrt(value);
+	#endif
+}
+//NOTE: The SSE2 fallback goes through a 32-bit integer so it's only correct for |value| < 2^31
+PEXPI SimdR32x4 SimdFloorR32x4(SimdR32x4 value)
+{
+	#if TARGET_HAS_SSE42
+	return _mm_floor_ps(value);
+	#elif TARGET_HAS_SSE2
+	__m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+	return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, value), _mm_set1_ps(1.0f)));
+	#elif TARGET_HAS_NEON
+	return vrndmq_f32(value);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_floor(value);
+	#endif
+}
+//Each lane is 0xFFFFFFFF where left > right and 0 elsewhere
+PEXPI SimdU32x4 SimdGreaterR32x4(SimdR32x4 left, SimdR32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_castps_si128(_mm_cmpgt_ps(left, right));
+	#elif TARGET_HAS_NEON
+	return vcgtq_f32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_gt(left, right);
+	#endif
+}
+//mask lanes must be all 1s or all 0s (like the ones returned by SimdGreaterR32x4)
+PEXPI SimdR32x4 SimdSelectR32x4(SimdU32x4 mask, SimdR32x4 ifTrue, SimdR32x4 ifFalse)
+{
+	#if TARGET_HAS_SSE2
+	__m128 maskR32 = _mm_castsi128_ps(mask);
+	return _mm_or_ps(_mm_and_ps(maskR32, ifTrue), _mm_andnot_ps(maskR32, ifFalse));
+	#elif TARGET_HAS_NEON
+	return vbslq_f32(mask, ifTrue, ifFalse);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_bitselect(ifTrue, ifFalse, mask);
+	#endif
+}
+PEXPI SimdR32x4 SimdCastU32ToR32x4(SimdU32x4 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_castsi128_ps(value);
+	#elif TARGET_HAS_NEON
+	return vreinterpretq_f32_u32(value);
+	#elif TARGET_HAS_WASM_SIMD
+	return value;
+	#endif
+}
+PEXPI SimdU32x4 SimdCastR32ToU32x4(SimdR32x4 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_castps_si128(value);
+	#elif TARGET_HAS_NEON
+	return vreinterpretq_u32_f32(value);
+	#elif TARGET_HAS_WASM_SIMD
+	return value;
+	#endif
+}
+//Treats each lane as a signed i32
+PEXPI SimdR32x4 SimdConvertI32ToR32x4(SimdU32x4 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_cvtepi32_ps(value);
+	#elif TARGET_HAS_NEON
+	return vcvtq_f32_s32(vreinterpretq_s32_u32(value));
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_f32x4_convert_i32x4(value);
+	#endif
+}
+//Truncates towards zero into signed i32 lanes
+PEXPI SimdU32x4 SimdConvertR32ToI32x4(SimdR32x4 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_cvttps_epi32(value);
+	#elif TARGET_HAS_NEON
+	return vreinterpretq_u32_s32(vcvtq_s32_f32(value));
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i32x4_trunc_sat_f32x4(value);
+	#endif
+}
+PEXPI SimdU32x4 SimdSplatU32x4(u32 value)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_set1_epi32((int)value);
+	#elif TARGET_HAS_NEON
+	return vdupq_n_u32(value);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_u32x4_splat(value);
+	#endif
+}
+PEXPI SimdU32x4 SimdAddU32x4(SimdU32x4 left, SimdU32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_add_epi32(left, right);
+	#elif TARGET_HAS_NEON
+	return vaddq_u32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i32x4_add(left, right);
+	#endif
+}
+//Keeps the low 32 bits of each product
+PEXPI SimdU32x4 SimdMulU32x4(SimdU32x4 left, SimdU32x4 right)
+{
+	#if TARGET_HAS_SSE42
+	return _mm_mullo_epi32(left, right);
+	#elif TARGET_HAS_SSE2
+	__m128i evenProducts = _mm_mul_epu32(left, right);
+	__m128i oddProducts = _mm_mul_epu32(_mm_srli_epi64(left, 32), _mm_srli_epi64(right, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(evenProducts, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(oddProducts, _MM_SHUFFLE(0, 0, 2, 0)));
+	#elif TARGET_HAS_NEON
+	return vmulq_u32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i32x4_mul(left, right);
+	#endif
+}
+PEXPI SimdU32x4 SimdAndU32x4(SimdU32x4 left, SimdU32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_and_si128(left, right);
+	#elif TARGET_HAS_NEON
+	return vandq_u32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_and(left, right);
+	#endif
+}
+//(~left) & right
+PEXPI SimdU32x4 SimdAndNotU32x4(SimdU32x4 left, SimdU32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_andnot_si128(left, right);
+	#elif TARGET_HAS_NEON
+	return vbicq_u32(right, left);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_andnot(right, left);
+	#endif
+}
+PEXPI SimdU32x4 SimdOrU32x4(SimdU32x4 left, SimdU32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_or_si128(left, right);
+	#elif TARGET_HAS_NEON
+	return vorrq_u32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_or(left, right);
+	#endif
+}
+PEXPI SimdU32x4 SimdXorU32x4(SimdU32x4 left, SimdU32x4 right)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_xor_si128(left, right);
+	#elif TARGET_HAS_NEON
+	return veorq_u32(left, right);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_v128_xor(left, right);
+	#endif
+}
+PEXPI SimdU32x4 SimdShiftLeftU32x4(SimdU32x4 value, u8 amount)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_sll_epi32(value, _mm_cvtsi32_si128((int)amount));
+	#elif TARGET_HAS_NEON
+	return vshlq_u32(value, vdupq_n_s32((i32)amount));
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i32x4_shl(value, amount);
+	#endif
+}
+PEXPI SimdU32x4 SimdShiftRightU32x4(SimdU32x4 value, u8 amount)
+{
+	#if TARGET_HAS_SSE2
+	return _mm_srl_epi32(value, _mm_cvtsi32_si128((int)amount));
+	#elif TARGET_HAS_NEON
+	return vshlq_u32(value, vdupq_n_s32(-(i32)amount));
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_u32x4_shr(value, amount);
+	#endif
+}
+//Reinterprets the bits (little-endian, byte 0 is the low byte of lane 0)
+PEXPI SimdU32x4 SimdCastU8ToU32x4(SimdU8x16 value)
+{
+	#if TARGET_HAS_SSE2 || TARGET_HAS_WASM_SIMD
+	return value;
+	#elif TARGET_HAS_NEON
+	return vreinterpretq_u32_u8(value);
+	#endif
+}
+PEXPI SimdU8x16 SimdCastU32ToU8x16(SimdU32x4 value)
+{
+	#if TARGET_HAS_SSE2 || TARGET_HAS_WASM_SIMD
+	return value;
+	#elif TARGET_HAS_NEON
+	return vreinterpretq_u8_u32(value);
+	#endif
+}
+#endif //TARGET_HAS_SIMD128
+
+#if TARGET_HAS_SIMD128_LOOKUP
+//Each byte of the result is table[indices[i]], indices must all be < 16
+PEXPI SimdU8x16 SimdLookupU8x16(SimdU8x16 table, SimdU8x16 indices)
+{
+	#if TARGET_HAS_SSSE3
+	return _mm_shuffle_epi8(table, indices);
+	#elif TARGET_HAS_NEON
+	return vqtbl1q_u8(table, indices);
+	#elif TARGET_HAS_WASM_SIMD
+	return wasm_i8x16_swizzle(table, indices);
+	#endif
+}
+#endif //TARGET_HAS_SIMD128_LOOKUP
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _BASE_SIMD_H
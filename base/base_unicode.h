@@ -11,6 +11,11 @@ Description:
 	** Along with encoding conversions, this file also contains conversions and
 	** comparisons between codepoints, and a few functions that operate on codepoints
 	** and some defines for various codepoint pages, maximums, etc.
+	** Case folding, general category, and east asian width lookups are answered by
+	** the generated tables in base_unicode_tables.h (see _scripts/generate_unicode_tables.py)
+	** Each lookup is 3 dependent table reads, no branching or searching.
+	** NOTE: GetCaseFoldedCodepoint does "simple" case folding (one codepoint to one codepoint).
+	** Multi-codepoint folds like U+00DF (sharp s) -> "ss" are not handled.
 */
 
 #ifndef _BASE_UNICODE_H
@@ -18,7 +23,11 @@ Description:
 
 #include "base/base_defines_check.h"
 #include "base/base_typedefs.h"
+#include "base/base_macros.h"
 #include "base/base_assert.h"
+#include "base/base_unicode_convert.h"
+#include "base/base_char_set.h"
+#include "base/base_unicode_tables.h"
 
 #define UTF8_MAX_CODEPOINT 0x10FFFFUL
 #define UCS2_MAX_CHAR_SIZE 2 //words
@@ -42,12 +51,126 @@ Description:
 #define UNICODE_KATAKANA_COUNT 96
 #define UNICODE_KATAKANA_END   (UNICODE_KATAKANA_START + UNICODE_KATAKANA_COUNT)
 
+//NOTE: The order of these values must match categoryAbbreviations in generate_unicode_tables.py
+typedef enum UnicodeCategory UnicodeCategory;
+enum UnicodeCategory
+{
+	UnicodeCategory_Unassigned = 0,       //Cn
+	UnicodeCategory_UppercaseLetter,      //Lu
+	UnicodeCategory_LowercaseLetter,      //Ll
+	UnicodeCategory_TitlecaseLetter,      //Lt
+	UnicodeCategory_ModifierLetter,       //Lm
+	UnicodeCategory_OtherLetter,          //Lo
+	UnicodeCategory_NonspacingMark,       //Mn
+	UnicodeCategory_SpacingMark,          //Mc
+	UnicodeCategory_EnclosingMark,        //Me
+	UnicodeCategory_DecimalNumber,        //Nd
+	UnicodeCategory_LetterNumber,         //Nl
+	UnicodeCategory_OtherNumber,          //No
+	UnicodeCategory_ConnectorPunctuation, //Pc
+	UnicodeCategory_DashPunctuation,      //Pd
+	UnicodeCategory_OpenPunctuation,      //Ps
+	UnicodeCategory_ClosePunctuation,     //Pe
+	UnicodeCategory_InitialPunctuation,   //Pi
+	UnicodeCategory_FinalPunctuation,     //Pf
+	UnicodeCategory_OtherPunctuation,     //Po
+	UnicodeCategory_MathSymbol,           //Sm
+	UnicodeCategory_CurrencySymbol,       //Sc
+	UnicodeCategory_ModifierSymbol,       //Sk
+	UnicodeCategory_OtherSymbol,          //So
+	UnicodeCategory_SpaceSeparator,       //Zs
+	UnicodeCategory_LineSeparator,        //Zl
+	UnicodeCategory_ParagraphSeparator,   //Zp
+	UnicodeCategory_Control,              //Cc
+	UnicodeCategory_Format,               //Cf
+	UnicodeCategory_Surrogate,            //Cs
+	UnicodeCategory_PrivateUse,           //Co
+	UnicodeCategory_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetUnicodeCategoryStr(UnicodeCategory enumValue);
+#else
+PEXP const char* GetUnicodeCategoryStr(UnicodeCategory enumValue)
+{
+	switch (enumValue)
+	{
+		case UnicodeCategory_Unassigned:           return "Unassigned";
+		case UnicodeCategory_UppercaseLetter:      return "UppercaseLetter";
+		case UnicodeCategory_LowercaseLetter:      return "LowercaseLetter";
+		case UnicodeCategory_TitlecaseLetter:      return "TitlecaseLetter";
+		case UnicodeCategory_ModifierLetter:       return "ModifierLetter";
+		case UnicodeCategory_OtherLetter:          return "OtherLetter";
+		case UnicodeCategory_NonspacingMark:       return "NonspacingMark";
+		case UnicodeCategory_SpacingMark:          return "SpacingMark";
+		case UnicodeCategory_EnclosingMark:        return "EnclosingMark";
+		case UnicodeCategory_DecimalNumber:        return "DecimalNumber";
+		case UnicodeCategory_LetterNumber:         return "LetterNumber";
+		case UnicodeCategory_OtherNumber:          return "OtherNumber";
+		case UnicodeCategory_ConnectorPunctuation: return "ConnectorPunctuation";
+		case UnicodeCategory_DashPunctuation:      return "DashPunctuation";
+		case UnicodeCategory_OpenPunctuation:      return "OpenPunctuation";
+		case UnicodeCategory_ClosePunctuation:     return "ClosePunctuation";
+		case UnicodeCategory_InitialPunctuation:   return "InitialPunctuation";
+		case UnicodeCategory_FinalPunctuation:     return "FinalPunctuation";
+		case UnicodeCategory_OtherPunctuation:     return "OtherPunctuation";
+		case UnicodeCategory_MathSymbol:           return "MathSymbol";
+		case UnicodeCategory_CurrencySymbol:       return "CurrencySymbol";
+		case UnicodeCategory_ModifierSymbol:       return "ModifierSymbol";
+		case UnicodeCategory_OtherSymbol:          return "OtherSymbol";
+		case UnicodeCategory_SpaceSeparator:       return "SpaceSeparator";
+		case UnicodeCategory_LineSeparator:        return "LineSeparator";
+		case UnicodeCategory_ParagraphSeparator:   return "ParagraphSeparator";
+		case UnicodeCategory_Control:              return "Control";
+		case UnicodeCategory_Format:               return "Format";
+		case UnicodeCategory_Surrogate:            return "Surrogate";
+		case UnicodeCategory_PrivateUse:           return "PrivateUse";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif //PIG_CORE_IMPLEMENTATION
+
+//NOTE: The order of these values must match eastAsianWidthAbbreviations in generate_unicode_tables.py
+typedef enum UnicodeEastAsianWidth UnicodeEastAsianWidth;
+enum UnicodeEastAsianWidth
+{
+	UnicodeEastAsianWidth_Neutral = 0, //N
+	UnicodeEastAsianWidth_Ambiguous,   //A
+	UnicodeEastAsianWidth_Halfwidth,   //H
+	UnicodeEastAsianWidth_Wide,        //W
+	UnicodeEastAsianWidth_Fullwidth,   //F
+	UnicodeEastAsianWidth_Narrow,      //Na
+	UnicodeEastAsianWidth_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetUnicodeEastAsianWidthStr(UnicodeEastAsianWidth enumValue);
+#else
+PEXP const char* GetUnicodeEastAsianWidthStr(UnicodeEastAsianWidth enumValue)
+{
+	switch (enumValue)
+	{
+		case UnicodeEastAsianWidth_Neutral:   return "Neutral";
+		case UnicodeEastAsianWidth_Ambiguous: return "Ambiguous";
+		case UnicodeEastAsianWidth_Halfwidth: return "Halfwidth";
+		case UnicodeEastAsianWidth_Wide:      return "Wide";
+		case UnicodeEastAsianWidth_Fullwidth: return "Fullwidth";
+		case UnicodeEastAsianWidth_Narrow:    return "Narrow";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif //PIG_CORE_IMPLEMENTATION
+
 // +--------------------------------------------------------------+
 // |                 Header Function Declarations                 |
 // +--------------------------------------------------------------+
 #if !PIG_CORE_IMPLEMENTATION
 	PIG_CORE_INLINE u32 GetLowercaseCodepoint(u32 codepoint);
 	PIG_CORE_INLINE u32 GetUppercaseCodepoint(u32 codepoint);
+	PIG_CORE_INLINE u32 GetCaseFoldedCodepoint(u32 codepoint);
+	PIG_CORE_INLINE bool AreCodepointsEqualAnyCase(u32 codepoint1, u32 codepoint2);
+	PIG_CORE_INLINE u8 GetCodepointPropertyValue(u32 codepoint);
+	PIG_CORE_INLINE UnicodeCategory GetCodepointCategory(u32 codepoint);
+	PIG_CORE_INLINE UnicodeEastAsianWidth GetCodepointEastAsianWidth(u32 codepoint);
+	PIG_CORE_INLINE u8 GetCodepointDisplayWidth(u32 codepoint);
 	u8 GetUtf8BytesForCode(u32 codepoint, u8* byteBufferOut, bool doAssertions);
 	u8 GetCodepointForUtf8(u64 maxNumBytes, const char* strPntr, u32* codepointOut);
 	u8 GetCodepointBeforeIndex(const char* strPntr, u64 startIndex, u32* codepointOut);
@@ -75,6 +198,60 @@ PEXPI u32 GetUppercaseCodepoint(u32 codepoint)
 	return codepoint;
 }
 
+// +--------------------------------------------------------------+
+// |                    Property Table Lookups                    |
+// +--------------------------------------------------------------+
+//Maps a codepoint to the codepoint it should be compared as in case-insensitive comparisons.
+//For most cased letters this is the lowercase form, but it also handles things like U+212A (Kelvin sign) -> 'k'
+PEXPI u32 GetCaseFoldedCodepoint(u32 codepoint)
+{
+	if (codepoint < 0x80) { return (codepoint >= 'A' && codepoint <= 'Z') ? codepoint + ('a' - 'A') : codepoint; }
+	if (codepoint >= UNICODE_FOLD_TABLE_LIMIT) { return codepoint; }
+	u32 stage2Index = ((u32)UnicodeFoldStage1[codepoint >> (UNICODE_FOLD_STAGE2_SHIFT + UNICODE_FOLD_STAGE3_SHIFT)] << UNICODE_FOLD_STAGE2_SHIFT)
+		+ ((codepoint >> UNICODE_FOLD_STAGE3_SHIFT) & ((1UL << UNICODE_FOLD_STAGE2_SHIFT) - 1));
+	u32 stage3Index = ((u32)UnicodeFoldStage2[stage2Index] << UNICODE_FOLD_STAGE3_SHIFT) + (codepoint & ((1UL << UNICODE_FOLD_STAGE3_SHIFT) - 1));
+	return (u32)((i32)codepoint + UnicodeFoldDeltas[UnicodeFoldStage3[stage3Index]]);
+}
+PEXPI bool AreCodepointsEqualAnyCase(u32 codepoint1, u32 codepoint2)
+{
+	return (codepoint1 == codepoint2 || GetCaseFoldedCodepoint(codepoint1) == GetCaseFoldedCodepoint(codepoint2));
+}
+
+//Returns the combined category\east asian width value from the property tables (see UNICODE_PROP_CATEGORY_MASK and UNICODE_PROP_WIDTH_SHIFT)
+PEXPI u8 GetCodepointPropertyValue(u32 codepoint)
+{
+	if (codepoint > UTF8_MAX_CODEPOINT) { return 0; }
+	u32 stage2Index = ((u32)UnicodePropStage1[codepoint >> (UNICODE_PROP_STAGE2_SHIFT + UNICODE_PROP_STAGE3_SHIFT)] << UNICODE_PROP_STAGE2_SHIFT)
+		+ ((codepoint >> UNICODE_PROP_STAGE3_SHIFT) & ((1UL << UNICODE_PROP_STAGE2_SHIFT) - 1));
+	u32 stage3Index = ((u32)UnicodePropStage2[stage2Index] << UNICODE_PROP_STAGE3_SHIFT) + (codepoint & ((1UL << UNICODE_PROP_STAGE3_SHIFT) - 1));
+	return UnicodePropStage3[stage3Index];
+}
+PEXPI UnicodeCategory GetCodepointCategory(u32 codepoint)
+{
+	return (UnicodeCategory)(GetCodepointPropertyValue(codepoint) & UNICODE_PROP_CATEGORY_MASK);
+}
+PEXPI UnicodeEastAsianWidth GetCodepointEastAsianWidth(u32 codepoint)
+{
+	return (UnicodeEastAsianWidth)(GetCodepointPropertyValue(codepoint) >> UNICODE_PROP_WIDTH_SHIFT);
+}
+
+//Returns the number of columns a codepoint takes up in a monospace terminal-like display (0, 1, or 2)
+//Combining marks, format characters, and control characters take 0 columns, Wide and Fullwidth characters take 2
+//NOTE: Ambiguous width characters are treated as narrow, which is what most non-CJK terminals do
+PEXPI u8 GetCodepointDisplayWidth(u32 codepoint)
+{
+	if (codepoint >= 0x20 && codepoint < 0x7F) { return 1; }
+	u8 propertyValue = GetCodepointPropertyValue(codepoint);
+	UnicodeCategory category = (UnicodeCategory)(propertyValue & UNICODE_PROP_CATEGORY_MASK);
+	if (category == UnicodeCategory_NonspacingMark || category == UnicodeCategory_EnclosingMark ||
+		category == UnicodeCategory_Format || category == UnicodeCategory_Control)
+	{
+		return 0;
+	}
+	UnicodeEastAsianWidth eastAsianWidth = (UnicodeEastAsianWidth)(propertyValue >> UNICODE_PROP_WIDTH_SHIFT);
+	return (eastAsianWidth == UnicodeEastAsianWidth_Wide || eastAsianWidth == UnicodeEastAsianWidth_Fullwidth) ? 2 : 1;
+}
+
 // +--------------------------------------------------------------+
 // |                       UTF-8 Functions                        |
 // +--------------------------------------------------------------+
@@ -281,7 +458,7 @@ PEXP bool DoesNtStrContainMultibyteUtf8Chars(const char* nullTermStr)
 			: (nullTermStr[bIndex+2] == '\0' ? 2
 			: (nullTermStr[bIndex+3] == '\0' ? 3
 			: 4));
-		if (GetCodepointForUtf8(numCharsLeft, nullTermStr + bIndex, nullptr) > 0) { return true; }
+		if (GetCodepointForUtf8(numCharsLeft, nullTermStr + bIndex, nullptr) > 1) { return true; }
 	}
 	return false;
 }
@@ -317,13 +494,25 @@ PEXP u8 GetUcs2WordsForCode(u32 codepoint, u16* wordBufferOut, bool doAssertions
 	}
 }
 
+//Returns the number of words consumed (1 or 2) to get the codepoint pointed to by strPntr
+//An unpaired surrogate (or a high surrogate at the end of maxNumWords) returns 0
 PEXP u8 GetCodepointForUcs2(u64 maxNumWords, const u16* strPntr, u32* codepointOut)
 {
-	UNUSED(maxNumWords);
-	UNUSED(strPntr);
-	UNUSED(codepointOut);
-	Assert(false); //TODO: Implement me!
-	return 0;
+	Assert(strPntr != nullptr || maxNumWords == 0);
+	SetOptionalOutPntr(codepointOut, 0);
+	if (maxNumWords == 0) { return 0; }
+	u16 firstWord = strPntr[0];
+	if (firstWord < 0xD800 || firstWord > 0xDFFF)
+	{
+		SetOptionalOutPntr(codepointOut, (u32)firstWord);
+		return 1;
+	}
+	else if (firstWord <= 0xDBFF && maxNumWords >= 2 && strPntr[1] >= 0xDC00 && strPntr[1] <= 0xDFFF)
+	{
+		SetOptionalOutPntr(codepointOut, 0x10000 + ((((u32)firstWord - 0xD800) << 10) | ((u32)strPntr[1] - 0xDC00)));
+		return 2;
+	}
+	else { return 0; }
 }
 
 // +--------------------------------------------------------------+
@@ -0,0 +1,504 @@
+/*
+File:   base_unicode_convert.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds bulk UTF-8 validation and UTF-8 <-> UCS-2 (UTF-16) measuring and transcoding
+	** functions that operate on whole buffers rather than one codepoint at a time.
+	** Runs of ASCII are handled 16-32 bytes at a time using the SimdU8x16 functions
+	** from base_simd.h and validation uses the lookup table algorithm from Keiser and
+	** Lemire ("Validating UTF-8 In Less Than One Instruction Per Byte") when a 16-entry
+	** byte lookup instruction is available (SSSE3, NEON, WASM SIMD).
+	** NOTE: Validation is strict, overlong encodings, surrogate codepoints (0xD800-0xDFFF)
+	** and codepoints above 0x10FFFF are all rejected.
+	** NOTE: Unpaired surrogates in UCS-2 input are converted to U+FFFD (the replacement
+	** character) so the UTF-8 output is always valid. U+FFFD takes 3 bytes just like a
+	** surrogate would so the measured length is the same either way.
+	** NOTE: The Utf8ToUcs2 and GetUcs2LengthForUtf8 functions expect their input to have
+	** been validated with IsValidUtf8 first, they do no error checking of their own
+*/
+
+#ifndef _BASE_UNICODE_CONVERT_H
+#define _BASE_UNICODE_CONVERT_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_simd.h"
+#include "std/std_memset.h"
+
+#define UNICODE_REPLACEMENT_CODEPOINT 0xFFFD
+
+//These are the error bits used by the validation lookup tables, each bit represents
+//a class of error that is possible given the high\low nibble of the previous byte
+//and the high nibble of the current byte. Only when all 3 tables agree is it an error.
+#define UTF8_VALIDATE_TOO_SHORT      0x01 //11______ 0_______ or 11______ 11______
+#define UTF8_VALIDATE_TOO_LONG       0x02 //0_______ 10______
+#define UTF8_VALIDATE_OVERLONG_3     0x04 //11100000 100_____
+#define UTF8_VALIDATE_TOO_LARGE      0x08 //11110100 1001____ or 11110100 101_____ or 11110101+ ________
+#define UTF8_VALIDATE_SURROGATE      0x10 //11101101 101_____
+#define UTF8_VALIDATE_OVERLONG_2     0x20 //1100000_ 10______
+#define UTF8_VALIDATE_TOO_LARGE_1000 0x40 //11110101 1000____ or 1111011_ 1000____ or 11111___ 1000____
+#define UTF8_VALIDATE_OVERLONG_4     0x40 //11110000 1000____
+#define UTF8_VALIDATE_TWO_CONTS      0x80 //10______ 10______
+#define UTF8_VALIDATE_CARRY          (UTF8_VALIDATE_TOO_SHORT | UTF8_VALIDATE_TOO_LONG | UTF8_VALIDATE_TWO_CONTS)
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE bool AreUcs2WordsAscii16(const u16* wordPntr);
+	PIG_CORE_INLINE void WidenAsciiToUcs2_16(const u8* bytePntr, u16* wordsOut);
+	PIG_CORE_INLINE void NarrowAsciiUcs2ToUtf8_16(const u16* wordPntr, u8* bytesOut);
+	uxx GetUtf8AsciiPrefixLength(const void* bytes, uxx numBytes);
+	uxx FindInvalidUtf8Scalar(const void* bytes, uxx numBytes);
+	#if TARGET_HAS_SIMD128_LOOKUP
+	PIG_CORE_INLINE SimdU8x16 CheckUtf8Block16(SimdU8x16 input, SimdU8x16 prevInput);
+	PIG_CORE_INLINE SimdU8x16 GetUtf8BlockIncomplete16(SimdU8x16 input);
+	#endif
+	bool IsValidUtf8(const void* bytes, uxx numBytes, uxx* invalidIndexOut);
+	uxx GetUcs2LengthForUtf8(const void* bytes, uxx numBytes);
+	uxx GetUtf8LengthForUcs2(const u16* words, uxx numWords);
+	uxx Utf8ToUcs2(const void* bytes, uxx numBytes, u16* wordsOut);
+	uxx Ucs2ToUtf8(const u16* words, uxx numWords, u8* bytesOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+// +==============================+
+// |       Helper Functions       |
+// +==============================+
+//Returns true if all 16 words starting at wordPntr are < 0x80
+PEXPI bool AreUcs2WordsAscii16(const u16* wordPntr)
+{
+	#if TARGET_HAS_SSE2
+	__m128i combined = _mm_or_si128(_mm_loadu_si128((const __m128i*)wordPntr), _mm_loadu_si128((const __m128i*)(wordPntr + 8)));
+	__m128i highBits = _mm_and_si128(combined, _mm_set1_epi16((short)0xFF80));
+	return (_mm_movemask_epi8(_mm_cmpeq_epi8(highBits, _mm_setzero_si128())) == 0xFFFF);
+	#elif TARGET_HAS_NEON
+	uint16x8_t combined = vorrq_u16(vld1q_u16(wordPntr), vld1q_u16(wordPntr + 8));
+	return (vmaxvq_u16(combined) < 0x80);
+	#elif TARGET_HAS_WASM_SIMD
+	v128_t combined = wasm_v128_or(wasm_v128_load(wordPntr), wasm_v128_load(wordPntr + 8));
+	return !wasm_v128_any_true(wasm_v128_and(combined, wasm_u16x8_splat(0xFF80)));
+	#else
+	u16 combined = 0;
+	for (uxx wIndex = 0; wIndex < 16; wIndex++) { combined |= wordPntr[wIndex]; }
+	return (combined < 0x80);
+	#endif
+}
+
+//Widens 16 ASCII bytes into 16 words
+PEXPI void WidenAsciiToUcs2_16(const u8* bytePntr, u16* wordsOut)
+{
+	#if TARGET_HAS_SSE2
+	__m128i bytes = _mm_loadu_si128((const __m128i*)bytePntr);
+	_mm_storeu_si128((__m128i*)wordsOut, _mm_unpacklo_epi8(bytes, _mm_setzero_si128()));
+	_mm_storeu_si128((__m128i*)(wordsOut + 8), _mm_unpackhi_epi8(bytes, _mm_setzero_si128()));
+	#elif TARGET_HAS_NEON
+	uint8x16_t bytes = vld1q_u8(bytePntr);
+	vst1q_u16(wordsOut, vmovl_u8(vget_low_u8(bytes)));
+	vst1q_u16(wordsOut + 8, vmovl_high_u8(bytes));
+	#elif TARGET_HAS_WASM_SIMD
+	v128_t bytes = wasm_v128_load(bytePntr);
+	wasm_v128_store(wordsOut, wasm_u16x8_extend_low_u8x16(bytes));
+	wasm_v128_store(wordsOut + 8, wasm_u16x8_extend_high_u8x16(bytes));
+	#else
+	for (uxx bIndex = 0; bIndex < 16; bIndex++) { wordsOut[bIndex] = bytePntr[bIndex]; }
+	#endif
+}
+
+//Narrows 16 words (that are known to be < 0x80) into 16 bytes
+PEXPI void NarrowAsciiUcs2ToUtf8_16(const u16* wordPntr, u8* bytesOut)
+{
+	#if TARGET_HAS_SSE2
+	__m128i packed = _mm_packus_epi16(_mm_loadu_si128((const __m128i*)wordPntr), _mm_loadu_si128((const __m128i*)(wordPntr + 8)));
+	_mm_storeu_si128((__m128i*)bytesOut, packed);
+	#elif TARGET_HAS_NEON
+	vst1q_u8(bytesOut, vmovn_high_u16(vmovn_u16(vld1q_u16(wordPntr)), vld1q_u16(wordPntr + 8)));
+	#elif TARGET_HAS_WASM_SIMD
+	wasm_v128_store(bytesOut, wasm_u8x16_narrow_i16x8(wasm_v128_load(wordPntr), wasm_v128_load(wordPntr + 8)));
+	#else
+	for (uxx wIndex = 0; wIndex < 16; wIndex++) { bytesOut[wIndex] = (u8)wordPntr[wIndex]; }
+	#endif
+}
+
+// +==============================+
+// |      ASCII Prefix Scan       |
+// +==============================+
+//Returns the index of the first byte >= 0x80, or numBytes if the whole buffer is ASCII
+PEXP uxx GetUtf8AsciiPrefixLength(const void* bytes, uxx numBytes)
+{
+	Assert(bytes != nullptr || numBytes == 0);
+	const u8* bytePntr = (const u8*)bytes;
+	uxx bIndex = 0;
+	#if TARGET_HAS_SIMD128
+	while (bIndex + 32 <= numBytes)
+	{
+		SimdU8x16 combined = SimdOrU8x16(SimdLoadU8x16(bytePntr + bIndex), SimdLoadU8x16(bytePntr + bIndex + 16));
+		if (SimdAnyHighBitU8x16(combined)) { break; }
+		bIndex += 32;
+	}
+	if (bIndex + 16 <= numBytes && !SimdAnyHighBitU8x16(SimdLoadU8x16(bytePntr + bIndex))) { bIndex += 16; }
+	#else
+	while (bIndex + sizeof(u64) <= numBytes)
+	{
+		u64 word;
+		MyMemCopy(&word, bytePntr + bIndex, sizeof(u64));
+		if ((word & 0x8080808080808080ULL) != 0) { break; }
+		bIndex += sizeof(u64);
+	}
+	#endif
+	while (bIndex < numBytes && bytePntr[bIndex] < 0x80) { bIndex++; }
+	return bIndex;
+}
+
+// +==============================+
+// |          Validation          |
+// +==============================+
+//Returns the index of the first byte of the first invalid (or truncated) sequence, or numBytes if everything is valid.
+//This follows Table 3-7 "Well-Formed UTF-8 Byte Sequences" from the Unicode standard
+PEXP uxx FindInvalidUtf8Scalar(const void* bytes, uxx numBytes)
+{
+	Assert(bytes != nullptr || numBytes == 0);
+	const u8* bytePntr = (const u8*)bytes;
+	uxx bIndex = 0;
+	while (bIndex < numBytes)
+	{
+		u8 lead = bytePntr[bIndex];
+		if (lead < 0x80) { bIndex += GetUtf8AsciiPrefixLength(bytePntr + bIndex, numBytes - bIndex); continue; }
+		
+		u8 numContinuations = 0;
+		u8 secondMin = 0x80, secondMax = 0xBF;
+		if (lead >= 0xC2 && lead <= 0xDF) { numContinuations = 1; }
+		else if (lead == 0xE0) { numContinuations = 2; secondMin = 0xA0; }
+		else if (lead == 0xED) { numContinuations = 2; secondMax = 0x9F; }
+		else if (lead >= 0xE1 && lead <= 0xEF) { numContinuations = 2; }
+		else if (lead == 0xF0) { numContinuations = 3; secondMin = 0x90; }
+		else if (lead >= 0xF1 && lead <= 0xF3) { numContinuations = 3; }
+		else if (lead == 0xF4) { numContinuations = 3; secondMax = 0x8F; }
+		else { return bIndex; }
+		
+		if (numBytes - bIndex <= numContinuations) { return bIndex; }
+		if (bytePntr[bIndex+1] < secondMin || bytePntr[bIndex+1] > secondMax) { return bIndex; }
+		for (u8 cIndex = 2; cIndex <= numContinuations; cIndex++)
+		{
+			if ((bytePntr[bIndex + cIndex] & 0xC0) != 0x80) { return bIndex; }
+		}
+		bIndex += 1 + numContinuations;
+	}
+	return numBytes;
+}
+
+#if TARGET_HAS_SIMD128_LOOKUP
+//Returns a non-zero byte anywhere there is an encoding error that ends within input (given the 16 bytes before it in prevInput)
+PEXPI SimdU8x16 CheckUtf8Block16(SimdU8x16 input, SimdU8x16 prevInput)
+{
+	static const u8 byte1HighTable[16] = {
+		//0_______ ________ <ASCII in byte 1>
+		UTF8_VALIDATE_TOO_LONG, UTF8_VALIDATE_TOO_LONG, UTF8_VALIDATE_TOO_LONG, UTF8_VALIDATE_TOO_LONG,
+		UTF8_VALIDATE_TOO_LONG, UTF8_VALIDATE_TOO_LONG, UTF8_VALIDATE_TOO_LONG, UTF8_VALIDATE_TOO_LONG,
+		//10______ ________ <continuation in byte 1>
+		UTF8_VALIDATE_TWO_CONTS, UTF8_VALIDATE_TWO_CONTS, UTF8_VALIDATE_TWO_CONTS, UTF8_VALIDATE_TWO_CONTS,
+		//1100____ ________ <two byte lead in byte 1>
+		UTF8_VALIDATE_TOO_SHORT | UTF8_VALIDATE_OVERLONG_2,
+		//1101____ ________ <two byte lead in byte 1>
+		UTF8_VALIDATE_TOO_SHORT,
+		//1110____ ________ <three byte lead in byte 1>
+		UTF8_VALIDATE_TOO_SHORT | UTF8_VALIDATE_OVERLONG_3 | UTF8_VALIDATE_SURROGATE,
+		//1111____ ________ <four+ byte lead in byte 1>
+		UTF8_VALIDATE_TOO_SHORT | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000 | UTF8_VALIDATE_OVERLONG_4,
+	};
+	static const u8 byte1LowTable[16] = {
+		//____0000 ________
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_OVERLONG_3 | UTF8_VALIDATE_OVERLONG_2 | UTF8_VALIDATE_OVERLONG_4,
+		//____0001 ________
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_OVERLONG_2,
+		//____001_ ________
+		UTF8_VALIDATE_CARRY,
+		UTF8_VALIDATE_CARRY,
+		//____0100 ________
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE,
+		//____0101 ________
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		//____011_ ________
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		//____1___ ________
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		//____1101 ________
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000 | UTF8_VALIDATE_SURROGATE,
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+		UTF8_VALIDATE_CARRY | UTF8_VALIDATE_TOO_LARGE | UTF8_VALIDATE_TOO_LARGE_1000,
+	};
+	static const u8 byte2HighTable[16] = {
+		//________ 0_______ <ASCII in byte 2>
+		UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT,
+		UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT,
+		//________ 1000____
+		UTF8_VALIDATE_TOO_LONG | UTF8_VALIDATE_OVERLONG_2 | UTF8_VALIDATE_TWO_CONTS | UTF8_VALIDATE_OVERLONG_3 | UTF8_VALIDATE_TOO_LARGE_1000 | UTF8_VALIDATE_OVERLONG_4,
+		//________ 1001____
+		UTF8_VALIDATE_TOO_LONG | UTF8_VALIDATE_OVERLONG_2 | UTF8_VALIDATE_TWO_CONTS | UTF8_VALIDATE_OVERLONG_3 | UTF8_VALIDATE_TOO_LARGE,
+		//________ 101_____
+		UTF8_VALIDATE_TOO_LONG | UTF8_VALIDATE_OVERLONG_2 | UTF8_VALIDATE_TWO_CONTS | UTF8_VALIDATE_SURROGATE | UTF8_VALIDATE_TOO_LARGE,
+		UTF8_VALIDATE_TOO_LONG | UTF8_VALIDATE_OVERLONG_2 | UTF8_VALIDATE_TWO_CONTS | UTF8_VALIDATE_SURROGATE | UTF8_VALIDATE_TOO_LARGE,
+		//________ 11______
+		UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT, UTF8_VALIDATE_TOO_SHORT,
+	};
+	
+	SimdU8x16 lowNibbleMask = SimdSplatU8x16(0x0F);
+	SimdU8x16 prev1 = SimdPrev1U8x16(input, prevInput);
+	SimdU8x16 byte1High = SimdLookupU8x16(SimdLoadU8x16(&byte1HighTable[0]), SimdShiftRight4U8x16(prev1));
+	SimdU8x16 byte1Low = SimdLookupU8x16(SimdLoadU8x16(&byte1LowTable[0]), SimdAndU8x16(prev1, lowNibbleMask));
+	SimdU8x16 byte2High = SimdLookupU8x16(SimdLoadU8x16(&byte2HighTable[0]), SimdShiftRight4U8x16(input));
+	SimdU8x16 specialCases = SimdAndU8x16(SimdAndU8x16(byte1High, byte1Low), byte2High);
+	
+	//The tables above only look at pairs of bytes, the 3rd and 4th bytes of longer sequences are checked here.
+	//Only 111_____ will be >= 0x80 after subtracting 0x60 and only 1111____ will be >= 0x80 after subtracting 0x70
+	SimdU8x16 isThirdByte = SimdSubSatU8x16(SimdPrev2U8x16(input, prevInput), SimdSplatU8x16(0xE0 - 0x80));
+	SimdU8x16 isFourthByte = SimdSubSatU8x16(SimdPrev3U8x16(input, prevInput), SimdSplatU8x16(0xF0 - 0x80));
+	SimdU8x16 mustBeContinuation = SimdAndU8x16(SimdOrU8x16(isThirdByte, isFourthByte), SimdSplatU8x16(0x80));
+	return SimdXorU8x16(mustBeContinuation, specialCases);
+}
+//Returns non-zero bytes if input ends with a sequence that continues into the next block
+PEXPI SimdU8x16 GetUtf8BlockIncomplete16(SimdU8x16 input)
+{
+	static const u8 maxValues[16] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1 };
+	return SimdSubSatU8x16(input, SimdLoadU8x16(&maxValues[0]));
+}
+#endif //TARGET_HAS_SIMD128_LOOKUP
+
+//Returns true if the buffer is entirely well-formed UTF-8. If not, invalidIndexOut gets the index of the first byte of the first invalid sequence
+PEXP bool IsValidUtf8(const void* bytes, uxx numBytes, uxx* invalidIndexOut)
+{
+	Assert(bytes != nullptr || numBytes == 0);
+	SetOptionalOutPntr(invalidIndexOut, numBytes);
+	const u8* bytePntr = (const u8*)bytes;
+	
+	#if TARGET_HAS_SIMD128_LOOKUP
+	{
+		SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+		SimdU8x16 prevInput = zeroVec;
+		SimdU8x16 prevIncomplete = zeroVec;
+		uxx bIndex = 0;
+		bool foundError = false;
+		while (bIndex < numBytes + 1)
+		{
+			SimdU8x16 input;
+			if (bIndex + 16 <= numBytes) { input = SimdLoadU8x16(bytePntr + bIndex); }
+			else
+			{
+				//The final partial block (which may be empty) is padded with zeros, the padding acts as ASCII which catches any truncated sequence at the end
+				u8 tailBuffer[16] = ZEROED;
+				if (bIndex < numBytes) { MyMemCopy(&tailBuffer[0], bytePntr + bIndex, numBytes - bIndex); }
+				input = SimdLoadU8x16(&tailBuffer[0]);
+			}
+			
+			SimdU8x16 error;
+			if (!SimdAnyHighBitU8x16(input))
+			{
+				error = prevIncomplete;
+				prevIncomplete = zeroVec;
+			}
+			else
+			{
+				error = CheckUtf8Block16(input, prevInput);
+				prevIncomplete = GetUtf8BlockIncomplete16(input);
+			}
+			if (SimdAnyNonZeroU8x16(error)) { foundError = true; break; }
+			prevInput = input;
+			bIndex += 16;
+		}
+		if (!foundError) { return true; }
+		if (invalidIndexOut != nullptr)
+		{
+			//Everything before the previous block is known good, so rescan from there (skipping continuation bytes of a sequence that started before it) to find the exact index
+			uxx scanStart = 0;
+			if (bIndex >= 16)
+			{
+				scanStart = bIndex - 16;
+				for (u8 skipIndex = 0; skipIndex < 3 && (bytePntr[scanStart] & 0xC0) == 0x80; skipIndex++) { scanStart++; }
+			}
+			*invalidIndexOut = scanStart + FindInvalidUtf8Scalar(bytePntr + scanStart, numBytes - scanStart);
+			Assert(*invalidIndexOut < numBytes);
+		}
+		return false;
+	}
+	#else
+	{
+		//NOTE: FindInvalidUtf8Scalar still skips runs of ASCII using GetUtf8AsciiPrefixLength
+		uxx invalidIndex = FindInvalidUtf8Scalar(bytePntr, numBytes);
+		SetOptionalOutPntr(invalidIndexOut, invalidIndex);
+		return (invalidIndex >= numBytes);
+	}
+	#endif
+}
+
+// +==============================+
+// |          Measuring           |
+// +==============================+
+//Expects valid UTF-8. Every non-continuation byte starts a codepoint that takes 1 word, 4-byte leads (0xF0+) need a surrogate pair so they take 1 extra word
+PEXP uxx GetUcs2LengthForUtf8(const void* bytes, uxx numBytes)
+{
+	Assert(bytes != nullptr || numBytes == 0);
+	const u8* bytePntr = (const u8*)bytes;
+	uxx result = 0;
+	uxx bIndex = 0;
+	#if TARGET_HAS_SIMD128
+	SimdU8x16 oneVec = SimdSplatU8x16(0x01);
+	SimdU8x16 topTwoMask = SimdSplatU8x16(0xC0);
+	SimdU8x16 continuationVec = SimdSplatU8x16(0x80);
+	SimdU8x16 topFourMask = SimdSplatU8x16(0xF0);
+	while (bIndex + 16 <= numBytes)
+	{
+		SimdU8x16 input = SimdLoadU8x16(bytePntr + bIndex);
+		if (!SimdAnyHighBitU8x16(input)) { result += 16; bIndex += 16; continue; }
+		SimdU8x16 isContinuation = SimdEqualsU8x16(SimdAndU8x16(input, topTwoMask), continuationVec);
+		SimdU8x16 isFourByteLead = SimdEqualsU8x16(SimdAndU8x16(input, topFourMask), topFourMask);
+		result += 16 + SimdSumU8x16(SimdAndU8x16(isFourByteLead, oneVec)) - SimdSumU8x16(SimdAndU8x16(isContinuation, oneVec));
+		bIndex += 16;
+	}
+	#endif
+	for (; bIndex < numBytes; bIndex++)
+	{
+		u8 byte = bytePntr[bIndex];
+		if ((byte & 0xC0) != 0x80) { result++; }
+		if (byte >= 0xF0) { result++; }
+	}
+	return result;
+}
+
+//Unpaired surrogates are counted as 3 bytes (they are converted to U+FFFD)
+PEXP uxx GetUtf8LengthForUcs2(const u16* words, uxx numWords)
+{
+	Assert(words != nullptr || numWords == 0);
+	uxx result = 0;
+	uxx wIndex = 0;
+	while (wIndex < numWords)
+	{
+		if (wIndex + 16 <= numWords && AreUcs2WordsAscii16(&words[wIndex])) { result += 16; wIndex += 16; continue; }
+		//Do scalar measuring until we hit an ASCII character again, then try the fast path again
+		do
+		{
+			u16 word = words[wIndex];
+			if (word < 0x80) { result += 1; wIndex += 1; }
+			else if (word < 0x800) { result += 2; wIndex += 1; }
+			else if (word >= 0xD800 && word <= 0xDBFF && wIndex+1 < numWords && words[wIndex+1] >= 0xDC00 && words[wIndex+1] <= 0xDFFF) { result += 4; wIndex += 2; }
+			else { result += 3; wIndex += 1; }
+		} while (wIndex < numWords && words[wIndex] >= 0x80);
+	}
+	return result;
+}
+
+// +==============================+
+// |         Transcoding          |
+// +==============================+
+//Expects valid UTF-8 and wordsOut must have space for GetUcs2LengthForUtf8(bytes, numBytes) words. Returns the number of words written
+PEXP uxx Utf8ToUcs2(const void* bytes, uxx numBytes, u16* wordsOut)
+{
+	Assert(bytes != nullptr || numBytes == 0);
+	Assert(wordsOut != nullptr || numBytes == 0);
+	const u8* bytePntr = (const u8*)bytes;
+	uxx wIndex = 0;
+	uxx bIndex = 0;
+	while (bIndex < numBytes)
+	{
+		#if TARGET_HAS_SIMD128
+		if (bIndex + 16 <= numBytes && !SimdAnyHighBitU8x16(SimdLoadU8x16(bytePntr + bIndex)))
+		{
+			WidenAsciiToUcs2_16(bytePntr + bIndex, &wordsOut[wIndex]);
+			bIndex += 16;
+			wIndex += 16;
+			continue;
+		}
+		#endif
+		//Do scalar decoding until we hit an ASCII character again, then try the fast path again
+		do
+		{
+			u8 lead = bytePntr[bIndex];
+			if (lead < 0x80) { wordsOut[wIndex++] = lead; bIndex += 1; }
+			else if (lead < 0xE0)
+			{
+				wordsOut[wIndex++] = (u16)(((u32)(lead & 0x1F) << 6) | (u32)(bytePntr[bIndex+1] & 0x3F));
+				bIndex += 2;
+			}
+			else if (lead < 0xF0)
+			{
+				wordsOut[wIndex++] = (u16)(((u32)(lead & 0x0F) << 12) | ((u32)(bytePntr[bIndex+1] & 0x3F) << 6) | (u32)(bytePntr[bIndex+2] & 0x3F));
+				bIndex += 3;
+			}
+			else
+			{
+				u32 codepoint = ((u32)(lead & 0x07) << 18) | ((u32)(bytePntr[bIndex+1] & 0x3F) << 12) | ((u32)(bytePntr[bIndex+2] & 0x3F) << 6) | (u32)(bytePntr[bIndex+3] & 0x3F);
+				codepoint -= 0x10000;
+				wordsOut[wIndex++] = (u16)(0xD800 + ((codepoint >> 10) & 0x03FF));
+				wordsOut[wIndex++] = (u16)(0xDC00 + (codepoint & 0x03FF));
+				bIndex += 4;
+			}
+		} while (bIndex < numBytes && bytePntr[bIndex] >= 0x80);
+	}
+	return wIndex;
+}
+
+//bytesOut must have space for GetUtf8LengthForUcs2(words, numWords) bytes. Returns the number of bytes written
+PEXP uxx Ucs2ToUtf8(const u16* words, uxx numWords, u8* bytesOut)
+{
+	Assert(words != nullptr || numWords == 0);
+	Assert(bytesOut != nullptr || numWords == 0);
+	uxx bIndex = 0;
+	uxx wIndex = 0;
+	while (wIndex < numWords)
+	{
+		if (wIndex + 16 <= numWords && AreUcs2WordsAscii16(&words[wIndex]))
+		{
+			NarrowAsciiUcs2ToUtf8_16(&words[wIndex], &bytesOut[bIndex]);
+			wIndex += 16;
+			bIndex += 16;
+			continue;
+		}
+		//Do scalar encoding until we hit an ASCII character again, then try the fast path again
+		do
+		{
+			u32 codepoint = words[wIndex];
+			if (codepoint < 0x80) { bytesOut[bIndex++] = (u8)codepoint; wIndex += 1; continue; }
+			if (codepoint < 0x800)
+			{
+				bytesOut[bIndex++] = (u8)(0xC0 | (codepoint >> 6));
+				bytesOut[bIndex++] = (u8)(0x80 | (codepoint & 0x3F));
+				wIndex += 1;
+				continue;
+			}
+			if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+			{
+				if (codepoint <= 0xDBFF && wIndex+1 < numWords && words[wIndex+1] >= 0xDC00 && words[wIndex+1] <= 0xDFFF)
+				{
+					codepoint = 0x10000 + (((codepoint - 0xD800) << 10) | ((u32)words[wIndex+1] - 0xDC00));
+					bytesOut[bIndex++] = (u8)(0xF0 | (codepoint >> 18));
+					bytesOut[bIndex++] = (u8)(0x80 | ((codepoint >> 12) & 0x3F));
+					bytesOut[bIndex++] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
+					bytesOut[bIndex++] = (u8)(0x80 | (codepoint & 0x3F));
+					wIndex += 2;
+					continue;
+				}
+				codepoint = UNICODE_REPLACEMENT_CODEPOINT;
+			}
+			bytesOut[bIndex++] = (u8)(0xE0 | (codepoint >> 12));
+			bytesOut[bIndex++] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
+			bytesOut[bIndex++] = (u8)(0x80 | (codepoint & 0x3F));
+			wIndex += 1;
+		} while (wIndex < numWords && words[wIndex] >= 0x80);
+	}
+	return bIndex;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _BASE_UNICODE_CONVERT_H
@@ -0,0 +1,788 @@
+/*
+File:   base_unicode_tables.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** !! This file is generated by _scripts/generate_unicode_tables.py, do not edit it by hand !!
+	** Holds the 3-stage lookup tables used by GetCaseFoldedCodepoint, GetCodepointCategory,
+	** and GetCodepointEastAsianWidth in base_unicode.h
+	** Generated from Unicode 14.0.0 (fold tables: 2389 bytes, property tables: 21184 bytes)
+*/
+
+#ifndef _BASE_UNICODE_TABLES_H
+#define _BASE_UNICODE_TABLES_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+
+#define UNICODE_TABLES_VERSION "14.0.0"
+
+//Codepoints >= UNICODE_FOLD_TABLE_LIMIT always fold to themselves
+#define UNICODE_FOLD_TABLE_LIMIT   0x1EA00UL
+#define UNICODE_FOLD_STAGE2_SHIFT  5
+#define UNICODE_FOLD_STAGE3_SHIFT  3
+#define UNICODE_PROP_STAGE2_SHIFT  5
+#define UNICODE_PROP_STAGE3_SHIFT  4
+//Property values hold the UnicodeCategory in the low bits and the UnicodeEastAsianWidth in the high bits
+#define UNICODE_PROP_CATEGORY_MASK 0x1F
+#define UNICODE_PROP_WIDTH_SHIFT   5
+
+#if !PIG_CORE_IMPLEMENTATION
+extern const u8 UnicodeFoldStage1[490];
+extern const u8 UnicodeFoldStage2[773];
+extern const u8 UnicodeFoldStage3[730];
+extern const u8 UnicodePropStage1[2176];
+extern const u16 UnicodePropStage2[3200];
+extern const u8 UnicodePropStage3[12608];
+extern const i32 UnicodeFoldDeltas[99];
+#else
+const u8 UnicodeFoldStage1[490] = {
+	0,1,2,3,4,5,6,6,6,6,6,6,6,6,6,6,7,6,6,8,6,6,6,6,6,6,6,6,9,6,10,11,
+	6,12,6,6,13,6,6,6,6,6,6,6,14,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,15,16,6,6,6,17,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,18,
+	6,6,6,6,19,20,6,6,6,6,6,6,21,6,6,6,6,6,6,6,6,6,6,6,22,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,23,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,24,
+};
+const u8 UnicodeFoldStage2[773] = {
+	0,0,0,0,0,0,0,0,1,2,2,3,0,0,0,0,0,0,0,0,0,0,4,0,2,2,5,5,0,0,0,0,
+	6,6,6,6,6,6,7,8,8,7,6,6,6,6,6,9,10,11,12,13,14,15,16,17,18,19,8,20,6,6,21,6,
+	6,6,6,6,22,6,23,24,25,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,26,0,0,0,0,0,27,28,29,30,1,2,31,32,0,0,33,34,35,6,6,6,36,37,
+	38,38,2,2,2,2,0,0,0,0,0,0,6,6,6,6,39,7,6,6,6,6,6,6,40,41,6,6,6,6,6,6,
+	6,6,6,6,6,6,42,43,43,43,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,45,45,45,46,47,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,50,51,51,51,51,51,52,0,0,0,0,0,0,0,0,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,53,54,6,6,6,6,6,6,6,6,6,6,6,6,
+	0,55,0,48,0,55,0,55,0,48,0,56,0,55,0,0,0,55,0,55,0,55,0,57,0,58,0,59,0,60,0,61,
+	0,0,0,0,62,63,64,0,0,0,0,0,65,65,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,68,68,68,0,0,0,0,0,0,
+	43,43,43,43,43,43,0,0,0,0,0,0,69,70,71,72,6,6,6,6,6,6,6,6,6,6,6,6,23,73,33,0,
+	0,0,0,0,0,0,0,0,6,6,6,6,6,53,0,0,6,6,6,23,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,7,6,7,6,6,6,6,6,6,6,0,74,6,75,27,6,6,76,77,6,78,79,80,39,0,0,81,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,82,82,82,82,82,82,82,82,82,0,0,0,0,0,0,0,0,
+	0,0,0,0,1,2,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	83,83,83,83,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,83,83,83,84,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,86,85,86,87,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,88,88,88,88,88,89,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	90,90,90,90,91,
+};
+const u8 UnicodeFoldStage3[730] = {
+	0,0,0,0,0,0,0,0,0,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,0,0,0,0,0,
+	0,0,0,0,0,93,0,0,66,66,66,66,66,66,66,0,59,0,59,0,59,0,59,0,0,0,59,0,59,0,59,0,
+	0,59,0,59,0,59,0,59,40,59,0,59,0,59,0,34,0,86,59,0,59,0,83,59,0,82,82,59,0,0,77,80,
+	81,59,0,82,84,0,87,85,59,0,0,0,87,88,0,89,59,0,59,0,59,0,91,59,0,91,0,0,59,0,91,59,
+	0,90,90,59,0,59,0,92,59,0,0,0,59,0,0,0,0,0,0,0,60,59,0,60,59,0,60,59,0,59,0,59,
+	0,59,0,59,0,0,59,0,0,60,59,0,59,0,43,49,37,0,59,0,59,0,59,0,59,0,59,0,0,0,0,0,
+	0,0,97,59,0,36,96,0,0,59,0,35,75,76,59,0,0,0,0,0,0,79,0,0,59,0,59,0,0,0,59,0,
+	0,0,0,0,0,0,0,79,0,0,0,0,0,0,69,0,68,68,68,0,74,0,73,73,66,66,0,66,66,66,66,66,
+	66,66,66,66,0,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,61,52,53,0,0,0,55,54,0,
+	50,51,0,0,47,46,0,59,0,58,59,0,0,37,37,37,78,78,78,78,78,78,78,78,59,0,0,0,0,0,0,0,
+	62,59,0,59,0,59,0,59,0,59,0,59,0,59,0,0,0,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+	72,72,72,72,72,72,72,0,95,95,95,95,95,95,95,95,95,95,95,95,95,95,0,95,0,0,0,0,0,95,0,0,
+	57,57,57,57,57,57,0,0,25,26,27,29,29,28,30,31,98,0,0,0,0,0,0,0,33,33,33,33,33,33,33,33,
+	33,33,33,0,0,33,33,33,59,0,59,0,59,0,0,0,0,0,0,48,0,0,22,0,57,57,57,57,57,57,57,57,
+	0,57,0,57,0,57,0,57,57,57,45,45,56,0,24,0,44,44,44,44,56,0,0,0,57,57,42,42,0,0,0,0,
+	57,57,41,41,58,0,0,0,38,38,39,39,56,0,0,0,0,0,0,0,0,0,23,0,0,0,20,21,0,0,0,0,
+	0,0,65,0,0,0,0,0,63,63,63,63,63,63,63,63,0,0,0,59,0,0,0,0,0,0,0,0,0,0,64,64,
+	64,64,64,64,64,64,64,64,59,0,18,32,19,0,0,59,0,59,0,59,0,16,17,14,15,0,59,0,0,59,0,0,
+	0,0,0,0,0,0,13,13,0,0,0,59,0,59,0,0,0,59,0,59,0,12,59,0,0,0,0,59,0,7,0,0,
+	59,0,3,1,2,5,3,0,9,6,8,94,59,0,59,0,59,0,59,0,51,4,11,59,0,59,0,0,0,0,0,0,
+	59,0,0,0,0,0,59,0,0,0,0,0,0,59,0,0,10,10,10,10,10,10,10,10,71,71,71,71,71,71,71,71,
+	71,71,71,71,0,0,0,0,70,70,70,70,70,70,70,70,70,70,70,0,70,70,70,70,70,70,70,0,70,70,0,0,
+	74,74,74,74,74,74,74,74,74,74,74,0,0,0,0,0,67,67,67,67,67,67,67,67,67,67,
+};
+const u8 UnicodePropStage1[2176] = {
+	0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,26,
+	26,26,26,26,26,26,27,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,28,26,29,30,31,32,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,33,34,34,34,34,35,35,35,35,35,35,35,35,35,35,35,35,36,37,38,39,
+	40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,59,59,59,60,56,56,61,59,59,59,59,59,
+	59,59,56,62,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,56,63,59,64,26,26,26,26,26,26,26,26,
+	26,26,26,65,26,26,66,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,67,68,69,59,59,59,59,70,59,
+	59,59,59,59,59,59,59,71,72,73,74,75,76,77,59,78,79,80,59,81,82,59,83,84,85,86,87,88,89,90,59,59,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,91,26,26,26,26,26,26,26,92,93,26,26,26,
+	26,26,26,26,26,26,26,94,26,26,26,26,26,26,26,26,26,26,26,26,26,95,59,59,59,59,59,59,26,96,59,59,
+	26,26,26,26,26,26,26,26,26,97,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	98,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,99,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+	35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,99,
+};
+const u16 UnicodePropStage2[3200] = {
+	0,0,1,2,3,4,5,6,0,0,7,8,9,10,11,12,
+	13,14,15,16,17,18,15,19,20,21,22,23,24,25,26,27,
+	26,26,26,28,29,30,30,31,31,32,31,33,34,35,36,37,
+	38,38,38,38,38,38,38,39,40,41,42,43,44,45,26,46,
+	47,48,48,49,49,30,26,26,50,26,26,26,51,26,26,26,
+	26,26,26,52,53,54,31,31,55,56,57,58,59,60,61,62,
+	63,64,60,60,65,57,66,67,60,60,60,60,60,68,69,70,
+	71,72,60,57,73,60,60,60,60,60,74,75,76,60,77,78,
+	60,79,80,81,60,82,83,60,84,85,60,60,86,57,87,57,
+	88,60,60,89,90,91,92,93,94,95,96,97,98,99,100,101,
+	102,95,96,103,104,105,106,107,108,109,96,110,111,112,100,113,
+	114,95,96,115,116,117,100,118,119,120,121,122,123,124,106,125,
+	126,127,96,128,129,130,100,131,132,127,96,133,134,135,100,136,
+	137,127,60,138,139,140,100,141,142,143,60,144,145,146,106,147,
+	148,60,60,149,150,151,152,152,153,60,154,155,156,157,152,152,
+	158,159,160,161,162,60,163,164,165,166,57,167,168,169,152,152,
+	60,60,170,171,172,173,174,175,176,177,53,53,178,31,31,179,
+	180,180,180,180,180,180,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,181,182,60,60,181,60,60,183,184,185,60,60,
+	60,184,60,60,60,186,187,188,60,189,53,53,53,53,53,190,
+	191,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,192,60,193,194,60,60,60,60,195,196,
+	60,197,60,198,60,199,200,201,60,60,60,202,203,204,205,206,
+	207,205,60,60,208,60,60,209,210,60,211,60,60,60,60,212,
+	60,213,214,215,216,60,217,218,60,60,219,60,220,221,222,222,
+	60,223,60,60,60,224,225,226,205,205,227,228,229,152,152,152,
+	230,60,60,231,232,172,233,234,235,60,236,76,60,60,237,238,
+	60,60,239,240,241,76,60,242,243,53,53,244,245,246,247,248,
+	31,31,249,33,33,33,250,251,31,252,33,33,57,57,57,57,
+	26,26,26,26,26,26,26,26,26,253,26,26,26,26,26,26,
+	254,255,254,254,255,256,254,257,258,258,258,259,260,261,262,263,
+	264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,
+	280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,
+	296,297,298,299,300,301,302,303,304,305,306,307,303,303,303,303,
+	308,309,310,222,222,222,222,311,222,312,303,313,222,314,315,316,
+	222,222,317,152,318,152,319,319,319,320,321,321,321,321,322,319,
+	321,321,321,321,323,321,321,324,321,325,326,327,328,329,330,331,
+	332,333,222,222,334,335,336,337,222,338,339,340,341,342,343,344,
+	345,222,346,347,348,349,350,351,352,353,222,354,355,303,356,303,
+	222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,
+	303,303,303,303,303,303,303,303,357,358,303,303,303,359,303,360,
+	303,303,303,303,303,303,303,303,303,303,303,303,303,303,303,303,
+	222,361,222,303,362,363,222,364,222,365,222,222,222,222,222,222,
+	53,53,53,31,31,31,366,367,26,26,26,26,26,26,368,369,
+	31,31,370,60,60,60,371,372,60,373,374,374,374,374,57,57,
+	375,376,377,378,379,380,152,152,381,382,381,381,381,381,381,383,
+	381,381,381,381,381,381,381,381,381,381,381,381,381,384,152,385,
+	386,387,388,389,390,180,180,180,180,391,392,180,180,180,180,393,
+	394,180,180,390,180,180,180,180,395,396,180,180,381,381,383,180,
+	381,397,398,381,399,400,381,381,398,381,381,400,381,381,381,381,
+	381,381,381,381,381,381,381,381,381,381,381,381,381,381,381,381,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,222,222,222,222,
+	180,401,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,402,381,381,381,403,60,60,242,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	404,60,405,152,26,26,406,407,26,408,60,60,60,60,409,410,
+	37,411,412,413,26,26,26,414,415,416,417,418,419,420,152,421,
+	422,60,423,424,60,60,60,425,426,60,60,427,428,205,57,429,
+	76,60,430,60,431,432,180,402,88,60,60,433,434,435,436,437,
+	60,60,438,439,440,441,60,442,60,60,60,443,444,445,446,447,
+	448,449,374,31,31,450,451,31,31,31,31,31,60,60,452,205,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,453,60,454,60,60,219,
+	455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,
+	455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,455,
+	456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,
+	456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,
+	456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,457,180,180,180,180,180,180,458,152,152,
+	459,460,461,462,463,60,60,60,60,60,60,464,465,466,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,467,222,60,60,60,60,468,60,60,469,152,152,470,
+	38,471,57,472,473,474,475,476,60,60,60,60,60,60,60,477,
+	478,479,480,481,482,483,484,485,486,487,486,488,489,490,491,492,
+	493,60,185,494,217,217,152,152,60,60,60,60,60,60,60,83,
+	495,352,352,496,497,497,497,498,499,500,501,152,152,222,222,502,
+	152,152,152,152,152,152,152,152,60,163,60,60,60,112,503,504,
+	60,60,505,60,506,60,60,507,60,508,60,60,509,510,152,152,
+	53,53,511,31,31,60,60,60,60,217,205,53,53,512,31,513,
+	60,60,514,60,60,60,515,516,516,517,518,519,152,152,152,152,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,373,60,212,514,152,520,33,33,521,152,152,152,152,
+	522,60,60,523,60,524,60,525,60,213,526,152,152,152,60,527,
+	60,528,60,529,152,152,152,152,60,60,60,530,352,531,352,352,
+	532,533,60,534,535,536,60,537,60,538,152,152,539,60,540,541,
+	60,60,60,542,60,543,60,544,60,545,546,152,152,152,152,152,
+	60,60,60,60,209,152,152,152,53,53,53,547,31,31,31,548,
+	60,60,549,205,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,352,550,60,60,551,552,152,152,152,152,
+	60,538,553,60,74,554,152,60,555,152,152,60,556,152,60,373,
+	557,60,60,558,559,531,560,561,235,60,60,562,563,60,209,205,
+	564,60,565,566,567,60,60,568,235,60,60,569,570,571,572,573,
+	60,109,574,575,152,152,152,152,576,577,578,60,60,579,580,205,
+	581,95,96,582,583,584,585,586,152,152,152,152,152,152,152,152,
+	60,60,60,587,588,589,552,152,60,60,60,590,591,205,152,152,
+	152,152,152,152,152,152,152,152,60,60,592,593,594,595,152,152,
+	60,60,60,596,597,205,598,152,60,60,599,600,205,152,152,152,
+	60,186,601,602,373,152,152,152,152,152,152,152,152,152,152,152,
+	60,60,574,603,152,152,152,152,152,152,53,53,31,31,160,604,
+	605,606,60,607,608,205,152,152,152,152,609,60,60,610,611,152,
+	612,60,60,613,614,615,60,60,616,617,618,60,60,60,60,209,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	96,60,592,619,620,160,188,621,60,622,623,624,152,152,152,152,
+	625,60,60,626,627,205,628,60,629,630,205,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,60,631,
+	152,152,152,152,152,152,152,152,152,152,152,112,352,632,633,634,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+	60,60,60,60,60,60,60,60,60,220,152,152,152,152,152,152,
+	497,497,497,497,497,497,635,636,60,60,60,60,60,60,60,60,
+	60,60,60,60,637,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,60,60,60,60,60,60,638,
+	60,60,213,639,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	60,60,60,60,373,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	60,60,60,209,60,213,435,60,60,60,60,213,205,60,217,640,
+	60,60,60,641,642,643,644,645,60,152,152,152,152,152,152,152,
+	152,152,152,152,53,53,31,31,352,646,152,152,152,152,152,152,
+	60,60,60,60,647,648,649,649,650,651,152,152,152,152,652,653,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,654,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,655,152,152,
+	656,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,657,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,658,152,152,658,659,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,660,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	60,60,60,60,60,60,83,163,209,661,662,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	57,57,663,57,664,222,222,222,222,222,222,222,665,152,152,152,
+	222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,666,
+	222,222,667,222,222,222,668,669,670,222,671,222,222,222,318,152,
+	222,222,222,222,672,152,152,152,152,152,152,152,152,152,352,673,
+	222,222,222,222,222,317,352,535,152,152,152,152,152,152,152,152,
+	53,674,31,675,676,677,254,53,678,679,680,681,682,53,674,31,
+	683,684,31,685,686,687,688,53,689,31,53,674,31,675,676,31,
+	254,53,678,688,53,689,31,53,674,31,690,53,691,692,693,694,
+	31,695,53,696,697,698,699,31,700,53,701,31,702,703,703,703,
+	222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,
+	222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,
+	57,57,57,704,57,57,705,706,707,708,56,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	709,710,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	711,712,713,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	60,60,163,714,715,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,60,716,152,60,60,717,718,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,719,213,
+	60,60,60,60,60,60,60,60,60,60,60,60,720,664,152,152,
+	53,53,678,31,721,435,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,572,352,352,722,723,152,152,152,152,
+	572,352,724,725,152,152,152,152,152,152,152,152,152,152,152,152,
+	726,60,727,728,729,730,731,732,733,219,734,219,152,152,152,735,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	736,222,737,222,222,222,222,222,222,665,738,739,740,739,222,666,
+	741,321,742,321,321,321,743,321,744,745,746,152,152,152,747,222,
+	748,381,381,385,749,750,384,152,152,152,152,152,152,152,152,152,
+	381,381,751,752,381,381,381,753,381,335,381,381,754,335,381,755,
+	381,381,381,756,757,381,381,381,381,381,381,381,381,381,381,758,
+	381,381,381,759,760,381,761,762,222,763,736,222,222,222,222,764,
+	381,381,381,381,381,222,222,222,381,381,381,381,765,766,767,768,
+	222,222,222,222,222,222,222,665,222,222,222,222,222,769,385,770,
+	737,222,222,222,771,189,222,222,771,222,772,773,152,152,152,152,
+	774,381,381,775,752,381,381,381,381,381,381,381,381,381,381,381,
+	222,222,222,222,222,665,772,776,403,381,777,778,384,779,780,403,
+	222,222,222,222,222,222,222,222,222,781,222,222,318,152,152,205,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,152,152,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,656,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,457,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,782,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,783,152,
+	180,457,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,152,
+	180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+	180,180,180,180,784,152,152,152,152,152,152,152,152,152,152,152,
+	785,152,786,786,786,786,786,786,152,152,152,152,152,152,152,152,
+	38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,152,
+	456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,
+	456,456,456,456,456,456,456,456,456,456,456,456,456,456,456,787,
+};
+const u8 UnicodePropStage3[12608] = {
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,183,178,178,178,180,178,178,178,174,175,178,179,178,173,178,178,
+	169,169,169,169,169,169,169,169,169,169,178,178,179,179,179,178,178,161,161,161,161,161,161,161,161,161,161,161,161,161,161,161,
+	161,161,161,161,161,161,161,161,161,161,161,174,178,175,181,172,181,162,162,162,162,162,162,162,162,162,162,162,162,162,162,162,
+	162,162,162,162,162,162,162,162,162,162,162,174,179,175,179,26,23,50,180,180,52,180,182,50,53,22,37,16,179,59,54,181,
+	54,51,43,43,53,2,50,50,53,43,37,17,43,43,43,50,1,1,1,1,1,1,33,1,1,1,1,1,1,1,1,1,
+	33,1,1,1,1,1,1,51,33,1,1,1,1,1,33,34,34,34,2,2,2,2,34,2,34,34,34,2,34,34,2,2,
+	34,2,34,34,2,2,2,51,34,34,34,2,34,2,34,2,1,34,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+	1,34,1,34,1,2,1,2,1,2,1,34,1,2,1,2,1,2,1,2,1,2,33,34,1,2,1,34,1,2,1,2,
+	1,34,33,34,1,2,1,2,34,1,2,1,2,1,2,33,34,33,34,1,34,1,2,1,34,34,33,34,1,34,1,2,
+	1,2,33,34,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,1,2,1,2,1,2,2,
+	2,1,1,2,1,2,1,1,2,1,1,1,2,2,1,1,1,1,2,1,1,2,1,1,1,2,2,2,1,1,2,1,
+	1,2,1,2,1,2,1,1,2,1,2,2,1,2,1,1,2,1,1,1,2,1,2,1,1,2,2,5,1,2,2,2,
+	5,5,5,5,1,3,2,1,3,2,1,3,2,1,34,1,34,1,34,1,34,1,34,1,34,1,34,1,34,2,1,2,
+	1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,1,3,2,1,2,1,1,1,2,1,2,1,2,1,2,
+	1,2,1,2,2,2,2,2,2,2,1,1,2,1,1,2,2,1,2,1,1,1,1,2,1,2,1,2,1,2,1,2,
+	2,34,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,5,2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	4,4,21,21,53,21,4,36,4,36,36,36,4,36,4,4,36,4,21,21,21,21,21,21,53,53,53,53,21,53,21,53,
+	4,4,4,4,4,21,21,21,21,21,21,21,4,21,4,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+	38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,1,2,1,2,4,21,1,2,128,128,4,2,2,2,18,1,
+	128,128,128,128,21,21,1,18,1,1,1,128,1,128,1,1,2,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+	33,33,128,33,33,33,33,33,33,33,1,1,2,2,2,2,2,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+	34,34,2,34,34,34,34,34,34,34,2,2,2,2,2,1,2,2,1,1,1,2,2,2,1,2,1,2,1,2,1,2,
+	2,2,2,2,1,2,19,1,2,1,1,2,2,1,1,1,1,33,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+	1,2,22,6,6,6,6,6,8,8,1,2,1,2,1,2,1,1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,
+	128,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,128,128,4,18,18,18,18,18,18,2,2,2,2,2,2,2,2,2,18,13,128,128,22,22,20,
+	128,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,13,6,18,6,6,18,6,6,18,6,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,128,128,5,
+	5,5,5,18,18,128,128,128,128,128,128,128,128,128,128,128,27,27,27,27,27,27,19,19,19,18,18,20,18,18,22,22,
+	6,6,6,6,6,6,6,6,6,6,6,18,27,18,18,18,4,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,
+	9,9,9,9,9,9,9,9,9,9,18,18,18,18,5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,18,5,6,6,6,6,6,6,6,27,22,6,6,6,6,6,6,4,4,6,6,22,6,6,6,6,5,5,
+	9,9,9,9,9,9,9,9,9,9,5,5,5,22,22,5,18,18,18,18,18,18,18,18,18,18,18,18,18,18,128,27,
+	5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,128,128,5,5,5,
+	5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,5,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,
+	6,6,6,6,4,4,22,18,18,18,4,128,128,6,20,20,5,5,5,5,5,5,6,6,6,6,4,6,6,6,6,6,
+	6,6,6,6,4,6,6,6,4,6,6,6,6,6,128,128,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,128,
+	5,5,5,5,5,5,5,5,5,6,6,6,128,128,18,128,5,5,5,5,5,5,5,5,5,5,5,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,21,5,5,5,5,5,5,128,27,27,128,128,128,128,128,128,6,6,6,6,6,6,6,6,
+	5,5,5,5,5,5,5,5,5,4,6,6,6,6,6,6,6,6,27,6,6,6,6,6,6,6,6,6,6,6,6,6,
+	6,6,6,7,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,7,6,5,7,7,
+	7,6,6,6,6,6,6,6,6,7,7,7,7,6,7,7,5,6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,
+	5,5,6,6,18,18,9,9,9,9,9,9,9,9,9,9,18,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,6,7,7,128,5,5,5,5,5,5,5,5,128,128,5,5,128,128,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,128,5,5,5,5,5,5,5,128,5,128,128,128,5,5,5,5,128,128,6,5,7,7,
+	7,6,6,6,6,128,128,7,7,128,128,7,7,6,5,128,128,128,128,128,128,128,128,7,128,128,128,128,5,5,128,5,
+	5,5,6,6,128,128,9,9,9,9,9,9,9,9,9,9,5,5,20,20,11,11,11,11,11,11,22,20,5,18,6,128,
+	128,6,6,7,128,5,5,5,5,5,5,128,128,128,128,5,5,128,5,5,128,5,5,128,5,5,128,128,6,128,7,7,
+	7,6,6,128,128,128,128,6,6,128,128,6,6,6,128,128,128,6,128,128,128,128,128,128,128,5,5,5,5,128,5,128,
+	128,128,128,128,128,128,9,9,9,9,9,9,9,9,9,9,6,6,5,5,5,6,18,128,128,128,128,128,128,128,128,128,
+	128,6,6,7,128,5,5,5,5,5,5,5,5,5,128,5,5,5,128,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,128,5,5,128,5,5,5,5,5,128,128,6,5,7,7,7,6,6,6,6,6,128,6,6,7,128,7,7,6,128,128,
+	5,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,18,20,128,128,128,128,128,128,128,5,6,6,6,6,6,6,
+	128,6,7,7,128,5,5,5,5,5,5,5,5,128,128,5,5,128,5,5,128,5,5,5,5,5,128,128,6,5,7,6,
+	7,6,6,6,6,128,128,7,7,128,128,7,7,6,128,128,128,128,128,128,128,6,6,7,128,128,128,128,5,5,128,5,
+	22,5,11,11,11,11,11,11,128,128,128,128,128,128,128,128,128,128,6,5,128,5,5,5,5,5,5,128,128,128,5,5,
+	5,128,5,5,5,5,128,128,128,5,5,128,5,128,5,5,128,128,128,5,5,128,128,128,5,5,5,128,128,128,5,5,
+	5,5,5,5,5,5,5,5,5,5,128,128,128,128,7,7,6,7,7,128,128,128,7,7,7,128,7,7,7,6,128,128,
+	5,128,128,128,128,128,128,7,128,128,128,128,128,128,128,128,11,11,11,22,22,22,22,22,22,20,22,128,128,128,128,128,
+	6,7,7,7,6,5,5,5,5,5,5,5,5,128,5,5,5,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,128,128,6,5,6,6,6,7,7,7,7,128,6,6,6,128,6,6,6,6,128,128,
+	128,128,128,128,128,6,6,128,5,5,5,128,128,5,128,128,128,128,128,128,128,128,128,18,11,11,11,11,11,11,11,22,
+	5,6,7,7,18,5,5,5,5,5,5,5,5,128,5,5,5,5,5,5,128,5,5,5,5,5,128,128,6,5,7,6,
+	7,7,7,7,7,128,6,7,7,128,7,7,6,6,128,128,128,128,128,128,128,7,7,128,128,128,128,128,128,5,5,128,
+	128,5,5,128,128,128,128,128,128,128,128,128,128,128,128,128,6,6,7,7,5,5,5,5,5,5,5,5,5,128,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,6,6,5,7,7,7,6,6,6,6,128,7,7,7,128,7,7,7,6,5,22,
+	128,128,128,128,5,5,5,7,11,11,11,11,11,11,11,5,11,11,11,11,11,11,11,11,11,22,5,5,5,5,5,5,
+	128,6,7,7,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,128,5,5,5,5,5,5,
+	5,5,128,5,5,5,5,5,5,5,5,5,128,5,128,128,5,5,5,5,5,5,5,128,128,128,6,128,128,128,128,7,
+	7,7,6,6,6,128,6,128,7,7,7,7,7,7,7,7,128,128,7,7,18,128,128,128,128,128,128,128,128,128,128,128,
+	128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,5,5,6,6,6,6,6,6,6,128,128,128,128,20,
+	5,5,5,5,5,5,4,6,6,6,6,6,6,6,6,18,9,9,9,9,9,9,9,9,9,9,18,18,128,128,128,128,
+	128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,5,5,128,5,128,5,5,5,5,5,128,5,5,5,5,
+	5,5,5,5,128,5,128,5,5,5,5,5,5,5,5,5,5,6,5,5,6,6,6,6,6,6,6,6,6,5,128,128,
+	5,5,5,5,5,128,4,128,6,6,6,6,6,6,128,128,9,9,9,9,9,9,9,9,9,9,128,128,5,5,5,5,
+	5,22,22,22,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,22,18,22,22,22,6,6,22,22,22,22,22,22,
+	9,9,9,9,9,9,9,9,9,9,11,11,11,11,11,11,11,11,11,11,22,6,22,6,22,6,14,15,14,15,7,7,
+	5,5,5,5,5,5,5,5,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,128,
+	128,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,6,6,6,6,6,18,6,6,5,5,5,5,5,6,6,6,
+	6,6,6,6,6,6,6,6,128,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,128,22,22,
+	22,22,22,22,22,22,6,22,22,22,22,22,22,128,22,22,18,18,18,18,18,22,22,22,22,18,18,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,5,7,7,6,6,6,6,7,6,6,6,6,6,6,7,6,6,7,7,6,6,5,
+	9,9,9,9,9,9,9,9,9,9,18,18,18,18,18,18,5,5,5,5,5,5,7,7,6,6,5,5,5,5,6,6,
+	6,5,7,7,7,5,5,7,7,7,7,7,7,7,5,5,5,6,6,6,6,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,6,7,7,6,6,7,7,7,7,7,7,6,5,7,9,9,9,9,9,9,9,9,9,9,7,7,7,6,22,22,
+	1,1,1,1,1,1,128,1,128,128,128,128,128,1,128,128,2,2,2,2,2,2,2,2,2,2,2,18,4,2,2,2,
+	101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,5,5,5,5,5,5,5,5,5,128,5,5,5,5,128,128,
+	5,5,5,5,5,5,5,128,5,128,5,5,5,5,128,128,5,128,5,5,5,5,128,128,5,5,5,5,5,5,5,128,
+	5,128,5,5,5,5,128,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,128,128,6,6,6,18,18,18,18,18,18,18,18,18,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,128,128,128,22,22,22,22,22,22,22,22,22,22,128,128,128,128,128,128,
+	1,1,1,1,1,1,128,128,2,2,2,2,2,2,128,128,13,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,22,18,5,23,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,14,15,128,128,128,5,5,5,5,5,5,5,5,5,5,5,18,18,18,10,10,
+	10,5,5,5,5,5,5,5,5,128,128,128,128,128,128,128,5,5,6,6,6,7,128,128,128,128,128,128,128,128,128,5,
+	5,5,6,6,7,18,18,128,128,128,128,128,128,128,128,128,5,5,6,6,128,128,128,128,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,128,5,5,5,128,6,6,128,128,128,128,128,128,128,128,128,128,128,128,
+	5,5,5,5,6,6,7,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,6,7,7,6,6,6,6,6,6,6,
+	6,6,6,6,18,18,18,4,18,18,18,20,5,6,128,128,9,9,9,9,9,9,9,9,9,9,128,128,128,128,128,128,
+	11,11,11,11,11,11,11,11,11,11,128,128,128,128,128,128,18,18,18,18,18,18,13,18,18,18,18,6,6,6,27,6,
+	5,5,5,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,128,128,128,128,128,
+	5,5,5,5,5,6,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,5,128,128,128,128,128,
+	5,5,5,5,5,5,128,128,128,128,128,128,128,128,128,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,
+	6,6,6,7,7,7,7,6,6,7,7,7,128,128,128,128,7,7,6,7,7,7,7,7,7,6,6,6,128,128,128,128,
+	22,128,128,128,18,18,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,
+	5,5,5,5,5,128,128,128,128,128,128,128,128,128,128,128,5,5,5,5,5,5,5,5,5,5,5,5,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,128,128,128,128,128,128,9,9,9,9,9,9,9,9,9,9,11,128,128,128,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,5,5,5,5,5,5,5,6,6,7,7,6,128,128,18,18,
+	5,5,5,5,5,7,6,7,6,6,6,6,6,6,6,128,6,7,6,7,7,6,6,6,6,6,6,6,6,7,7,7,
+	7,7,7,6,6,6,6,6,6,6,6,6,6,128,128,6,18,18,18,18,18,18,18,4,18,18,18,18,18,18,128,128,
+	6,6,6,6,6,6,6,6,6,6,6,6,6,6,8,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,128,
+	6,6,6,6,7,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,7,6,6,6,6,6,7,6,7,7,7,
+	7,7,6,7,7,5,5,5,5,5,5,5,5,128,128,128,18,22,22,22,22,22,22,22,22,22,22,6,6,6,6,6,
+	6,6,6,6,22,22,22,22,22,22,22,22,22,18,18,128,6,6,7,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,7,6,6,6,6,7,7,6,6,7,6,6,6,5,5,5,5,5,5,5,5,6,7,6,6,7,7,7,6,7,6,
+	6,6,7,7,128,128,128,128,128,128,128,128,18,18,18,18,5,5,5,5,7,7,7,7,7,7,7,7,6,6,6,6,
+	6,6,6,6,7,7,6,6,128,128,128,18,18,18,18,18,9,9,9,9,9,9,9,9,9,9,128,128,128,5,5,5,
+	5,5,5,5,5,5,5,5,4,4,4,4,4,4,18,18,2,2,2,2,2,2,2,2,2,128,128,128,128,128,128,128,
+	1,1,1,1,1,1,1,1,1,1,1,128,128,1,1,1,18,18,18,18,18,18,18,18,128,128,128,128,128,128,128,128,
+	6,6,6,18,6,6,6,6,6,6,6,6,6,6,6,6,6,7,6,6,6,6,6,6,6,5,5,5,5,6,5,5,
+	5,5,5,5,6,5,5,7,6,6,5,128,128,128,128,128,2,2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,
+	4,4,4,4,4,4,4,4,4,4,4,2,2,2,2,2,2,2,2,2,2,2,2,2,4,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,4,4,4,4,4,1,2,1,2,1,2,2,2,2,2,2,2,2,2,1,2,
+	2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,2,2,2,2,2,128,128,1,1,1,1,1,1,128,128,
+	2,2,2,2,2,2,2,2,128,1,128,1,128,1,128,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,128,128,
+	2,2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,2,2,2,2,2,128,2,2,1,1,1,1,3,21,2,21,
+	21,21,2,2,2,128,2,2,1,1,1,1,3,21,21,21,2,2,2,2,128,128,2,2,1,1,1,1,128,21,21,21,
+	2,2,2,2,2,2,2,2,1,1,1,1,1,21,21,21,128,128,2,2,2,128,2,2,1,1,1,1,3,21,21,128,
+	23,23,23,23,23,23,23,23,23,23,23,27,27,27,27,27,45,13,13,45,45,45,50,18,48,49,14,16,48,49,14,16,
+	50,50,50,18,50,50,50,50,24,25,27,27,27,27,27,23,50,18,50,50,18,50,18,18,18,16,17,50,18,18,50,12,
+	12,18,18,18,19,14,15,18,18,18,18,18,18,18,18,18,18,18,19,18,12,18,18,18,18,18,18,18,18,18,18,23,
+	27,27,27,27,27,128,27,27,27,27,27,27,27,27,27,27,11,4,128,128,43,11,11,11,11,11,19,19,19,14,15,36,
+	11,43,43,43,43,11,11,11,11,11,19,19,19,14,15,128,4,4,4,4,4,4,4,4,4,4,4,4,4,128,128,128,
+	20,20,20,20,20,20,20,20,20,84,20,20,52,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+	20,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,6,6,6,6,6,6,6,6,6,6,6,6,6,8,8,8,
+	8,6,8,8,8,6,6,6,6,6,6,6,6,6,6,6,6,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	22,22,1,54,22,54,22,1,22,54,2,1,1,1,2,2,1,1,1,34,22,1,54,22,19,1,1,1,1,1,22,22,
+	22,54,54,22,1,22,33,22,1,22,1,33,1,1,22,2,1,1,1,1,2,5,5,5,5,2,22,22,2,2,1,1,
+	19,19,19,19,19,1,2,2,2,2,22,19,22,22,2,22,11,11,11,43,43,11,11,11,11,11,11,43,43,43,43,11,
+	42,42,42,42,42,42,42,42,42,42,42,42,10,10,10,10,42,42,42,42,42,42,42,42,42,42,10,10,10,10,10,10,
+	10,10,10,1,2,10,10,10,10,43,22,22,128,128,128,128,51,51,51,51,51,54,54,54,54,54,19,19,22,22,22,22,
+	19,22,22,19,22,22,19,22,22,22,22,22,22,22,19,22,22,22,22,22,22,22,22,22,54,54,22,22,22,22,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,22,22,22,19,19,22,22,51,22,51,22,22,22,22,22,22,22,22,22,22,22,
+	22,22,22,22,22,22,22,54,22,22,22,22,22,22,22,22,22,22,22,22,19,19,19,19,19,19,19,19,19,19,19,19,
+	51,19,51,51,19,19,19,51,51,19,19,51,19,19,19,51,19,51,19,19,19,51,19,19,19,19,51,19,19,51,51,51,
+	51,19,19,51,19,51,19,51,51,51,51,51,51,19,51,19,19,19,19,19,51,51,51,51,19,19,19,19,51,51,19,19,
+	19,19,19,19,19,19,19,19,51,19,19,19,51,19,19,19,19,19,51,19,19,19,19,19,19,19,19,19,19,19,19,19,
+	51,51,19,19,51,51,51,51,19,19,51,51,19,19,51,51,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+	19,19,51,51,19,19,51,51,19,19,19,19,19,19,19,19,19,19,19,19,19,51,19,19,19,51,19,19,19,19,19,19,
+	19,19,19,19,19,51,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,51,
+	22,22,22,22,22,22,22,22,14,15,14,15,22,22,22,22,22,22,54,22,22,22,22,22,22,22,118,118,22,22,22,22,
+	19,19,22,22,22,22,22,22,22,110,111,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,19,22,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,19,19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22,22,22,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,22,19,19,19,19,19,19,22,22,22,22,22,22,22,118,118,118,118,22,22,22,
+	118,22,22,118,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,128,128,128,128,128,128,128,128,128,
+	22,22,22,22,22,22,22,22,22,22,22,128,128,128,128,128,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,
+	43,43,43,43,43,43,43,43,43,43,43,43,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,11,43,43,43,43,43,54,54,54,54,54,54,54,54,54,54,54,54,22,22,22,22,
+	54,54,54,54,22,22,22,22,22,22,22,22,22,22,22,22,22,22,54,54,54,54,22,22,22,22,22,22,22,22,22,22,
+	54,54,22,54,54,54,54,54,54,54,22,22,22,22,22,22,22,22,54,54,22,22,54,51,22,22,22,22,54,54,22,22,
+	54,51,22,22,22,22,54,54,54,22,22,54,22,22,54,54,54,54,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+	22,22,54,54,54,54,22,22,22,22,22,22,22,22,22,54,22,22,22,22,22,22,22,22,19,19,19,19,19,115,115,19,
+	22,22,22,22,22,54,54,22,22,54,22,22,22,22,54,54,22,22,22,22,118,118,22,22,22,22,22,22,54,22,54,22,
+	54,22,54,22,22,22,22,22,118,118,118,118,118,118,118,118,118,118,118,118,22,22,22,22,22,22,22,22,22,22,22,22,
+	54,54,22,54,54,54,22,54,54,54,54,22,54,54,22,51,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,118,
+	22,22,22,118,22,22,22,22,22,22,22,22,22,22,54,54,22,118,22,22,22,22,22,22,22,22,118,118,22,22,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,22,22,118,118,54,22,22,22,22,118,118,54,54,54,54,54,54,54,54,118,54,
+	54,54,54,54,118,54,54,54,54,54,54,54,54,54,54,54,54,54,22,54,22,22,22,22,54,54,118,54,54,54,54,54,
+	54,54,118,118,54,118,54,54,54,54,118,54,54,118,54,54,22,22,22,22,22,118,22,22,22,22,118,118,22,22,22,22,
+	22,22,22,22,22,22,22,22,118,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,54,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,22,118,22,118,22,22,22,22,118,118,118,22,118,22,22,22,22,22,22,22,22,
+	22,22,22,22,22,22,22,22,14,15,14,15,14,15,14,15,14,15,14,15,14,15,43,43,43,43,43,43,43,43,43,43,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,22,118,118,118,22,22,22,22,22,22,22,22,
+	118,22,22,22,22,22,22,22,22,22,22,22,22,22,22,118,19,19,19,19,19,14,15,19,19,19,19,19,19,19,19,19,
+	19,19,19,19,19,19,174,175,174,175,174,175,174,175,14,15,19,19,19,14,15,174,175,14,15,14,15,14,15,14,15,14,
+	15,14,15,14,15,14,15,14,15,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,14,15,14,15,19,19,19,19,
+	19,19,19,19,19,19,19,19,19,19,19,19,14,15,19,19,22,22,22,22,22,22,22,22,22,22,22,118,118,22,22,22,
+	19,19,19,19,19,22,22,19,19,19,19,19,19,22,22,22,118,22,22,22,22,118,54,54,54,54,22,22,22,22,22,22,
+	22,22,22,22,128,128,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,128,22,22,22,22,22,22,22,22,22,
+	1,2,1,1,1,2,2,1,2,1,2,1,2,1,1,1,1,2,1,2,2,1,2,2,2,2,2,2,4,4,1,1,
+	1,2,1,2,2,22,22,22,22,22,22,1,2,1,2,6,6,6,1,2,128,128,128,128,128,18,18,18,18,11,18,18,
+	2,2,2,2,2,2,128,2,128,128,128,128,128,2,128,128,5,5,5,5,5,5,5,5,128,128,128,128,128,128,128,4,
+	18,128,128,128,128,128,128,128,128,128,128,128,128,128,128,6,5,5,5,5,5,5,5,128,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,5,128,5,5,5,5,5,5,5,128,18,18,16,17,16,17,18,18,18,16,17,18,16,17,18,18,
+	18,18,18,18,18,18,18,13,18,18,13,18,16,17,18,18,16,17,14,15,14,15,14,15,14,15,18,18,18,18,18,4,
+	18,18,18,18,18,18,18,18,18,18,13,13,18,18,18,18,13,18,14,18,18,18,18,18,18,18,18,18,18,18,18,18,
+	22,22,18,18,18,14,15,14,15,14,15,14,15,13,128,128,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,
+	118,118,118,118,118,118,118,118,118,118,128,118,118,118,118,118,118,118,118,118,128,128,128,128,128,128,128,128,128,128,128,128,
+	118,118,118,118,118,118,128,128,128,128,128,128,128,128,128,128,118,118,118,118,118,118,118,118,118,118,118,118,128,128,128,128,
+	151,114,114,114,118,100,101,106,110,111,110,111,110,111,110,111,110,111,118,118,110,111,110,111,110,111,110,111,109,110,111,111,
+	118,106,106,106,106,106,106,106,106,106,102,102,102,102,103,103,109,100,100,100,100,100,118,118,106,106,106,100,101,114,118,22,
+	128,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,128,128,102,102,117,117,100,100,101,
+	109,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,114,100,100,100,101,
+	128,128,128,128,128,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,128,
+	118,118,107,107,107,107,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,128,
+	107,107,107,107,107,107,107,107,107,107,118,118,118,118,118,118,118,118,118,118,118,118,118,118,43,43,43,43,43,43,43,43,
+	118,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,101,101,101,101,101,100,101,101,101,101,101,101,101,101,101,101,
+	101,101,101,101,101,101,101,101,101,101,101,101,101,128,128,128,118,118,118,118,118,118,118,128,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,5,5,4,18,18,18,9,9,9,9,9,9,9,9,9,9,5,5,128,128,128,128,
+	1,2,1,2,1,2,1,2,1,2,1,2,1,2,5,6,8,8,8,18,6,6,6,6,6,6,6,6,6,6,18,4,
+	1,2,1,2,1,2,1,2,1,2,1,2,4,4,6,6,5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,
+	6,6,18,18,18,18,18,18,128,128,128,128,128,128,128,128,21,21,21,21,21,21,21,4,4,4,4,4,4,4,4,4,
+	21,21,1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+	4,2,2,2,2,2,2,2,2,1,2,1,2,1,1,2,1,2,1,2,1,2,1,2,4,21,21,1,2,1,2,5,
+	1,2,1,2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,1,1,1,1,2,
+	1,1,1,1,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,1,1,1,2,1,2,128,128,128,128,128,
+	1,2,128,2,128,2,1,2,1,2,128,128,128,128,128,128,128,128,4,4,4,1,2,5,4,4,2,5,5,5,5,5,
+	5,5,6,5,5,5,6,5,5,5,5,6,5,5,5,5,5,5,5,7,7,6,6,7,22,22,22,22,6,128,128,128,
+	11,11,11,11,11,11,22,22,20,22,128,128,128,128,128,128,5,5,5,5,18,18,18,18,128,128,128,128,128,128,128,128,
+	7,7,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,6,6,128,128,128,128,128,128,128,128,18,18,6,6,5,5,5,5,5,5,18,18,18,5,18,5,5,6,
+	5,5,5,5,5,5,6,6,6,6,6,6,6,6,18,18,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,
+	6,6,7,7,128,128,128,128,128,128,128,128,128,128,128,18,5,5,5,6,7,7,6,6,6,6,7,7,6,6,7,7,
+	7,18,18,18,18,18,18,18,18,18,18,18,18,18,128,4,9,9,9,9,9,9,9,9,9,9,128,128,128,128,18,18,
+	5,5,5,5,5,6,4,5,5,5,5,5,5,5,5,5,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,128,
+	5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,7,6,6,7,7,6,6,128,128,128,128,128,128,128,128,128,
+	5,5,5,6,5,5,5,5,5,5,5,5,6,7,128,128,9,9,9,9,9,9,9,9,9,9,128,128,18,18,18,18,
+	4,5,5,5,5,5,5,22,22,22,5,7,6,7,5,5,6,5,6,6,6,5,5,6,6,5,5,5,5,5,6,6,
+	5,6,5,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,5,5,4,18,18,
+	5,5,5,5,5,5,5,5,5,5,5,7,6,6,7,7,18,18,5,4,4,7,6,128,128,128,128,128,128,128,128,128,
+	128,5,5,5,5,5,5,128,128,5,5,5,5,5,5,128,128,5,5,5,5,5,5,128,128,128,128,128,128,128,128,128,
+	2,2,2,2,2,2,2,2,2,2,2,21,4,4,4,4,2,2,2,2,2,2,2,2,2,4,21,21,128,128,128,128,
+	5,5,5,7,7,6,7,7,6,7,7,18,7,6,128,128,101,101,101,101,128,128,128,128,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,5,128,128,128,128,5,5,5,5,5,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+	61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,101,101,101,101,101,101,101,101,101,101,101,101,101,101,128,128,
+	101,101,101,101,101,101,101,101,101,101,128,128,128,128,128,128,2,2,2,2,2,2,2,128,128,128,128,128,128,128,128,128,
+	128,128,128,2,2,2,2,2,128,128,128,128,128,5,6,5,5,5,5,5,5,5,5,5,5,19,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,128,5,5,5,5,5,128,5,128,5,5,128,5,5,128,5,5,5,5,5,5,5,5,5,5,
+	5,5,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	128,128,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,15,14,
+	128,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,128,128,128,128,128,22,
+	5,5,5,5,5,5,5,5,5,5,5,5,20,22,22,22,114,114,114,114,114,114,114,110,111,114,128,128,128,128,128,128,
+	114,109,109,108,108,110,111,110,111,110,111,110,111,110,111,110,111,110,111,110,111,114,114,110,111,114,114,114,114,108,108,108,
+	114,114,114,128,114,114,114,114,109,110,111,110,111,110,111,114,114,114,115,109,115,115,115,128,114,116,114,114,128,128,128,128,
+	5,5,5,5,5,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,27,
+	128,146,146,146,148,146,146,146,142,143,146,147,146,141,146,146,137,137,137,137,137,137,137,137,137,137,146,146,147,147,147,146,
+	146,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,142,146,143,149,140,
+	149,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,142,147,143,147,142,
+	143,82,78,79,82,82,69,69,69,69,69,69,69,69,69,69,68,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+	69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,68,68,
+	69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,128,128,128,69,69,69,69,69,69,128,128,69,69,69,69,69,69,
+	128,128,69,69,69,69,69,69,128,128,69,69,69,128,128,128,148,148,147,149,150,148,148,128,86,83,83,83,83,86,86,128,
+	128,128,128,128,128,128,128,128,128,27,27,27,22,54,128,128,5,5,5,5,5,5,5,5,5,5,5,5,128,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,5,128,5,5,128,5,18,18,18,128,128,128,128,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,128,128,128,22,22,22,22,22,22,22,22,22,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,11,11,11,11,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,11,22,22,22,128,
+	22,22,22,22,22,22,22,22,22,22,22,22,22,128,128,128,22,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	22,22,22,22,22,22,22,22,22,22,22,22,22,6,128,128,6,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	11,11,11,11,11,11,11,11,11,11,11,11,128,128,128,128,11,11,11,11,128,128,128,128,128,128,128,128,128,5,5,5,
+	5,10,5,5,5,5,5,5,5,5,10,128,128,128,128,128,5,5,5,5,5,5,6,6,6,6,6,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,18,5,5,5,5,128,128,128,128,5,5,5,5,5,5,5,5,
+	18,10,10,10,10,10,128,128,128,128,128,128,128,128,128,128,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+	1,1,1,1,128,128,128,128,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,128,128,128,128,
+	5,5,5,5,5,5,5,5,128,128,128,128,128,128,128,128,5,5,5,5,128,128,128,128,128,128,128,128,128,128,128,18,
+	1,1,1,1,1,1,1,1,1,1,1,128,1,1,1,1,1,1,1,128,1,1,128,2,2,2,2,2,2,2,2,2,
+	2,2,128,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,128,2,2,2,2,2,2,2,128,2,2,128,128,128,
+	4,4,4,4,4,4,128,4,4,4,4,4,4,4,4,4,4,128,4,4,4,4,4,4,4,4,4,128,128,128,128,128,
+	5,5,5,5,5,5,128,128,5,128,5,5,5,5,5,5,5,5,5,5,5,5,128,5,5,128,128,128,5,128,128,5,
+	5,5,5,5,5,5,128,18,11,11,11,11,11,11,11,11,5,5,5,5,5,5,5,22,22,11,11,11,11,11,11,11,
+	128,128,128,128,128,128,128,11,11,11,11,11,11,11,11,11,5,5,5,128,5,5,128,128,128,128,128,11,11,11,11,11,
+	5,5,5,5,5,5,11,11,11,11,11,11,128,128,128,18,5,5,5,5,5,5,5,5,5,5,128,128,128,128,128,18,
+	5,5,5,5,5,5,5,5,128,128,128,128,11,11,5,5,128,128,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+	5,6,6,6,128,6,6,128,128,128,128,128,6,6,6,6,5,5,5,5,128,5,5,5,128,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,128,128,6,6,6,128,128,128,128,6,11,11,11,11,11,11,11,11,11,128,128,128,128,128,128,128,
+	18,18,18,18,18,18,18,18,18,128,128,128,128,128,128,128,5,5,5,5,5,5,5,5,5,5,5,5,5,11,11,18,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,11,11,11,5,5,5,5,5,5,5,5,22,5,5,5,5,5,5,5,
+	5,5,5,5,5,6,6,128,128,128,128,11,11,11,11,11,18,18,18,18,18,18,18,128,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,128,128,128,18,18,18,18,18,18,18,5,5,5,5,5,5,128,128,11,11,11,11,11,11,11,11,
+	5,5,5,128,128,128,128,128,11,11,11,11,11,11,11,11,5,5,128,128,128,128,128,128,128,18,18,18,18,128,128,128,
+	128,128,128,128,128,128,128,128,128,11,11,11,11,11,11,11,1,1,1,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	2,2,2,128,128,128,128,128,128,128,11,11,11,11,11,11,5,5,5,5,6,6,6,6,128,128,128,128,128,128,128,128,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,128,5,5,5,5,5,5,5,5,5,5,128,6,6,13,128,128,
+	5,5,128,128,128,128,128,128,128,128,128,128,128,128,128,128,11,11,11,11,11,11,11,5,128,128,128,128,128,128,128,128,
+	6,11,11,11,11,18,18,18,18,18,128,128,128,128,128,128,5,5,6,6,6,6,18,18,18,18,128,128,128,128,128,128,
+	5,5,5,5,5,11,11,11,11,11,11,11,128,128,128,128,7,6,7,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,18,18,18,18,18,18,18,128,128,
+	11,11,11,11,11,11,9,9,9,9,9,9,9,9,9,9,6,5,5,6,6,5,128,128,128,128,128,128,128,128,128,6,
+	7,7,7,6,6,6,6,7,7,6,6,18,18,27,18,18,18,18,6,128,128,128,128,128,128,128,128,128,128,27,128,128,
+	6,6,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,7,6,6,6,
+	6,6,6,6,6,128,9,9,9,9,9,9,9,9,9,9,18,18,18,18,5,7,7,5,128,128,128,128,128,128,128,128,
+	5,5,5,6,18,18,5,128,128,128,128,128,128,128,128,128,5,5,5,7,7,7,6,6,6,6,6,6,6,6,6,7,
+	7,5,5,5,5,18,18,18,18,6,6,6,6,18,7,6,9,9,9,9,9,9,9,9,9,9,5,18,5,18,18,18,
+	128,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,128,128,128,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,6,6,6,7,7,6,7,6,6,18,18,18,18,18,18,6,128,
+	5,5,5,5,5,5,5,128,5,128,5,5,5,5,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,5,
+	5,5,5,5,5,5,5,5,5,18,128,128,128,128,128,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+	7,7,7,6,6,6,6,6,6,6,6,128,128,128,128,128,6,6,7,7,128,5,5,5,5,5,5,5,5,128,128,5,
+	5,128,5,5,128,5,5,5,5,5,128,6,6,5,7,7,6,7,7,7,7,128,128,7,7,128,128,7,7,7,128,128,
+	5,128,128,128,128,128,128,7,128,128,128,128,128,5,5,5,5,5,7,7,128,128,6,6,6,6,6,6,6,128,128,128,
+	6,6,6,6,6,128,128,128,128,128,128,128,128,128,128,128,5,5,5,5,5,7,7,7,6,6,6,6,6,6,6,6,
+	7,7,6,6,6,7,6,5,5,5,5,18,18,18,18,18,9,9,9,9,9,9,9,9,9,9,18,18,128,18,6,5,
+	7,7,7,6,6,6,6,6,6,7,6,7,7,7,7,6,6,7,6,6,5,5,18,5,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,6,6,6,6,128,128,7,7,7,7,6,6,7,6,
+	6,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,5,5,5,5,6,6,128,128,
+	7,7,7,6,6,6,6,6,6,6,6,7,7,6,7,6,6,18,18,18,5,128,128,128,128,128,128,128,128,128,128,128,
+	18,18,18,18,18,18,18,18,18,18,18,18,18,128,128,128,5,5,5,5,5,5,5,5,5,5,5,6,7,6,7,7,
+	6,6,6,6,6,6,7,6,5,18,128,128,128,128,128,128,7,7,6,6,6,6,7,6,6,6,6,6,128,128,128,128,
+	9,9,9,9,9,9,9,9,9,9,11,11,18,18,18,22,6,6,6,6,6,6,6,6,7,6,6,18,128,128,128,128,
+	11,11,11,128,128,128,128,128,128,128,128,128,128,128,128,5,5,5,5,5,5,5,5,128,128,5,128,128,5,5,5,5,
+	5,5,5,5,128,5,5,128,5,5,5,5,5,5,5,5,7,7,7,7,7,7,128,7,7,128,128,6,6,7,6,5,
+	7,5,7,6,18,18,18,128,128,128,128,128,128,128,128,128,5,5,5,5,5,5,5,5,128,128,5,5,5,5,5,5,
+	5,7,7,7,6,6,6,6,128,128,6,6,7,7,7,7,6,5,18,5,7,128,128,128,128,128,128,128,128,128,128,128,
+	5,6,6,6,6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,6,6,6,6,6,6,7,5,6,6,6,6,18,
+	18,18,18,18,18,18,18,6,128,128,128,128,128,128,128,128,5,6,6,6,6,6,6,7,7,6,6,6,5,5,5,5,
+	5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,6,6,7,6,6,18,18,18,5,18,18,
+	18,18,18,128,128,128,128,128,128,128,128,128,128,128,128,128,6,6,6,6,6,6,6,128,6,6,6,6,6,6,7,6,
+	5,18,18,18,18,18,128,128,128,128,128,128,128,128,128,128,18,18,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+	128,128,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,128,7,6,6,6,6,6,6,
+	6,7,6,6,7,6,6,128,128,128,128,128,128,128,128,128,5,5,5,5,5,5,5,128,5,5,128,5,5,5,5,5,
+	5,6,6,6,6,6,6,128,128,128,6,128,6,6,128,6,6,6,6,6,6,6,5,6,128,128,128,128,128,128,128,128,
+	5,5,5,5,5,5,128,5,5,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,7,7,7,7,7,128,
+	6,6,128,7,7,6,7,6,5,128,128,128,128,128,128,128,5,5,5,6,6,7,7,18,18,128,128,128,128,128,128,128,
+	11,11,11,11,11,22,22,22,22,22,22,22,22,20,20,20,20,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+	22,22,128,128,128,128,128,128,128,128,128,128,128,128,128,18,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,128,
+	18,18,18,18,18,128,128,128,128,128,128,128,128,128,128,128,5,5,5,5,128,128,128,128,128,128,128,128,128,128,128,128,
+	5,18,18,128,128,128,128,128,128,128,128,128,128,128,128,128,27,27,27,27,27,27,27,27,27,128,128,128,128,128,128,128,
+	6,6,6,6,6,18,128,128,128,128,128,128,128,128,128,128,6,6,6,6,6,6,6,18,18,18,18,18,22,22,22,22,
+	4,4,4,4,18,22,128,128,128,128,128,128,128,128,128,128,9,9,9,9,9,9,9,9,9,9,128,11,11,11,11,11,
+	11,11,128,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,128,128,128,128,128,5,5,5,
+	11,11,11,11,11,11,11,18,18,18,18,128,128,128,128,128,5,5,5,5,5,5,5,5,5,5,5,128,128,128,128,6,
+	5,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	7,7,7,7,7,7,7,7,128,128,128,128,128,128,128,6,6,6,6,4,4,4,4,4,4,4,4,4,4,4,4,4,
+	100,100,114,100,102,128,128,128,128,128,128,128,128,128,128,128,103,103,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	101,101,101,101,101,101,101,101,128,128,128,128,128,128,128,128,101,101,101,101,101,101,128,128,128,128,128,128,128,128,128,128,
+	101,101,101,101,101,101,101,101,101,128,128,128,128,128,128,128,100,100,100,100,128,100,100,100,100,100,100,100,128,100,100,128,
+	101,101,101,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,101,101,101,101,128,128,128,128,128,128,128,128,
+	101,101,101,101,101,101,101,101,101,101,101,101,128,128,128,128,5,5,5,5,5,5,5,5,5,5,128,128,22,6,6,18,
+	27,27,27,27,128,128,128,128,128,128,128,128,128,128,128,128,6,6,6,6,6,6,6,6,6,6,6,6,6,6,128,128,
+	6,6,6,6,6,6,6,128,128,128,128,128,128,128,128,128,22,22,22,22,128,128,128,128,128,128,128,128,128,128,128,128,
+	22,22,22,22,22,22,128,128,128,128,128,128,128,128,128,128,22,22,22,22,22,22,22,128,128,22,22,22,22,22,22,22,
+	22,22,22,22,22,7,7,6,6,6,22,22,22,7,7,7,7,7,7,27,27,27,27,27,27,27,27,6,6,6,6,6,
+	6,6,6,22,22,6,6,6,6,6,6,6,22,22,22,22,22,22,22,22,22,22,22,22,22,22,6,6,6,6,22,22,
+	22,22,6,6,6,22,128,128,128,128,128,128,128,128,128,128,11,11,11,11,128,128,128,128,128,128,128,128,128,128,128,128,
+	1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,128,2,2,2,2,2,2,2,2,2,2,
+	1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,128,1,1,
+	128,128,1,128,128,1,1,128,128,1,1,1,1,128,1,1,1,1,1,1,1,1,2,2,2,2,128,2,128,2,2,2,
+	2,2,2,2,128,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,128,1,1,1,1,128,128,1,1,1,
+	1,1,1,1,1,128,1,1,1,1,1,1,1,128,2,2,2,2,2,2,2,2,2,2,1,1,128,1,1,1,1,128,
+	1,1,1,1,1,128,1,128,128,128,1,1,1,1,1,1,1,128,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,128,128,1,1,1,1,1,1,1,1,1,19,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,19,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+	1,1,1,1,1,1,1,1,1,1,1,19,2,2,2,2,2,2,2,2,2,19,2,2,2,2,2,2,1,1,1,1,
+	1,1,1,1,1,19,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,19,
+	2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,19,
+	2,2,2,2,2,2,2,2,2,19,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,19,2,2,2,2,2,2,
+	2,2,2,19,2,2,2,2,2,2,1,2,128,128,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	6,6,6,6,6,6,6,22,22,22,22,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,22,22,22,
+	22,22,22,22,22,6,22,22,22,22,22,22,22,22,22,22,22,22,22,22,6,22,22,18,18,18,18,18,128,128,128,128,
+	128,128,128,128,128,128,128,128,128,128,128,6,6,6,6,6,2,2,2,2,2,2,2,2,2,2,5,2,2,2,2,2,
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,128,6,6,6,6,6,6,6,128,6,6,6,6,6,6,6,6,
+	6,6,6,6,6,6,6,6,6,128,128,6,6,6,6,6,6,6,128,6,6,128,6,6,6,6,6,128,128,128,128,128,
+	6,6,6,6,6,6,6,4,4,4,4,4,4,4,128,128,9,9,9,9,9,9,9,9,9,9,128,128,128,128,5,22,
+	5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,128,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,
+	9,9,9,9,9,9,9,9,9,9,128,128,128,128,128,20,5,5,5,5,5,5,5,128,5,5,5,5,128,5,5,128,
+	5,5,5,5,5,128,128,11,11,11,11,11,11,11,11,11,2,2,2,2,6,6,6,6,6,6,6,4,128,128,128,128,
+	11,11,11,11,11,11,11,11,11,11,11,11,22,11,11,11,20,11,11,11,11,128,128,128,128,128,128,128,128,128,128,128,
+	11,11,11,11,11,11,11,11,11,11,11,11,11,11,22,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,128,128,
+	5,5,5,5,128,5,5,5,5,5,5,5,5,5,5,5,128,5,5,128,5,128,128,5,128,5,5,5,5,5,5,5,
+	5,5,5,128,5,5,5,5,128,5,128,5,128,128,128,128,128,128,5,128,128,128,128,5,128,5,128,5,128,5,5,5,
+	128,5,5,128,5,128,128,5,128,5,128,5,128,5,128,5,128,5,5,128,5,128,128,5,5,5,5,128,5,5,5,5,
+	5,5,5,128,5,5,5,5,128,5,5,5,5,128,5,128,5,5,5,5,5,5,5,5,5,5,128,5,5,5,5,5,
+	128,5,5,5,128,5,5,5,5,5,128,5,5,5,5,5,19,19,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	22,22,22,22,118,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,128,128,128,128,
+	22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,128,128,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+	128,22,22,22,22,22,22,22,22,22,22,22,22,22,22,118,43,43,43,43,43,43,43,43,43,43,43,11,11,22,22,22,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,22,22,54,54,54,54,54,54,54,54,54,54,22,22,22,22,22,22,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,54,118,54,54,118,118,118,118,118,118,118,118,118,118,54,54,54,54,54,
+	54,54,54,54,54,54,54,54,54,54,54,54,54,22,128,128,128,128,128,128,128,128,22,22,22,22,22,22,22,22,22,22,
+	118,118,118,128,128,128,128,128,128,128,128,128,128,128,128,128,118,118,118,118,118,118,118,118,118,128,128,128,128,128,128,128,
+	118,118,128,128,128,128,128,128,128,128,128,128,128,128,128,128,118,22,22,22,22,22,22,22,22,22,22,22,22,118,118,118,
+	118,118,118,118,118,118,22,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,22,118,118,
+	118,118,118,118,118,118,118,118,118,118,118,22,22,22,22,118,118,22,22,22,118,22,22,22,118,118,118,117,117,117,117,117,
+	118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,22,118,22,118,118,118,118,118,118,118,118,118,118,118,118,118,118,
+	118,118,118,118,118,118,118,118,118,118,118,118,118,22,22,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,118,118,118,118,22,118,118,118,118,118,118,118,118,22,22,22,22,22,22,22,22,
+	22,22,22,22,22,22,22,22,22,22,118,22,22,22,22,22,22,22,22,22,22,118,118,22,22,22,22,22,22,22,22,22,
+	22,22,22,22,22,22,22,22,22,22,22,118,118,118,118,118,118,118,118,118,118,118,22,22,22,22,22,22,118,22,22,22,
+	118,118,118,22,22,118,118,118,128,128,128,128,128,118,118,118,22,22,22,22,22,22,22,22,22,22,22,118,118,128,128,128,
+	22,22,22,22,118,118,118,118,118,118,118,118,118,128,128,128,22,22,22,22,22,22,22,22,22,128,128,128,128,128,128,128,
+	118,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,22,22,22,22,22,22,22,22,128,128,128,128,128,128,128,128,
+	22,22,22,22,22,22,22,22,22,22,22,22,22,22,128,128,22,22,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	22,22,22,22,22,22,22,22,22,22,22,22,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,22,118,118,118,118,
+	118,118,118,118,118,128,128,128,118,118,118,118,118,128,128,128,118,118,118,118,118,118,118,118,118,118,118,118,118,128,128,128,
+	118,118,118,118,118,118,118,118,118,118,118,128,128,128,128,128,118,118,118,118,118,118,118,118,118,118,128,128,128,128,128,128,
+	118,118,118,118,118,118,118,118,128,128,128,128,128,128,128,128,22,22,22,128,22,22,22,22,22,22,22,22,22,22,22,22,
+	101,101,128,128,128,128,128,128,128,128,128,128,128,128,128,128,101,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	101,101,101,101,101,101,101,101,101,101,101,128,128,128,128,128,128,27,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,61,61,61,61,61,61,61,61,61,61,61,61,61,61,128,128,
+};
+const i32 UnicodeFoldDeltas[99] = {
+	0,-42319,-42315,-42308,-42307,-42305,-42282,-42280,-42261,-42258,-38864,-35384,-35332,-10815,-10783,-10782,
+	-10780,-10749,-10743,-10727,-8383,-8262,-7615,-7517,-7173,-6222,-6221,-6212,-6211,-6210,-6204,-6180,
+	-3814,-3008,-268,-195,-163,-130,-128,-126,-121,-112,-100,-97,-86,-74,-64,-60,
+	-58,-56,-54,-48,-30,-25,-22,-15,-9,-8,-7,1,2,8,15,16,
+	26,28,32,34,37,38,39,40,48,63,64,69,71,79,80,116,
+	202,203,205,206,207,209,210,211,213,214,217,218,219,775,928,7264,
+	10792,10795,35267,
+};
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _BASE_UNICODE_TABLES_H
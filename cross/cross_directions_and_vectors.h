@@ -0,0 +1,57 @@
+/*
+File:   cross_directions_and_vectors.h
+Author: Taylor Robbins
+Date:   10\19\2026
+*/
+
+#ifndef _CROSS_DIRECTIONS_AND_VECTORS_H
+#define _CROSS_DIRECTIONS_AND_VECTORS_H
+
+//NOTE: Intentionally no includes here
+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE v2i ToV2iFromDir2(Dir2 dir2);
+	PIG_CORE_INLINE v2i ToV2iFromDir2Ex(Dir2Ex dir2ex);
+	PIG_CORE_INLINE v3i ToV3iFromDir3(Dir3 dir3);
+#endif
+
+#if PIG_CORE_IMPLEMENTATION
+
+PEXPI v2i ToV2iFromDir2(Dir2 dir2)
+{
+	v2i result = V2i_Zero;
+	if (IsFlagSet(dir2, Dir2_Right)) { result.X += 1; }
+	if (IsFlagSet(dir2, Dir2_Left))  { result.X -= 1; }
+	if (IsFlagSet(dir2, Dir2_Down))  { result.Y += 1; }
+	if (IsFlagSet(dir2, Dir2_Up))    { result.Y -= 1; }
+	return result;
+}
+PEXPI v2i ToV2iFromDir2Ex(Dir2Ex dir2ex)
+{
+	v2i result = V2i_Zero;
+	if (IsFlagSet(dir2ex, Dir2Ex_Right)) { result.X += 1; }
+	if (IsFlagSet(dir2ex, Dir2Ex_Left))  { result.X -= 1; }
+	if (IsFlagSet(dir2ex, Dir2Ex_Down))  { result.Y += 1; }
+	if (IsFlagSet(dir2ex, Dir2Ex_Up))    { result.Y -= 1; }
+	if (IsFlagSet(dir2ex, Dir2Ex_TopLeft))     { result.X -= 1; result.Y -= 1; }
+	if (IsFlagSet(dir2ex, Dir2Ex_TopRight))    { result.X += 1; result.Y -= 1; }
+	if (IsFlagSet(dir2ex, Dir2Ex_BottomRight)) { result.X += 1; result.Y += 1; }
+	if (IsFlagSet(dir2ex, Dir2Ex_BottomLeft))  { result.X -= 1; result.Y += 1; }
+	return result;
+}
+
+PEXPI v3i ToV3iFromDir3(Dir3 dir3)
+{
+	v3i result = V3i_Zero;
+	if (IsFlagSet(dir3, Dir3_Right))    { result.X += 1; }
+	if (IsFlagSet(dir3, Dir3_Left))     { result.X -= 1; }
+	if (IsFlagSet(dir3, Dir3_Down))     { result.Y -= 1; }
+	if (IsFlagSet(dir3, Dir3_Up))       { result.Y += 1; }
+	if (IsFlagSet(dir3, Dir3_Forward))  { result.Z += 1; }
+	if (IsFlagSet(dir3, Dir3_Backward)) { result.Z -= 1; }
+	return result;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _CROSS_DIRECTIONS_AND_VECTORS_H
@@ -128,39 +128,26 @@ PEXP Str8 StrReplace(Arena* arena, Str8 str, Str8 target, Str8 replacement, bool
 	{
 		uxx numBytesNeeded = 0;
 		
-		for (uxx bIndex = 0; bIndex < str.length; bIndex++)
+		//MemFindBytes jumps straight from one match to the next, the bytes in between are copied as one span
+		uxx bIndex = 0;
+		while (bIndex < str.length)
 		{
-			if (bIndex + target.length <= str.length)
+			uxx matchIndex = bIndex + MemFindBytes(str.chars + bIndex, str.length - bIndex, target.chars, target.length);
+			uxx spanLength = ((matchIndex < str.length) ? matchIndex : str.length) - bIndex;
+			if (result.chars != nullptr && spanLength > 0)
 			{
-				if (MyMemEquals(str.chars + bIndex, target.chars, target.length))
-				{
-					if (result.chars != nullptr)
-					{
-						Assert(numBytesNeeded + replacement.length <= result.length);
-						MyMemCopy(&result.chars[numBytesNeeded], replacement.chars, replacement.length);
-					}
-					numBytesNeeded += replacement.length;
-					bIndex += target.length-1;
-				}
-				else
-				{
-					if (result.chars != nullptr)
-					{
-						Assert(numBytesNeeded+1 <= result.length);
-						result.chars[numBytesNeeded] = str.chars[bIndex];
-					}
-					numBytesNeeded += 1;
-				}
+				Assert(numBytesNeeded + spanLength <= result.length);
+				MyMemCopy(&result.chars[numBytesNeeded], &str.chars[bIndex], spanLength);
 			}
-			else
+			numBytesNeeded += spanLength;
+			if (matchIndex >= str.length) { break; }
+			if (result.chars != nullptr && replacement.length > 0)
 			{
-				if (result.chars != nullptr)
-				{
-					Assert(numBytesNeeded+1 <= result.length);
-					result.chars[numBytesNeeded] = str.chars[bIndex];
-				}
-				numBytesNeeded += 1;
+				Assert(numBytesNeeded + replacement.length <= result.length);
+				MyMemCopy(&result.chars[numBytesNeeded], replacement.chars, replacement.length);
 			}
+			numBytesNeeded += replacement.length;
+			bIndex = matchIndex + target.length;
 		}
 		
 		if (pass == 0)
@@ -28,83 +28,38 @@ Date:   01\17\2025
 // +--------------------------------------------------------------+
 #if PIG_CORE_IMPLEMENTATION
 
-//TODO: This function isn't fully implemented, it just casts each 16-bit character to u32
+//NOTE: Unpaired surrogates in usc2Str are converted to U+FFFD (see base_unicode_convert.h)
+//If arena is nullptr then only the length of the result is calculated
 PEXP Str8 ConvertUcs2StrToUtf8(Arena* arena, Str16 usc2Str, bool addNullTerm)
 {
 	Assert(usc2Str.pntr != nullptr || usc2Str.length == 0);
-	u8 encodeBuffer[UTF8_MAX_CHAR_SIZE];
 	Str8 result = Str8_Empty;
-	for (u8 pass = 0; pass < 2; pass++)
-	{
-		uxx byteIndex = 0;
-		
-		for (uxx cIndex = 0; cIndex < usc2Str.length; cIndex++)
-		{
-			char16_t wideChar = usc2Str.chars[cIndex];
-			//TODO: Do better than casting wideChar to u32! We need to implement GetCodepointForUcs2
-			u8 encodeSize = GetUtf8BytesForCode((u32)wideChar, &encodeBuffer[0], false);
-			if (encodeSize == 0) { return result; }
-			if (result.chars != nullptr)
-			{
-				Assert(result.length >= byteIndex + encodeSize);
-				MyMemCopy(&result.chars[byteIndex], &encodeBuffer[0], encodeSize);
-			}
-			byteIndex += encodeSize;
-		}
-		
-		if (pass == 0)
-		{
-			result.length = byteIndex;
-			if (arena == nullptr) { return result; }
-			result.chars = AllocArray(char, arena, result.length + (addNullTerm ? 1 : 0));
-			NotNull(result.chars);
-		}
-		else
-		{
-			Assert(byteIndex == result.length);
-			if (addNullTerm) { result.chars[result.length] = '\0'; }
-		}
-	}
+	result.length = GetUtf8LengthForUcs2((const u16*)usc2Str.chars, usc2Str.length);
+	if (arena == nullptr) { return result; }
+	result.chars = AllocArray(char, arena, result.length + (addNullTerm ? 1 : 0));
+	NotNull(result.chars);
+	uxx numBytesWritten = Ucs2ToUtf8((const u16*)usc2Str.chars, usc2Str.length, (u8*)result.chars);
+	Assert(numBytesWritten == result.length);
+	UNUSED(numBytesWritten);
+	if (addNullTerm) { result.chars[result.length] = '\0'; }
 	return result;
 }
 
+//Returns Str16_Empty if utf8Str is not valid UTF-8
+//If arena is nullptr then only the length of the result is calculated
 PEXP Str16 ConvertUtf8StrToUcs2(Arena* arena, Str8 utf8Str, bool addNullTerm)
 {
 	NotNullStr(utf8Str);
-	u16 encodeBuffer[UCS2_MAX_CHAR_SIZE];
 	Str16 result = Str16_Empty;
-	for (u8 pass = 0; pass < 2; pass++)
-	{
-		uxx wordIndex = 0;
-		
-		for (uxx cIndex = 0; cIndex < utf8Str.length; cIndex++)
-		{
-			u32 codepoint;
-			u8 codepointSize = GetCodepointForUtf8Str(utf8Str, cIndex, &codepoint);
-			if (codepointSize == 0) { return result; }
-			u8 numWords = GetUcs2WordsForCode(codepoint, &encodeBuffer[0], false);
-			if (numWords == 0) { return result; }
-			if (result.chars != nullptr)
-			{
-				Assert(result.length >= wordIndex + numWords);
-				MyMemCopy(&result.chars[wordIndex], &encodeBuffer[0], numWords * sizeof(u16));
-			}
-			wordIndex += numWords;
-		}
-		
-		if (pass == 0)
-		{
-			result.length = wordIndex;
-			if (arena == nullptr) { return result; }
-			result.chars = AllocArray(char16_t, arena, result.length + (addNullTerm ? 1 : 0));
-			NotNull(result.chars);
-		}
-		else
-		{
-			Assert(wordIndex == result.length);
-			if (addNullTerm) { result.chars[result.length] = 0; }
-		}
-	}
+	if (!IsValidUtf8(utf8Str.chars, utf8Str.length, nullptr)) { return result; }
+	result.length = GetUcs2LengthForUtf8(utf8Str.chars, utf8Str.length);
+	if (arena == nullptr) { return result; }
+	result.chars = AllocArray(char16_t, arena, result.length + (addNullTerm ? 1 : 0));
+	NotNull(result.chars);
+	uxx numWordsWritten = Utf8ToUcs2(utf8Str.chars, utf8Str.length, (u16*)result.chars);
+	Assert(numWordsWritten == result.length);
+	UNUSED(numWordsWritten);
+	if (addNullTerm) { result.chars[result.length] = 0; }
 	return result;
 }
 
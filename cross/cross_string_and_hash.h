@@ -22,6 +22,14 @@ Date:   01\15\2025
 	PIG_CORE_INLINE u32 MeowHashStrU32(Str8 string);
 	PIG_CORE_INLINE u64 MeowHashStrU64(Str8 string);
 	PIG_CORE_INLINE Hash128 MeowHashStr128(Str8 string);
+	PIG_CORE_INLINE u32 PigHashStrU32(Str8 string);
+	PIG_CORE_INLINE u64 PigHashStrU64(Str8 string);
+	PIG_CORE_INLINE u64 PigHashStrU64Ex(Str8 string, u64 seed);
+	PIG_CORE_INLINE Hash128 PigHashStr128(Str8 string);
+	PIG_CORE_INLINE void PigHashStreamAddStr(PigHashStream* stream, Str8 string);
+	#if MEOW_HASH_AVAILABLE
+	PIG_CORE_INLINE void MeowHashStreamAddStr(MeowHashStream* stream, Str8 string);
+	#endif
 #endif //!PIG_CORE_IMPLEMENTATION
 
 // +--------------------------------------------------------------+
@@ -67,8 +75,33 @@ PEXPI Hash128 MeowHashStr128(Str8 string)
 {
 	return MeowHash128(string.pntr, string.length);
 }
+PEXPI void MeowHashStreamAddStr(MeowHashStream* stream, Str8 string)
+{
+	MeowHashStreamAdd(stream, string.pntr, string.length);
+}
 #endif //MEOW_HASH_AVAILABLE
 
+PEXPI u32 PigHashStrU32(Str8 string)
+{
+	return PigHashU32(string.pntr, string.length);
+}
+PEXPI u64 PigHashStrU64(Str8 string)
+{
+	return PigHashU64(string.pntr, string.length);
+}
+PEXPI u64 PigHashStrU64Ex(Str8 string, u64 seed)
+{
+	return PigHashU64Ex(string.pntr, string.length, seed);
+}
+PEXPI Hash128 PigHashStr128(Str8 string)
+{
+	return PigHash128(string.pntr, string.length);
+}
+PEXPI void PigHashStreamAddStr(PigHashStream* stream, Str8 string)
+{
+	PigHashStreamAdd(stream, string.pntr, string.length);
+}
+
 #endif //PIG_CORE_IMPLEMENTATION
 
 #endif //  _CROSS_STRING_AND_HASH_H
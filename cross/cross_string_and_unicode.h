@@ -11,12 +11,24 @@ Description:
 
 //NOTE: Intentionally no includes here
 
+#define FIND_NEXT_CHAR_MAX_FAST_CHARS 4 //FindNextCharInStrEx does one MemFindByte per search char when they're all ASCII, past this many chars a CharSet scan is faster
+
 // +--------------------------------------------------------------+
 // |                 Header Function Declarations                 |
 // +--------------------------------------------------------------+
 #if !PIG_CORE_IMPLEMENTATION
 	PIG_CORE_INLINE u8 GetCodepointForUtf8Str(Str8 str, uxx index, u32* codepointOut);
 	bool DoesStrContainMultibyteUtf8Chars(Str8 str);
+	bool StrUnicodeAnyCaseEquals(Str8 left, Str8 right);
+	bool CharSetAddStrEx(CharSet* set, Str8 charsStr, bool assertOnFull);
+	PIG_CORE_INLINE bool CharSetAddStr(CharSet* set, Str8 charsStr);
+	PIG_CORE_INLINE CharSet NewCharSet(Str8 charsStr);
+	uxx FindNextCharInSetEx(Str8 target, uxx startIndex, const CharSet* set, bool ignoreCharsInQuotes);
+	PIG_CORE_INLINE uxx FindNextCharInSet(Str8 target, uxx startIndex, const CharSet* set);
+	uxx FindNextCharNotInSetEx(Str8 target, uxx startIndex, const CharSet* set, bool ignoreCharsInQuotes);
+	PIG_CORE_INLINE uxx FindNextCharNotInSet(Str8 target, uxx startIndex, const CharSet* set);
+	bool IsCodepointInStr_(Str8 charsStr, u32 codepoint);
+	uxx FindNextCharInStrSlow_(Str8 target, uxx startIndex, Str8 charsStr, bool ignoreCharsInQuotes, bool matchInStr);
 	uxx FindNextCharInStrEx(Str8 target, uxx startIndex, Str8 searchCharsStr, bool ignoreCharsInQuotes);
 	PIG_CORE_INLINE uxx FindNextCharInStr(Str8 target, uxx startIndex, Str8 searchCharsStr);
 	uxx FindNextUnknownCharInStrEx(Str8 target, uxx startIndex, Str8 knownCharsStr, bool ignoreCharsInQuotes);
@@ -38,18 +50,110 @@ PEXPI u8 GetCodepointForUtf8Str(Str8 str, uxx index, u32* codepointOut)
 
 PEXP bool DoesStrContainMultibyteUtf8Chars(Str8 str)
 {
-	for (uxx bIndex = 0; bIndex < str.length; bIndex++)
+	uxx bIndex = 0;
+	while (bIndex < str.length)
 	{
-		if (GetCodepointForUtf8Str(str, bIndex, nullptr) > 0) { return true; }
+		bIndex += GetUtf8AsciiPrefixLength(str.chars + bIndex, str.length - bIndex);
+		if (bIndex >= str.length) { break; }
+		if (GetCodepointForUtf8Str(str, bIndex, nullptr) > 1) { return true; }
+		bIndex++;
 	}
 	return false;
 }
 
-//Returns target.length if no matching char is found
-PEXP uxx FindNextCharInStrEx(Str8 target, uxx startIndex, Str8 searchCharsStr, bool ignoreCharsInQuotes)
+//Like StrAnyCaseEquals but folds every cased codepoint (see GetCaseFoldedCodepoint), not just ASCII letters
+//Runs of ASCII in both strings are compared 16 bytes at a time by MemEqualsAnyCase, only non-ASCII characters go through the fold tables
+//NOTE: Folding can map characters with different encoded lengths together (U+212A Kelvin sign is 3 bytes, 'k' is 1)
+//      so the strings don't need to be the same length to be equal. Invalid UTF-8 bytes are only equal to the exact same byte
+PEXP bool StrUnicodeAnyCaseEquals(Str8 left, Str8 right)
+{
+	NotNullStr(left);
+	NotNullStr(right);
+	uxx leftIndex = 0;
+	uxx rightIndex = 0;
+	while (leftIndex < left.length && rightIndex < right.length)
+	{
+		uxx maxAsciiLength = left.length - leftIndex;
+		if (right.length - rightIndex < maxAsciiLength) { maxAsciiLength = right.length - rightIndex; }
+		uxx asciiLength = GetUtf8AsciiPrefixLength(left.chars + leftIndex, maxAsciiLength);
+		if (asciiLength > 0) { asciiLength = GetUtf8AsciiPrefixLength(right.chars + rightIndex, asciiLength); }
+		if (asciiLength > 0)
+		{
+			if (!MemEqualsAnyCase(left.chars + leftIndex, right.chars + rightIndex, asciiLength)) { return false; }
+			leftIndex += asciiLength;
+			rightIndex += asciiLength;
+			continue;
+		}
+		
+		u32 leftCodepoint = 0;
+		u32 rightCodepoint = 0;
+		u8 leftCharSize = GetCodepointForUtf8Str(left, leftIndex, &leftCodepoint);
+		u8 rightCharSize = GetCodepointForUtf8Str(right, rightIndex, &rightCodepoint);
+		if (leftCharSize == 0 || rightCharSize == 0)
+		{
+			if (leftCharSize != rightCharSize || left.bytes[leftIndex] != right.bytes[rightIndex]) { return false; }
+			leftCharSize = 1;
+			rightCharSize = 1;
+		}
+		else if (!AreCodepointsEqualAnyCase(leftCodepoint, rightCodepoint)) { return false; }
+		leftIndex += leftCharSize;
+		rightIndex += rightCharSize;
+	}
+	return (leftIndex == left.length && rightIndex == right.length);
+}
+
+// +==============================+
+// |           CharSet            |
+// +==============================+
+//Adds every codepoint in charsStr to the set. Returns false if the set ran out of space for ranges
+PEXP bool CharSetAddStrEx(CharSet* set, Str8 charsStr, bool assertOnFull)
+{
+	NotNull(set);
+	NotNullStr(charsStr);
+	bool result = true;
+	for (uxx cIndex = 0; cIndex < charsStr.length; )
+	{
+		u32 codepoint = 0;
+		u8 codepointSize = GetCodepointForUtf8Str(charsStr, cIndex, &codepoint);
+		DebugAssert(codepointSize > 0);
+		if (codepointSize == 0) { cIndex++; continue; } //invalid utf-8 encoding in charsStr
+		if (!CharSetAddRangeEx(set, codepoint, codepoint, assertOnFull)) { result = false; }
+		cIndex += codepointSize;
+	}
+	return result;
+}
+PEXPI bool CharSetAddStr(CharSet* set, Str8 charsStr) { return CharSetAddStrEx(set, charsStr, true); }
+PEXPI CharSet NewCharSet(Str8 charsStr)
+{
+	CharSet result = ZEROED;
+	CharSetAddStr(&result, charsStr);
+	return result;
+}
+
+//Returns target.length if no char in the set is found
+PEXP uxx FindNextCharInSetEx(Str8 target, uxx startIndex, const CharSet* set, bool ignoreCharsInQuotes)
 {
 	NotNullStr(target);
+	NotNull(set);
 	Assert(startIndex <= target.length);
+	
+	if (!ignoreCharsInQuotes)
+	{
+		uxx cIndex = startIndex;
+		while (cIndex < target.length)
+		{
+			cIndex += FindNextCharSetCandidate(set, target.bytes + cIndex, target.length - cIndex, true);
+			if (cIndex >= target.length) { break; }
+			if (target.bytes[cIndex] < 0x80) { return cIndex; }
+			u32 codepoint = 0;
+			u8 codepointSize = GetCodepointForUtf8Str(target, cIndex, &codepoint);
+			if (codepointSize == 0) { cIndex++; continue; } //invalid utf-8 encoding in target
+			if (IsCodepointInCharSet(set, codepoint)) { return cIndex; }
+			cIndex += codepointSize;
+		}
+		return target.length;
+	}
+	
 	bool inQuotes = false;
 	u32 previousCodepoint = 0;
 	for (uxx cIndex = startIndex; cIndex < target.length; )
@@ -57,19 +161,8 @@ PEXP uxx FindNextCharInStrEx(Str8 target, uxx startIndex, Str8 searchCharsStr, b
 		u32 codepoint = 0;
 		u8 codepointSize = GetCodepointForUtf8Str(target, cIndex, &codepoint);
 		if (codepointSize == 0) { cIndex++; continue; } //invalid utf-8 encoding in target
-		for (uxx sIndex = 0; sIndex < searchCharsStr.length; )
-		{
-			u32 searchCodepoint = 0;
-			u8 searchCodepointSize = GetCodepointForUtf8Str(searchCharsStr, sIndex, &searchCodepoint);
-			DebugAssert(searchCodepointSize > 0);
-			if (searchCodepointSize == 0) { return target.length; } //invalid utf-8 encoding in searchCharsStr
-			if (codepoint == searchCodepoint && !inQuotes)
-			{
-				return cIndex;
-			}
-			sIndex += searchCodepointSize;
-		}
-		if (ignoreCharsInQuotes && codepoint == '"' && !(inQuotes && previousCodepoint == '\\'))
+		if (!inQuotes && IsCodepointInCharSet(set, codepoint)) { return cIndex; }
+		if (codepoint == '"' && !(inQuotes && previousCodepoint == '\\'))
 		{
 			inQuotes = !inQuotes;
 		}
@@ -78,12 +171,32 @@ PEXP uxx FindNextCharInStrEx(Str8 target, uxx startIndex, Str8 searchCharsStr, b
 	}
 	return target.length;
 }
-PEXPI uxx FindNextCharInStr(Str8 target, uxx startIndex, Str8 searchCharsStr) { return FindNextCharInStrEx(target, startIndex, searchCharsStr, false); }
+PEXPI uxx FindNextCharInSet(Str8 target, uxx startIndex, const CharSet* set) { return FindNextCharInSetEx(target, startIndex, set, false); }
 
-PEXP uxx FindNextUnknownCharInStrEx(Str8 target, uxx startIndex, Str8 knownCharsStr, bool ignoreCharsInQuotes)
+//Returns target.length if every char (outside of quotes when ignoreCharsInQuotes) is in the set
+PEXP uxx FindNextCharNotInSetEx(Str8 target, uxx startIndex, const CharSet* set, bool ignoreCharsInQuotes)
 {
 	NotNullStr(target);
+	NotNull(set);
 	Assert(startIndex <= target.length);
+	
+	if (!ignoreCharsInQuotes)
+	{
+		uxx cIndex = startIndex;
+		while (cIndex < target.length)
+		{
+			cIndex += FindNextCharSetCandidate(set, target.bytes + cIndex, target.length - cIndex, false);
+			if (cIndex >= target.length) { break; }
+			if (target.bytes[cIndex] < 0x80) { return cIndex; }
+			u32 codepoint = 0;
+			u8 codepointSize = GetCodepointForUtf8Str(target, cIndex, &codepoint);
+			if (codepointSize == 0) { cIndex++; continue; } //invalid utf-8 encoding in target
+			if (!IsCodepointInCharSet(set, codepoint)) { return cIndex; }
+			cIndex += codepointSize;
+		}
+		return target.length;
+	}
+	
 	bool inQuotes = false;
 	u32 previousCodepoint = 0;
 	for (uxx cIndex = startIndex; cIndex < target.length; )
@@ -91,33 +204,89 @@ PEXP uxx FindNextUnknownCharInStrEx(Str8 target, uxx startIndex, Str8 knownChars
 		u32 codepoint = 0;
 		u8 codepointSize = GetCodepointForUtf8Str(target, cIndex, &codepoint);
 		if (codepointSize == 0) { cIndex++; continue; } //invalid utf-8 encoding in target
-		bool isKnownChar = false;
-		for (uxx sIndex = 0; sIndex < knownCharsStr.length; )
-		{
-			u32 searchCodepoint = 0;
-			u8 searchCodepointSize = GetCodepointForUtf8Str(knownCharsStr, sIndex, &searchCodepoint);
-			DebugAssert(searchCodepointSize > 0);
-			if (searchCodepointSize == 0) { return target.length; } //invalid utf-8 encoding in knownCharsStr
-			if (codepoint == searchCodepoint && !inQuotes)
-			{
-				isKnownChar = true;
-				break;
-			}
-			sIndex += searchCodepointSize;
-		}
-		if (!isKnownChar)
-		{
-			return cIndex;
-		}
-		if (ignoreCharsInQuotes && codepoint == '"' && !(inQuotes && previousCodepoint == '\\'))
-		{
-			inQuotes = !inQuotes;
-		}
+		bool isQuoteToggle = (codepoint == '"' && !(inQuotes && previousCodepoint == '\\'));
+		if (!inQuotes && !isQuoteToggle && !IsCodepointInCharSet(set, codepoint)) { return cIndex; }
+		if (isQuoteToggle) { inQuotes = !inQuotes; }
+		previousCodepoint = codepoint;
+		cIndex += codepointSize;
+	}
+	return target.length;
+}
+PEXPI uxx FindNextCharNotInSet(Str8 target, uxx startIndex, const CharSet* set) { return FindNextCharNotInSetEx(target, startIndex, set, false); }
+
+// +==============================+
+// |      Str8 Search Chars       |
+// +==============================+
+PEXP bool IsCodepointInStr_(Str8 charsStr, u32 codepoint)
+{
+	for (uxx sIndex = 0; sIndex < charsStr.length; )
+	{
+		u32 searchCodepoint = 0;
+		u8 searchCodepointSize = GetCodepointForUtf8Str(charsStr, sIndex, &searchCodepoint);
+		DebugAssert(searchCodepointSize > 0);
+		if (searchCodepointSize == 0) { sIndex++; continue; } //invalid utf-8 encoding in charsStr
+		if (searchCodepoint == codepoint) { return true; }
+		sIndex += searchCodepointSize;
+	}
+	return false;
+}
+//Per-codepoint scan used when charsStr has too many distinct non-Latin-1 runs to fit in a CharSet (see CHAR_SET_MAX_RANGES).
+//Same results as FindNextCharInSetEx (matchInStr) and FindNextCharNotInSetEx (!matchInStr) would give for a set built from charsStr
+PEXP uxx FindNextCharInStrSlow_(Str8 target, uxx startIndex, Str8 charsStr, bool ignoreCharsInQuotes, bool matchInStr)
+{
+	bool inQuotes = false;
+	u32 previousCodepoint = 0;
+	for (uxx cIndex = startIndex; cIndex < target.length; )
+	{
+		u32 codepoint = 0;
+		u8 codepointSize = GetCodepointForUtf8Str(target, cIndex, &codepoint);
+		if (codepointSize == 0) { cIndex++; continue; } //invalid utf-8 encoding in target
+		bool isQuoteToggle = (ignoreCharsInQuotes && codepoint == '"' && !(inQuotes && previousCodepoint == '\\'));
+		if (!inQuotes && (matchInStr || !isQuoteToggle) && IsCodepointInStr_(charsStr, codepoint) == matchInStr) { return cIndex; }
+		if (isQuoteToggle) { inQuotes = !inQuotes; }
 		previousCodepoint = codepoint;
 		cIndex += codepointSize;
 	}
 	return target.length;
 }
+
+//Returns target.length if no matching char is found
+//NOTE: If you are searching for the same set of chars many times, build a CharSet once with NewCharSet and use FindNextCharInSetEx instead
+PEXP uxx FindNextCharInStrEx(Str8 target, uxx startIndex, Str8 searchCharsStr, bool ignoreCharsInQuotes)
+{
+	NotNullStr(target);
+	Assert(startIndex <= target.length);
+	
+	//Fast path: ASCII bytes never show up inside multi-byte UTF-8 sequences so a handful of ASCII search chars can use MemFindByte directly.
+	//Each search only has to look as far as the best match found so far
+	bool useFastPath = (!ignoreCharsInQuotes && searchCharsStr.length > 0 && searchCharsStr.length <= FIND_NEXT_CHAR_MAX_FAST_CHARS);
+	for (uxx sIndex = 0; useFastPath && sIndex < searchCharsStr.length; sIndex++) { if (searchCharsStr.bytes[sIndex] >= 0x80) { useFastPath = false; } }
+	if (useFastPath)
+	{
+		uxx result = target.length;
+		for (uxx sIndex = 0; sIndex < searchCharsStr.length; sIndex++)
+		{
+			uxx foundIndex = startIndex + MemFindByte(target.bytes + startIndex, result - startIndex, searchCharsStr.bytes[sIndex]);
+			if (foundIndex < result) { result = foundIndex; }
+		}
+		return result;
+	}
+	
+	CharSet searchSet = ZEROED;
+	if (!CharSetAddStrEx(&searchSet, searchCharsStr, false)) { return FindNextCharInStrSlow_(target, startIndex, searchCharsStr, ignoreCharsInQuotes, true); }
+	return FindNextCharInSetEx(target, startIndex, &searchSet, ignoreCharsInQuotes);
+}
+PEXPI uxx FindNextCharInStr(Str8 target, uxx startIndex, Str8 searchCharsStr) { return FindNextCharInStrEx(target, startIndex, searchCharsStr, false); }
+
+//NOTE: When ignoreCharsInQuotes is true, quote chars and anything inside quotes are never considered unknown
+PEXP uxx FindNextUnknownCharInStrEx(Str8 target, uxx startIndex, Str8 knownCharsStr, bool ignoreCharsInQuotes)
+{
+	NotNullStr(target);
+	Assert(startIndex <= target.length);
+	CharSet knownSet = ZEROED;
+	if (!CharSetAddStrEx(&knownSet, knownCharsStr, false)) { return FindNextCharInStrSlow_(target, startIndex, knownCharsStr, ignoreCharsInQuotes, false); }
+	return FindNextCharNotInSetEx(target, startIndex, &knownSet, ignoreCharsInQuotes);
+}
 PEXPI uxx FindNextUnknownCharInStr(Str8 target, uxx startIndex, Str8 knownCharsStr) { return FindNextUnknownCharInStrEx(target, startIndex, knownCharsStr, false); }
 
 PEXPI uxx FindNextWhitespaceInStrEx(Str8 target, uxx startIndex, bool ignoreCharsInQuotes)
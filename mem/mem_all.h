@@ -19,8 +19,11 @@ Description:
 #include "std/std_malloc.h" //required by mem_arena.h
 #include "std/std_memset.h" //required by mem_arena.h
 #include "os/os_virtual_mem.h" //required by mem_arena.h
+#include "std/std_basic_math.h" //required by mem_compact_heap.h
 
 #include "mem/mem_arena.h"
 #include "mem/mem_scratch.h"
+#include "mem/mem_snapshot.h"
+#include "mem/mem_compact_heap.h"
 
 #endif //  _MEM_ALL_H
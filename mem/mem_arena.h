@@ -1067,11 +1067,28 @@ PEXP uxx ArenaSoftGrowBegin(const Arena* arena, const void* allocPntr, uxx alloc
 {
 	DebugNotNull(arena);
 	Assert(CanArenaSoftGrow(arena));
-	UNUSED(arena);
-	UNUSED(allocPntr);
-	UNUSED(allocSize);
-	//TODO: Implement this!
-	return 0;
+	if (allocPntr == nullptr || allocSize == 0) { return 0; } //none of our arenas can find the size of an allocation on their own
+	switch (arena->type)
+	{
+		case ArenaType_Alias: DebugNotNull(arena->sourceArena); return ArenaSoftGrowBegin(arena->sourceArena, allocPntr, allocSize);
+		case ArenaType_Buffer:
+		case ArenaType_Stack:
+		case ArenaType_StackVirtual:
+		case ArenaType_StackWasm:
+		{
+			DebugNotNull(arena->mainPntr);
+			//NOTE: Only the last allocation can grow. Stack arenas leave their alignment padding after the allocation so allow for that gap
+			const u8* arenaEnd = (const u8*)arena->mainPntr + arena->used;
+			const u8* allocEnd = (const u8*)allocPntr + allocSize;
+			uxx maxGap = (arena->alignment > 1) ? arena->alignment : 1;
+			if (allocEnd > arenaEnd || (uxx)(arenaEnd - allocEnd) >= maxGap) { return 0; }
+			//NOTE: StackVirtual and StackWasm only grow into memory that's already been committed, we don't want to commit pages for a soft grow
+			uxx limit = (arena->type == ArenaType_StackVirtual || arena->type == ArenaType_StackWasm) ? arena->committed : arena->size;
+			if (arena->used > limit) { return 0; }
+			return (limit - arena->used) + (uxx)(arenaEnd - allocEnd);
+		}
+		default: AssertMsg(false, "Arena type does not have a ArenaSoftGrowBegin implementation!"); return 0;
+	}
 }
 // The size can be assumed in some arenas, by choosing to not pass a size you accept
 // some arenas returning 0 because they cannot determine the size of the allocation
@@ -1084,11 +1101,29 @@ PEXPI uxx ArenaSoftGrowBeginNoSize(const Arena* arena, const void* allocPntr)
 PEXP void ArenaSoftGrowEnd(Arena* arena, void* allocPntr, uxx allocSize, uxx newSpaceUsed)
 {
 	DebugNotNull(arena);
-	UNUSED(arena);
-	UNUSED(allocPntr);
-	UNUSED(allocSize);
-	UNUSED(newSpaceUsed);
-	//TODO: Implement me!
+	Assert(CanArenaSoftGrow(arena));
+	if (newSpaceUsed == 0) { return; }
+	Assert(newSpaceUsed <= ArenaSoftGrowBegin(arena, allocPntr, allocSize));
+	switch (arena->type)
+	{
+		case ArenaType_Alias:
+		{
+			DebugNotNull(arena->sourceArena);
+			ArenaSoftGrowEnd(arena->sourceArena, allocPntr, allocSize, newSpaceUsed);
+			arena->used = arena->sourceArena->used;
+			arena->committed = arena->sourceArena->committed;
+			arena->size = arena->sourceArena->size;
+			arena->allocCount = arena->sourceArena->allocCount;
+		} break;
+		case ArenaType_Buffer:
+		case ArenaType_Stack:
+		case ArenaType_StackVirtual:
+		case ArenaType_StackWasm:
+		{
+			arena->used = (uxx)(((u8*)allocPntr + allocSize + newSpaceUsed) - (u8*)arena->mainPntr);
+		} break;
+		default: AssertMsg(false, "Arena type does not have a ArenaSoftGrowEnd implementation!"); break;
+	}
 }
 PEXPI void ArenaSoftGrowEndNoSize(Arena* arena, void* allocPntr, uxx newSpaceUsed)
 {
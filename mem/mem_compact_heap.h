@@ -0,0 +1,353 @@
+/*
+File:   mem_compact_heap.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A CompactHeap is an opt-in compacting allocator that sits on top of an Arena.
+	** It owns one contiguous buffer (allocated from the Arena) and hands out
+	** CompactHandles rather than pointers. Allocation is a bump at the end of the
+	** buffer and freeing leaves a hole behind. CompactHeapStep slides live blocks
+	** down over the holes, a bounded number of bytes at a time, and fixes up the
+	** handle table as it goes so long-running processes don't slowly bloat from
+	** fragmentation. Use CompactHeapGet to turn a handle into a pointer, that pointer
+	** is only valid until the next CompactAlloc or CompactHeapStep call.
+	** NOTE: The step budget is measured in bytes moved rather than time, callers that
+	** want a time budget can pick a byte count from their measured memmove throughput
+*/
+
+/*
+* Usage Example:
+*	CompactHeap heap;
+*	InitCompactHeap(&heap, stdHeap, Megabytes(1));
+*	CompactHandle nameHandle = CompactAlloc(&heap, 64);
+*	MyMemCopy(CompactHeapGet(&heap, nameHandle), "hello", 6);
+*	CompactFree(&heap, nameHandle);
+*	//Once per frame:
+*	CompactHeapStats before, after;
+*	CompactHeapStep(&heap, Kilobytes(64), &before, &after);
+*/
+
+#ifndef _MEM_COMPACT_HEAP_H
+#define _MEM_COMPACT_HEAP_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_math.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+
+#define COMPACT_HEAP_ALIGNMENT       16 //every block (and therefore every allocation) is aligned to this
+#define COMPACT_HEAP_MIN_SIZE        Kilobytes(4)
+#define COMPACT_HEAP_MIN_NUM_ENTRIES 64
+#define COMPACT_HEAP_FREE_BLOCK      UINT32_MAX //entryIndex value of a block header that marks a hole
+#define COMPACT_HEAP_INVALID_OFFSET  UINTXX_MAX //offset value of a handle table entry that isn't in use
+#define COMPACT_HEAP_ALIGN_SIZE(size, alignment) ((((size) + (alignment) - 1) / (alignment)) * (alignment))
+
+typedef struct CompactHandle CompactHandle;
+struct CompactHandle
+{
+	u32 index;
+	u32 generation; //0 is never a valid generation so a ZEROED handle is always invalid
+};
+
+//Sits at the front of every block in the buffer, padded to COMPACT_HEAP_ALIGNMENT
+typedef struct CompactBlockHeader CompactBlockHeader;
+struct CompactBlockHeader
+{
+	u32 entryIndex; //COMPACT_HEAP_FREE_BLOCK for holes
+	uxx blockSize; //including this header, always a multiple of COMPACT_HEAP_ALIGNMENT
+};
+#define COMPACT_HEAP_HEADER_SIZE COMPACT_HEAP_ALIGN_SIZE(sizeof(CompactBlockHeader), COMPACT_HEAP_ALIGNMENT)
+
+typedef struct CompactHeapEntry CompactHeapEntry;
+struct CompactHeapEntry
+{
+	uxx offset; //offset of the block header in the buffer, COMPACT_HEAP_INVALID_OFFSET when the entry is free
+	uxx size; //size requested by the caller
+	u32 generation;
+	u32 nextFreeIndex; //only meaningful when the entry is free
+};
+
+typedef struct CompactHeapStats CompactHeapStats;
+struct CompactHeapStats
+{
+	uxx capacity; //size of the buffer
+	uxx used; //everything before this offset is either a live block or a hole
+	uxx liveBytes; //bytes in live blocks (including headers and padding)
+	uxx holeBytes; //bytes in holes below used
+	uxx numLiveBlocks;
+	uxx packedBytes; //everything before this offset is tightly packed, compaction is finished once this reaches used
+	r32 fragmentation; //holeBytes / used, 0 when fully compacted
+};
+
+typedef struct CompactHeap CompactHeap;
+struct CompactHeap
+{
+	Arena* arena; //doubles as IsInit check
+	uxx capacity;
+	u8* buffer;
+	uxx used;
+	uxx holeBytes;
+	uxx numLiveBlocks;
+	uxx compactCursor; //everything before this offset is known to be tightly packed
+	
+	u32 numEntries;
+	u32 numEntriesAlloc;
+	u32 firstFreeEntry; //COMPACT_HEAP_FREE_BLOCK if there are no free entries
+	CompactHeapEntry* entries;
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	void InitCompactHeap(CompactHeap* heap, Arena* arena, uxx initialCapacity);
+	PIG_CORE_INLINE bool IsCompactHeapInit(const CompactHeap* heap);
+	void FreeCompactHeap(CompactHeap* heap);
+	PIG_CORE_INLINE CompactBlockHeader* CompactHeapGetBlock(CompactHeap* heap, uxx offset);
+	PIG_CORE_INLINE bool IsCompactHandleValid(const CompactHeap* heap, CompactHandle handle);
+	PIG_CORE_INLINE void* CompactHeapGet(CompactHeap* heap, CompactHandle handle);
+	PIG_CORE_INLINE uxx CompactHeapGetSize(const CompactHeap* heap, CompactHandle handle);
+	PIG_CORE_INLINE CompactHeapStats GetCompactHeapStats(const CompactHeap* heap);
+	uxx CompactHeapStep(CompactHeap* heap, uxx maxBytesToMove, CompactHeapStats* statsBeforeOut, CompactHeapStats* statsAfterOut);
+	PIG_CORE_INLINE void CompactHeapCompactAll(CompactHeap* heap);
+	void CompactHeapGrow(CompactHeap* heap, uxx minCapacity);
+	CompactHandle CompactAlloc(CompactHeap* heap, uxx numBytes);
+	void CompactFree(CompactHeap* heap, CompactHandle handle);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                            Macros                            |
+// +--------------------------------------------------------------+
+#define CompactHeapGetType(type, heapPntr, handle) ((type*)CompactHeapGet((heapPntr), (handle)))
+#define CompactAllocType(type, heapPntr)           CompactAlloc((heapPntr), (uxx)sizeof(type))
+#define CompactAllocArray(type, heapPntr, count)   CompactAlloc((heapPntr), (uxx)(sizeof(type) * (count)))
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+PEXP void InitCompactHeap(CompactHeap* heap, Arena* arena, uxx initialCapacity)
+{
+	NotNull(heap);
+	NotNull(arena);
+	ClearPointer(heap);
+	heap->arena = arena;
+	heap->capacity = COMPACT_HEAP_ALIGN_SIZE(MaxUXX(initialCapacity, COMPACT_HEAP_MIN_SIZE), COMPACT_HEAP_ALIGNMENT);
+	heap->buffer = (u8*)AllocMemAligned(arena, heap->capacity, COMPACT_HEAP_ALIGNMENT);
+	NotNull(heap->buffer);
+	heap->firstFreeEntry = COMPACT_HEAP_FREE_BLOCK;
+}
+
+PEXPI bool IsCompactHeapInit(const CompactHeap* heap)
+{
+	return (heap->arena != nullptr);
+}
+
+PEXP void FreeCompactHeap(CompactHeap* heap)
+{
+	NotNull(heap);
+	if (heap->arena != nullptr && CanArenaFree(heap->arena))
+	{
+		if (heap->entries != nullptr) { FreeMem(heap->arena, heap->entries, sizeof(CompactHeapEntry) * heap->numEntriesAlloc); }
+		if (heap->buffer != nullptr) { FreeMem(heap->arena, heap->buffer, heap->capacity); }
+	}
+	ClearPointer(heap);
+}
+
+PEXPI CompactBlockHeader* CompactHeapGetBlock(CompactHeap* heap, uxx offset)
+{
+	DebugAssert(offset + COMPACT_HEAP_HEADER_SIZE <= heap->used);
+	return (CompactBlockHeader*)(heap->buffer + offset);
+}
+
+PEXPI bool IsCompactHandleValid(const CompactHeap* heap, CompactHandle handle)
+{
+	if (handle.generation == 0 || handle.index >= heap->numEntries) { return false; }
+	const CompactHeapEntry* entry = &heap->entries[handle.index];
+	return (entry->generation == handle.generation && entry->offset != COMPACT_HEAP_INVALID_OFFSET);
+}
+
+//NOTE: The returned pointer is only valid until the next CompactAlloc or CompactHeapStep
+PEXPI void* CompactHeapGet(CompactHeap* heap, CompactHandle handle)
+{
+	DebugNotNull(heap);
+	if (!IsCompactHandleValid(heap, handle)) { return nullptr; }
+	return heap->buffer + heap->entries[handle.index].offset + COMPACT_HEAP_HEADER_SIZE;
+}
+
+PEXPI uxx CompactHeapGetSize(const CompactHeap* heap, CompactHandle handle)
+{
+	if (!IsCompactHandleValid(heap, handle)) { return 0; }
+	return heap->entries[handle.index].size;
+}
+
+PEXPI CompactHeapStats GetCompactHeapStats(const CompactHeap* heap)
+{
+	CompactHeapStats result = ZEROED;
+	result.capacity = heap->capacity;
+	result.used = heap->used;
+	result.holeBytes = heap->holeBytes;
+	result.liveBytes = heap->used - heap->holeBytes;
+	result.numLiveBlocks = heap->numLiveBlocks;
+	result.packedBytes = heap->compactCursor;
+	result.fragmentation = (heap->used > 0) ? (r32)((r64)heap->holeBytes / (r64)heap->used) : 0.0f;
+	return result;
+}
+
+//Slides live blocks down over holes until at least maxBytesToMove bytes have been moved (or the heap is fully compacted). Returns the number of bytes moved
+PEXP uxx CompactHeapStep(CompactHeap* heap, uxx maxBytesToMove, CompactHeapStats* statsBeforeOut, CompactHeapStats* statsAfterOut)
+{
+	NotNull(heap);
+	Assert(IsCompactHeapInit(heap));
+	SetOptionalOutPntr(statsBeforeOut, GetCompactHeapStats(heap));
+	
+	uxx numBytesMoved = 0;
+	uxx writeOffset = heap->compactCursor;
+	uxx readOffset = heap->compactCursor;
+	while (readOffset < heap->used && numBytesMoved < maxBytesToMove)
+	{
+		CompactBlockHeader* block = CompactHeapGetBlock(heap, readOffset);
+		uxx blockSize = block->blockSize;
+		DebugAssert(blockSize >= COMPACT_HEAP_HEADER_SIZE && (blockSize % COMPACT_HEAP_ALIGNMENT) == 0);
+		if (block->entryIndex != COMPACT_HEAP_FREE_BLOCK)
+		{
+			if (writeOffset != readOffset)
+			{
+				heap->entries[block->entryIndex].offset = writeOffset;
+				MyMemMove(heap->buffer + writeOffset, heap->buffer + readOffset, blockSize);
+				numBytesMoved += blockSize;
+			}
+			writeOffset += blockSize;
+		}
+		readOffset += blockSize;
+	}
+	
+	if (readOffset >= heap->used)
+	{
+		//Everything after writeOffset was holes, drop them off the end
+		heap->holeBytes -= (heap->used - writeOffset);
+		heap->used = writeOffset;
+	}
+	else if (writeOffset != readOffset)
+	{
+		//Ran out of budget in the middle, leave a single hole covering the gap so the buffer stays walkable
+		CompactBlockHeader* gapBlock = (CompactBlockHeader*)(heap->buffer + writeOffset);
+		gapBlock->entryIndex = COMPACT_HEAP_FREE_BLOCK;
+		gapBlock->blockSize = readOffset - writeOffset;
+	}
+	heap->compactCursor = writeOffset;
+	
+	SetOptionalOutPntr(statsAfterOut, GetCompactHeapStats(heap));
+	return numBytesMoved;
+}
+
+PEXPI void CompactHeapCompactAll(CompactHeap* heap)
+{
+	CompactHeapStep(heap, UINTXX_MAX, nullptr, nullptr);
+}
+
+//Compacts first so only live blocks get copied to the new buffer. Offsets are relative to the buffer so handles don't need fixing up
+PEXP void CompactHeapGrow(CompactHeap* heap, uxx minCapacity)
+{
+	NotNull(heap);
+	CompactHeapCompactAll(heap);
+	uxx newCapacity = heap->capacity;
+	while (newCapacity < minCapacity) { newCapacity *= 2; }
+	if (newCapacity == heap->capacity) { return; }
+	u8* newBuffer = (u8*)AllocMemAligned(heap->arena, newCapacity, COMPACT_HEAP_ALIGNMENT);
+	NotNull(newBuffer);
+	if (heap->used > 0) { MyMemCopy(newBuffer, heap->buffer, heap->used); }
+	if (CanArenaFree(heap->arena)) { FreeMem(heap->arena, heap->buffer, heap->capacity); }
+	heap->buffer = newBuffer;
+	heap->capacity = newCapacity;
+}
+
+PEXP CompactHandle CompactAlloc(CompactHeap* heap, uxx numBytes)
+{
+	NotNull(heap);
+	Assert(IsCompactHeapInit(heap));
+	CompactHandle result = ZEROED;
+	uxx blockSize = COMPACT_HEAP_HEADER_SIZE + COMPACT_HEAP_ALIGN_SIZE(MaxUXX(numBytes, 1), COMPACT_HEAP_ALIGNMENT);
+	
+	if (heap->used + blockSize > heap->capacity)
+	{
+		//Only pay for a full compaction if it actually makes enough room, otherwise grow (which compacts anyway)
+		if (heap->used - heap->holeBytes + blockSize <= heap->capacity) { CompactHeapCompactAll(heap); }
+		else { CompactHeapGrow(heap, heap->used - heap->holeBytes + blockSize); }
+	}
+	Assert(heap->used + blockSize <= heap->capacity);
+	
+	u32 entryIndex = heap->firstFreeEntry;
+	if (entryIndex != COMPACT_HEAP_FREE_BLOCK)
+	{
+		heap->firstFreeEntry = heap->entries[entryIndex].nextFreeIndex;
+	}
+	else
+	{
+		if (heap->numEntries >= heap->numEntriesAlloc)
+		{
+			u32 newNumEntriesAlloc = (heap->numEntriesAlloc > 0) ? heap->numEntriesAlloc * 2 : COMPACT_HEAP_MIN_NUM_ENTRIES;
+			CompactHeapEntry* newEntries = AllocArray(CompactHeapEntry, heap->arena, newNumEntriesAlloc);
+			NotNull(newEntries);
+			if (heap->entries != nullptr)
+			{
+				MyMemCopy(newEntries, heap->entries, sizeof(CompactHeapEntry) * heap->numEntries);
+				if (CanArenaFree(heap->arena)) { FreeMem(heap->arena, heap->entries, sizeof(CompactHeapEntry) * heap->numEntriesAlloc); }
+			}
+			heap->entries = newEntries;
+			heap->numEntriesAlloc = newNumEntriesAlloc;
+		}
+		entryIndex = heap->numEntries;
+		heap->numEntries++;
+		heap->entries[entryIndex].generation = 0;
+	}
+	
+	CompactHeapEntry* entry = &heap->entries[entryIndex];
+	entry->offset = heap->used;
+	entry->size = numBytes;
+	entry->generation++;
+	if (entry->generation == 0) { entry->generation = 1; }
+	entry->nextFreeIndex = COMPACT_HEAP_FREE_BLOCK;
+	
+	CompactBlockHeader* block = (CompactBlockHeader*)(heap->buffer + heap->used);
+	block->entryIndex = entryIndex;
+	block->blockSize = blockSize;
+	if (heap->compactCursor == heap->used) { heap->compactCursor += blockSize; }
+	heap->used += blockSize;
+	heap->numLiveBlocks++;
+	
+	result.index = entryIndex;
+	result.generation = entry->generation;
+	return result;
+}
+
+PEXP void CompactFree(CompactHeap* heap, CompactHandle handle)
+{
+	NotNull(heap);
+	Assert(IsCompactHeapInit(heap));
+	AssertMsg(IsCompactHandleValid(heap, handle), "Tried to free an invalid or stale CompactHandle!");
+	CompactHeapEntry* entry = &heap->entries[handle.index];
+	CompactBlockHeader* block = CompactHeapGetBlock(heap, entry->offset);
+	block->entryIndex = COMPACT_HEAP_FREE_BLOCK;
+	if (entry->offset + block->blockSize == heap->used)
+	{
+		//Last block in the buffer, no hole necessary
+		heap->used = entry->offset;
+	}
+	else { heap->holeBytes += block->blockSize; }
+	heap->compactCursor = MinUXX(heap->compactCursor, entry->offset);
+	heap->numLiveBlocks--;
+	
+	entry->offset = COMPACT_HEAP_INVALID_OFFSET;
+	entry->nextFreeIndex = heap->firstFreeEntry;
+	heap->firstFreeEntry = handle.index;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MEM_COMPACT_HEAP_H
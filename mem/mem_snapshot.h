@@ -0,0 +1,298 @@
+/*
+File:   mem_snapshot.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Copy-on-write snapshots of StackVirtual arenas. Taking a snapshot marks every
+	** page of the arena that is in use as read-only. The first write to each of those
+	** pages faults, the fault handler (a SIGSEGV\SIGBUS handler on Linux\OSX or a
+	** vectored exception handler on Windows) copies the original page contents into
+	** a shadow reservation and makes the page writable again. Restoring copies only
+	** the pages that were touched back, and retaking only re-protects. The cost of
+	** both scales with the number of pages that changed rather than arena->used.
+	** NOTE: The ArenaSnapshot is registered by address with the fault handler so it must not move while active
+	** NOTE: Only one snapshot can be active per arena, and at most MAX_ACTIVE_ARENA_SNAPSHOTS at once
+	** NOTE: Syscalls that write into a protected page (like read() into an arena buffer) will fail rather than fault, so don't do that while a snapshot is active
+	** NOTE: The active snapshot list is not synchronized, take\restore\discard snapshots on the same thread that owns the arena
+*/
+
+/*
+* Usage Example:
+*	Arena gameArena; InitArenaStackVirtual(&gameArena, Gigabytes(1));
+*	... allocate game state in gameArena ...
+*	ArenaSnapshot snapshot;
+*	TakeArenaSnapshot(&snapshot, &gameArena);
+*	... simulate a frame, which writes to some pages ...
+*	RestoreArenaSnapshot(&snapshot); //rolls gameArena back, snapshot remains active
+*	RetakeArenaSnapshot(&snapshot); //or move the snapshot point to the current state
+*	DiscardArenaSnapshot(&snapshot);
+*/
+
+#ifndef _MEM_SNAPSHOT_H
+#define _MEM_SNAPSHOT_H
+
+#include "base/base_compiler_check.h"
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_math.h"
+#include "std/std_includes.h"
+#include "std/std_memset.h"
+#include "os/os_virtual_mem.h"
+#include "mem/mem_arena.h"
+
+#define ARENA_SNAPSHOTS_SUPPORTED (TARGET_IS_WINDOWS || TARGET_IS_LINUX || TARGET_IS_OSX)
+
+#if ARENA_SNAPSHOTS_SUPPORTED
+
+#define MAX_ACTIVE_ARENA_SNAPSHOTS 8
+
+typedef struct ArenaSnapshot ArenaSnapshot;
+struct ArenaSnapshot
+{
+	Arena* arena; //doubles as IsInit check
+	uxx pageSize;
+	uxx used; //arena->used at the time the snapshot was taken
+	uxx allocCount; //arena->allocCount at the time the snapshot was taken
+	uxx numPages; //pages [0, numPages) of the arena are read-only until they are written to
+	uxx numDirtyPages;
+	uxx* dirtyPageIndices;
+	u8* pageCopies; //original contents of page N live at pageCopies + N*pageSize (only committed once the page is dirty)
+	void* shadowPntr; //reservation that holds dirtyPageIndices and pageCopies
+	uxx shadowSize;
+};
+
+typedef struct ArenaSnapshotGlobals ArenaSnapshotGlobals;
+struct ArenaSnapshotGlobals
+{
+	bool handlerInstalled;
+	ArenaSnapshot* active[MAX_ACTIVE_ARENA_SNAPSHOTS];
+	#if TARGET_IS_WINDOWS
+	void* exceptionHandlerHandle;
+	#else
+	struct sigaction prevSegvAction;
+	struct sigaction prevBusAction;
+	#endif
+};
+
+#if PIG_CORE_IMPLEMENTATION
+ArenaSnapshotGlobals arenaSnapshotGlobals = ZEROED;
+#else
+extern ArenaSnapshotGlobals arenaSnapshotGlobals;
+#endif
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	bool ArenaSnapshotHandleWriteFault(void* faultAddress);
+	#if TARGET_IS_WINDOWS
+	LONG NTAPI ArenaSnapshotExceptionHandler(EXCEPTION_POINTERS* exceptionInfo);
+	#else
+	void ArenaSnapshotSignalHandler(int signalNum, siginfo_t* signalInfo, void* context);
+	#endif
+	void InstallArenaSnapshotHandler();
+	PIG_CORE_INLINE bool IsArenaSnapshotActive(const ArenaSnapshot* snapshot);
+	bool TakeArenaSnapshot(ArenaSnapshot* snapshotOut, Arena* arena);
+	void RetakeArenaSnapshot(ArenaSnapshot* snapshot);
+	void RestoreArenaSnapshot(ArenaSnapshot* snapshot);
+	void DiscardArenaSnapshot(ArenaSnapshot* snapshot);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+PEXP void RetakeArenaSnapshot(ArenaSnapshot* snapshot); //pre-declared at top of file
+
+// +==============================+
+// |        Fault Handling        |
+// +==============================+
+//Called from inside the fault handler, returns false if the address doesn't belong to any active snapshot
+PEXP bool ArenaSnapshotHandleWriteFault(void* faultAddress)
+{
+	for (uxx sIndex = 0; sIndex < MAX_ACTIVE_ARENA_SNAPSHOTS; sIndex++)
+	{
+		ArenaSnapshot* snapshot = arenaSnapshotGlobals.active[sIndex];
+		if (snapshot == nullptr) { continue; }
+		u8* arenaBase = (u8*)snapshot->arena->mainPntr;
+		if ((u8*)faultAddress < arenaBase || (u8*)faultAddress >= arenaBase + (snapshot->numPages * snapshot->pageSize)) { continue; }
+		
+		uxx pageIndex = (uxx)((u8*)faultAddress - arenaBase) / snapshot->pageSize;
+		u8* pagePntr = arenaBase + (pageIndex * snapshot->pageSize);
+		u8* copyPntr = snapshot->pageCopies + (pageIndex * snapshot->pageSize);
+		#if TARGET_IS_WINDOWS
+		{
+			//Linux\OSX commit the shadow pages implicitly on first write, on Windows we have to do it ourselves
+			uxx indexBytesUsed = snapshot->numDirtyPages * sizeof(uxx);
+			if ((indexBytesUsed % snapshot->pageSize) == 0) { OsCommitReservedMemory((u8*)snapshot->dirtyPageIndices + indexBytesUsed, snapshot->pageSize); }
+			OsCommitReservedMemory(copyPntr, snapshot->pageSize);
+		}
+		#endif
+		MyMemCopy(copyPntr, pagePntr, snapshot->pageSize);
+		snapshot->dirtyPageIndices[snapshot->numDirtyPages] = pageIndex;
+		snapshot->numDirtyPages++;
+		OsProtectMemory(pagePntr, snapshot->pageSize, false);
+		return true;
+	}
+	return false;
+}
+
+#if TARGET_IS_WINDOWS
+PEXP LONG NTAPI ArenaSnapshotExceptionHandler(EXCEPTION_POINTERS* exceptionInfo)
+{
+	EXCEPTION_RECORD* record = exceptionInfo->ExceptionRecord;
+	if (record->ExceptionCode == EXCEPTION_ACCESS_VIOLATION && record->NumberParameters >= 2 && record->ExceptionInformation[0] == 1) //1 = write
+	{
+		if (ArenaSnapshotHandleWriteFault((void*)record->ExceptionInformation[1])) { return EXCEPTION_CONTINUE_EXECUTION; }
+	}
+	return EXCEPTION_CONTINUE_SEARCH;
+}
+#else
+PEXP void ArenaSnapshotSignalHandler(int signalNum, siginfo_t* signalInfo, void* context)
+{
+	if (ArenaSnapshotHandleWriteFault(signalInfo->si_addr)) { return; }
+	
+	//Not one of ours, hand it to whoever was installed before us
+	struct sigaction* prevAction = (signalNum == SIGBUS) ? &arenaSnapshotGlobals.prevBusAction : &arenaSnapshotGlobals.prevSegvAction;
+	if (IsFlagSet(prevAction->sa_flags, SA_SIGINFO) && prevAction->sa_sigaction != nullptr) { prevAction->sa_sigaction(signalNum, signalInfo, context); }
+	else if (prevAction->sa_handler != SIG_DFL && prevAction->sa_handler != SIG_IGN) { prevAction->sa_handler(signalNum); }
+	else
+	{
+		//Put the default action back, the faulting instruction will run again and the fault will be handled normally
+		sigaction(signalNum, prevAction, nullptr);
+		arenaSnapshotGlobals.handlerInstalled = false;
+	}
+}
+#endif
+
+PEXP void InstallArenaSnapshotHandler()
+{
+	if (arenaSnapshotGlobals.handlerInstalled) { return; }
+	#if TARGET_IS_WINDOWS
+	{
+		if (arenaSnapshotGlobals.exceptionHandlerHandle == nullptr)
+		{
+			arenaSnapshotGlobals.exceptionHandlerHandle = AddVectoredExceptionHandler(1, ArenaSnapshotExceptionHandler);
+			NotNull(arenaSnapshotGlobals.exceptionHandlerHandle);
+		}
+	}
+	#else
+	{
+		struct sigaction action = ZEROED;
+		action.sa_sigaction = ArenaSnapshotSignalHandler;
+		action.sa_flags = SA_SIGINFO;
+		sigemptyset(&action.sa_mask);
+		int segvResult = sigaction(SIGSEGV, &action, &arenaSnapshotGlobals.prevSegvAction);
+		Assert(segvResult == 0);
+		//OSX reports writes to read-only pages as SIGBUS
+		int busResult = sigaction(SIGBUS, &action, &arenaSnapshotGlobals.prevBusAction);
+		Assert(busResult == 0);
+	}
+	#endif
+	arenaSnapshotGlobals.handlerInstalled = true;
+}
+
+// +==============================+
+// |          Snapshots           |
+// +==============================+
+PEXPI bool IsArenaSnapshotActive(const ArenaSnapshot* snapshot)
+{
+	return (snapshot->arena != nullptr);
+}
+
+//Returns false if there are already MAX_ACTIVE_ARENA_SNAPSHOTS active
+PEXP bool TakeArenaSnapshot(ArenaSnapshot* snapshotOut, Arena* arena)
+{
+	NotNull(snapshotOut);
+	NotNull(arena);
+	AssertMsg(arena->type == ArenaType_StackVirtual, "Only StackVirtual arenas can be snapshotted!");
+	
+	uxx freeSlotIndex = MAX_ACTIVE_ARENA_SNAPSHOTS;
+	for (uxx sIndex = 0; sIndex < MAX_ACTIVE_ARENA_SNAPSHOTS; sIndex++)
+	{
+		ArenaSnapshot* otherSnapshot = arenaSnapshotGlobals.active[sIndex];
+		if (otherSnapshot == nullptr) { if (freeSlotIndex == MAX_ACTIVE_ARENA_SNAPSHOTS) { freeSlotIndex = sIndex; } }
+		else { AssertMsg(otherSnapshot->arena != arena, "This arena already has an active snapshot!"); }
+	}
+	if (freeSlotIndex >= MAX_ACTIVE_ARENA_SNAPSHOTS) { return false; }
+	
+	InstallArenaSnapshotHandler();
+	ClearPointer(snapshotOut);
+	snapshotOut->arena = arena;
+	snapshotOut->pageSize = OsGetMemoryPageSize();
+	Assert(arena->size % snapshotOut->pageSize == 0);
+	
+	//The shadow reservation covers the whole arena so RetakeArenaSnapshot never has to grow it
+	uxx maxNumPages = arena->size / snapshotOut->pageSize;
+	uxx indicesSize = CeilDivUXX(maxNumPages * sizeof(uxx), snapshotOut->pageSize) * snapshotOut->pageSize;
+	snapshotOut->shadowSize = indicesSize + arena->size;
+	snapshotOut->shadowPntr = OsReserveMemory(snapshotOut->shadowSize);
+	NotNull(snapshotOut->shadowPntr);
+	snapshotOut->dirtyPageIndices = (uxx*)snapshotOut->shadowPntr;
+	snapshotOut->pageCopies = (u8*)snapshotOut->shadowPntr + indicesSize;
+	
+	arenaSnapshotGlobals.active[freeSlotIndex] = snapshotOut;
+	RetakeArenaSnapshot(snapshotOut);
+	return true;
+}
+
+//Moves the snapshot point to the current state of the arena, reusing the shadow reservation
+PEXP void RetakeArenaSnapshot(ArenaSnapshot* snapshot) //pre-declared at top of file
+{
+	NotNull(snapshot);
+	Assert(IsArenaSnapshotActive(snapshot));
+	Arena* arena = snapshot->arena;
+	uxx newNumPages = CeilDivUXX(arena->used, snapshot->pageSize);
+	Assert(newNumPages * snapshot->pageSize <= arena->committed);
+	if (newNumPages < snapshot->numPages)
+	{
+		OsProtectMemory((u8*)arena->mainPntr + (newNumPages * snapshot->pageSize), (snapshot->numPages - newNumPages) * snapshot->pageSize, false);
+	}
+	snapshot->used = arena->used;
+	snapshot->allocCount = arena->allocCount;
+	snapshot->numDirtyPages = 0;
+	snapshot->numPages = newNumPages;
+	//NOTE: One call over the whole range (rather than only the dirty pages) also lets the OS merge the split page ranges back together
+	OsProtectMemory(arena->mainPntr, newNumPages * snapshot->pageSize, true);
+}
+
+//Puts the arena back the way it was when the snapshot was taken. The snapshot stays active so it can be restored again
+PEXP void RestoreArenaSnapshot(ArenaSnapshot* snapshot)
+{
+	NotNull(snapshot);
+	Assert(IsArenaSnapshotActive(snapshot));
+	Arena* arena = snapshot->arena;
+	for (uxx dIndex = 0; dIndex < snapshot->numDirtyPages; dIndex++)
+	{
+		uxx pageIndex = snapshot->dirtyPageIndices[dIndex];
+		MyMemCopy((u8*)arena->mainPntr + (pageIndex * snapshot->pageSize), snapshot->pageCopies + (pageIndex * snapshot->pageSize), snapshot->pageSize);
+	}
+	snapshot->numDirtyPages = 0;
+	if (snapshot->numPages > 0) { OsProtectMemory(arena->mainPntr, snapshot->numPages * snapshot->pageSize, true); }
+	//NOTE: Pages committed after the snapshot was taken stay committed, they just aren't in use anymore
+	arena->used = snapshot->used;
+	arena->allocCount = snapshot->allocCount;
+}
+
+//Stops tracking writes, the arena keeps whatever contents it has right now
+PEXP void DiscardArenaSnapshot(ArenaSnapshot* snapshot)
+{
+	NotNull(snapshot);
+	Assert(IsArenaSnapshotActive(snapshot));
+	OsProtectMemory(snapshot->arena->mainPntr, snapshot->numPages * snapshot->pageSize, false);
+	for (uxx sIndex = 0; sIndex < MAX_ACTIVE_ARENA_SNAPSHOTS; sIndex++)
+	{
+		if (arenaSnapshotGlobals.active[sIndex] == snapshot) { arenaSnapshotGlobals.active[sIndex] = nullptr; }
+	}
+	OsFreeReservedMemory(snapshot->shadowPntr, snapshot->shadowSize);
+	ClearPointer(snapshot);
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //ARENA_SNAPSHOTS_SUPPORTED
+
+#endif //  _MEM_SNAPSHOT_H
@@ -13,12 +13,21 @@ Date:   01\05\2025
 #include "misc/misc_result.h"
 
 #include "base/base_typedefs.h" //required by everyone below
+#include "base/base_assert.h" //required by misc_hash.h
+#include "base/base_math.h" //required by misc_hash.h
+#include "base/base_simd.h" //required by misc_hash.h
+#include "std/std_memset.h" //required by misc_hash.h
 
 #include "misc/misc_hash.h"
+#include "misc/misc_crc_tables.h"
+#include "misc/misc_crc.h"
+
+#include "std/std_basic_math.h" //required by misc_random.h and misc_easing.h
+
 #include "misc/misc_random.h"
 
 #include "std/std_trig.h" //required by misc_easing.h
-#include "std/std_basic_math.h" //required by misc_easing.h
+#include "mem/mem_arena.h" //required by misc_easing.h and misc_printing.h
 
 #include "misc/misc_easing.h"
 
@@ -29,14 +38,37 @@ Date:   01\05\2025
 #include "std/std_includes.h" //required by misc_printing.h
 #include "struct/struct_string.h" //required by misc_printing.h
 #include "std/std_printf.h" //required by misc_printing.h
-#include "mem/mem_arena.h" //required by misc_printing.h
 
 #include "misc/misc_printing.h"
 
+#include "base/base_char.h" //required by misc_parsing.h
+#include "base/base_math.h" //required by misc_parsing.h
+#include "base/base_simd.h" //required by misc_parsing.h
+
+#include "misc/misc_parsing.h"
+#include "misc/misc_formatting.h"
+
 #include "struct/struct_vectors.h" //required by misc_noise.h
 
 #include "misc/misc_noise.h"
 
+#include "mem/mem_scratch.h" //required by misc_poisson_disk.h
+#include "struct/struct_var_array.h" //required by misc_poisson_disk.h
+
+#include "misc/misc_poisson_disk.h"
+#include "misc/misc_tween.h"
+
+#include "std/std_trig.h" //required by misc_expression.h
+
+#include "misc/misc_expression.h"
+
+#include "base/base_unicode.h" //required by misc_json.h
+
+#include "misc/misc_json.h"
+#include "misc/misc_csv.h"
+#include "misc/misc_encoding.h"
+#include "misc/misc_tokenizer.h"
+
 #include "misc/misc_zip.h"
 
 #endif //  _MISC_ALL_H
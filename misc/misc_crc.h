@@ -0,0 +1,354 @@
+/*
+File:   misc_crc.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds functions that calculate CRC32 (the polynomial used by zip, png, gzip, etc.)
+	** and CRC32C (Castagnoli, used by iSCSI, ext4, etc.) checksums.
+	** Large buffers use hardware acceleration when the CPU supports it, which is checked once at runtime:
+	**   x86: PCLMULQDQ folding for both polynomials (64 bytes per iteration) and the SSE4.2 crc32 instruction for CRC32C
+	**   ARM: The ARMv8 crc32 instructions (only when compiled with __ARM_FEATURE_CRC32 since there's no portable way to check at runtime)
+	** Everything else (and the leftover bytes) falls back to slicing-by-8 tables which are constant data generated
+	** ahead of time into misc_crc_tables.h (see _scripts/generate_crc_tables.py) so there's nothing to initialize.
+	** The Ex functions chain like zlib's crc32(): Crc32Ex(Crc32(a), b) == Crc32(a + b)
+*/
+
+/*
+* Usage Example:
+	u32 checksum = Crc32(fileContents.bytes, fileContents.length);
+	if (checksum != expectedChecksum) { PrintLine_E("File is corrupt!"); }
+*/
+
+#ifndef _MISC_CRC_H
+#define _MISC_CRC_H
+
+#include "base/base_compiler_check.h"
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "std/std_memset.h"
+#include "misc/misc_crc_tables.h"
+
+#define CRC32_POLYNOMIAL  0xEDB88320UL //reflected 0x04C11DB7
+#define CRC32C_POLYNOMIAL 0x82F63B78UL //reflected 0x1EDC6F41
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (COMPILER_IS_MSVC || COMPILER_IS_GCC || COMPILER_IS_CLANG) && !TARGET_IS_WASM
+#define CRC_X86_HARDWARE_AVAILABLE 1
+#else
+#define CRC_X86_HARDWARE_AVAILABLE 0
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+#define CRC_ARM_HARDWARE_AVAILABLE 1
+#else
+#define CRC_ARM_HARDWARE_AVAILABLE 0
+#endif
+
+typedef enum CrcHardware CrcHardware;
+enum CrcHardware
+{
+	CrcHardware_None     = 0x00,
+	CrcHardware_Sse42    = 0x01,
+	CrcHardware_Pclmul   = 0x02,
+	CrcHardware_ArmCrc   = 0x04,
+	CrcHardware_Detected = 0x80, //set once we've checked the CPU
+};
+
+//Constants for PCLMULQDQ folding, each is (x^n mod P) bit-reflected and shifted left by 1
+typedef struct CrcFoldConstants CrcFoldConstants;
+struct CrcFoldConstants
+{
+	u64 fold512Low;  //x^(4*128+32)
+	u64 fold512High; //x^(4*128-32)
+	u64 fold128Low;  //x^(128+32)
+	u64 fold128High; //x^(128-32)
+	u64 fold64;      //x^64
+	u64 polynomial;  //P bit-reflected (33 bits)
+	u64 barrettMu;   //floor(x^64 / P) bit-reflected (33 bits)
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	extern u8 CrcHardwareFlags;
+	extern const CrcFoldConstants Crc32FoldConstants;
+	extern const CrcFoldConstants Crc32cFoldConstants;
+	u8 GetCrcHardwareFlags();
+	u32 CrcUpdateSlicing8(const u32* tables, u32 crc, const u8* bytes, uxx numBytes);
+	#if CRC_X86_HARDWARE_AVAILABLE
+	u32 CrcUpdatePclmul(const CrcFoldConstants* constants, u32 crc, const u8* bytes, uxx numBytes);
+	u32 Crc32cUpdateSse42(u32 crc, const u8* bytes, uxx numBytes);
+	#endif
+	#if CRC_ARM_HARDWARE_AVAILABLE
+	u32 Crc32UpdateArm(u32 crc, const u8* bytes, uxx numBytes);
+	u32 Crc32cUpdateArm(u32 crc, const u8* bytes, uxx numBytes);
+	#endif
+	u32 Crc32Ex(u32 previousCrc, const void* bufferPntr, uxx numBytes);
+	PIG_CORE_INLINE u32 Crc32(const void* bufferPntr, uxx numBytes);
+	u32 Crc32cEx(u32 previousCrc, const void* bufferPntr, uxx numBytes);
+	PIG_CORE_INLINE u32 Crc32c(const void* bufferPntr, uxx numBytes);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+#if CRC_X86_HARDWARE_AVAILABLE
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#if COMPILER_IS_MSVC
+#include <intrin.h>
+#define CRC_X86_TARGET_ATTRIBUTE //MSVC lets us use any intrinsic without changing compiler flags
+#else
+#include <cpuid.h>
+#define CRC_X86_TARGET_ATTRIBUTE __attribute__((target("sse4.2,pclmul")))
+#endif
+#endif //CRC_X86_HARDWARE_AVAILABLE
+
+#if CRC_ARM_HARDWARE_AVAILABLE
+#include <arm_acle.h>
+#endif
+
+u8 CrcHardwareFlags = CrcHardware_None;
+
+const CrcFoldConstants Crc32FoldConstants = {
+	.fold512Low  = 0x154442BD4ULL,
+	.fold512High = 0x1C6E41596ULL,
+	.fold128Low  = 0x1751997D0ULL,
+	.fold128High = 0x0CCAA009EULL,
+	.fold64      = 0x163CD6124ULL,
+	.polynomial  = 0x1DB710641ULL,
+	.barrettMu   = 0x1F7011641ULL,
+};
+const CrcFoldConstants Crc32cFoldConstants = {
+	.fold512Low  = 0x0740EEF02ULL,
+	.fold512High = 0x09E4ADDF8ULL,
+	.fold128Low  = 0x0F20C0DFEULL,
+	.fold128High = 0x14CD00BD6ULL,
+	.fold64      = 0x0DD45AAB8ULL,
+	.polynomial  = 0x105EC76F1ULL,
+	.barrettMu   = 0x0DEA713F1ULL,
+};
+
+//NOTE: If two threads race to do this first they both write the same value, so no lock is needed
+PEXP u8 GetCrcHardwareFlags()
+{
+	if (CrcHardwareFlags & CrcHardware_Detected) { return CrcHardwareFlags; }
+	u8 result = CrcHardware_Detected;
+	#if CRC_X86_HARDWARE_AVAILABLE
+	{
+		#if COMPILER_IS_MSVC
+		int cpuInfo[4] = ZEROED;
+		__cpuid(cpuInfo, 1);
+		unsigned int featureBits = (unsigned int)cpuInfo[2];
+		#else
+		unsigned int eax = 0, ebx = 0, featureBits = 0, edx = 0;
+		if (!__get_cpuid(1, &eax, &ebx, &featureBits, &edx)) { featureBits = 0; }
+		#endif
+		if (featureBits & (1U << 20)) { result |= CrcHardware_Sse42; }
+		if (featureBits & (1U << 1)) { result |= CrcHardware_Pclmul; }
+	}
+	#endif
+	#if CRC_ARM_HARDWARE_AVAILABLE
+	result |= CrcHardware_ArmCrc;
+	#endif
+	CrcHardwareFlags = result;
+	return result;
+}
+
+//NOTE: crc is the raw register value here (not inverted)
+PEXP u32 CrcUpdateSlicing8(const u32* tables, u32 crc, const u8* bytes, uxx numBytes)
+{
+	while (numBytes >= 8)
+	{
+		u32 low = 0, high = 0;
+		MyMemCopy(&low, bytes + 0, sizeof(u32));
+		MyMemCopy(&high, bytes + 4, sizeof(u32));
+		low ^= crc;
+		crc = tables[7*256 + ((low >>  0) & 0xFF)] ^ tables[6*256 + ((low >>  8) & 0xFF)] ^
+		      tables[5*256 + ((low >> 16) & 0xFF)] ^ tables[4*256 + ((low >> 24) & 0xFF)] ^
+		      tables[3*256 + ((high >>  0) & 0xFF)] ^ tables[2*256 + ((high >>  8) & 0xFF)] ^
+		      tables[1*256 + ((high >> 16) & 0xFF)] ^ tables[0*256 + ((high >> 24) & 0xFF)];
+		bytes += 8;
+		numBytes -= 8;
+	}
+	while (numBytes > 0)
+	{
+		crc = (crc >> 8) ^ tables[(crc ^ bytes[0]) & 0xFF];
+		bytes++;
+		numBytes--;
+	}
+	return crc;
+}
+
+// +==============================+
+// |          x86 Paths           |
+// +==============================+
+#if CRC_X86_HARDWARE_AVAILABLE
+//Folds 4 lanes of 128 bits at a time then reduces to 32 bits with a Barrett reduction
+//Based on "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, Gopal et al.)
+//NOTE: numBytes must be >= 64 and a multiple of 16
+CRC_X86_TARGET_ATTRIBUTE PEXP u32 CrcUpdatePclmul(const CrcFoldConstants* constants, u32 crc, const u8* bytes, uxx numBytes)
+{
+	Assert(numBytes >= 64 && (numBytes % 16) == 0);
+	__m128i fold512 = _mm_set_epi64x((long long)constants->fold512High, (long long)constants->fold512Low);
+	__m128i fold128 = _mm_set_epi64x((long long)constants->fold128High, (long long)constants->fold128Low);
+	__m128i lane0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(bytes + 0x00)), _mm_cvtsi32_si128((int)crc));
+	__m128i lane1 = _mm_loadu_si128((const __m128i*)(bytes + 0x10));
+	__m128i lane2 = _mm_loadu_si128((const __m128i*)(bytes + 0x20));
+	__m128i lane3 = _mm_loadu_si128((const __m128i*)(bytes + 0x30));
+	bytes += 64;
+	numBytes -= 64;
+	
+	while (numBytes >= 64)
+	{
+		lane0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lane0, fold512, 0x00), _mm_clmulepi64_si128(lane0, fold512, 0x11)), _mm_loadu_si128((const __m128i*)(bytes + 0x00)));
+		lane1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lane1, fold512, 0x00), _mm_clmulepi64_si128(lane1, fold512, 0x11)), _mm_loadu_si128((const __m128i*)(bytes + 0x10)));
+		lane2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lane2, fold512, 0x00), _mm_clmulepi64_si128(lane2, fold512, 0x11)), _mm_loadu_si128((const __m128i*)(bytes + 0x20)));
+		lane3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lane3, fold512, 0x00), _mm_clmulepi64_si128(lane3, fold512, 0x11)), _mm_loadu_si128((const __m128i*)(bytes + 0x30)));
+		bytes += 64;
+		numBytes -= 64;
+	}
+	
+	//Fold the 4 lanes into 1, then any remaining 16 byte blocks into that
+	__m128i value = lane0;
+	value = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, fold128, 0x00), _mm_clmulepi64_si128(value, fold128, 0x11)), lane1);
+	value = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, fold128, 0x00), _mm_clmulepi64_si128(value, fold128, 0x11)), lane2);
+	value = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, fold128, 0x00), _mm_clmulepi64_si128(value, fold128, 0x11)), lane3);
+	while (numBytes >= 16)
+	{
+		value = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, fold128, 0x00), _mm_clmulepi64_si128(value, fold128, 0x11)), _mm_loadu_si128((const __m128i*)bytes));
+		bytes += 16;
+		numBytes -= 16;
+	}
+	
+	//128 bits -> 64 bits
+	__m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+	value = _mm_xor_si128(_mm_clmulepi64_si128(value, fold128, 0x10), _mm_srli_si128(value, 8));
+	//64 bits -> 32 bits
+	__m128i fold64 = _mm_set_epi64x(0, (long long)constants->fold64);
+	value = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(value, mask32), fold64, 0x00), _mm_srli_si128(value, 4));
+	//Barrett reduction
+	__m128i polyMu = _mm_set_epi64x((long long)constants->barrettMu, (long long)constants->polynomial);
+	__m128i temp = _mm_clmulepi64_si128(_mm_and_si128(value, mask32), polyMu, 0x10);
+	temp = _mm_clmulepi64_si128(_mm_and_si128(temp, mask32), polyMu, 0x00);
+	value = _mm_xor_si128(value, temp);
+	return (u32)_mm_extract_epi32(value, 1);
+}
+
+CRC_X86_TARGET_ATTRIBUTE PEXP u32 Crc32cUpdateSse42(u32 crc, const u8* bytes, uxx numBytes)
+{
+	u64 crc64 = crc;
+	while (numBytes >= 8)
+	{
+		u64 word = 0;
+		MyMemCopy(&word, bytes, sizeof(word));
+		crc64 = _mm_crc32_u64(crc64, word);
+		bytes += 8;
+		numBytes -= 8;
+	}
+	crc = (u32)crc64;
+	while (numBytes > 0)
+	{
+		crc = _mm_crc32_u8(crc, bytes[0]);
+		bytes++;
+		numBytes--;
+	}
+	return crc;
+}
+#endif //CRC_X86_HARDWARE_AVAILABLE
+
+// +==============================+
+// |          ARM Paths           |
+// +==============================+
+#if CRC_ARM_HARDWARE_AVAILABLE
+PEXP u32 Crc32UpdateArm(u32 crc, const u8* bytes, uxx numBytes)
+{
+	while (numBytes >= 8)
+	{
+		u64 word = 0;
+		MyMemCopy(&word, bytes, sizeof(word));
+		crc = __crc32d(crc, word);
+		bytes += 8;
+		numBytes -= 8;
+	}
+	while (numBytes > 0) { crc = __crc32b(crc, bytes[0]); bytes++; numBytes--; }
+	return crc;
+}
+PEXP u32 Crc32cUpdateArm(u32 crc, const u8* bytes, uxx numBytes)
+{
+	while (numBytes >= 8)
+	{
+		u64 word = 0;
+		MyMemCopy(&word, bytes, sizeof(word));
+		crc = __crc32cd(crc, word);
+		bytes += 8;
+		numBytes -= 8;
+	}
+	while (numBytes > 0) { crc = __crc32cb(crc, bytes[0]); bytes++; numBytes--; }
+	return crc;
+}
+#endif //CRC_ARM_HARDWARE_AVAILABLE
+
+// +==============================+
+// |         Public API           |
+// +==============================+
+PEXP u32 Crc32Ex(u32 previousCrc, const void* bufferPntr, uxx numBytes)
+{
+	Assert(numBytes == 0 || bufferPntr != nullptr);
+	const u8* bytes = (const u8*)bufferPntr;
+	u32 crc = ~previousCrc;
+	u8 hardware = GetCrcHardwareFlags();
+	UNUSED(hardware);
+	#if CRC_ARM_HARDWARE_AVAILABLE
+	if (hardware & CrcHardware_ArmCrc) { return ~Crc32UpdateArm(crc, bytes, numBytes); }
+	#endif
+	#if CRC_X86_HARDWARE_AVAILABLE
+	if ((hardware & CrcHardware_Pclmul) && (hardware & CrcHardware_Sse42) && numBytes >= 64)
+	{
+		uxx numFoldBytes = (numBytes & ~(uxx)15);
+		crc = CrcUpdatePclmul(&Crc32FoldConstants, crc, bytes, numFoldBytes);
+		bytes += numFoldBytes;
+		numBytes -= numFoldBytes;
+	}
+	#endif
+	if (numBytes > 0) { crc = CrcUpdateSlicing8(&Crc32Tables[0], crc, bytes, numBytes); }
+	return ~crc;
+}
+PEXPI u32 Crc32(const void* bufferPntr, uxx numBytes) { return Crc32Ex(0, bufferPntr, numBytes); }
+
+PEXP u32 Crc32cEx(u32 previousCrc, const void* bufferPntr, uxx numBytes)
+{
+	Assert(numBytes == 0 || bufferPntr != nullptr);
+	const u8* bytes = (const u8*)bufferPntr;
+	u32 crc = ~previousCrc;
+	u8 hardware = GetCrcHardwareFlags();
+	UNUSED(hardware);
+	#if CRC_ARM_HARDWARE_AVAILABLE
+	if (hardware & CrcHardware_ArmCrc) { return ~Crc32cUpdateArm(crc, bytes, numBytes); }
+	#endif
+	#if CRC_X86_HARDWARE_AVAILABLE
+	if (hardware & CrcHardware_Sse42)
+	{
+		//The crc32 instruction has a 3 cycle latency so PCLMULQDQ folding (4 independent lanes) is faster on big buffers
+		if ((hardware & CrcHardware_Pclmul) && numBytes >= 256)
+		{
+			uxx numFoldBytes = (numBytes & ~(uxx)15);
+			crc = CrcUpdatePclmul(&Crc32cFoldConstants, crc, bytes, numFoldBytes);
+			bytes += numFoldBytes;
+			numBytes -= numFoldBytes;
+		}
+		return ~Crc32cUpdateSse42(crc, bytes, numBytes);
+	}
+	#endif
+	if (numBytes > 0) { crc = CrcUpdateSlicing8(&Crc32cTables[0], crc, bytes, numBytes); }
+	return ~crc;
+}
+PEXPI u32 Crc32c(const void* bufferPntr, uxx numBytes) { return Crc32cEx(0, bufferPntr, numBytes); }
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_CRC_H
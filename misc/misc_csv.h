@@ -0,0 +1,428 @@
+/*
+File:   misc_csv.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Reads CSV (RFC 4180) and TSV files directly from a Str8 (ex. the contents from OsReadFile).
+	** The delimiter is chosen when the CsvReader is initialized (',' for CSV, '\t' for TSV, or anything else).
+	** Fields can be quoted with '"' in which case they can contain delimiters, newlines and doubled quotes ("").
+	** Rows can end with "\n", "\r\n" or "\r". Completely empty lines are skipped.
+	** CsvReaderNextRow hands back each row as an array of CsvFields which are slices of the source, nothing
+	** is copied unless a quoted field contains doubled quotes (see DecodeCsvField).
+	** TryCsvReadColumns parses all the remaining rows into typed VarArrays (one VarArray per column).
+	** Finding the end of each field is done 16 bytes at a time using base_simd.h when it's available.
+*/
+
+/*
+* Usage Example:
+*	CsvReader reader;
+*	InitCsvReader(&reader, stdHeap, fileContents, ',');
+*	CsvRow header;
+*	if (CsvReaderNextRow(&reader, &header))
+*	{
+*		VarArray names; InitVarArray(Str8, &names, stdHeap);
+*		VarArray scores; InitVarArray(r64, &scores, stdHeap);
+*		CsvColumn columns[] = {
+*			{ .fieldIndex=FindCsvColumn(&header, StrLit("name")),  .type=CsvColumnType_Str, .values=&names },
+*			{ .fieldIndex=FindCsvColumn(&header, StrLit("score")), .type=CsvColumnType_R64, .values=&scores },
+*		};
+*		if (!TryCsvReadColumns(&reader, ArrayCount(columns), columns)) { PrintLine_E("Row %llu: %s", reader.rowIndex, GetResultStr(reader.error)); }
+*	}
+*	FreeCsvReader(&reader);
+*/
+
+#ifndef _MISC_CSV_H
+#define _MISC_CSV_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_char.h"
+#include "base/base_math.h"
+#include "base/base_simd.h"
+#include "std/std_memset.h"
+#include "std/std_mem_search.h"
+#include "mem/mem_arena.h"
+#include "struct/struct_string.h"
+#include "struct/struct_var_array.h"
+#include "misc/misc_result.h"
+#include "misc/misc_parsing.h"
+
+#define CSV_INVALID_COLUMN UINTXX_MAX //returned from FindCsvColumn when the header doesn't have a column with that name
+
+typedef struct CsvField CsvField;
+struct CsvField
+{
+	Str8 str; //for quoted fields this is the contents between the quotes
+	bool isQuoted;
+	bool hasEscapes; //the field contains doubled quotes (""), use DecodeCsvField to get the actual string
+};
+
+typedef struct CsvRow CsvRow;
+struct CsvRow
+{
+	uxx rowIndex; //counts rows handed out by the reader (including the header), empty lines are not counted
+	uxx index; //where the row starts in the source
+	uxx numFields;
+	CsvField* fields; //owned by the reader, only valid until the next row is read
+};
+
+typedef struct CsvReader CsvReader;
+struct CsvReader
+{
+	Arena* arena; //doubles as IsInit check
+	Str8 source;
+	char delimiter;
+	uxx index;
+	uxx rowIndex;
+	bool finished;
+	Result error;
+	uxx errorIndex;
+	VarArray fields; //CsvField
+};
+
+typedef enum CsvColumnType CsvColumnType;
+enum CsvColumnType
+{
+	CsvColumnType_None = 0,
+	CsvColumnType_Str, //Str8 (slices of the source unless the field has escapes, those are allocated from the VarArray's arena)
+	CsvColumnType_Bool, //bool ("true", "false", "1" or "0", any case)
+	CsvColumnType_I32, //i32
+	CsvColumnType_I64, //i64
+	CsvColumnType_U64, //u64
+	CsvColumnType_R32, //r32
+	CsvColumnType_R64, //r64
+	CsvColumnType_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetCsvColumnTypeStr(CsvColumnType enumValue);
+#else
+PEXP const char* GetCsvColumnTypeStr(CsvColumnType enumValue)
+{
+	switch (enumValue)
+	{
+		case CsvColumnType_None: return "None";
+		case CsvColumnType_Str:  return "Str";
+		case CsvColumnType_Bool: return "Bool";
+		case CsvColumnType_I32:  return "I32";
+		case CsvColumnType_I64:  return "I64";
+		case CsvColumnType_U64:  return "U64";
+		case CsvColumnType_R32:  return "R32";
+		case CsvColumnType_R64:  return "R64";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct CsvColumn CsvColumn;
+struct CsvColumn
+{
+	uxx fieldIndex;
+	CsvColumnType type;
+	VarArray* values; //must be initialized with the item type that matches the CsvColumnType
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE uxx FindCsvFieldEnd_(const u8* bytes, uxx numBytes, char delimiter);
+	void InitCsvReader(CsvReader* reader, Arena* arena, Str8 source, char delimiter);
+	PIG_CORE_INLINE bool IsCsvReaderInit(const CsvReader* reader);
+	void FreeCsvReader(CsvReader* reader);
+	PIG_CORE_INLINE bool CsvReaderError_(CsvReader* reader, Result error, uxx errorIndex);
+	bool CsvReaderNextRow(CsvReader* reader, CsvRow* rowOut);
+	Str8 DecodeCsvField(Arena* arena, const CsvField* field);
+	uxx FindCsvColumn(const CsvRow* headerRow, Str8 name);
+	bool TryParseCsvValue_(Str8 fieldStr, CsvColumnType type, void* valueOut, Result* errorOut);
+	bool TryCsvReadColumns(CsvReader* reader, uxx numColumns, const CsvColumn* columns);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+//Returns the index of the first delimiter, '\n' or '\r' (or numBytes if there are none)
+PEXPI uxx FindCsvFieldEnd_(const u8* bytes, uxx numBytes, char delimiter)
+{
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_SIMD128
+	SimdU8x16 delimiterVec = SimdSplatU8x16((u8)delimiter);
+	SimdU8x16 newLineVec = SimdSplatU8x16('\n');
+	SimdU8x16 carriageReturnVec = SimdSplatU8x16('\r');
+	while (bIndex + 16 <= numBytes)
+	{
+		SimdU8x16 input = SimdLoadU8x16(bytes + bIndex);
+		SimdU8x16 flagged = SimdOrU8x16(SimdEqualsU8x16(input, delimiterVec), SimdOrU8x16(SimdEqualsU8x16(input, newLineVec), SimdEqualsU8x16(input, carriageReturnVec)));
+		u64 mask = SimdHighBitMaskU8x16(flagged);
+		if (mask != 0) { return bIndex + (uxx)(CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE); }
+		bIndex += 16;
+	}
+	#endif
+	
+	for (; bIndex < numBytes; bIndex++)
+	{
+		u8 character = bytes[bIndex];
+		if (character == (u8)delimiter || character == '\n' || character == '\r') { break; }
+	}
+	return bIndex;
+}
+
+// +==============================+
+// |          CsvReader           |
+// +==============================+
+PEXP void InitCsvReader(CsvReader* reader, Arena* arena, Str8 source, char delimiter)
+{
+	NotNull(reader);
+	NotNull(arena);
+	NotNullStr(source);
+	Assert(delimiter != '"' && delimiter != '\n' && delimiter != '\r');
+	ClearPointer(reader);
+	reader->arena = arena;
+	reader->source = source;
+	reader->delimiter = delimiter;
+	InitVarArray(CsvField, &reader->fields, arena);
+	//Skip the UTF-8 byte order mark if there is one
+	if (source.length >= 3 && source.bytes[0] == 0xEF && source.bytes[1] == 0xBB && source.bytes[2] == 0xBF) { reader->index = 3; }
+}
+
+PEXPI bool IsCsvReaderInit(const CsvReader* reader)
+{
+	return (reader->arena != nullptr);
+}
+
+PEXP void FreeCsvReader(CsvReader* reader)
+{
+	NotNull(reader);
+	if (reader->arena != nullptr)
+	{
+		FreeVarArray(&reader->fields);
+	}
+	ClearPointer(reader);
+}
+
+PEXPI bool CsvReaderError_(CsvReader* reader, Result error, uxx errorIndex)
+{
+	reader->finished = true;
+	reader->error = error;
+	reader->errorIndex = errorIndex;
+	return false;
+}
+
+//Returns false at the end of the source or when an error is found (reader->error is Result_None in the former case)
+PEXP bool CsvReaderNextRow(CsvReader* reader, CsvRow* rowOut)
+{
+	NotNull(reader);
+	NotNull(reader->arena);
+	NotNull(rowOut);
+	ClearPointer(rowOut);
+	if (reader->finished) { return false; }
+	
+	Str8 source = reader->source;
+	uxx index = reader->index;
+	while (index < source.length && (source.chars[index] == '\n' || source.chars[index] == '\r')) { index++; }
+	if (index >= source.length)
+	{
+		reader->index = index;
+		reader->finished = true;
+		return false;
+	}
+	
+	VarArrayClear(&reader->fields);
+	rowOut->rowIndex = reader->rowIndex;
+	rowOut->index = index;
+	while (true)
+	{
+		//NOTE: We add to the VarArray by hand since going through VarArrayAdd for every field is a large part of the cost for short fields
+		if (reader->fields.length >= reader->fields.allocLength && !VarArrayExpand(&reader->fields, reader->fields.length+1)) { return CsvReaderError_(reader, Result_FailedToAllocateMemory, index); }
+		CsvField* field = ((CsvField*)reader->fields.items) + reader->fields.length;
+		reader->fields.length++;
+		ClearPointer(field);
+		if (index < source.length && source.chars[index] == '"')
+		{
+			uxx quoteIndex = index;
+			index++;
+			field->isQuoted = true;
+			while (true)
+			{
+				index += MemFindByte(source.bytes + index, source.length - index, '"');
+				if (index >= source.length) { return CsvReaderError_(reader, Result_UnexpectedEnd, quoteIndex); }
+				if (index+1 < source.length && source.chars[index+1] == '"') { field->hasEscapes = true; index += 2; }
+				else { break; }
+			}
+			field->str = StrSlice(source, quoteIndex+1, index);
+			index++;
+			if (index < source.length && source.chars[index] != reader->delimiter && source.chars[index] != '\n' && source.chars[index] != '\r')
+			{
+				return CsvReaderError_(reader, Result_UnexpectedToken, index);
+			}
+		}
+		else
+		{
+			uxx endIndex = index + FindCsvFieldEnd_(source.bytes + index, source.length - index, reader->delimiter);
+			field->str = StrSlice(source, index, endIndex);
+			index = endIndex;
+		}
+		
+		if (index >= source.length) { break; }
+		char character = source.chars[index];
+		index++;
+		if (character == '\r')
+		{
+			if (index < source.length && source.chars[index] == '\n') { index++; }
+			break;
+		}
+		else if (character == '\n') { break; }
+		//Otherwise it's a delimiter and there's another field in this row
+	}
+	
+	reader->index = index;
+	reader->rowIndex++;
+	rowOut->numFields = reader->fields.length;
+	rowOut->fields = (CsvField*)reader->fields.items;
+	return true;
+}
+
+//Fields without doubled quotes are returned as-is, only fields with escapes get allocated in the arena
+PEXP Str8 DecodeCsvField(Arena* arena, const CsvField* field)
+{
+	NotNull(field);
+	if (!field->hasEscapes) { return field->str; }
+	NotNull(arena);
+	uxx numQuotes = 0;
+	for (uxx cIndex = 0; cIndex < field->str.length; cIndex++) { if (field->str.chars[cIndex] == '"') { numQuotes++; } }
+	DebugAssert(numQuotes % 2 == 0);
+	Str8 result = NewStr8(field->str.length - numQuotes/2, nullptr);
+	result.chars = AllocArray(char, arena, result.length);
+	NotNull(result.chars);
+	uxx writeIndex = 0;
+	for (uxx cIndex = 0; cIndex < field->str.length; cIndex++)
+	{
+		result.chars[writeIndex] = field->str.chars[cIndex];
+		writeIndex++;
+		if (field->str.chars[cIndex] == '"') { cIndex++; } //skip the second quote
+	}
+	DebugAssert(writeIndex == result.length);
+	return result;
+}
+
+PEXP uxx FindCsvColumn(const CsvRow* headerRow, Str8 name)
+{
+	NotNull(headerRow);
+	for (uxx fIndex = 0; fIndex < headerRow->numFields; fIndex++)
+	{
+		//NOTE: Header names with doubled quotes are compared as-is, which is fine as long as the name we are looking for has no quotes
+		if (StrExactEquals(headerRow->fields[fIndex].str, name)) { return fIndex; }
+	}
+	return CSV_INVALID_COLUMN;
+}
+
+// +==============================+
+// |      TryCsvReadColumns       |
+// +==============================+
+//Parses the non-string column types. Leading and trailing whitespace is ignored
+PEXP bool TryParseCsvValue_(Str8 fieldStr, CsvColumnType type, void* valueOut, Result* errorOut)
+{
+	Str8 trimmed = TrimWhitespace(fieldStr);
+	switch (type)
+	{
+		case CsvColumnType_Bool:
+		{
+			if (StrAnyCaseEquals(trimmed, StrLit("true")) || StrExactEquals(trimmed, StrLit("1"))) { *(bool*)valueOut = true; return true; }
+			if (StrAnyCaseEquals(trimmed, StrLit("false")) || StrExactEquals(trimmed, StrLit("0"))) { *(bool*)valueOut = false; return true; }
+			SetOptionalOutPntr(errorOut, (trimmed.length == 0) ? Result_EmptyString : Result_InvalidCharacter);
+			return false;
+		} break;
+		case CsvColumnType_I32:
+		{
+			i64 value = 0;
+			if (!TryParseI64Ex(trimmed, &value, errorOut, false, false)) { return false; }
+			if (value < INT32_MIN || value > INT32_MAX) { SetOptionalOutPntr(errorOut, Result_Overflow); return false; }
+			*(i32*)valueOut = (i32)value;
+			return true;
+		} break;
+		case CsvColumnType_I64: return TryParseI64Ex(trimmed, (i64*)valueOut, errorOut, false, false);
+		case CsvColumnType_U64: return TryParseU64Ex(trimmed, (u64*)valueOut, errorOut, false, false);
+		case CsvColumnType_R32: return TryParseR32(trimmed, (r32*)valueOut, errorOut);
+		case CsvColumnType_R64: return TryParseR64(trimmed, (r64*)valueOut, errorOut);
+		default: AssertMsg(false, "Unhandled CsvColumnType in TryParseCsvValue_"); return false;
+	}
+}
+
+//Reads all the remaining rows, adding one value per row to each column's VarArray. Stops at the first field that fails to
+//parse (or a row that is missing a field), in which case reader->error, reader->errorIndex and reader->rowIndex say where.
+//NOTE: Values from the rows before the failure are left in the VarArrays. Values from the failing row are removed
+//from every column, so all the VarArrays always end with the same length
+PEXP bool TryCsvReadColumns(CsvReader* reader, uxx numColumns, const CsvColumn* columns)
+{
+	NotNull(reader);
+	Assert(numColumns == 0 || columns != nullptr);
+	for (uxx cIndex = 0; cIndex < numColumns; cIndex++)
+	{
+		const CsvColumn* column = &columns[cIndex];
+		NotNull(column->values);
+		AssertMsg(column->fieldIndex != CSV_INVALID_COLUMN, "Column passed to TryCsvReadColumns was not found in the header");
+		uxx expectedItemSize = 0;
+		switch (column->type)
+		{
+			case CsvColumnType_Str:  expectedItemSize = sizeof(Str8); break;
+			case CsvColumnType_Bool: expectedItemSize = sizeof(bool); break;
+			case CsvColumnType_I32:  expectedItemSize = sizeof(i32); break;
+			case CsvColumnType_I64:  expectedItemSize = sizeof(i64); break;
+			case CsvColumnType_U64:  expectedItemSize = sizeof(u64); break;
+			case CsvColumnType_R32:  expectedItemSize = sizeof(r32); break;
+			case CsvColumnType_R64:  expectedItemSize = sizeof(r64); break;
+			default: AssertMsg(false, "Invalid CsvColumnType passed to TryCsvReadColumns"); break;
+		}
+		AssertMsg(column->values->itemSize == expectedItemSize, "CsvColumn VarArray was initialized with the wrong item type");
+		UNUSED(expectedItemSize);
+	}
+	
+	CsvRow row;
+	while (CsvReaderNextRow(reader, &row))
+	{
+		for (uxx cIndex = 0; cIndex < numColumns; cIndex++)
+		{
+			if (columns[cIndex].fieldIndex >= row.numFields)
+			{
+				reader->rowIndex = row.rowIndex;
+				return CsvReaderError_(reader, Result_MissingField, row.index);
+			}
+		}
+		//NOTE: Strings can't fail so they are decoded after all the other values in the row parse, that way a failing row never allocates
+		for (uxx cIndex = 0; cIndex < numColumns; cIndex++)
+		{
+			const CsvColumn* column = &columns[cIndex];
+			if (column->type == CsvColumnType_Str) { continue; }
+			const CsvField* field = &row.fields[column->fieldIndex];
+			void* valuePntr = VarArrayAdd_(column->values->itemSize, column->values->itemAlignment, column->values);
+			NotNull(valuePntr);
+			Result parseError = Result_None;
+			if (!TryParseCsvValue_(field->str, column->type, valuePntr, &parseError))
+			{
+				for (uxx rollbackIndex = 0; rollbackIndex <= cIndex; rollbackIndex++)
+				{
+					if (columns[rollbackIndex].type != CsvColumnType_Str) { columns[rollbackIndex].values->length--; }
+				}
+				reader->rowIndex = row.rowIndex;
+				return CsvReaderError_(reader, parseError, (uxx)(field->str.chars - reader->source.chars));
+			}
+		}
+		for (uxx cIndex = 0; cIndex < numColumns; cIndex++)
+		{
+			const CsvColumn* column = &columns[cIndex];
+			if (column->type != CsvColumnType_Str) { continue; }
+			Str8* strPntr = (Str8*)VarArrayAdd_(column->values->itemSize, column->values->itemAlignment, column->values);
+			NotNull(strPntr);
+			*strPntr = DecodeCsvField(column->values->arena, &row.fields[column->fieldIndex]);
+		}
+	}
+	return (reader->error == Result_None);
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_CSV_H
@@ -8,14 +8,26 @@ Description:
 	** useful for making non-linear movement speed animations, but they can be used
 	** for anything where you want to change the velocity of a value delta without
 	** changing the end-points or the duration
+	** EaseArray evaluates one style over a whole array of values with the switch hoisted
+	** out of the loop and the polynomial/circular/bounce styles done 4 at a time with SIMD.
+	** Styles that need Sin/Pow/Log (Sine, Exponential, Elastic, Back, LogTwo) can instead be
+	** baked into an EasingLut and evaluated with linear interpolation between samples.
 */
 
 #ifndef _MISC_EASING_H
 #define _MISC_EASING_H
 
 #include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_assert.h"
+#include "base/base_math.h"
+#include "base/base_simd.h"
 #include "std/std_trig.h"
 #include "std/std_basic_math.h"
+#include "std/std_memset.h"
+#include "mem/mem_arena.h"
+
+#define EASING_LUT_DEFAULT_RESOLUTION 256 //segments, so 257 samples (~1KB)
 
 // In Functions: (slow start, fast end)
 // f(t)
@@ -81,6 +93,18 @@ enum EasingStyle
 	EasingStyle_NumStyles,
 };
 
+//A table of samples of some EasingStyle that can be evaluated with a lookup and a lerp rather than the real function
+//Inputs outside [0, 1] are clamped since there are no samples out there
+typedef struct EasingLut EasingLut;
+struct EasingLut
+{
+	Arena* arena;
+	EasingStyle style;
+	uxx resolution; //number of segments, values has resolution+1 samples so both 0 and 1 are exact
+	r32 resolutionR32;
+	r32* values;
+};
+
 #if !PIG_CORE_IMPLEMENTATION
 const char* GetEasingStyleStr(EasingStyle style);
 #else
@@ -172,6 +196,32 @@ PEXP const char* GetEasingStyleStr(EasingStyle style)
 	PIG_CORE_INLINE r32 EaseLogTwoInCustom(r32 p);
 	r32 Ease(EasingStyle style, r32 p);
 	r32 InverseEase(EasingStyle style, r32 y);
+	#if TARGET_HAS_SIMD128
+	PIG_CORE_INLINE SimdR32x4 EaseQuadraticInx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuadraticOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuadraticInOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseCubicInx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseCubicOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseCubicInOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuarticInx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuarticOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuarticInOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuinticInx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuinticOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseQuinticInOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseCircularInx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseCircularOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseCircularInOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseBounceOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseBounceInx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseBounceInOutx4(SimdR32x4 p);
+	PIG_CORE_INLINE SimdR32x4 EaseEarlyInOutx4(SimdR32x4 p);
+	#endif
+	void EaseArray(EasingStyle style, const r32* inputs, r32* outputs, uxx count);
+	void InitEasingLut(EasingLut* lutOut, Arena* arena, EasingStyle style, uxx resolution);
+	void FreeEasingLut(EasingLut* lut);
+	PIG_CORE_INLINE r32 EaseWithLut(const EasingLut* lut, r32 p);
+	void EaseArrayWithLut(const EasingLut* lut, const r32* inputs, r32* outputs, uxx count);
 #endif //!PIG_CORE_IMPLEMENTATION
 
 // +--------------------------------------------------------------+
@@ -642,6 +692,276 @@ PEXP r32 InverseEase(EasingStyle style, r32 y)
 	};
 }
 
+// +--------------------------------------------------------------+
+// |                        SIMD Functions                        |
+// +--------------------------------------------------------------+
+// These match the scalar versions above operation for operation, so EaseArray gives the same results as calling Ease in a loop
+#if TARGET_HAS_SIMD128
+
+#define EaseLessThanx4(p, value) SimdGreaterR32x4(SimdSplatR32x4(value), (p))
+
+PEXPI SimdR32x4 EaseQuadraticInx4(SimdR32x4 p)
+{
+	return SimdMulR32x4(p, p);
+}
+PEXPI SimdR32x4 EaseQuadraticOutx4(SimdR32x4 p)
+{
+	return SimdSubR32x4(SimdSplatR32x4(0.0f), SimdMulR32x4(p, SimdSubR32x4(p, SimdSplatR32x4(2.0f))));
+}
+PEXPI SimdR32x4 EaseQuadraticInOutx4(SimdR32x4 p)
+{
+	SimdR32x4 lower = SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(2.0f), p), p);
+	SimdR32x4 upper = SimdSubR32x4(SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(-2.0f), p), p), SimdMulR32x4(SimdSplatR32x4(4.0f), p)), SimdSplatR32x4(1.0f));
+	return SimdSelectR32x4(EaseLessThanx4(p, 0.5f), lower, upper);
+}
+
+PEXPI SimdR32x4 EaseCubicInx4(SimdR32x4 p)
+{
+	return SimdMulR32x4(SimdMulR32x4(p, p), p);
+}
+PEXPI SimdR32x4 EaseCubicOutx4(SimdR32x4 p)
+{
+	SimdR32x4 f = SimdSubR32x4(p, SimdSplatR32x4(1.0f));
+	return SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(f, f), f), SimdSplatR32x4(1.0f));
+}
+PEXPI SimdR32x4 EaseCubicInOutx4(SimdR32x4 p)
+{
+	SimdR32x4 lower = SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(4.0f), p), p), p);
+	SimdR32x4 f = SimdSubR32x4(SimdMulR32x4(SimdSplatR32x4(2.0f), p), SimdSplatR32x4(2.0f));
+	SimdR32x4 upper = SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(0.5f), f), f), f), SimdSplatR32x4(1.0f));
+	return SimdSelectR32x4(EaseLessThanx4(p, 0.5f), lower, upper);
+}
+
+PEXPI SimdR32x4 EaseQuarticInx4(SimdR32x4 p)
+{
+	return SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(p, p), p), p);
+}
+PEXPI SimdR32x4 EaseQuarticOutx4(SimdR32x4 p)
+{
+	SimdR32x4 f = SimdSubR32x4(p, SimdSplatR32x4(1.0f));
+	return SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(f, f), f), SimdSubR32x4(SimdSplatR32x4(1.0f), p)), SimdSplatR32x4(1.0f));
+}
+PEXPI SimdR32x4 EaseQuarticInOutx4(SimdR32x4 p)
+{
+	SimdR32x4 lower = SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(8.0f), p), p), p), p);
+	SimdR32x4 f = SimdSubR32x4(p, SimdSplatR32x4(1.0f));
+	SimdR32x4 upper = SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(-8.0f), f), f), f), f), SimdSplatR32x4(1.0f));
+	return SimdSelectR32x4(EaseLessThanx4(p, 0.5f), lower, upper);
+}
+
+PEXPI SimdR32x4 EaseQuinticInx4(SimdR32x4 p)
+{
+	return SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(p, p), p), p), p);
+}
+PEXPI SimdR32x4 EaseQuinticOutx4(SimdR32x4 p)
+{
+	SimdR32x4 f = SimdSubR32x4(p, SimdSplatR32x4(1.0f));
+	return SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(f, f), f), f), f), SimdSplatR32x4(1.0f));
+}
+PEXPI SimdR32x4 EaseQuinticInOutx4(SimdR32x4 p)
+{
+	SimdR32x4 lower = SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(16.0f), p), p), p), p), p);
+	SimdR32x4 f = SimdSubR32x4(SimdMulR32x4(SimdSplatR32x4(2.0f), p), SimdSplatR32x4(2.0f));
+	SimdR32x4 upper = SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(0.5f), f), f), f), f), f), SimdSplatR32x4(1.0f));
+	return SimdSelectR32x4(EaseLessThanx4(p, 0.5f), lower, upper);
+}
+
+PEXPI SimdR32x4 EaseCircularInx4(SimdR32x4 p)
+{
+	return SimdSubR32x4(SimdSplatR32x4(1.0f), SimdSqrtR32x4(SimdSubR32x4(SimdSplatR32x4(1.0f), SimdMulR32x4(p, p))));
+}
+PEXPI SimdR32x4 EaseCircularOutx4(SimdR32x4 p)
+{
+	return SimdSqrtR32x4(SimdMulR32x4(SimdSubR32x4(SimdSplatR32x4(2.0f), p), p));
+}
+PEXPI SimdR32x4 EaseCircularInOutx4(SimdR32x4 p)
+{
+	SimdR32x4 lower = SimdMulR32x4(SimdSplatR32x4(0.5f), SimdSubR32x4(SimdSplatR32x4(1.0f), SimdSqrtR32x4(SimdSubR32x4(SimdSplatR32x4(1.0f), SimdMulR32x4(SimdSplatR32x4(4.0f), SimdMulR32x4(p, p))))));
+	SimdR32x4 twoP = SimdMulR32x4(SimdSplatR32x4(2.0f), p);
+	SimdR32x4 upperRoot = SimdSqrtR32x4(SimdMulR32x4(SimdSubR32x4(SimdSplatR32x4(3.0f), twoP), SimdSubR32x4(twoP, SimdSplatR32x4(1.0f))));
+	SimdR32x4 upper = SimdMulR32x4(SimdSplatR32x4(0.5f), SimdAddR32x4(upperRoot, SimdSplatR32x4(1.0f)));
+	//NOTE: The lanes we don't select can be sqrt of a negative number, that's fine since the NaNs get masked away
+	return SimdSelectR32x4(EaseLessThanx4(p, 0.5f), lower, upper);
+}
+
+//All 4 pieces are evaluated for every lane and then we pick, that's still much cheaper than 4 branchy scalar calls
+PEXPI SimdR32x4 EaseBounceOutx4(SimdR32x4 p)
+{
+	SimdR32x4 piece1 = SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(121.0f), p), p), SimdSplatR32x4(1/16.0f));
+	SimdR32x4 piece2 = SimdAddR32x4(SimdSubR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(363/40.0f), p), p), SimdMulR32x4(SimdSplatR32x4(99/10.0f), p)), SimdSplatR32x4(17/5.0f));
+	SimdR32x4 piece3 = SimdAddR32x4(SimdSubR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(4356/361.0f), p), p), SimdMulR32x4(SimdSplatR32x4(35442/1805.0f), p)), SimdSplatR32x4(16061/1805.0f));
+	SimdR32x4 piece4 = SimdAddR32x4(SimdSubR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(54/5.0f), p), p), SimdMulR32x4(SimdSplatR32x4(513/25.0f), p)), SimdSplatR32x4(268/25.0f));
+	SimdR32x4 result = SimdSelectR32x4(EaseLessThanx4(p, 9/10.0f), piece3, piece4);
+	result = SimdSelectR32x4(EaseLessThanx4(p, 8/11.0f), piece2, result);
+	result = SimdSelectR32x4(EaseLessThanx4(p, 4/11.0f), piece1, result);
+	return result;
+}
+PEXPI SimdR32x4 EaseBounceInx4(SimdR32x4 p)
+{
+	return SimdSubR32x4(SimdSplatR32x4(1.0f), EaseBounceOutx4(SimdSubR32x4(SimdSplatR32x4(1.0f), p)));
+}
+//Both halves are a single EaseBounceOut so we pick the input first and only evaluate it once
+PEXPI SimdR32x4 EaseBounceInOutx4(SimdR32x4 p)
+{
+	SimdU32x4 isLower = EaseLessThanx4(p, 0.5f);
+	SimdR32x4 twoP = SimdMulR32x4(p, SimdSplatR32x4(2.0f));
+	SimdR32x4 bounceInput = SimdSelectR32x4(isLower, SimdSubR32x4(SimdSplatR32x4(1.0f), twoP), SimdSubR32x4(twoP, SimdSplatR32x4(1.0f)));
+	SimdR32x4 bounce = EaseBounceOutx4(bounceInput);
+	SimdR32x4 lower = SimdMulR32x4(SimdSplatR32x4(0.5f), SimdSubR32x4(SimdSplatR32x4(1.0f), bounce));
+	SimdR32x4 upper = SimdAddR32x4(SimdMulR32x4(SimdSplatR32x4(0.5f), bounce), SimdSplatR32x4(0.5f));
+	return SimdSelectR32x4(isLower, lower, upper);
+}
+
+PEXPI SimdR32x4 EaseEarlyInOutx4(SimdR32x4 p)
+{
+	SimdR32x4 p2 = SimdMulR32x4(SimdSplatR32x4(1.2f), p);
+	SimdR32x4 piece1 = SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(2.0f), p2), p2);
+	SimdR32x4 piece2 = SimdSubR32x4(SimdAddR32x4(SimdMulR32x4(SimdMulR32x4(SimdSplatR32x4(-2.0f), p2), p2), SimdMulR32x4(SimdSplatR32x4(4.0f), p2)), SimdSplatR32x4(1.0f));
+	SimdR32x4 result = SimdSelectR32x4(EaseLessThanx4(p, 0.833f), piece2, SimdSplatR32x4(1.0f));
+	result = SimdSelectR32x4(EaseLessThanx4(p, 0.418f), piece1, result);
+	return result;
+}
+
+#undef EaseLessThanx4
+
+#endif //TARGET_HAS_SIMD128
+
+// +--------------------------------------------------------------+
+// |                            Arrays                            |
+// +--------------------------------------------------------------+
+//inputs and outputs are allowed to be the same array
+#define EaseArrayLoop(scalarFunction) do                                                             \
+{                                                                                                     \
+	for (uxx vIndex = 0; vIndex < count; vIndex++) { outputs[vIndex] = scalarFunction(inputs[vIndex]); } \
+} while(0)
+#if TARGET_HAS_SIMD128
+#define EaseArrayLoopSimd(simdFunction, scalarFunction) do                                            \
+{                                                                                                     \
+	uxx vIndex = 0;                                                                                   \
+	for (; vIndex + 4 <= count; vIndex += 4) { SimdStoreR32x4(&outputs[vIndex], simdFunction(SimdLoadR32x4(&inputs[vIndex]))); } \
+	for (; vIndex < count; vIndex++) { outputs[vIndex] = scalarFunction(inputs[vIndex]); }            \
+} while(0)
+#else
+#define EaseArrayLoopSimd(simdFunction, scalarFunction) EaseArrayLoop(scalarFunction)
+#endif
+
+PEXP void EaseArray(EasingStyle style, const r32* inputs, r32* outputs, uxx count)
+{
+	Assert(count == 0 || (inputs != nullptr && outputs != nullptr));
+	switch (style)
+	{
+		case EasingStyle_Linear:           if (outputs != inputs) { MyMemCopy(outputs, inputs, sizeof(r32) * count); } break;
+		case EasingStyle_QuadraticIn:      EaseArrayLoopSimd(EaseQuadraticInx4,    EaseQuadraticIn);    break;
+		case EasingStyle_QuadraticOut:     EaseArrayLoopSimd(EaseQuadraticOutx4,   EaseQuadraticOut);   break;
+		case EasingStyle_QuadraticInOut:   EaseArrayLoopSimd(EaseQuadraticInOutx4, EaseQuadraticInOut); break;
+		case EasingStyle_CubicIn:          EaseArrayLoopSimd(EaseCubicInx4,        EaseCubicIn);        break;
+		case EasingStyle_CubicOut:         EaseArrayLoopSimd(EaseCubicOutx4,       EaseCubicOut);       break;
+		case EasingStyle_CubicInOut:       EaseArrayLoopSimd(EaseCubicInOutx4,     EaseCubicInOut);     break;
+		case EasingStyle_QuarticIn:        EaseArrayLoopSimd(EaseQuarticInx4,      EaseQuarticIn);      break;
+		case EasingStyle_QuarticOut:       EaseArrayLoopSimd(EaseQuarticOutx4,     EaseQuarticOut);     break;
+		case EasingStyle_QuarticInOut:     EaseArrayLoopSimd(EaseQuarticInOutx4,   EaseQuarticInOut);   break;
+		case EasingStyle_QuinticIn:        EaseArrayLoopSimd(EaseQuinticInx4,      EaseQuinticIn);      break;
+		case EasingStyle_QuinticOut:       EaseArrayLoopSimd(EaseQuinticOutx4,     EaseQuinticOut);     break;
+		case EasingStyle_QuinticInOut:     EaseArrayLoopSimd(EaseQuinticInOutx4,   EaseQuinticInOut);   break;
+		case EasingStyle_SineIn:           EaseArrayLoop(EaseSineIn);           break;
+		case EasingStyle_SineOut:          EaseArrayLoop(EaseSineOut);          break;
+		case EasingStyle_SineInOut:        EaseArrayLoop(EaseSineInOut);        break;
+		case EasingStyle_CircularIn:       EaseArrayLoopSimd(EaseCircularInx4,     EaseCircularIn);     break;
+		case EasingStyle_CircularOut:      EaseArrayLoopSimd(EaseCircularOutx4,    EaseCircularOut);    break;
+		case EasingStyle_CircularInOut:    EaseArrayLoopSimd(EaseCircularInOutx4,  EaseCircularInOut);  break;
+		case EasingStyle_ExponentialIn:    EaseArrayLoop(EaseExponentialIn);    break;
+		case EasingStyle_ExponentialOut:   EaseArrayLoop(EaseExponentialOut);   break;
+		case EasingStyle_ExponentialInOut: EaseArrayLoop(EaseExponentialInOut); break;
+		case EasingStyle_ElasticIn:        EaseArrayLoop(EaseElasticIn);        break;
+		case EasingStyle_ElasticOut:       EaseArrayLoop(EaseElasticOut);       break;
+		case EasingStyle_ElasticInOut:     EaseArrayLoop(EaseElasticInOut);     break;
+		case EasingStyle_BackIn:           EaseArrayLoop(EaseBackIn);           break;
+		case EasingStyle_BackOut:          EaseArrayLoop(EaseBackOut);          break;
+		case EasingStyle_BackInOut:        EaseArrayLoop(EaseBackInOut);        break;
+		case EasingStyle_BounceIn:         EaseArrayLoopSimd(EaseBounceInx4,       EaseBounceIn);       break;
+		case EasingStyle_BounceOut:        EaseArrayLoopSimd(EaseBounceOutx4,      EaseBounceOut);      break;
+		case EasingStyle_BounceInOut:      EaseArrayLoopSimd(EaseBounceInOutx4,    EaseBounceInOut);    break;
+		case EasingStyle_EarlyInOut:       EaseArrayLoopSimd(EaseEarlyInOutx4,     EaseEarlyInOut);     break;
+		case EasingStyle_LogTwoOutCustom:  EaseArrayLoop(EaseLogTwoOutCustom);  break;
+		case EasingStyle_LogTwoInCustom:   EaseArrayLoop(EaseLogTwoInCustom);   break;
+		default: Assert(false); if (outputs != inputs) { MyMemCopy(outputs, inputs, sizeof(r32) * count); } break;
+	}
+}
+
+#undef EaseArrayLoop
+#undef EaseArrayLoopSimd
+
+// +--------------------------------------------------------------+
+// |                        Lookup Tables                         |
+// +--------------------------------------------------------------+
+//Pass 0 for resolution to get EASING_LUT_DEFAULT_RESOLUTION. Interpolation error goes down with the square of the
+//resolution for smooth styles, but styles with sharp corners (Bounce, EarlyInOut) will always round off the corners a little
+//and styles that jump (ElasticInOut at 0.5) get a steep ramp across one segment instead of a jump
+PEXP void InitEasingLut(EasingLut* lutOut, Arena* arena, EasingStyle style, uxx resolution)
+{
+	NotNull(lutOut);
+	NotNull(arena);
+	Assert(style > EasingStyle_None && style < EasingStyle_NumStyles);
+	if (resolution == 0) { resolution = EASING_LUT_DEFAULT_RESOLUTION; }
+	ClearPointer(lutOut);
+	lutOut->arena = arena;
+	lutOut->style = style;
+	lutOut->resolution = resolution;
+	lutOut->resolutionR32 = (r32)resolution;
+	lutOut->values = AllocArray(r32, arena, resolution+1);
+	NotNull(lutOut->values);
+	for (uxx sIndex = 0; sIndex < resolution; sIndex++) { lutOut->values[sIndex] = (r32)sIndex / lutOut->resolutionR32; }
+	lutOut->values[resolution] = 1.0f;
+	EaseArray(style, lutOut->values, lutOut->values, resolution+1);
+}
+
+PEXP void FreeEasingLut(EasingLut* lut)
+{
+	NotNull(lut);
+	if (lut->values != nullptr && CanArenaFree(lut->arena)) { FreeMem(lut->arena, lut->values, sizeof(r32) * (lut->resolution+1)); }
+	ClearPointer(lut);
+}
+
+PEXPI r32 EaseWithLut(const EasingLut* lut, r32 p)
+{
+	DebugNotNull(lut);
+	DebugNotNull(lut->values);
+	r32 position = ClampR32(p, 0.0f, 1.0f) * lut->resolutionR32;
+	uxx index = (uxx)position;
+	if (index >= lut->resolution) { index = lut->resolution-1; }
+	r32 fraction = position - (r32)index;
+	return lut->values[index] + (lut->values[index+1] - lut->values[index]) * fraction;
+}
+
+PEXP void EaseArrayWithLut(const EasingLut* lut, const r32* inputs, r32* outputs, uxx count)
+{
+	NotNull(lut);
+	NotNull(lut->values);
+	Assert(count == 0 || (inputs != nullptr && outputs != nullptr));
+	uxx vIndex = 0;
+	#if TARGET_HAS_SIMD128
+	//Clamping and splitting into index + fraction is done 4 at a time, the table reads themselves have to be scalar
+	SimdR32x4 resolutionVec = SimdSplatR32x4(lut->resolutionR32);
+	SimdR32x4 maxIndexVec = SimdSplatR32x4(lut->resolutionR32 - 1.0f);
+	for (; vIndex + 4 <= count; vIndex += 4)
+	{
+		SimdR32x4 position = SimdMulR32x4(SimdMinR32x4(SimdMaxR32x4(SimdLoadR32x4(&inputs[vIndex]), SimdSplatR32x4(0.0f)), SimdSplatR32x4(1.0f)), resolutionVec);
+		SimdR32x4 indexR32 = SimdMinR32x4(SimdFloorR32x4(position), maxIndexVec);
+		SimdR32x4 fraction = SimdSubR32x4(position, indexR32);
+		r32 indices[4];
+		SimdStoreR32x4(&indices[0], indexR32);
+		const r32* samples0 = &lut->values[(uxx)indices[0]];
+		const r32* samples1 = &lut->values[(uxx)indices[1]];
+		const r32* samples2 = &lut->values[(uxx)indices[2]];
+		const r32* samples3 = &lut->values[(uxx)indices[3]];
+		SimdR32x4 lowerVec = SimdSetR32x4(samples0[0], samples1[0], samples2[0], samples3[0]);
+		SimdR32x4 upperVec = SimdSetR32x4(samples0[1], samples1[1], samples2[1], samples3[1]);
+		SimdStoreR32x4(&outputs[vIndex], SimdAddR32x4(lowerVec, SimdMulR32x4(SimdSubR32x4(upperVec, lowerVec), fraction)));
+	}
+	#endif
+	for (; vIndex < count; vIndex++) { outputs[vIndex] = EaseWithLut(lut, inputs[vIndex]); }
+}
+
 #endif //PIG_CORE_IMPLEMENTATION
 
 #endif //  _MISC_EASING_H
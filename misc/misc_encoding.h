@@ -0,0 +1,462 @@
+/*
+File:   misc_encoding.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds functions that encode binary data as text and decode it back again. Supports
+	** hex (base16) and base64 (both the standard "+/" alphabet and the URL-safe "-_" alphabet, RFC 4648).
+	** Each encoding has an Encode\TryDecode pair that writes into a caller provided buffer
+	** (use the GetXEncodedLength\GetXDecodedLength functions to size it exactly) and an InArena
+	** variant that allocates the result from an Arena.
+	** Decoding is strict: any character outside the alphabet (including whitespace) is an error,
+	** hex strings must have an even length, and base64 padding must be correct if present
+	** (unpadded input is also accepted) with the unused bits of the last character set to 0.
+	** Hex encode\decode and base64 encode\decode have 16 byte wide paths using base_simd.h
+	** when SimdLookupU8x16 is available (SSSE3, NEON or WASM SIMD).
+*/
+
+/*
+* Usage Example:
+*	u8 hash[16] = { ... };
+*	Str8 hashHex = EncodeHexInArena(stdHeap, NewStr8(sizeof(hash), &hash[0]), false); //"00112233..."
+*	Str8 base64Str = EncodeBase64InArena(stdHeap, fileContents, false, true);
+*	Slice decodedData = Slice_Empty; Result error = Result_None; uxx errorIndex = 0;
+*	if (!TryDecodeBase64InArena(stdHeap, base64Str, false, &decodedData, &error, &errorIndex)) { PrintLine_E("Invalid base64 at %llu: %s", errorIndex, GetResultStr(error)); }
+*/
+
+#ifndef _MISC_ENCODING_H
+#define _MISC_ENCODING_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_char.h"
+#include "base/base_math.h"
+#include "base/base_simd.h"
+#include "std/std_memset.h"
+#include "mem/mem_arena.h"
+#include "struct/struct_string.h"
+#include "misc/misc_result.h"
+
+#define BASE64_PADDING_CHAR '='
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	extern const char Base64Alphabet[64];
+	extern const char Base64UrlAlphabet[64];
+	PIG_CORE_INLINE uxx GetHexEncodedLength(uxx numBytes);
+	PIG_CORE_INLINE uxx GetHexDecodedLength(uxx numChars);
+	uxx EncodeHex(Slice data, char* bufferOut, bool upperCase);
+	Str8 EncodeHexInArena(Arena* arena, Slice data, bool upperCase);
+	bool TryDecodeHex(Str8 hexStr, u8* bufferOut, Result* errorOut, uxx* errorIndexOut);
+	bool TryDecodeHexInArena(Arena* arena, Str8 hexStr, Slice* dataOut, Result* errorOut, uxx* errorIndexOut);
+	PIG_CORE_INLINE uxx GetBase64EncodedLength(uxx numBytes, bool addPadding);
+	PIG_CORE_INLINE uxx GetBase64DecodedLength(Str8 base64Str);
+	PIG_CORE_INLINE u8 GetBase64CharValue_(char character, bool urlSafe);
+	uxx EncodeBase64(Slice data, char* bufferOut, bool urlSafe, bool addPadding);
+	Str8 EncodeBase64InArena(Arena* arena, Slice data, bool urlSafe, bool addPadding);
+	bool TryDecodeBase64(Str8 base64Str, u8* bufferOut, bool urlSafe, Result* errorOut, uxx* errorIndexOut);
+	bool TryDecodeBase64InArena(Arena* arena, Str8 base64Str, bool urlSafe, Slice* dataOut, Result* errorOut, uxx* errorIndexOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+const char Base64Alphabet[64] = {
+	'A','B','C','D','E','F','G','H','I','J','K','L','M','N','O','P','Q','R','S','T','U','V','W','X','Y','Z',
+	'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v','w','x','y','z',
+	'0','1','2','3','4','5','6','7','8','9','+','/',
+};
+const char Base64UrlAlphabet[64] = {
+	'A','B','C','D','E','F','G','H','I','J','K','L','M','N','O','P','Q','R','S','T','U','V','W','X','Y','Z',
+	'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v','w','x','y','z',
+	'0','1','2','3','4','5','6','7','8','9','-','_',
+};
+
+// +==============================+
+// |             Hex              |
+// +==============================+
+PEXPI uxx GetHexEncodedLength(uxx numBytes) { return numBytes * 2; }
+//NOTE: numChars must be even for the string to be valid, this rounds down
+PEXPI uxx GetHexDecodedLength(uxx numChars) { return numChars / 2; }
+
+//Writes GetHexEncodedLength(data.length) chars to bufferOut (no null-terminator) and returns that number
+PEXP uxx EncodeHex(Slice data, char* bufferOut, bool upperCase)
+{
+	NotNullStr(data);
+	Assert(bufferOut != nullptr || data.length == 0);
+	const char* hexChars = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_SIMD128_LOOKUP
+	{
+		//Each input byte is duplicated so the even chars can take the upper nibble and the odd chars the lower nibble
+		const u8 spreadLowIndices[16]  = { 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7 };
+		const u8 spreadHighIndices[16] = { 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15 };
+		const u8 lowNibbleMask[16] = { 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F };
+		SimdU8x16 hexTable = SimdLoadU8x16(hexChars);
+		SimdU8x16 spreadLow = SimdLoadU8x16(&spreadLowIndices[0]);
+		SimdU8x16 spreadHigh = SimdLoadU8x16(&spreadHighIndices[0]);
+		SimdU8x16 lowMask = SimdLoadU8x16(&lowNibbleMask[0]);
+		SimdU8x16 highMask = SimdXorU8x16(lowMask, SimdSplatU8x16(0x0F));
+		while (bIndex + 16 <= data.length)
+		{
+			SimdU8x16 input = SimdLoadU8x16(data.bytes + bIndex);
+			SimdU8x16 spreadFirst = SimdLookupU8x16(input, spreadLow);
+			SimdU8x16 spreadSecond = SimdLookupU8x16(input, spreadHigh);
+			SimdU8x16 nibblesFirst = SimdOrU8x16(SimdAndU8x16(SimdShiftRight4U8x16(spreadFirst), highMask), SimdAndU8x16(spreadFirst, lowMask));
+			SimdU8x16 nibblesSecond = SimdOrU8x16(SimdAndU8x16(SimdShiftRight4U8x16(spreadSecond), highMask), SimdAndU8x16(spreadSecond, lowMask));
+			SimdStoreU8x16(bufferOut + bIndex*2, SimdLookupU8x16(hexTable, nibblesFirst));
+			SimdStoreU8x16(bufferOut + bIndex*2 + 16, SimdLookupU8x16(hexTable, nibblesSecond));
+			bIndex += 16;
+		}
+	}
+	#endif
+	
+	for (; bIndex < data.length; bIndex++)
+	{
+		bufferOut[bIndex*2 + 0] = hexChars[data.bytes[bIndex] >> 4];
+		bufferOut[bIndex*2 + 1] = hexChars[data.bytes[bIndex] & 0x0F];
+	}
+	return data.length * 2;
+}
+
+PEXP Str8 EncodeHexInArena(Arena* arena, Slice data, bool upperCase)
+{
+	NotNull(arena);
+	uxx numChars = GetHexEncodedLength(data.length);
+	if (numChars == 0) { return Str8_Empty; }
+	char* chars = AllocArray(char, arena, numChars);
+	if (chars == nullptr) { return Str8_Empty; }
+	EncodeHex(data, chars, upperCase);
+	return NewStr8(numChars, chars);
+}
+
+//Accepts upper and lowercase hex digits. Writes GetHexDecodedLength(hexStr.length) bytes to bufferOut
+PEXP bool TryDecodeHex(Str8 hexStr, u8* bufferOut, Result* errorOut, uxx* errorIndexOut)
+{
+	NotNullStr(hexStr);
+	Assert(bufferOut != nullptr || hexStr.length < 2);
+	if ((hexStr.length % 2) != 0)
+	{
+		SetOptionalOutPntr(errorOut, Result_UnexpectedEnd);
+		SetOptionalOutPntr(errorIndexOut, hexStr.length);
+		return false;
+	}
+	uxx cIndex = 0;
+	
+	#if TARGET_HAS_SIMD128_LOOKUP
+	{
+		//Each char is range checked as a digit or a letter (after folding to lowercase), any char outside both
+		//ranges sends us to the scalar loop below which finds the exact index of the invalid char
+		const u8 evenIndices[16] = { 0, 2, 4, 6, 8, 10, 12, 14, 0, 2, 4, 6, 8, 10, 12, 14 };
+		const u8 oddIndices[16]  = { 1, 3, 5, 7, 9, 11, 13, 15, 1, 3, 5, 7, 9, 11, 13, 15 };
+		const u8 timesSixteen[16] = { 0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0 };
+		SimdU8x16 evenVec = SimdLoadU8x16(&evenIndices[0]);
+		SimdU8x16 oddVec = SimdLoadU8x16(&oddIndices[0]);
+		SimdU8x16 shiftTable = SimdLoadU8x16(&timesSixteen[0]);
+		SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+		SimdU8x16 allOnesVec = SimdSplatU8x16(0xFF);
+		SimdU8x16 digitMinVec = SimdSplatU8x16('0');
+		SimdU8x16 digitMaxVec = SimdSplatU8x16('9');
+		SimdU8x16 letterMinVec = SimdSplatU8x16('a');
+		SimdU8x16 letterMaxVec = SimdSplatU8x16('f');
+		SimdU8x16 letterOffsetVec = SimdSplatU8x16('a' - 10);
+		SimdU8x16 lowercaseBitVec = SimdSplatU8x16(0x20);
+		//NOTE: We store 16 bytes but only 8 are valid, so we stop while there's still room in bufferOut for the extra 8
+		while (cIndex + 32 <= hexStr.length)
+		{
+			SimdU8x16 input = SimdLoadU8x16(hexStr.bytes + cIndex);
+			SimdU8x16 lowercase = SimdOrU8x16(input, lowercaseBitVec);
+			SimdU8x16 isDigit = SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(input, digitMaxVec), zeroVec), SimdEqualsU8x16(SimdSubSatU8x16(digitMinVec, input), zeroVec));
+			SimdU8x16 isLetter = SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(lowercase, letterMaxVec), zeroVec), SimdEqualsU8x16(SimdSubSatU8x16(letterMinVec, lowercase), zeroVec));
+			if (SimdAnyHighBitU8x16(SimdXorU8x16(SimdOrU8x16(isDigit, isLetter), allOnesVec))) { break; }
+			SimdU8x16 nibbles = SimdOrU8x16(SimdAndU8x16(isDigit, SimdSubSatU8x16(input, digitMinVec)), SimdAndU8x16(isLetter, SimdSubSatU8x16(lowercase, letterOffsetVec)));
+			SimdU8x16 highNibbles = SimdLookupU8x16(shiftTable, SimdLookupU8x16(nibbles, evenVec));
+			SimdStoreU8x16(bufferOut + cIndex/2, SimdOrU8x16(highNibbles, SimdLookupU8x16(nibbles, oddVec)));
+			cIndex += 16;
+		}
+	}
+	#endif
+	
+	for (; cIndex < hexStr.length; cIndex += 2)
+	{
+		char highChar = hexStr.chars[cIndex + 0];
+		char lowChar = hexStr.chars[cIndex + 1];
+		if (!IsCharHexadecimal(CharToU32(highChar)) || !IsCharHexadecimal(CharToU32(lowChar)))
+		{
+			SetOptionalOutPntr(errorOut, Result_InvalidCharacter);
+			SetOptionalOutPntr(errorIndexOut, IsCharHexadecimal(CharToU32(highChar)) ? cIndex+1 : cIndex);
+			return false;
+		}
+		bufferOut[cIndex/2] = (u8)((GetHexCharValue(highChar) << 4) | GetHexCharValue(lowChar));
+	}
+	return true;
+}
+
+PEXP bool TryDecodeHexInArena(Arena* arena, Str8 hexStr, Slice* dataOut, Result* errorOut, uxx* errorIndexOut)
+{
+	NotNull(arena);
+	NotNull(dataOut);
+	uxx numBytes = GetHexDecodedLength(hexStr.length);
+	u8* bytes = nullptr;
+	if (numBytes > 0)
+	{
+		bytes = AllocArray(u8, arena, numBytes);
+		if (bytes == nullptr) { SetOptionalOutPntr(errorOut, Result_FailedToAllocateMemory); SetOptionalOutPntr(errorIndexOut, 0); return false; }
+	}
+	if (!TryDecodeHex(hexStr, bytes, errorOut, errorIndexOut))
+	{
+		if (bytes != nullptr && CanArenaFree(arena)) { FreeMem(arena, bytes, numBytes); }
+		return false;
+	}
+	*dataOut = NewStr8(numBytes, bytes);
+	return true;
+}
+
+// +==============================+
+// |            Base64            |
+// +==============================+
+PEXPI uxx GetBase64EncodedLength(uxx numBytes, bool addPadding)
+{
+	return addPadding ? (((numBytes + 2) / 3) * 4) : ((numBytes / 3) * 4 + (((numBytes % 3) != 0) ? (numBytes % 3) + 1 : 0));
+}
+//This is exact for valid base64 strings (padded or unpadded)
+PEXPI uxx GetBase64DecodedLength(Str8 base64Str)
+{
+	uxx numChars = base64Str.length;
+	if (numChars > 0 && base64Str.chars[numChars-1] == BASE64_PADDING_CHAR) { numChars--; }
+	if (numChars > 0 && base64Str.chars[numChars-1] == BASE64_PADDING_CHAR) { numChars--; }
+	return (numChars / 4) * 3 + (((numChars % 4) != 0) ? (numChars % 4) - 1 : 0);
+}
+
+//Returns 0xFF for chars that aren't part of the alphabet
+PEXPI u8 GetBase64CharValue_(char character, bool urlSafe)
+{
+	if (character >= 'A' && character <= 'Z') { return (u8)(character - 'A'); }
+	if (character >= 'a' && character <= 'z') { return (u8)(character - 'a' + 26); }
+	if (character >= '0' && character <= '9') { return (u8)(character - '0' + 52); }
+	if (character == (urlSafe ? '-' : '+')) { return 62; }
+	if (character == (urlSafe ? '_' : '/')) { return 63; }
+	return 0xFF;
+}
+
+//Writes GetBase64EncodedLength(data.length, addPadding) chars to bufferOut (no null-terminator) and returns that number
+PEXP uxx EncodeBase64(Slice data, char* bufferOut, bool urlSafe, bool addPadding)
+{
+	NotNullStr(data);
+	Assert(bufferOut != nullptr || data.length == 0);
+	const char* alphabet = urlSafe ? &Base64UrlAlphabet[0] : &Base64Alphabet[0];
+	uxx bIndex = 0;
+	uxx cIndex = 0;
+	
+	#if TARGET_HAS_SIMD128_LOOKUP
+	{
+		//Each 32-bit lane gets 3 input bytes arranged as [b1, b0, b2, b1] so each of the 4 sextets can be pulled out with a shift and a mask
+		const u8 shuffleIndices[16] = { 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 };
+		//Sextets are turned into chars by adding an offset that depends on which range they are in (see reduced below)
+		const u8 offsets[16] = {
+			(u8)('a' - 26),
+			(u8)('0' - 52), (u8)('0' - 52), (u8)('0' - 52), (u8)('0' - 52), (u8)('0' - 52),
+			(u8)('0' - 52), (u8)('0' - 52), (u8)('0' - 52), (u8)('0' - 52), (u8)('0' - 52),
+			(u8)(alphabet[62] - 62), (u8)(alphabet[63] - 63), (u8)'A', 0, 0,
+		};
+		SimdU8x16 shuffleVec = SimdLoadU8x16(&shuffleIndices[0]);
+		SimdU8x16 offsetTable = SimdLoadU8x16(&offsets[0]);
+		SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+		SimdU8x16 vec25 = SimdSplatU8x16(25);
+		SimdU8x16 vec51 = SimdSplatU8x16(51);
+		SimdU8x16 vec13 = SimdSplatU8x16(13);
+		SimdU32x4 mask0 = SimdSplatU32x4(0x0000003F);
+		SimdU32x4 mask1 = SimdSplatU32x4(0x00003F00);
+		SimdU32x4 mask2 = SimdSplatU32x4(0x003F0000);
+		SimdU32x4 mask3 = SimdSplatU32x4(0x3F000000);
+		//NOTE: Each step reads 16 bytes but only consumes 12
+		while (bIndex + 16 <= data.length)
+		{
+			SimdU32x4 lanes = SimdCastU8ToU32x4(SimdLookupU8x16(SimdLoadU8x16(data.bytes + bIndex), shuffleVec));
+			SimdU32x4 sextets = SimdOrU32x4(
+				SimdOrU32x4(SimdAndU32x4(SimdShiftRightU32x4(lanes, 10), mask0), SimdAndU32x4(SimdShiftLeftU32x4(lanes, 4), mask1)),
+				SimdOrU32x4(SimdAndU32x4(SimdShiftRightU32x4(lanes, 6), mask2), SimdAndU32x4(SimdShiftLeftU32x4(lanes, 8), mask3))
+			);
+			SimdU8x16 values = SimdCastU32ToU8x16(sextets);
+			//reduced is 13 for [0,25], 0 for [26,51], 1-10 for [52,61], 11 for 62 and 12 for 63
+			SimdU8x16 reduced = SimdSubSatU8x16(values, vec51);
+			reduced = SimdOrU8x16(reduced, SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(values, vec25), zeroVec), vec13));
+			SimdStoreU8x16(bufferOut + cIndex, SimdAddU8x16(values, SimdLookupU8x16(offsetTable, reduced)));
+			bIndex += 12;
+			cIndex += 16;
+		}
+	}
+	#endif
+	
+	for (; bIndex + 3 <= data.length; bIndex += 3)
+	{
+		u32 triple = ((u32)data.bytes[bIndex] << 16) | ((u32)data.bytes[bIndex+1] << 8) | (u32)data.bytes[bIndex+2];
+		bufferOut[cIndex+0] = alphabet[(triple >> 18) & 0x3F];
+		bufferOut[cIndex+1] = alphabet[(triple >> 12) & 0x3F];
+		bufferOut[cIndex+2] = alphabet[(triple >> 6) & 0x3F];
+		bufferOut[cIndex+3] = alphabet[triple & 0x3F];
+		cIndex += 4;
+	}
+	uxx numLeftover = data.length - bIndex;
+	if (numLeftover > 0)
+	{
+		u32 triple = ((u32)data.bytes[bIndex] << 16) | ((numLeftover > 1) ? ((u32)data.bytes[bIndex+1] << 8) : 0);
+		bufferOut[cIndex+0] = alphabet[(triple >> 18) & 0x3F];
+		bufferOut[cIndex+1] = alphabet[(triple >> 12) & 0x3F];
+		cIndex += 2;
+		if (numLeftover > 1) { bufferOut[cIndex] = alphabet[(triple >> 6) & 0x3F]; cIndex++; }
+		if (addPadding)
+		{
+			bufferOut[cIndex] = BASE64_PADDING_CHAR; cIndex++;
+			if (numLeftover == 1) { bufferOut[cIndex] = BASE64_PADDING_CHAR; cIndex++; }
+		}
+	}
+	DebugAssert(cIndex == GetBase64EncodedLength(data.length, addPadding));
+	return cIndex;
+}
+
+PEXP Str8 EncodeBase64InArena(Arena* arena, Slice data, bool urlSafe, bool addPadding)
+{
+	NotNull(arena);
+	uxx numChars = GetBase64EncodedLength(data.length, addPadding);
+	if (numChars == 0) { return Str8_Empty; }
+	char* chars = AllocArray(char, arena, numChars);
+	if (chars == nullptr) { return Str8_Empty; }
+	EncodeBase64(data, chars, urlSafe, addPadding);
+	return NewStr8(numChars, chars);
+}
+
+//Writes GetBase64DecodedLength(base64Str) bytes to bufferOut. Padding is optional, but if present it must be correct
+PEXP bool TryDecodeBase64(Str8 base64Str, u8* bufferOut, bool urlSafe, Result* errorOut, uxx* errorIndexOut)
+{
+	NotNullStr(base64Str);
+	uxx numChars = base64Str.length;
+	uxx numPadding = 0;
+	while (numChars > 0 && numPadding < 2 && base64Str.chars[numChars-1] == BASE64_PADDING_CHAR) { numChars--; numPadding++; }
+	//Padded strings must be a multiple of 4 long, and a single leftover char (6 bits) can't make a whole byte
+	if ((numPadding > 0 && (base64Str.length % 4) != 0) || (numChars % 4) == 1)
+	{
+		SetOptionalOutPntr(errorOut, Result_UnexpectedEnd);
+		SetOptionalOutPntr(errorIndexOut, numChars);
+		return false;
+	}
+	uxx numBytes = GetBase64DecodedLength(base64Str);
+	Assert(bufferOut != nullptr || numBytes == 0);
+	uxx cIndex = 0;
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_SIMD128_LOOKUP
+	{
+		//Each char is range checked against the 5 parts of the alphabet. Any char outside all of them sends us to the scalar
+		//loop below which finds the exact index of the invalid char. Otherwise the sextets are packed back into 3 bytes per lane
+		char char62 = (urlSafe ? '-' : '+');
+		char char63 = (urlSafe ? '_' : '/');
+		const u8 compactIndices[16] = { 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 0, 0, 0, 0 };
+		SimdU8x16 compactVec = SimdLoadU8x16(&compactIndices[0]);
+		SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+		SimdU8x16 allOnesVec = SimdSplatU8x16(0xFF);
+		SimdU8x16 upperMinVec = SimdSplatU8x16('A');
+		SimdU8x16 upperMaxVec = SimdSplatU8x16('Z');
+		SimdU8x16 lowerMinVec = SimdSplatU8x16('a');
+		SimdU8x16 lowerMaxVec = SimdSplatU8x16('z');
+		SimdU8x16 digitMinVec = SimdSplatU8x16('0');
+		SimdU8x16 digitMaxVec = SimdSplatU8x16('9');
+		SimdU8x16 char62Vec = SimdSplatU8x16((u8)char62);
+		SimdU8x16 char63Vec = SimdSplatU8x16((u8)char63);
+		SimdU8x16 upperOffsetVec = SimdSplatU8x16((u8)(0 - 'A'));
+		SimdU8x16 lowerOffsetVec = SimdSplatU8x16((u8)(26 - 'a'));
+		SimdU8x16 digitOffsetVec = SimdSplatU8x16((u8)(52 - '0'));
+		SimdU8x16 offset62Vec = SimdSplatU8x16((u8)(62 - char62));
+		SimdU8x16 offset63Vec = SimdSplatU8x16((u8)(63 - char63));
+		SimdU32x4 mask0 = SimdSplatU32x4(0x00FC0000);
+		SimdU32x4 mask1 = SimdSplatU32x4(0x0003F000);
+		SimdU32x4 mask2 = SimdSplatU32x4(0x00000FC0);
+		//NOTE: We store 16 bytes but only 12 are valid, so we stop while there's still room in bufferOut for the extra 4
+		while (cIndex + 16 <= numChars && bIndex + 16 <= numBytes)
+		{
+			SimdU8x16 input = SimdLoadU8x16(base64Str.bytes + cIndex);
+			SimdU8x16 isUpper = SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(input, upperMaxVec), zeroVec), SimdEqualsU8x16(SimdSubSatU8x16(upperMinVec, input), zeroVec));
+			SimdU8x16 isLower = SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(input, lowerMaxVec), zeroVec), SimdEqualsU8x16(SimdSubSatU8x16(lowerMinVec, input), zeroVec));
+			SimdU8x16 isDigit = SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(input, digitMaxVec), zeroVec), SimdEqualsU8x16(SimdSubSatU8x16(digitMinVec, input), zeroVec));
+			SimdU8x16 is62 = SimdEqualsU8x16(input, char62Vec);
+			SimdU8x16 is63 = SimdEqualsU8x16(input, char63Vec);
+			SimdU8x16 isValid = SimdOrU8x16(SimdOrU8x16(isUpper, isLower), SimdOrU8x16(isDigit, SimdOrU8x16(is62, is63)));
+			if (SimdAnyHighBitU8x16(SimdXorU8x16(isValid, allOnesVec))) { break; }
+			SimdU8x16 offsets = SimdOrU8x16(
+				SimdOrU8x16(SimdAndU8x16(isUpper, upperOffsetVec), SimdAndU8x16(isLower, lowerOffsetVec)),
+				SimdOrU8x16(SimdAndU8x16(isDigit, digitOffsetVec), SimdOrU8x16(SimdAndU8x16(is62, offset62Vec), SimdAndU8x16(is63, offset63Vec)))
+			);
+			//Each lane holds 4 sextets [s0, s1, s2, s3] which become the 24 bit value (s0 << 18) | (s1 << 12) | (s2 << 6) | s3
+			SimdU32x4 lanes = SimdCastU8ToU32x4(SimdAddU8x16(input, offsets));
+			SimdU32x4 packed = SimdOrU32x4(
+				SimdOrU32x4(SimdAndU32x4(SimdShiftLeftU32x4(lanes, 18), mask0), SimdAndU32x4(SimdShiftLeftU32x4(lanes, 4), mask1)),
+				SimdOrU32x4(SimdAndU32x4(SimdShiftRightU32x4(lanes, 10), mask2), SimdShiftRightU32x4(lanes, 24))
+			);
+			SimdStoreU8x16(bufferOut + bIndex, SimdLookupU8x16(SimdCastU32ToU8x16(packed), compactVec));
+			cIndex += 16;
+			bIndex += 12;
+		}
+	}
+	#endif
+	
+	u32 accumulator = 0;
+	u8 numBits = 0;
+	for (; cIndex < numChars; cIndex++)
+	{
+		u8 value = GetBase64CharValue_(base64Str.chars[cIndex], urlSafe);
+		if (value == 0xFF)
+		{
+			SetOptionalOutPntr(errorOut, Result_InvalidCharacter);
+			SetOptionalOutPntr(errorIndexOut, cIndex);
+			return false;
+		}
+		accumulator = (accumulator << 6) | value;
+		numBits += 6;
+		if (numBits >= 8)
+		{
+			numBits -= 8;
+			bufferOut[bIndex] = (u8)(accumulator >> numBits);
+			bIndex++;
+		}
+	}
+	//The bits of the last char that didn't make it into a byte must be 0, otherwise there's more than one string that decodes to the same data
+	if ((accumulator & ((1U << numBits) - 1)) != 0)
+	{
+		SetOptionalOutPntr(errorOut, Result_InvalidCharacter);
+		SetOptionalOutPntr(errorIndexOut, numChars-1);
+		return false;
+	}
+	DebugAssert(bIndex == numBytes);
+	return true;
+}
+
+PEXP bool TryDecodeBase64InArena(Arena* arena, Str8 base64Str, bool urlSafe, Slice* dataOut, Result* errorOut, uxx* errorIndexOut)
+{
+	NotNull(arena);
+	NotNull(dataOut);
+	uxx numBytes = GetBase64DecodedLength(base64Str);
+	u8* bytes = nullptr;
+	if (numBytes > 0)
+	{
+		bytes = AllocArray(u8, arena, numBytes);
+		if (bytes == nullptr) { SetOptionalOutPntr(errorOut, Result_FailedToAllocateMemory); SetOptionalOutPntr(errorIndexOut, 0); return false; }
+	}
+	if (!TryDecodeBase64(base64Str, bytes, urlSafe, errorOut, errorIndexOut))
+	{
+		if (bytes != nullptr && CanArenaFree(arena)) { FreeMem(arena, bytes, numBytes); }
+		return false;
+	}
+	*dataOut = NewStr8(numBytes, bytes);
+	return true;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_ENCODING_H
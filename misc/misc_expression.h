@@ -0,0 +1,1084 @@
+/*
+File:   misc_expression.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Compiles math expressions like "baseDamage * pow(1.15, level - 1) + (isBoss ? 50 : 0)"
+	** into a compact stack bytecode (stored in an Arena) that can be evaluated over and over
+	** without re-parsing. Variables are registered in an ExprScope ahead of time and compiled
+	** down to a handle (an index into the values array you pass to EvaluateExpression).
+	** Literals, named constants and any sub-expression that only depends on constants are
+	** folded at compile time. The last input of each instruction can come straight from a
+	** constant or variable, so "x * 2" is a single instruction rather than push, push, multiply.
+	** EvaluateExpressionBatch runs each instruction across EXPR_BATCH_SIZE sets of variable
+	** bindings at once, which amortizes the dispatch and lets the compiler vectorize the arithmetic.
+	** Supported syntax (highest precedence first):
+	**   numbers, identifiers, func(args...), (parens)
+	**   ^ (power, right associative)
+	**   unary - + !
+	**   * / %
+	**   + -
+	**   < <= > >=
+	**   == !=
+	**   && (both sides are always evaluated, there is no short circuiting)
+	**   ||
+	**   cond ? a : b (both a and b are always evaluated)
+	** Comparisons and logical operators produce 1 or 0, anything non-zero is considered true.
+	** Built-in constants: pi, tau, e. See GetExprOpFunctionName for the list of functions.
+*/
+
+/*
+* Usage Example:
+*	ExprScope scope;
+*	InitExprScope(&scope, stdHeap);
+*	uxx levelHandle = AddExprVariable(&scope, StrLit("level"));
+*	AddExprConstant(&scope, StrLit("baseDamage"), 12.0);
+*	Expression damageExpr;
+*	Result error = Result_None; uxx errorIndex = 0;
+*	if (!TryCompileExpression(stdHeap, StrLit("baseDamage * pow(1.15, level - 1)"), &scope, &damageExpr, &error, &errorIndex)) { PrintLine_E("Error at %llu: %s", errorIndex, GetResultStr(error)); }
+*	r64 values[1] = { 0 };
+*	values[levelHandle] = 10;
+*	r64 damage = EvaluateExpression(&damageExpr, values);
+*/
+
+#ifndef _MISC_EXPRESSION_H
+#define _MISC_EXPRESSION_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_char.h"
+#include "base/base_math.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "std/std_trig.h"
+#include "mem/mem_arena.h"
+#include "mem/mem_scratch.h"
+#include "struct/struct_string.h"
+#include "struct/struct_var_array.h"
+#include "misc/misc_result.h"
+#include "misc/misc_parsing.h"
+
+#define EXPR_MAX_STACK_DEPTH 64 //expressions that need a deeper stack than this fail to compile with Result_TooComplex
+#define EXPR_MAX_NESTING     256 //limits the parser's recursion depth on things like "((((((x))))))"
+#define EXPR_MAX_OPERAND     0xFFFF //max number of constants\variables an expression can refer to
+#define EXPR_BATCH_SIZE      64 //number of bindings EvaluateExpressionBatch evaluates each instruction over at a time
+
+typedef enum ExprTokenType ExprTokenType;
+enum ExprTokenType
+{
+	ExprTokenType_None = 0, //returned at the end of the string
+	ExprTokenType_Number,
+	ExprTokenType_Identifier,
+	ExprTokenType_Operator,
+	ExprTokenType_OpenParens,
+	ExprTokenType_CloseParens,
+	ExprTokenType_Comma,
+	ExprTokenType_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetExprTokenTypeStr(ExprTokenType enumValue);
+#else
+PEXP const char* GetExprTokenTypeStr(ExprTokenType enumValue)
+{
+	switch (enumValue)
+	{
+		case ExprTokenType_None:        return "None";
+		case ExprTokenType_Number:      return "Number";
+		case ExprTokenType_Identifier:  return "Identifier";
+		case ExprTokenType_Operator:    return "Operator";
+		case ExprTokenType_OpenParens:  return "OpenParens";
+		case ExprTokenType_CloseParens: return "CloseParens";
+		case ExprTokenType_Comma:       return "Comma";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct ExprToken ExprToken;
+struct ExprToken
+{
+	ExprTokenType type;
+	uxx index; //where str starts in the expression string
+	Str8 str;
+	r64 value; //only filled for ExprTokenType_Number
+};
+
+//NOTE: These are stored in a u8 in ExprInstr so we can't have more than 256 of them
+typedef enum ExprOp ExprOp;
+enum ExprOp
+{
+	ExprOp_None = 0,
+	
+	//1 input
+	ExprOp_Identity, //pushes a constant or variable onto the stack
+	ExprOp_Negate,
+	ExprOp_Not,
+	ExprOp_Abs,
+	ExprOp_Sign,
+	ExprOp_Floor,
+	ExprOp_Ceil,
+	ExprOp_Round,
+	ExprOp_Sqrt,
+	ExprOp_Cbrt,
+	ExprOp_Exp,
+	ExprOp_Ln,
+	ExprOp_Log2,
+	ExprOp_Log10,
+	ExprOp_Sin,
+	ExprOp_Cos,
+	ExprOp_Tan,
+	ExprOp_Asin,
+	ExprOp_Acos,
+	ExprOp_Atan,
+	ExprOp_Saturate,
+	
+	//2 inputs
+	ExprOp_Add,
+	ExprOp_Subtract,
+	ExprOp_Multiply,
+	ExprOp_Divide,
+	ExprOp_Modulo,
+	ExprOp_Power,
+	ExprOp_Less,
+	ExprOp_LessOrEqual,
+	ExprOp_Greater,
+	ExprOp_GreaterOrEqual,
+	ExprOp_Equal,
+	ExprOp_NotEqual,
+	ExprOp_And,
+	ExprOp_Or,
+	ExprOp_Min,
+	ExprOp_Max,
+	ExprOp_Atan2,
+	
+	//3 inputs
+	ExprOp_Select,
+	ExprOp_Clamp,
+	ExprOp_Lerp,
+	
+	ExprOp_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetExprOpStr(ExprOp enumValue);
+#else
+PEXP const char* GetExprOpStr(ExprOp enumValue)
+{
+	switch (enumValue)
+	{
+		case ExprOp_None:           return "None";
+		case ExprOp_Identity:       return "Identity";
+		case ExprOp_Negate:         return "Negate";
+		case ExprOp_Not:            return "Not";
+		case ExprOp_Abs:            return "Abs";
+		case ExprOp_Sign:           return "Sign";
+		case ExprOp_Floor:          return "Floor";
+		case ExprOp_Ceil:           return "Ceil";
+		case ExprOp_Round:          return "Round";
+		case ExprOp_Sqrt:           return "Sqrt";
+		case ExprOp_Cbrt:           return "Cbrt";
+		case ExprOp_Exp:            return "Exp";
+		case ExprOp_Ln:             return "Ln";
+		case ExprOp_Log2:           return "Log2";
+		case ExprOp_Log10:          return "Log10";
+		case ExprOp_Sin:            return "Sin";
+		case ExprOp_Cos:            return "Cos";
+		case ExprOp_Tan:            return "Tan";
+		case ExprOp_Asin:           return "Asin";
+		case ExprOp_Acos:           return "Acos";
+		case ExprOp_Atan:           return "Atan";
+		case ExprOp_Saturate:       return "Saturate";
+		case ExprOp_Add:            return "Add";
+		case ExprOp_Subtract:       return "Subtract";
+		case ExprOp_Multiply:       return "Multiply";
+		case ExprOp_Divide:         return "Divide";
+		case ExprOp_Modulo:         return "Modulo";
+		case ExprOp_Power:          return "Power";
+		case ExprOp_Less:           return "Less";
+		case ExprOp_LessOrEqual:    return "LessOrEqual";
+		case ExprOp_Greater:        return "Greater";
+		case ExprOp_GreaterOrEqual: return "GreaterOrEqual";
+		case ExprOp_Equal:          return "Equal";
+		case ExprOp_NotEqual:       return "NotEqual";
+		case ExprOp_And:            return "And";
+		case ExprOp_Or:             return "Or";
+		case ExprOp_Min:            return "Min";
+		case ExprOp_Max:            return "Max";
+		case ExprOp_Atan2:          return "Atan2";
+		case ExprOp_Select:         return "Select";
+		case ExprOp_Clamp:          return "Clamp";
+		case ExprOp_Lerp:           return "Lerp";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+//Where an instruction's last input comes from, any other inputs are always popped off the stack
+typedef enum ExprSource ExprSource;
+enum ExprSource
+{
+	ExprSource_Stack = 0,
+	ExprSource_Constant, //operand is an index into expression->constants
+	ExprSource_Variable, //operand is a variable handle
+	ExprSource_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetExprSourceStr(ExprSource enumValue);
+#else
+PEXP const char* GetExprSourceStr(ExprSource enumValue)
+{
+	switch (enumValue)
+	{
+		case ExprSource_Stack:    return "Stack";
+		case ExprSource_Constant: return "Constant";
+		case ExprSource_Variable: return "Variable";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct ExprInstr ExprInstr;
+struct ExprInstr
+{
+	u8 op; //ExprOp
+	u8 source; //ExprSource
+	u16 operand;
+};
+
+typedef struct ExprSymbol ExprSymbol;
+struct ExprSymbol
+{
+	Str8 name; //allocated from the scope's arena
+	bool isVariable;
+	uxx variableHandle; //only valid if isVariable
+	r64 constantValue; //only valid if !isVariable
+};
+
+//Holds the names that expressions are allowed to refer to. Variables are given handles in the order they are added (0, 1, 2...)
+typedef struct ExprScope ExprScope;
+struct ExprScope
+{
+	Arena* arena; //doubles as IsInit check
+	uxx numVariables;
+	VarArray symbols; //ExprSymbol
+};
+
+typedef struct Expression Expression;
+struct Expression
+{
+	Arena* arena; //doubles as IsInit check
+	uxx numInstructions;
+	ExprInstr* instructions;
+	uxx numConstants;
+	r64* constants;
+	uxx maxStackDepth;
+	uxx numVariables; //highest variable handle used + 1, the values passed to EvaluateExpression must be at least this long
+};
+
+//Used while compiling, keeps track of the current token and everything we've emitted so far
+typedef struct ExprCompiler ExprCompiler;
+struct ExprCompiler
+{
+	Str8 str;
+	const ExprScope* scope; //may be nullptr
+	uxx index; //just past the current token
+	ExprToken token;
+	uxx nesting;
+	//Every token emits at most one instruction and one constant so these are allocated up front (from scratch) with room for one per character
+	uxx maxItems;
+	uxx numInstructions;
+	ExprInstr* instructions;
+	uxx numConstants;
+	r64* constants; //may contain constants that were folded away, these are removed when the Expression is made
+	Result error;
+	uxx errorIndex;
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE u8 GetExprOpNumInputs(ExprOp op);
+	PIG_CORE_INLINE const char* GetExprOpFunctionName(ExprOp op);
+	PIG_CORE_INLINE ExprOp FindExprFunction(Str8 name);
+	PIG_CORE_INLINE r64 ExprApplyOp_(ExprOp op, const r64* inputs);
+	void InitExprScope(ExprScope* scope, Arena* arena);
+	PIG_CORE_INLINE bool IsExprScopeInit(const ExprScope* scope);
+	void FreeExprScope(ExprScope* scope);
+	PIG_CORE_INLINE ExprSymbol* FindExprSymbol(const ExprScope* scope, Str8 name);
+	PIG_CORE_INLINE ExprSymbol* AddExprSymbol_(ExprScope* scope, Str8 name);
+	uxx AddExprVariable(ExprScope* scope, Str8 name);
+	void AddExprConstant(ExprScope* scope, Str8 name, r64 value);
+	bool TryGetExprToken(Str8 str, uxx* indexInOut, ExprToken* tokenOut, Result* errorOut);
+	PIG_CORE_INLINE bool ExprCompilerError_(ExprCompiler* compiler, Result error, uxx errorIndex);
+	PIG_CORE_INLINE bool ExprCompilerNext_(ExprCompiler* compiler);
+	PIG_CORE_INLINE bool IsExprCompilerOperator_(const ExprCompiler* compiler, const char* operatorStr);
+	PIG_CORE_INLINE u8 GetExprBinaryOperator_(const ExprCompiler* compiler, ExprOp* opOut);
+	PIG_CORE_INLINE bool ExprCompilerPush_(ExprCompiler* compiler, ExprSource source, uxx operand);
+	PIG_CORE_INLINE bool ExprCompilerPushConstant_(ExprCompiler* compiler, r64 value);
+	bool ExprCompilerEmit_(ExprCompiler* compiler, ExprOp op);
+	PIG_CORE_INLINE void ExprCompilerSwapOperands_(ExprCompiler* compiler, ExprOp* opInOut, uxx leftStart, uxx rightStart);
+	bool ExprCompilerParsePrimary_(ExprCompiler* compiler);
+	bool ExprCompilerParseUnary_(ExprCompiler* compiler);
+	bool ExprCompilerParseExpression_(ExprCompiler* compiler, u8 minPrecedence);
+	bool TryCompileExpression(Arena* arena, Str8 expressionStr, const ExprScope* scope, Expression* expressionOut, Result* errorOut, uxx* errorIndexOut);
+	PIG_CORE_INLINE bool IsExpressionInit(const Expression* expression);
+	void FreeExpression(Expression* expression);
+	r64 EvaluateExpression(const Expression* expression, const r64* values);
+	void EvaluateExpressionBatch(const Expression* expression, uxx count, const r64* const* variableArrays, const r64* uniformValues, r64* resultsOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+#define EXPR_PRECEDENCE_TERNARY 1
+#define EXPR_PRECEDENCE_POWER   9 //unary operators parse their operand at this precedence so -2^2 is -(2^2)
+
+//The single source of truth for what each op does. Each evaluator (constant folding, EvaluateExpression, EvaluateExpressionBatch)
+//defines Unary, Binary and Ternary to turn these into switch cases where a, b and c are the inputs
+#define ExprOpFormulas_(Unary, Binary, Ternary)                   \
+	Unary(Identity,         a)                                   \
+	Unary(Negate,           -a)                                  \
+	Unary(Not,              (a == 0.0) ? 1.0 : 0.0)              \
+	Unary(Abs,              AbsR64(a))                           \
+	Unary(Sign,             SignOfR64(a))                        \
+	Unary(Floor,            FloorR64(a))                         \
+	Unary(Ceil,             CeilR64(a))                          \
+	Unary(Round,            RoundR64(a))                         \
+	Unary(Sqrt,             SqrtR64(a))                          \
+	Unary(Cbrt,             CbrtR64(a))                          \
+	Unary(Exp,              ExpR64(a))                           \
+	Unary(Ln,               LnR64(a))                            \
+	Unary(Log2,             Log2R64(a))                          \
+	Unary(Log10,            Log10R64(a))                         \
+	Unary(Sin,              SinR64(a))                           \
+	Unary(Cos,              CosR64(a))                           \
+	Unary(Tan,              TanR64(a))                           \
+	Unary(Asin,             AsinR64(a))                          \
+	Unary(Acos,             AcosR64(a))                          \
+	Unary(Atan,             AtanJoinedR64(a))                    \
+	Unary(Saturate,         ClampR64(a, 0.0, 1.0))               \
+	Binary(Add,             a + b)                               \
+	Binary(Subtract,        a - b)                               \
+	Binary(Multiply,        a * b)                               \
+	Binary(Divide,          a / b)                               \
+	Binary(Modulo,          ModR64(a, b))                        \
+	Binary(Power,           PowR64(a, b))                        \
+	Binary(Less,            (a < b) ? 1.0 : 0.0)                 \
+	Binary(LessOrEqual,     (a <= b) ? 1.0 : 0.0)                \
+	Binary(Greater,         (a > b) ? 1.0 : 0.0)                 \
+	Binary(GreaterOrEqual,  (a >= b) ? 1.0 : 0.0)                \
+	Binary(Equal,           (a == b) ? 1.0 : 0.0)                \
+	Binary(NotEqual,        (a != b) ? 1.0 : 0.0)                \
+	Binary(And,             (a != 0.0 && b != 0.0) ? 1.0 : 0.0)  \
+	Binary(Or,              (a != 0.0 || b != 0.0) ? 1.0 : 0.0)  \
+	Binary(Min,             MinR64(a, b))                        \
+	Binary(Max,             MaxR64(a, b))                        \
+	Binary(Atan2,           AtanR64(a, b))                       \
+	Ternary(Select,         (a != 0.0) ? b : c)                  \
+	Ternary(Clamp,          ClampR64(a, b, c))                   \
+	Ternary(Lerp,           LerpR64(a, b, c))
+
+#define ExprNumInputsUnary_(name, formula)   case ExprOp_##name: return 1;
+#define ExprNumInputsBinary_(name, formula)  case ExprOp_##name: return 2;
+#define ExprNumInputsTernary_(name, formula) case ExprOp_##name: return 3;
+PEXPI u8 GetExprOpNumInputs(ExprOp op)
+{
+	switch (op)
+	{
+		ExprOpFormulas_(ExprNumInputsUnary_, ExprNumInputsBinary_, ExprNumInputsTernary_)
+		default: return 0;
+	}
+}
+#undef ExprNumInputsUnary_
+#undef ExprNumInputsBinary_
+#undef ExprNumInputsTernary_
+
+//Returns nullptr for ops that can't be called like a function (they are only reachable through operators)
+PEXPI const char* GetExprOpFunctionName(ExprOp op)
+{
+	switch (op)
+	{
+		case ExprOp_Abs:      return "abs";
+		case ExprOp_Sign:     return "sign";
+		case ExprOp_Floor:    return "floor";
+		case ExprOp_Ceil:     return "ceil";
+		case ExprOp_Round:    return "round";
+		case ExprOp_Sqrt:     return "sqrt";
+		case ExprOp_Cbrt:     return "cbrt";
+		case ExprOp_Exp:      return "exp";
+		case ExprOp_Ln:       return "ln";
+		case ExprOp_Log2:     return "log2";
+		case ExprOp_Log10:    return "log10";
+		case ExprOp_Sin:      return "sin";
+		case ExprOp_Cos:      return "cos";
+		case ExprOp_Tan:      return "tan";
+		case ExprOp_Asin:     return "asin";
+		case ExprOp_Acos:     return "acos";
+		case ExprOp_Atan:     return "atan";
+		case ExprOp_Saturate: return "saturate";
+		case ExprOp_Modulo:   return "mod";
+		case ExprOp_Power:    return "pow";
+		case ExprOp_Min:      return "min";
+		case ExprOp_Max:      return "max";
+		case ExprOp_Atan2:    return "atan2"; //atan2(y, x)
+		case ExprOp_Select:   return "select"; //select(condition, ifTrue, ifFalse)
+		case ExprOp_Clamp:    return "clamp"; //clamp(value, min, max)
+		case ExprOp_Lerp:     return "lerp"; //lerp(from, to, amount)
+		default: return nullptr;
+	}
+}
+
+PEXPI ExprOp FindExprFunction(Str8 name)
+{
+	for (uxx opIndex = 1; opIndex < ExprOp_Count; opIndex++)
+	{
+		const char* functionName = GetExprOpFunctionName((ExprOp)opIndex);
+		if (functionName != nullptr && StrExactEquals(name, StrLit(functionName))) { return (ExprOp)opIndex; }
+	}
+	return ExprOp_None;
+}
+
+#define ExprApplyUnary_(name, formula)   case ExprOp_##name: { r64 a = inputs[0]; return (formula); }
+#define ExprApplyBinary_(name, formula)  case ExprOp_##name: { r64 a = inputs[0]; r64 b = inputs[1]; return (formula); }
+#define ExprApplyTernary_(name, formula) case ExprOp_##name: { r64 a = inputs[0]; r64 b = inputs[1]; r64 c = inputs[2]; return (formula); }
+//Used for constant folding, inputs must hold GetExprOpNumInputs(op) values
+PEXPI r64 ExprApplyOp_(ExprOp op, const r64* inputs)
+{
+	switch (op)
+	{
+		ExprOpFormulas_(ExprApplyUnary_, ExprApplyBinary_, ExprApplyTernary_)
+		default: AssertMsg(false, "Unhandled ExprOp in ExprApplyOp_"); return 0.0;
+	}
+}
+#undef ExprApplyUnary_
+#undef ExprApplyBinary_
+#undef ExprApplyTernary_
+
+// +==============================+
+// |          ExprScope           |
+// +==============================+
+PEXP void InitExprScope(ExprScope* scope, Arena* arena)
+{
+	NotNull(scope);
+	NotNull(arena);
+	ClearPointer(scope);
+	scope->arena = arena;
+	InitVarArray(ExprSymbol, &scope->symbols, arena);
+}
+
+PEXPI bool IsExprScopeInit(const ExprScope* scope)
+{
+	return (scope->arena != nullptr);
+}
+
+PEXP void FreeExprScope(ExprScope* scope)
+{
+	NotNull(scope);
+	if (scope->arena != nullptr)
+	{
+		if (CanArenaFree(scope->arena))
+		{
+			VarArrayLoop(&scope->symbols, sIndex)
+			{
+				VarArrayLoopGet(ExprSymbol, symbol, &scope->symbols, sIndex);
+				FreeMem(scope->arena, symbol->name.chars, symbol->name.length);
+			}
+		}
+		FreeVarArray(&scope->symbols);
+	}
+	ClearPointer(scope);
+}
+
+PEXPI ExprSymbol* FindExprSymbol(const ExprScope* scope, Str8 name)
+{
+	NotNull(scope);
+	VarArrayLoop(&scope->symbols, sIndex)
+	{
+		VarArrayLoopGet(ExprSymbol, symbol, &scope->symbols, sIndex);
+		if (StrExactEquals(symbol->name, name)) { return symbol; }
+	}
+	return nullptr;
+}
+
+PEXPI ExprSymbol* AddExprSymbol_(ExprScope* scope, Str8 name)
+{
+	NotNull(scope);
+	Assert(IsExprScopeInit(scope));
+	AssertMsg(name.length > 0 && IsValidIdentifier(name.length, name.chars, false, false, false), "ExprScope names must be valid identifiers");
+	AssertMsg(FindExprSymbol(scope, name) == nullptr, "Tried to add the same name to an ExprScope twice");
+	ExprSymbol* newSymbol = VarArrayAdd(ExprSymbol, &scope->symbols);
+	NotNull(newSymbol);
+	ClearPointer(newSymbol);
+	char* nameChars = AllocArray(char, scope->arena, name.length);
+	NotNull(nameChars);
+	MyMemCopy(nameChars, name.chars, name.length);
+	newSymbol->name = NewStr8(name.length, nameChars);
+	return newSymbol;
+}
+
+//Returns the handle for this variable, which is the index you should put its value at when evaluating
+PEXP uxx AddExprVariable(ExprScope* scope, Str8 name)
+{
+	ExprSymbol* newSymbol = AddExprSymbol_(scope, name);
+	newSymbol->isVariable = true;
+	newSymbol->variableHandle = scope->numVariables;
+	scope->numVariables++;
+	return newSymbol->variableHandle;
+}
+
+//Named constants are folded into the bytecode at compile time, changing them requires recompiling any expressions that use them
+PEXP void AddExprConstant(ExprScope* scope, Str8 name, r64 value)
+{
+	ExprSymbol* newSymbol = AddExprSymbol_(scope, name);
+	newSymbol->isVariable = false;
+	newSymbol->constantValue = value;
+}
+
+// +==============================+
+// |          Tokenizer           |
+// +==============================+
+//Skips whitespace and reads the next token starting at *indexInOut, moving *indexInOut past it.
+//Returns true with tokenOut->type == ExprTokenType_None when we reach the end of the string
+PEXP bool TryGetExprToken(Str8 str, uxx* indexInOut, ExprToken* tokenOut, Result* errorOut)
+{
+	NotNullStr(str);
+	NotNull(indexInOut);
+	NotNull(tokenOut);
+	uxx cIndex = *indexInOut;
+	while (cIndex < str.length && IsCharWhitespace(CharToU32(str.chars[cIndex]), true)) { cIndex++; }
+	ClearPointer(tokenOut);
+	tokenOut->index = cIndex;
+	if (cIndex >= str.length) { *indexInOut = cIndex; tokenOut->type = ExprTokenType_None; return true; }
+	
+	char c = str.chars[cIndex];
+	char nextChar = (cIndex+1 < str.length) ? str.chars[cIndex+1] : '\0';
+	uxx tokenEnd = cIndex+1;
+	if (IsCharNumeric(CharToU32(c)) || (c == '.' && IsCharNumeric(CharToU32(nextChar))))
+	{
+		tokenOut->type = ExprTokenType_Number;
+		tokenEnd = cIndex;
+		while (tokenEnd < str.length && (IsCharNumeric(CharToU32(str.chars[tokenEnd])) || str.chars[tokenEnd] == '.')) { tokenEnd++; }
+		if (tokenEnd < str.length && (str.chars[tokenEnd] == 'e' || str.chars[tokenEnd] == 'E'))
+		{
+			uxx exponentIndex = tokenEnd+1;
+			if (exponentIndex < str.length && (str.chars[exponentIndex] == '-' || str.chars[exponentIndex] == '+')) { exponentIndex++; }
+			if (exponentIndex < str.length && IsCharNumeric(CharToU32(str.chars[exponentIndex])))
+			{
+				tokenEnd = exponentIndex;
+				while (tokenEnd < str.length && IsCharNumeric(CharToU32(str.chars[tokenEnd]))) { tokenEnd++; }
+			}
+		}
+		Str8 numberStr = NewStr8(tokenEnd - cIndex, &str.chars[cIndex]);
+		if (!TryParseR64(numberStr, &tokenOut->value, errorOut)) { return false; }
+	}
+	else if (IsCharAlphabetic(CharToU32(c)) || c == '_')
+	{
+		tokenOut->type = ExprTokenType_Identifier;
+		while (tokenEnd < str.length && (IsCharAlphaNumeric(CharToU32(str.chars[tokenEnd])) || str.chars[tokenEnd] == '_')) { tokenEnd++; }
+	}
+	else if (c == '(') { tokenOut->type = ExprTokenType_OpenParens; }
+	else if (c == ')') { tokenOut->type = ExprTokenType_CloseParens; }
+	else if (c == ',') { tokenOut->type = ExprTokenType_Comma; }
+	else if ((c == '<' || c == '>' || c == '=' || c == '!') && nextChar == '=') { tokenOut->type = ExprTokenType_Operator; tokenEnd++; }
+	else if ((c == '&' || c == '|') && nextChar == c) { tokenOut->type = ExprTokenType_Operator; tokenEnd++; }
+	else if (c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '^' || c == '<' || c == '>' || c == '!' || c == '?' || c == ':')
+	{
+		tokenOut->type = ExprTokenType_Operator;
+	}
+	else { SetOptionalOutPntr(errorOut, Result_InvalidCharacter); return false; }
+	
+	tokenOut->str = NewStr8(tokenEnd - cIndex, &str.chars[cIndex]);
+	*indexInOut = tokenEnd;
+	return true;
+}
+
+// +==============================+
+// |           Compiler           |
+// +==============================+
+//Always returns false so it can be used like "return ExprCompilerError_(...)". Only the first error is kept
+PEXPI bool ExprCompilerError_(ExprCompiler* compiler, Result error, uxx errorIndex)
+{
+	if (compiler->error == Result_None)
+	{
+		compiler->error = error;
+		compiler->errorIndex = errorIndex;
+	}
+	return false;
+}
+
+PEXPI bool ExprCompilerNext_(ExprCompiler* compiler)
+{
+	Result tokenError = Result_None;
+	if (!TryGetExprToken(compiler->str, &compiler->index, &compiler->token, &tokenError))
+	{
+		return ExprCompilerError_(compiler, tokenError, compiler->token.index);
+	}
+	return true;
+}
+
+PEXPI bool IsExprCompilerOperator_(const ExprCompiler* compiler, const char* operatorStr)
+{
+	return (compiler->token.type == ExprTokenType_Operator && StrExactEquals(compiler->token.str, StrLit(operatorStr)));
+}
+
+//Returns 0 if the current token is not a binary operator
+PEXPI u8 GetExprBinaryOperator_(const ExprCompiler* compiler, ExprOp* opOut)
+{
+	if (compiler->token.type != ExprTokenType_Operator) { return 0; }
+	if (IsExprCompilerOperator_(compiler, "||")) { *opOut = ExprOp_Or;             return 2; }
+	if (IsExprCompilerOperator_(compiler, "&&")) { *opOut = ExprOp_And;            return 3; }
+	if (IsExprCompilerOperator_(compiler, "==")) { *opOut = ExprOp_Equal;          return 4; }
+	if (IsExprCompilerOperator_(compiler, "!=")) { *opOut = ExprOp_NotEqual;       return 4; }
+	if (IsExprCompilerOperator_(compiler, "<"))  { *opOut = ExprOp_Less;           return 5; }
+	if (IsExprCompilerOperator_(compiler, "<=")) { *opOut = ExprOp_LessOrEqual;    return 5; }
+	if (IsExprCompilerOperator_(compiler, ">"))  { *opOut = ExprOp_Greater;        return 5; }
+	if (IsExprCompilerOperator_(compiler, ">=")) { *opOut = ExprOp_GreaterOrEqual; return 5; }
+	if (IsExprCompilerOperator_(compiler, "+"))  { *opOut = ExprOp_Add;            return 6; }
+	if (IsExprCompilerOperator_(compiler, "-"))  { *opOut = ExprOp_Subtract;       return 6; }
+	if (IsExprCompilerOperator_(compiler, "*"))  { *opOut = ExprOp_Multiply;       return 7; }
+	if (IsExprCompilerOperator_(compiler, "/"))  { *opOut = ExprOp_Divide;         return 7; }
+	if (IsExprCompilerOperator_(compiler, "%"))  { *opOut = ExprOp_Modulo;         return 7; }
+	if (IsExprCompilerOperator_(compiler, "^"))  { *opOut = ExprOp_Power;          return EXPR_PRECEDENCE_POWER; }
+	return 0;
+}
+
+PEXPI bool ExprCompilerPush_(ExprCompiler* compiler, ExprSource source, uxx operand)
+{
+	if (operand > EXPR_MAX_OPERAND) { return ExprCompilerError_(compiler, Result_TooComplex, compiler->token.index); }
+	Assert(compiler->numInstructions < compiler->maxItems);
+	ExprInstr* newInstr = &compiler->instructions[compiler->numInstructions];
+	compiler->numInstructions++;
+	newInstr->op = (u8)ExprOp_Identity;
+	newInstr->source = (u8)source;
+	newInstr->operand = (u16)operand;
+	return true;
+}
+
+PEXPI bool ExprCompilerPushConstant_(ExprCompiler* compiler, r64 value)
+{
+	Assert(compiler->numConstants < compiler->maxItems);
+	uxx constantIndex = compiler->numConstants;
+	compiler->constants[compiler->numConstants] = value;
+	compiler->numConstants++;
+	return ExprCompilerPush_(compiler, ExprSource_Constant, constantIndex);
+}
+
+//Emits an op that takes its inputs from whatever was emitted before it. If all the inputs are constants the op is folded,
+//otherwise if the last input was a lone push of a constant or variable, that push is folded into this instruction's source
+PEXP bool ExprCompilerEmit_(ExprCompiler* compiler, ExprOp op)
+{
+	u8 numInputs = GetExprOpNumInputs(op);
+	Assert(numInputs > 0 && numInputs <= 3);
+	uxx numInstructions = compiler->numInstructions;
+	Assert(numInstructions >= numInputs);
+	ExprInstr* instructions = compiler->instructions;
+	const r64* constants = compiler->constants;
+	
+	bool allConstant = true;
+	for (uxx iIndex = numInstructions - numInputs; iIndex < numInstructions; iIndex++)
+	{
+		if (instructions[iIndex].op != ExprOp_Identity || instructions[iIndex].source != ExprSource_Constant) { allConstant = false; break; }
+	}
+	if (allConstant)
+	{
+		r64 inputs[3];
+		for (uxx inputIndex = 0; inputIndex < numInputs; inputIndex++)
+		{
+			inputs[inputIndex] = constants[instructions[numInstructions - numInputs + inputIndex].operand];
+		}
+		compiler->numInstructions -= numInputs;
+		return ExprCompilerPushConstant_(compiler, ExprApplyOp_(op, &inputs[0]));
+	}
+	
+	ExprInstr newInstr = ZEROED;
+	newInstr.op = (u8)op;
+	newInstr.source = (u8)ExprSource_Stack;
+	ExprInstr lastInstr = instructions[numInstructions-1];
+	if (lastInstr.op == ExprOp_Identity && lastInstr.source != ExprSource_Stack)
+	{
+		newInstr.source = lastInstr.source;
+		newInstr.operand = lastInstr.operand;
+		compiler->numInstructions--;
+	}
+	Assert(compiler->numInstructions < compiler->maxItems);
+	compiler->instructions[compiler->numInstructions] = newInstr;
+	compiler->numInstructions++;
+	return true;
+}
+
+//If the left side of a binary op is a lone push of a constant or variable (like the "2" in "2 * (x + 1)") and the op can have
+//its operands swapped, we move that push after the right side so ExprCompilerEmit_ can fold it into the op's source
+PEXPI void ExprCompilerSwapOperands_(ExprCompiler* compiler, ExprOp* opInOut, uxx leftStart, uxx rightStart)
+{
+	ExprOp swappedOp = ExprOp_None;
+	switch (*opInOut)
+	{
+		case ExprOp_Add:            swappedOp = ExprOp_Add;            break;
+		case ExprOp_Multiply:       swappedOp = ExprOp_Multiply;       break;
+		case ExprOp_Equal:          swappedOp = ExprOp_Equal;          break;
+		case ExprOp_NotEqual:       swappedOp = ExprOp_NotEqual;       break;
+		case ExprOp_And:            swappedOp = ExprOp_And;            break;
+		case ExprOp_Or:             swappedOp = ExprOp_Or;             break;
+		case ExprOp_Less:           swappedOp = ExprOp_Greater;        break;
+		case ExprOp_LessOrEqual:    swappedOp = ExprOp_GreaterOrEqual; break;
+		case ExprOp_Greater:        swappedOp = ExprOp_Less;           break;
+		case ExprOp_GreaterOrEqual: swappedOp = ExprOp_LessOrEqual;    break;
+		default: return;
+	}
+	ExprInstr leftInstr = compiler->instructions[leftStart];
+	bool isLeftLonePush = (rightStart == leftStart + 1 && leftInstr.op == ExprOp_Identity && leftInstr.source != ExprSource_Stack);
+	ExprInstr rightLastInstr = compiler->instructions[compiler->numInstructions-1];
+	bool isRightLonePush = (compiler->numInstructions == rightStart + 1 && rightLastInstr.op == ExprOp_Identity && rightLastInstr.source != ExprSource_Stack);
+	if (!isLeftLonePush || isRightLonePush) { return; }
+	MyMemMove(&compiler->instructions[leftStart], &compiler->instructions[rightStart], sizeof(ExprInstr) * (compiler->numInstructions - rightStart));
+	compiler->instructions[compiler->numInstructions-1] = leftInstr;
+	*opInOut = swappedOp;
+}
+
+PEXP bool ExprCompilerParseExpression_(ExprCompiler* compiler, u8 minPrecedence); //pre-declared since parsing is mutually recursive
+
+PEXP bool ExprCompilerParsePrimary_(ExprCompiler* compiler)
+{
+	ExprToken token = compiler->token;
+	if (token.type == ExprTokenType_Number)
+	{
+		if (!ExprCompilerPushConstant_(compiler, token.value)) { return false; }
+		return ExprCompilerNext_(compiler);
+	}
+	else if (token.type == ExprTokenType_Identifier)
+	{
+		if (!ExprCompilerNext_(compiler)) { return false; }
+		if (compiler->token.type == ExprTokenType_OpenParens)
+		{
+			ExprOp functionOp = FindExprFunction(token.str);
+			if (functionOp == ExprOp_None) { return ExprCompilerError_(compiler, Result_UnknownIdentifier, token.index); }
+			if (!ExprCompilerNext_(compiler)) { return false; }
+			uxx numArgs = 0;
+			if (compiler->token.type != ExprTokenType_CloseParens)
+			{
+				while (true)
+				{
+					if (!ExprCompilerParseExpression_(compiler, 0)) { return false; }
+					numArgs++;
+					if (compiler->token.type != ExprTokenType_Comma) { break; }
+					if (!ExprCompilerNext_(compiler)) { return false; }
+				}
+			}
+			if (compiler->token.type != ExprTokenType_CloseParens) { return ExprCompilerError_(compiler, Result_UnexpectedToken, compiler->token.index); }
+			if (numArgs != GetExprOpNumInputs(functionOp)) { return ExprCompilerError_(compiler, Result_WrongNumArguments, token.index); }
+			if (!ExprCompilerNext_(compiler)) { return false; }
+			return ExprCompilerEmit_(compiler, functionOp);
+		}
+		
+		ExprSymbol* symbol = (compiler->scope != nullptr) ? FindExprSymbol(compiler->scope, token.str) : nullptr;
+		if (symbol != nullptr && symbol->isVariable) { return ExprCompilerPush_(compiler, ExprSource_Variable, symbol->variableHandle); }
+		else if (symbol != nullptr) { return ExprCompilerPushConstant_(compiler, symbol->constantValue); }
+		else if (StrExactEquals(token.str, StrLit("pi"))) { return ExprCompilerPushConstant_(compiler, Pi64); }
+		else if (StrExactEquals(token.str, StrLit("tau"))) { return ExprCompilerPushConstant_(compiler, TwoPi64); }
+		else if (StrExactEquals(token.str, StrLit("e"))) { return ExprCompilerPushConstant_(compiler, 2.71828182845904523536); }
+		else { return ExprCompilerError_(compiler, Result_UnknownIdentifier, token.index); }
+	}
+	else if (token.type == ExprTokenType_OpenParens)
+	{
+		if (!ExprCompilerNext_(compiler)) { return false; }
+		if (!ExprCompilerParseExpression_(compiler, 0)) { return false; }
+		if (compiler->token.type != ExprTokenType_CloseParens) { return ExprCompilerError_(compiler, Result_UnexpectedToken, compiler->token.index); }
+		return ExprCompilerNext_(compiler);
+	}
+	else { return ExprCompilerError_(compiler, Result_UnexpectedToken, token.index); }
+}
+
+PEXP bool ExprCompilerParseUnary_(ExprCompiler* compiler)
+{
+	ExprOp unaryOp = ExprOp_None;
+	if (IsExprCompilerOperator_(compiler, "-")) { unaryOp = ExprOp_Negate; }
+	else if (IsExprCompilerOperator_(compiler, "!")) { unaryOp = ExprOp_Not; }
+	else if (!IsExprCompilerOperator_(compiler, "+")) { return ExprCompilerParsePrimary_(compiler); }
+	
+	if (!ExprCompilerNext_(compiler)) { return false; }
+	if (!ExprCompilerParseExpression_(compiler, EXPR_PRECEDENCE_POWER)) { return false; }
+	return (unaryOp != ExprOp_None) ? ExprCompilerEmit_(compiler, unaryOp) : true;
+}
+
+//Precedence climbing, parses a unary expression followed by any binary operators that bind at least as tight as minPrecedence
+PEXP bool ExprCompilerParseExpression_(ExprCompiler* compiler, u8 minPrecedence)
+{
+	if (compiler->nesting >= EXPR_MAX_NESTING) { return ExprCompilerError_(compiler, Result_TooComplex, compiler->token.index); }
+	compiler->nesting++;
+	uxx leftStart = compiler->numInstructions;
+	bool result = ExprCompilerParseUnary_(compiler);
+	while (result)
+	{
+		if (minPrecedence <= EXPR_PRECEDENCE_TERNARY && IsExprCompilerOperator_(compiler, "?"))
+		{
+			result = (ExprCompilerNext_(compiler) && ExprCompilerParseExpression_(compiler, EXPR_PRECEDENCE_TERNARY));
+			if (result && !IsExprCompilerOperator_(compiler, ":")) { result = ExprCompilerError_(compiler, Result_UnexpectedToken, compiler->token.index); }
+			result = (result && ExprCompilerNext_(compiler) && ExprCompilerParseExpression_(compiler, EXPR_PRECEDENCE_TERNARY));
+			result = (result && ExprCompilerEmit_(compiler, ExprOp_Select));
+			continue;
+		}
+		
+		ExprOp binaryOp = ExprOp_None;
+		u8 precedence = GetExprBinaryOperator_(compiler, &binaryOp);
+		if (precedence == 0 || precedence < minPrecedence) { break; }
+		//Power is right associative, everything else is left associative
+		u8 rightPrecedence = (binaryOp == ExprOp_Power) ? precedence : (u8)(precedence + 1);
+		uxx rightStart = compiler->numInstructions;
+		result = (ExprCompilerNext_(compiler) && ExprCompilerParseExpression_(compiler, rightPrecedence));
+		if (result) { ExprCompilerSwapOperands_(compiler, &binaryOp, leftStart, rightStart); }
+		result = (result && ExprCompilerEmit_(compiler, binaryOp));
+	}
+	compiler->nesting--;
+	return result;
+}
+
+//On failure errorIndexOut is filled with the character index in expressionStr where the problem was found
+//NOTE: Variable handles are baked into the bytecode, adding more variables to the scope later doesn't affect existing Expressions
+PEXP bool TryCompileExpression(Arena* arena, Str8 expressionStr, const ExprScope* scope, Expression* expressionOut, Result* errorOut, uxx* errorIndexOut)
+{
+	NotNull(arena);
+	NotNullStr(expressionStr);
+	NotNull(expressionOut);
+	Assert(scope == nullptr || IsExprScopeInit(scope));
+	ScratchBegin1(scratch, arena);
+	
+	ExprCompiler compiler = ZEROED;
+	compiler.str = expressionStr;
+	compiler.scope = scope;
+	compiler.maxItems = expressionStr.length + 1;
+	compiler.instructions = AllocArray(ExprInstr, scratch, compiler.maxItems);
+	compiler.constants = AllocArray(r64, scratch, compiler.maxItems);
+	NotNull(compiler.instructions);
+	NotNull(compiler.constants);
+	
+	bool parsed = ExprCompilerNext_(&compiler);
+	if (parsed && compiler.token.type == ExprTokenType_None) { parsed = ExprCompilerError_(&compiler, Result_EmptyString, 0); }
+	parsed = (parsed && ExprCompilerParseExpression_(&compiler, 0));
+	if (parsed && compiler.token.type != ExprTokenType_None) { parsed = ExprCompilerError_(&compiler, Result_UnexpectedToken, compiler.token.index); }
+	
+	//Walk the final instructions to find how deep the stack gets and how many variables are referenced
+	uxx stackDepth = 0;
+	uxx maxStackDepth = 0;
+	uxx numVariables = 0;
+	if (parsed)
+	{
+		for (uxx iIndex = 0; iIndex < compiler.numInstructions; iIndex++)
+		{
+			ExprInstr instr = compiler.instructions[iIndex];
+			uxx numPops = GetExprOpNumInputs((ExprOp)instr.op) - ((instr.source != ExprSource_Stack) ? 1 : 0);
+			Assert(stackDepth >= numPops);
+			stackDepth = stackDepth - numPops + 1;
+			if (stackDepth > maxStackDepth) { maxStackDepth = stackDepth; }
+			if (instr.source == ExprSource_Variable && (uxx)instr.operand + 1 > numVariables) { numVariables = (uxx)instr.operand + 1; }
+		}
+		Assert(stackDepth == 1);
+		if (maxStackDepth > EXPR_MAX_STACK_DEPTH) { parsed = ExprCompilerError_(&compiler, Result_TooComplex, 0); }
+	}
+	
+	if (!parsed)
+	{
+		SetOptionalOutPntr(errorOut, compiler.error);
+		SetOptionalOutPntr(errorIndexOut, compiler.errorIndex);
+		ScratchEnd(scratch);
+		return false;
+	}
+	
+	//Only keep the constants that are still referenced (folding leaves the inputs behind) and share duplicates
+	ClearPointer(expressionOut);
+	expressionOut->arena = arena;
+	expressionOut->maxStackDepth = maxStackDepth;
+	expressionOut->numVariables = numVariables;
+	expressionOut->numInstructions = compiler.numInstructions;
+	expressionOut->instructions = AllocArray(ExprInstr, arena, expressionOut->numInstructions);
+	NotNull(expressionOut->instructions);
+	MyMemCopy(expressionOut->instructions, compiler.instructions, sizeof(ExprInstr) * expressionOut->numInstructions);
+	r64* usedConstants = AllocArray(r64, scratch, compiler.numConstants + 1);
+	NotNull(usedConstants);
+	for (uxx iIndex = 0; iIndex < expressionOut->numInstructions; iIndex++)
+	{
+		ExprInstr* instr = &expressionOut->instructions[iIndex];
+		if (instr->source != ExprSource_Constant) { continue; }
+		r64 value = compiler.constants[instr->operand];
+		uxx newIndex = 0;
+		while (newIndex < expressionOut->numConstants && !MyMemEquals(&usedConstants[newIndex], &value, sizeof(r64))) { newIndex++; }
+		if (newIndex == expressionOut->numConstants) { usedConstants[expressionOut->numConstants++] = value; }
+		instr->operand = (u16)newIndex;
+	}
+	if (expressionOut->numConstants > 0)
+	{
+		expressionOut->constants = AllocArray(r64, arena, expressionOut->numConstants);
+		NotNull(expressionOut->constants);
+		MyMemCopy(expressionOut->constants, usedConstants, sizeof(r64) * expressionOut->numConstants);
+	}
+	
+	ScratchEnd(scratch);
+	SetOptionalOutPntr(errorOut, Result_Success);
+	return true;
+}
+
+PEXPI bool IsExpressionInit(const Expression* expression)
+{
+	return (expression->arena != nullptr);
+}
+
+PEXP void FreeExpression(Expression* expression)
+{
+	NotNull(expression);
+	if (expression->arena != nullptr && CanArenaFree(expression->arena))
+	{
+		FreeMem(expression->arena, expression->instructions, sizeof(ExprInstr) * expression->numInstructions);
+		if (expression->constants != nullptr) { FreeMem(expression->arena, expression->constants, sizeof(r64) * expression->numConstants); }
+	}
+	ClearPointer(expression);
+}
+
+// +==============================+
+// |          Evaluation          |
+// +==============================+
+//The top of the stack is kept in a local (topValue) and only the values under it live in stack[], so most instructions
+//never round-trip their result through memory. stack[0] is a dummy slot so the first push doesn't need a special case.
+//We switch on op and source together so each case knows where its last input comes from without another branch
+#define ExprEvalCase_(op, source) case (((uxx)ExprOp_##op * ExprSource_Count) + ExprSource_##source)
+#define ExprEvalUnary_(name, formula)                                                                                                     \
+	ExprEvalCase_(name, Stack):    { r64 a = topValue; topValue = (formula); } break;                                                     \
+	ExprEvalCase_(name, Constant): { r64 a = constants[instr->operand]; stack[stackSize] = topValue; stackSize++; topValue = (formula); } break; \
+	ExprEvalCase_(name, Variable): { r64 a = values[instr->operand]; stack[stackSize] = topValue; stackSize++; topValue = (formula); } break;
+#define ExprEvalBinary_(name, formula)                                                                                                    \
+	ExprEvalCase_(name, Stack):    { r64 b = topValue; stackSize--; r64 a = stack[stackSize]; topValue = (formula); } break;              \
+	ExprEvalCase_(name, Constant): { r64 a = topValue; r64 b = constants[instr->operand]; topValue = (formula); } break;                  \
+	ExprEvalCase_(name, Variable): { r64 a = topValue; r64 b = values[instr->operand]; topValue = (formula); } break;
+#define ExprEvalTernary_(name, formula)                                                                                                   \
+	ExprEvalCase_(name, Stack):    { r64 c = topValue; r64 b = stack[stackSize-1]; r64 a = stack[stackSize-2]; stackSize -= 2; topValue = (formula); } break; \
+	ExprEvalCase_(name, Constant): { r64 c = constants[instr->operand]; r64 b = topValue; stackSize--; r64 a = stack[stackSize]; topValue = (formula); } break; \
+	ExprEvalCase_(name, Variable): { r64 c = values[instr->operand]; r64 b = topValue; stackSize--; r64 a = stack[stackSize]; topValue = (formula); } break;
+//values[handle] is the value for each variable, must be at least expression->numVariables long (may be nullptr if that's 0)
+PEXP r64 EvaluateExpression(const Expression* expression, const r64* values)
+{
+	DebugNotNull(expression);
+	DebugAssert(IsExpressionInit(expression));
+	DebugAssert(values != nullptr || expression->numVariables == 0);
+	r64 stack[EXPR_MAX_STACK_DEPTH + 1];
+	stack[0] = 0.0;
+	uxx stackSize = 0;
+	r64 topValue = 0.0;
+	const r64* constants = expression->constants;
+	const ExprInstr* instrEnd = expression->instructions + expression->numInstructions;
+	for (const ExprInstr* instr = expression->instructions; instr < instrEnd; instr++)
+	{
+		switch (((uxx)instr->op * ExprSource_Count) + instr->source)
+		{
+			ExprOpFormulas_(ExprEvalUnary_, ExprEvalBinary_, ExprEvalTernary_)
+			default: DebugAssertMsg(false, "Unhandled ExprOp in EvaluateExpression"); break;
+		}
+	}
+	DebugAssert(stackSize == 1);
+	return topValue;
+}
+#undef ExprEvalCase_
+#undef ExprEvalUnary_
+#undef ExprEvalBinary_
+#undef ExprEvalTernary_
+
+//Each stack entry is a pointer to EXPR_BATCH_SIZE lanes. Variables are pushed by pointing right at the caller's array,
+//everything else writes into the lanes owned by the stack slot it ends up in. Every block runs all EXPR_BATCH_SIZE lanes
+//(the last partial block reads from zero padded copies of the variables) so these loops have a fixed trip count
+#define ExprBatchUnary_(name, formula) case ExprOp_##name:                                            \
+{                                                                                                     \
+	r64* outLanes = &laneBuffers[stackSize * EXPR_BATCH_SIZE];                                         \
+	for (uxx lIndex = 0; lIndex < EXPR_BATCH_SIZE; lIndex++) { r64 a = lastLanes[lIndex]; outLanes[lIndex] = (formula); } \
+	stack[stackSize] = outLanes; stackSize++;                                                         \
+} break;
+#define ExprBatchBinary_(name, formula) case ExprOp_##name:                                           \
+{                                                                                                     \
+	const r64* aLanes = stack[stackSize-1];                                                           \
+	r64* outLanes = &laneBuffers[(stackSize-1) * EXPR_BATCH_SIZE];                                     \
+	for (uxx lIndex = 0; lIndex < EXPR_BATCH_SIZE; lIndex++) { r64 a = aLanes[lIndex]; r64 b = lastLanes[lIndex]; outLanes[lIndex] = (formula); } \
+	stack[stackSize-1] = outLanes;                                                                    \
+} break;
+#define ExprBatchTernary_(name, formula) case ExprOp_##name:                                          \
+{                                                                                                     \
+	const r64* aLanes = stack[stackSize-2];                                                           \
+	const r64* bLanes = stack[stackSize-1];                                                           \
+	r64* outLanes = &laneBuffers[(stackSize-2) * EXPR_BATCH_SIZE];                                     \
+	for (uxx lIndex = 0; lIndex < EXPR_BATCH_SIZE; lIndex++) { r64 a = aLanes[lIndex]; r64 b = bLanes[lIndex]; r64 c = lastLanes[lIndex]; outLanes[lIndex] = (formula); } \
+	stack[stackSize-2] = outLanes; stackSize--;                                                       \
+} break;
+//Evaluates the expression count times. variableArrays[handle] points to count values for that variable (structure-of-arrays).
+//A variable whose array is nullptr uses uniformValues[handle] for every evaluation instead (uniformValues can be nullptr if there are none)
+PEXP void EvaluateExpressionBatch(const Expression* expression, uxx count, const r64* const* variableArrays, const r64* uniformValues, r64* resultsOut)
+{
+	NotNull(expression);
+	Assert(IsExpressionInit(expression));
+	Assert(variableArrays != nullptr || expression->numVariables == 0);
+	NotNull(resultsOut);
+	if (count == 0) { return; }
+	ScratchBegin(scratch);
+	//One set of lanes per stack slot plus one more for splatting a constant\uniform that's used as an instruction's last input
+	r64* laneBuffers = AllocArray(r64, scratch, (expression->maxStackDepth + 1) * EXPR_BATCH_SIZE);
+	NotNull(laneBuffers);
+	r64* splatLanes = &laneBuffers[expression->maxStackDepth * EXPR_BATCH_SIZE];
+	r64* paddedVariables = nullptr;
+	const r64* stack[EXPR_MAX_STACK_DEPTH];
+	const r64* constants = expression->constants;
+	const ExprInstr* instrEnd = expression->instructions + expression->numInstructions;
+	
+	for (uxx blockStart = 0; blockStart < count; blockStart += EXPR_BATCH_SIZE)
+	{
+		uxx numLanes = MinUXX(count - blockStart, EXPR_BATCH_SIZE);
+		if (numLanes < EXPR_BATCH_SIZE && expression->numVariables > 0)
+		{
+			paddedVariables = AllocArray(r64, scratch, expression->numVariables * EXPR_BATCH_SIZE);
+			NotNull(paddedVariables);
+			MyMemSet(paddedVariables, 0x00, sizeof(r64) * expression->numVariables * EXPR_BATCH_SIZE);
+			for (uxx vIndex = 0; vIndex < expression->numVariables; vIndex++)
+			{
+				if (variableArrays[vIndex] != nullptr) { MyMemCopy(&paddedVariables[vIndex * EXPR_BATCH_SIZE], &variableArrays[vIndex][blockStart], sizeof(r64) * numLanes); }
+			}
+		}
+		
+		uxx stackSize = 0;
+		for (const ExprInstr* instr = expression->instructions; instr < instrEnd; instr++)
+		{
+			const r64* lastLanes = nullptr;
+			if (instr->source == ExprSource_Stack) { stackSize--; lastLanes = stack[stackSize]; }
+			else if (instr->source == ExprSource_Variable && variableArrays[instr->operand] != nullptr)
+			{
+				lastLanes = (paddedVariables != nullptr) ? &paddedVariables[instr->operand * EXPR_BATCH_SIZE] : &variableArrays[instr->operand][blockStart];
+			}
+			else
+			{
+				DebugAssert(instr->source == ExprSource_Constant || uniformValues != nullptr);
+				r64 splatValue = (instr->source == ExprSource_Constant) ? constants[instr->operand] : uniformValues[instr->operand];
+				//A pushed value needs to live in its own slot since splatLanes is reused by the next instruction
+				r64* splatTarget = (instr->op == ExprOp_Identity) ? &laneBuffers[stackSize * EXPR_BATCH_SIZE] : splatLanes;
+				for (uxx lIndex = 0; lIndex < EXPR_BATCH_SIZE; lIndex++) { splatTarget[lIndex] = splatValue; }
+				lastLanes = splatTarget;
+			}
+			if (instr->op == ExprOp_Identity) { stack[stackSize] = lastLanes; stackSize++; continue; }
+			
+			switch (instr->op)
+			{
+				ExprOpFormulas_(ExprBatchUnary_, ExprBatchBinary_, ExprBatchTernary_)
+				default: DebugAssertMsg(false, "Unhandled ExprOp in EvaluateExpressionBatch"); break;
+			}
+		}
+		DebugAssert(stackSize == 1);
+		MyMemCopy(&resultsOut[blockStart], stack[0], sizeof(r64) * numLanes);
+	}
+	ScratchEnd(scratch);
+}
+#undef ExprBatchUnary_
+#undef ExprBatchBinary_
+#undef ExprBatchTernary_
+
+#undef EXPR_PRECEDENCE_TERNARY
+#undef EXPR_PRECEDENCE_POWER
+#undef ExprOpFormulas_
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_EXPRESSION_H
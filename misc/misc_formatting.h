@@ -0,0 +1,509 @@
+/*
+File:   misc_formatting.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds functions that format numbers directly into a char buffer without going through
+	** printf (no format string parsing, no locale, no varargs). Each function returns the number
+	** of chars written and never writes a null-terminator. The caller is expected to provide
+	** a buffer that is at least FORMAT_XXX_MAX_CHARS long.
+	** Integers are written 2 digits at a time from a 200 char table.
+	** FormatR64\FormatR32 write the shortest string that parses back to the exact same value
+	** (using the Schubfach algorithm by Raffaello Giulietti). Numbers from 1e-6 up to 1e21 are written
+	** in fixed notation (ex. "0.001", "1.5", "120") and everything else in scientific (ex. "1.5e+300").
+	** FormatR64Fixed writes a value with a fixed number of decimal places (like "%.*f") and is exactly
+	** rounded (round-half-even on the exact binary value). It uses the shortest digits when those
+	** are guaranteed to round the same way and falls back to big-decimal arithmetic otherwise.
+	** NOTE: The powers-of-five table used by FormatR64 is shared with TryParseR64 in misc_parsing.h
+*/
+
+/*
+* Usage Example:
+	char numberBuffer[FORMAT_R64_MAX_CHARS];
+	uxx numberLength = FormatR64(0.1 + 0.2, numberBuffer); //"0.30000000000000004"
+	PrintLine_D("%.*s", (int)numberLength, numberBuffer);
+*/
+
+#ifndef _MISC_FORMATTING_H
+#define _MISC_FORMATTING_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_char.h"
+#include "base/base_math.h"
+#include "base/base_simd.h"
+#include "std/std_memset.h"
+#include "misc/misc_parsing.h"
+
+#define FORMAT_U64_MAX_CHARS     20 //"18446744073709551615"
+#define FORMAT_I64_MAX_CHARS     20 //"-9223372036854775808"
+#define FORMAT_HEX_U64_MAX_CHARS 16
+#define FORMAT_BIN_U64_MAX_CHARS 64
+#define FORMAT_R64_MAX_CHARS     32 //longest is 26 (ex. "-0.0000012345678901234567")
+#define FORMAT_R32_MAX_CHARS     32
+//Largest r64 has 309 integer digits, plus sign and decimal point
+#define FORMAT_R64_FIXED_MAX_CHARS(numDecimals) (1 + 309 + 1 + (uxx)(numDecimals))
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE u8 GetDecimalDigitCountU64(u64 value);
+	PIG_CORE_INLINE void WriteDecimalDigitsU64(u64 value, u8 numDigits, char* bufferOut);
+	PIG_CORE_INLINE uxx FormatU64(u64 value, char* bufferOut);
+	PIG_CORE_INLINE uxx FormatI64(i64 value, char* bufferOut);
+	uxx FormatHexU64(u64 value, char* bufferOut, bool upperCase, u8 minDigits);
+	uxx FormatBinaryU64(u64 value, char* bufferOut, u8 minDigits);
+	PIG_CORE_INLINE i32 FloorLog10Pow2(i32 exponent);
+	PIG_CORE_INLINE i32 FloorLog10ThreeQuartersPow2(i32 exponent);
+	PIG_CORE_INLINE i32 FloorLog2Pow10(i32 exponent);
+	PIG_CORE_INLINE u64 RoundToOddSchubfach(u64 gHigh, u64 gLow, u64 cp);
+	void GetShortestDecimalSchubfach(u64 significand, i32 exponent2, u8 mantissaBits, i32 minExponent2, u64 tinyLimit, u64* digitsOut, i32* exponent10Out);
+	bool SplitFloatBits(u64 bits, u8 mantissaBits, u8 exponentBits, u64* significandOut, i32* exponent2Out);
+	uxx WriteShortestFloatDigits(char* bufferOut, bool isNegative, u64 digits, i32 exponent10);
+	uxx FormatR64(r64 value, char* bufferOut);
+	uxx FormatR32(r32 value, char* bufferOut);
+	uxx WriteFixedFloatDigits(char* bufferOut, bool isNegative, const u8* digits, uxx numDigits, i32 decimalPoint, u8 numDecimals);
+	uxx FormatR64Fixed(r64 value, u8 numDecimals, char* bufferOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+// +==============================+
+// |           Integers           |
+// +==============================+
+PEXPI u8 GetDecimalDigitCountU64(u64 value)
+{
+	static const u64 powersOfTen[20] = {
+		1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+		10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+		10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL,
+	};
+	//floor(numBits * log10(2)) is either the right answer or one too small (1233/4096 ~= log10(2))
+	u8 numBits = 64 - CountLeadingZerosU64(value | 1);
+	u8 guess = (u8)(((u32)numBits * 1233) >> 12);
+	return guess + (((value | 1) >= powersOfTen[guess]) ? 1 : 0); //value | 1 so that 0 counts as 1 digit
+}
+
+//Writes exactly numDigits digits (the caller must make sure value fits) 2 at a time starting from the end
+PEXPI void WriteDecimalDigitsU64(u64 value, u8 numDigits, char* bufferOut)
+{
+	static const char digitPairs[201] =
+		"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+		"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+	char* writePntr = bufferOut + numDigits;
+	while (value >= 100)
+	{
+		u64 pairIndex = (value % 100) * 2;
+		value /= 100;
+		writePntr -= 2;
+		writePntr[0] = digitPairs[pairIndex + 0];
+		writePntr[1] = digitPairs[pairIndex + 1];
+	}
+	if (value >= 10)
+	{
+		writePntr -= 2;
+		writePntr[0] = digitPairs[value * 2 + 0];
+		writePntr[1] = digitPairs[value * 2 + 1];
+	}
+	else { writePntr--; writePntr[0] = (char)('0' + value); }
+	while (writePntr > bufferOut) { writePntr--; writePntr[0] = '0'; } //zero padding if numDigits was larger than needed
+}
+
+PEXPI uxx FormatU64(u64 value, char* bufferOut)
+{
+	NotNull(bufferOut);
+	u8 numDigits = GetDecimalDigitCountU64(value);
+	WriteDecimalDigitsU64(value, numDigits, bufferOut);
+	return numDigits;
+}
+PEXPI uxx FormatI64(i64 value, char* bufferOut)
+{
+	NotNull(bufferOut);
+	if (value >= 0) { return FormatU64((u64)value, bufferOut); }
+	bufferOut[0] = '-';
+	return 1 + FormatU64(0 - (u64)value, bufferOut + 1);
+}
+
+//No "0x" prefix is written. minDigits pads with leading zeros (ex. 2 for bytes)
+PEXP uxx FormatHexU64(u64 value, char* bufferOut, bool upperCase, u8 minDigits)
+{
+	NotNull(bufferOut);
+	Assert(minDigits <= FORMAT_HEX_U64_MAX_CHARS);
+	const char* hexChars = upperCase ? HEX_UPPERCASE_CHARS : HEX_LOWERCASE_CHARS;
+	u8 numDigits = (u8)((64 - CountLeadingZerosU64(value | 1) + 3) / 4);
+	if (numDigits < minDigits) { numDigits = minDigits; }
+	for (u8 dIndex = 0; dIndex < numDigits; dIndex++)
+	{
+		bufferOut[numDigits - 1 - dIndex] = hexChars[(value >> (dIndex * 4)) & 0x0F];
+	}
+	return numDigits;
+}
+//No "0b" prefix is written. minDigits pads with leading zeros (ex. 8 for bytes)
+PEXP uxx FormatBinaryU64(u64 value, char* bufferOut, u8 minDigits)
+{
+	NotNull(bufferOut);
+	Assert(minDigits <= FORMAT_BIN_U64_MAX_CHARS);
+	u8 numDigits = (u8)(64 - CountLeadingZerosU64(value | 1));
+	if (numDigits < minDigits) { numDigits = minDigits; }
+	for (u8 dIndex = 0; dIndex < numDigits; dIndex++)
+	{
+		bufferOut[numDigits - 1 - dIndex] = (char)('0' + ((value >> dIndex) & 1));
+	}
+	return numDigits;
+}
+
+// +==============================+
+// |     Schubfach (Shortest)     |
+// +==============================+
+//NOTE: These approximations are exact over the range of exponents that floats can have (see the Schubfach paper)
+PEXPI i32 FloorLog10Pow2(i32 exponent) { return (i32)(((i64)exponent * 661971961083LL) >> 41); }
+PEXPI i32 FloorLog10ThreeQuartersPow2(i32 exponent) { return (i32)(((i64)exponent * 661971961083LL - 274743187321LL) >> 41); }
+PEXPI i32 FloorLog2Pow10(i32 exponent) { return (i32)(((i64)exponent * 913124641741LL) >> 38); }
+
+//Returns (g * cp) / 2^127 with the lowest bit set if anything was lost to the division ("round to odd")
+//g is split into two 63-bit halves and the lowest product is left out on purpose, g is slightly larger
+//than the real power of ten so that error must not show up in the sticky bit (otherwise exact ties are missed)
+PEXPI u64 RoundToOddSchubfach(u64 gHigh, u64 gLow, u64 cp)
+{
+	u64 unusedLow = 0;
+	u64 lowProductHigh = 0;
+	unusedLow = MultiplyU64Wide(gLow, cp, &lowProductHigh);
+	UNUSED(unusedLow);
+	u64 highProductHigh = 0;
+	u64 highProductLow = MultiplyU64Wide(gHigh, cp, &highProductHigh);
+	u64 middle = (highProductLow >> 1) + lowProductHigh;
+	u64 result = highProductHigh + (middle >> 63);
+	return result | (((middle & 0x7FFFFFFFFFFFFFFFULL) + 0x7FFFFFFFFFFFFFFFULL) >> 63);
+}
+
+//Finds the shortest decimal (digits * 10^exponent10) that rounds back to significand * 2^exponent2
+//significand includes the implicit bit for normal numbers. minExponent2 is the exponent of subnormals (-1074 for r64, -149 for r32)
+//and tinyLimit is the number of subnormal significands that need one more digit of precision than the others (3 for r64, 8 for r32)
+//NOTE: digitsOut can have trailing zeros
+PEXP void GetShortestDecimalSchubfach(u64 significand, i32 exponent2, u8 mantissaBits, i32 minExponent2, u64 tinyLimit, u64* digitsOut, i32* exponent10Out)
+{
+	u64 minSignificand = (1ULL << mantissaBits);
+	
+	//Integers that fit in the significand are their own shortest representation
+	if (exponent2 < 0 && exponent2 > -(i32)(mantissaBits + 1) && significand >= minSignificand)
+	{
+		u64 integerValue = significand >> (-exponent2);
+		if ((integerValue << (-exponent2)) == significand) { *digitsOut = integerValue; *exponent10Out = 0; return; }
+	}
+	u64 isOdd = (significand & 1);
+	u64 halfGap = 2; //half the distance to the neighboring floats, in the same units as cb
+	i32 exponentAdjust = 0;
+	if (significand < tinyLimit)
+	{
+		//The few smallest subnormals don't have enough bits for the math below to be precise so we
+		//work with 10x the value (and 10x the gap) then take the exponent back down by 1 at the end
+		significand *= 10;
+		halfGap *= 10;
+		exponentAdjust = -1;
+	}
+	
+	u64 cb = (significand << 2);
+	u64 cbRight = cb + halfGap;
+	u64 cbLeft = 0;
+	i32 k = 0;
+	if (significand != minSignificand || exponent2 == minExponent2)
+	{
+		cbLeft = cb - halfGap;
+		k = FloorLog10Pow2(exponent2);
+	}
+	else
+	{
+		//The gap below a power of 2 is half the size of the gap above it
+		cbLeft = cb - 1;
+		k = FloorLog10ThreeQuartersPow2(exponent2);
+	}
+	i32 h = exponent2 + FloorLog2Pow10(-k) + 2;
+	
+	//g is 10^-k normalized into [2^125, 2^126) and rounded up, built from the shared powers-of-five table
+	i32 powerOfFive = -k;
+	uxx tableIndex = 2 * (uxx)(powerOfFive + 342);
+	u64 tableHigh = ParsePowersOfFive128[tableIndex + 0];
+	u64 tableLow = ParsePowersOfFive128[tableIndex + 1];
+	if (powerOfFive >= -27 && powerOfFive < 0) //these entries are rounded up, everything else is truncated
+	{
+		if (tableLow == 0) { tableHigh--; }
+		tableLow--;
+	}
+	u64 gHigh = (tableHigh >> 2);
+	u64 gLow = (tableLow >> 2) | (tableHigh << 62);
+	gLow++;
+	if (gLow == 0) { gHigh++; }
+	//Split into 63-bit halves for RoundToOddSchubfach
+	gHigh = (gHigh << 1) | (gLow >> 63);
+	gLow &= 0x7FFFFFFFFFFFFFFFULL;
+	
+	u64 vb = RoundToOddSchubfach(gHigh, gLow, cb << h);
+	u64 vbLeft = RoundToOddSchubfach(gHigh, gLow, cbLeft << h);
+	u64 vbRight = RoundToOddSchubfach(gHigh, gLow, cbRight << h);
+	u64 s = (vb >> 2);
+	if (s >= 10)
+	{
+		//Try one digit shorter first
+		u64 sp10 = (s / 10) * 10;
+		u64 tp10 = sp10 + 10;
+		bool upIn = (vbLeft + isOdd <= (sp10 << 2));
+		bool wpIn = ((tp10 << 2) + isOdd <= vbRight);
+		if (upIn != wpIn) { *digitsOut = upIn ? sp10 : tp10; *exponent10Out = k + exponentAdjust; return; }
+		if (upIn && wpIn) //only happens for the tiny subnormals where the gap is wide enough to hold both
+		{
+			i64 compare10 = (i64)(vb - ((sp10 + tp10) << 1));
+			*digitsOut = (compare10 < 0 || (compare10 == 0 && ((sp10 / 10) & 1) == 0)) ? sp10 : tp10;
+			*exponent10Out = k + exponentAdjust;
+			return;
+		}
+	}
+	u64 t = s + 1;
+	bool uIn = (vbLeft + isOdd <= (s << 2));
+	bool wIn = ((t << 2) + isOdd <= vbRight);
+	if (uIn != wIn) { *digitsOut = uIn ? s : t; *exponent10Out = k + exponentAdjust; return; }
+	//Both are in range, pick the closer one (ties go to even)
+	i64 compare = (i64)(vb - ((s + t) << 1));
+	*digitsOut = (compare < 0 || (compare == 0 && (s & 1) == 0)) ? s : t;
+	*exponent10Out = k + exponentAdjust;
+}
+
+//Splits the bits of an IEEE float into significand * 2^exponent2. Returns false for infinity\nan
+PEXP bool SplitFloatBits(u64 bits, u8 mantissaBits, u8 exponentBits, u64* significandOut, i32* exponent2Out)
+{
+	u64 mantissa = bits & ((1ULL << mantissaBits) - 1);
+	u32 biasedExponent = (u32)((bits >> mantissaBits) & ((1ULL << exponentBits) - 1));
+	if (biasedExponent == (1U << exponentBits) - 1) { return false; }
+	i32 exponentBias = (1 << (exponentBits - 1)) - 1;
+	if (biasedExponent == 0) //subnormal (or zero)
+	{
+		*significandOut = mantissa;
+		*exponent2Out = 1 - exponentBias - mantissaBits;
+	}
+	else
+	{
+		*significandOut = mantissa | (1ULL << mantissaBits);
+		*exponent2Out = (i32)biasedExponent - exponentBias - mantissaBits;
+	}
+	return true;
+}
+
+//Writes digits * 10^exponent10 in fixed notation when the number is in [1e-6, 1e21) and scientific otherwise
+PEXP uxx WriteShortestFloatDigits(char* bufferOut, bool isNegative, u64 digits, i32 exponent10)
+{
+	uxx result = 0;
+	if (isNegative) { bufferOut[result++] = '-'; }
+	if (digits == 0) { bufferOut[result++] = '0'; return result; }
+	while (digits % 10 == 0) { digits /= 10; exponent10++; }
+	
+	char digitChars[FORMAT_U64_MAX_CHARS];
+	u8 numDigits = GetDecimalDigitCountU64(digits);
+	WriteDecimalDigitsU64(digits, numDigits, &digitChars[0]);
+	i32 scientificExponent = exponent10 + (i32)numDigits - 1;
+	
+	if (scientificExponent >= -6 && scientificExponent < 21)
+	{
+		if (scientificExponent < 0)
+		{
+			bufferOut[result++] = '0';
+			bufferOut[result++] = '.';
+			for (i32 zIndex = 0; zIndex < -scientificExponent - 1; zIndex++) { bufferOut[result++] = '0'; }
+			MyMemCopy(&bufferOut[result], &digitChars[0], numDigits);
+			result += numDigits;
+		}
+		else if (scientificExponent + 1 >= (i32)numDigits)
+		{
+			MyMemCopy(&bufferOut[result], &digitChars[0], numDigits);
+			result += numDigits;
+			for (i32 zIndex = 0; zIndex < scientificExponent + 1 - (i32)numDigits; zIndex++) { bufferOut[result++] = '0'; }
+		}
+		else
+		{
+			uxx numIntegerDigits = (uxx)scientificExponent + 1;
+			MyMemCopy(&bufferOut[result], &digitChars[0], numIntegerDigits);
+			result += numIntegerDigits;
+			bufferOut[result++] = '.';
+			MyMemCopy(&bufferOut[result], &digitChars[numIntegerDigits], numDigits - numIntegerDigits);
+			result += numDigits - numIntegerDigits;
+		}
+	}
+	else
+	{
+		bufferOut[result++] = digitChars[0];
+		if (numDigits > 1)
+		{
+			bufferOut[result++] = '.';
+			MyMemCopy(&bufferOut[result], &digitChars[1], numDigits - 1);
+			result += numDigits - 1;
+		}
+		bufferOut[result++] = 'e';
+		bufferOut[result++] = (scientificExponent < 0) ? '-' : '+';
+		result += FormatU64((u64)(scientificExponent < 0 ? -scientificExponent : scientificExponent), &bufferOut[result]);
+	}
+	return result;
+}
+
+PEXP uxx FormatR64(r64 value, char* bufferOut)
+{
+	NotNull(bufferOut);
+	u64 bits = 0;
+	MyMemCopy(&bits, &value, sizeof(value));
+	bool isNegative = ((bits >> 63) != 0);
+	u64 significand = 0;
+	i32 exponent2 = 0;
+	if (!SplitFloatBits(bits, 52, 11, &significand, &exponent2))
+	{
+		if ((bits & ((1ULL << 52) - 1)) != 0) { MyMemCopy(bufferOut, "nan", 3); return 3; }
+		if (isNegative) { MyMemCopy(bufferOut, "-inf", 4); return 4; }
+		MyMemCopy(bufferOut, "inf", 3); return 3;
+	}
+	u64 digits = 0;
+	i32 exponent10 = 0;
+	if (significand != 0) { GetShortestDecimalSchubfach(significand, exponent2, 52, -1074, 3, &digits, &exponent10); }
+	return WriteShortestFloatDigits(bufferOut, isNegative, digits, exponent10);
+}
+PEXP uxx FormatR32(r32 value, char* bufferOut)
+{
+	NotNull(bufferOut);
+	u32 bits = 0;
+	MyMemCopy(&bits, &value, sizeof(value));
+	bool isNegative = ((bits >> 31) != 0);
+	u64 significand = 0;
+	i32 exponent2 = 0;
+	if (!SplitFloatBits(bits, 23, 8, &significand, &exponent2))
+	{
+		if ((bits & ((1UL << 23) - 1)) != 0) { MyMemCopy(bufferOut, "nan", 3); return 3; }
+		if (isNegative) { MyMemCopy(bufferOut, "-inf", 4); return 4; }
+		MyMemCopy(bufferOut, "inf", 3); return 3;
+	}
+	u64 digits = 0;
+	i32 exponent10 = 0;
+	if (significand != 0) { GetShortestDecimalSchubfach(significand, exponent2, 23, -149, 8, &digits, &exponent10); }
+	return WriteShortestFloatDigits(bufferOut, isNegative, digits, exponent10);
+}
+
+// +==============================+
+// |        Fixed Decimals        |
+// +==============================+
+//Writes the value 0.digits * 10^decimalPoint with exactly numDecimals digits after the decimal point (no rounding is done here)
+PEXP uxx WriteFixedFloatDigits(char* bufferOut, bool isNegative, const u8* digits, uxx numDigits, i32 decimalPoint, u8 numDecimals)
+{
+	uxx result = 0;
+	if (isNegative) { bufferOut[result++] = '-'; }
+	if (decimalPoint <= 0) { bufferOut[result++] = '0'; }
+	else
+	{
+		for (i32 dIndex = 0; dIndex < decimalPoint; dIndex++) { bufferOut[result++] = (char)('0' + (((uxx)dIndex < numDigits) ? digits[dIndex] : 0)); }
+	}
+	if (numDecimals > 0)
+	{
+		bufferOut[result++] = '.';
+		for (i32 dIndex = decimalPoint; dIndex < decimalPoint + (i32)numDecimals; dIndex++)
+		{
+			bufferOut[result++] = (char)('0' + ((dIndex >= 0 && (uxx)dIndex < numDigits) ? digits[dIndex] : 0));
+		}
+	}
+	return result;
+}
+
+//Like printf("%.*f", numDecimals, value) but exactly rounded on all platforms. Buffer must be FORMAT_R64_FIXED_MAX_CHARS(numDecimals) long
+PEXP uxx FormatR64Fixed(r64 value, u8 numDecimals, char* bufferOut)
+{
+	NotNull(bufferOut);
+	u64 bits = 0;
+	MyMemCopy(&bits, &value, sizeof(value));
+	bool isNegative = ((bits >> 63) != 0);
+	u64 significand = 0;
+	i32 exponent2 = 0;
+	if (!SplitFloatBits(bits, 52, 11, &significand, &exponent2)) { return FormatR64(value, bufferOut); }
+	if (significand == 0) { return WriteFixedFloatDigits(bufferOut, isNegative, nullptr, 0, 0, numDecimals); }
+	
+	//If the gap between neighboring floats is smaller than 10^-numDecimals then the exact value and the shortest digits can't
+	//land on different sides of a rounding boundary, only an exact tie in the shortest digits needs the slow path
+	i32 maxFastExponent2 = -(FloorLog2Pow10(numDecimals) + ((numDecimals > 0) ? 1 : 0));
+	if (exponent2 <= maxFastExponent2)
+	{
+		u64 shortestDigits = 0;
+		i32 exponent10 = 0;
+		GetShortestDecimalSchubfach(significand, exponent2, 52, -1074, 3, &shortestDigits, &exponent10);
+		while (shortestDigits % 10 == 0) { shortestDigits /= 10; exponent10++; }
+		u8 numShortestDigits = GetDecimalDigitCountU64(shortestDigits);
+		i32 numDroppedDigits = -exponent10 - (i32)numDecimals;
+		bool isTie = false;
+		if (numDroppedDigits > (i32)numShortestDigits) { shortestDigits = 0; exponent10 = -(i32)numDecimals; }
+		else if (numDroppedDigits > 0)
+		{
+			u64 divisor = 1;
+			for (i32 dIndex = 0; dIndex < numDroppedDigits; dIndex++) { divisor *= 10; }
+			u64 remainder = shortestDigits % divisor;
+			shortestDigits /= divisor;
+			exponent10 += numDroppedDigits;
+			if (remainder * 2 > divisor) { shortestDigits++; }
+			else if (remainder * 2 == divisor) { isTie = true; }
+		}
+		if (!isTie)
+		{
+			u8 digits[FORMAT_U64_MAX_CHARS];
+			char digitChars[FORMAT_U64_MAX_CHARS];
+			u8 numDigits = 0;
+			if (shortestDigits > 0)
+			{
+				numDigits = GetDecimalDigitCountU64(shortestDigits);
+				WriteDecimalDigitsU64(shortestDigits, numDigits, &digitChars[0]);
+				for (u8 dIndex = 0; dIndex < numDigits; dIndex++) { digits[dIndex] = (u8)(digitChars[dIndex] - '0'); }
+			}
+			return WriteFixedFloatDigits(bufferOut, isNegative, &digits[0], numDigits, (i32)numDigits + exponent10, numDecimals);
+		}
+	}
+	
+	//Slow path: expand the exact value into decimal digits and round those
+	ParseDecimal decimal = ZEROED;
+	char digitChars[FORMAT_U64_MAX_CHARS];
+	u8 numSignificandDigits = GetDecimalDigitCountU64(significand);
+	WriteDecimalDigitsU64(significand, numSignificandDigits, &digitChars[0]);
+	for (u8 dIndex = 0; dIndex < numSignificandDigits; dIndex++) { decimal.digits[dIndex] = (u8)(digitChars[dIndex] - '0'); }
+	decimal.numDigits = numSignificandDigits;
+	decimal.decimalPoint = (i32)numSignificandDigits;
+	ParseDecimalTrim(&decimal);
+	ParseDecimalShift(&decimal, exponent2);
+	
+	i32 roundIndex = decimal.decimalPoint + (i32)numDecimals;
+	if (roundIndex < 0) { decimal.numDigits = 0; }
+	else if ((uxx)roundIndex < decimal.numDigits)
+	{
+		bool roundUp = false;
+		if (decimal.digits[roundIndex] == 5 && (uxx)roundIndex + 1 == decimal.numDigits)
+		{
+			roundUp = (decimal.isTruncated || (roundIndex > 0 && (decimal.digits[roundIndex-1] % 2) == 1));
+		}
+		else { roundUp = (decimal.digits[roundIndex] >= 5); }
+		decimal.numDigits = (uxx)roundIndex;
+		if (roundUp)
+		{
+			i32 carryIndex = roundIndex - 1;
+			while (carryIndex >= 0 && decimal.digits[carryIndex] == 9) { carryIndex--; }
+			if (carryIndex < 0)
+			{
+				decimal.digits[0] = 1;
+				decimal.numDigits = 1;
+				decimal.decimalPoint++;
+			}
+			else
+			{
+				decimal.digits[carryIndex]++;
+				decimal.numDigits = (uxx)carryIndex + 1;
+			}
+		}
+	}
+	return WriteFixedFloatDigits(bufferOut, isNegative, &decimal.digits[0], decimal.numDigits, decimal.decimalPoint, numDecimals);
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_FORMATTING_H
@@ -4,6 +4,14 @@ Author: Taylor Robbins
 Date:   01\15\2025
 Description:
 	** Contains functions that perform various hash algorithms
+	** FnvHash is a simple byte-at-a-time hash, good for tiny keys and available everywhere
+	** MeowHash is very fast on large buffers but needs AES-NI (so it's not available on WASM or ARM)
+	** PigHash is a portable 64\128-bit hash for everything else. Short inputs (<= 256 bytes) use
+	** a wyhash style multiply-mix and longer inputs use an xxh3 style striped accumulator that has
+	** SSE2, NEON, and WASM SIMD128 implementations (all of them produce the same result).
+	** Both MeowHash and PigHash have a streaming API (Begin\Add\End) for hashing data that is
+	** not all in memory at once. Streaming always produces the same hash as the one-shot functions.
+	** NOTE: None of these are cryptographic hashes, do not use them where an attacker can choose the input
 */
 
 #ifndef _MISC_HASH_H
@@ -12,11 +20,16 @@ Description:
 #include "base/base_compiler_check.h"
 #include "base/base_defines_check.h"
 #include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_math.h"
+#include "base/base_simd.h"
+#include "std/std_memset.h"
 
 #define FNV_HASH_BASE_U64   0xcbf29ce484222325ULL //= DEC(14695981039346656037)
 #define FNV_HASH_PRIME_U64  0x100000001b3ULL      //= DEC(1099511628211)
 
-#if !TARGET_IS_WASM
+#if !TARGET_IS_WASM && TARGET_HAS_SSE2
 #define MEOW_HASH_AVAILABLE 1
 #else
 #define MEOW_HASH_AVAILABLE 0
@@ -34,6 +47,39 @@ union Hash128
 	struct { u64 half1; u64 half2; };
 };
 
+#define PIG_HASH_STRIPE_SIZE      64 //bytes consumed by each step of the long input accumulator
+#define PIG_HASH_STRIPES_PER_BLOCK 16 //accumulators are scrambled after this many stripes
+#define PIG_HASH_SECRET_SIZE      192
+#define PIG_HASH_LONG_THRESHOLD   256 //inputs longer than this use the striped accumulator
+
+typedef struct PigHashStream PigHashStream;
+struct PigHashStream
+{
+	u64 seed;
+	u64 totalLength;
+	u64 accumulators[8];
+	uxx numStripesInBlock;
+	uxx bufferLength;
+	u8 secret[PIG_HASH_SECRET_SIZE];
+	//NOTE: The first PIG_HASH_STRIPE_SIZE bytes hold the end of the data we already consumed (the last stripe
+	//      is allowed to overlap previous data), the rest holds up to PIG_HASH_LONG_THRESHOLD bytes we haven't consumed yet
+	u8 buffer[PIG_HASH_STRIPE_SIZE + PIG_HASH_LONG_THRESHOLD];
+};
+
+#if MEOW_HASH_AVAILABLE
+typedef struct MeowHashStream MeowHashStream;
+struct MeowHashStream
+{
+	//NOTE: This mirrors meow_state from meow_hash_x64_aesni.h so we don't have to include that header
+	//      everywhere (it has static variables). The implementation StaticAsserts that the sizes match
+	SimdU8x16 lanes[8];
+	u64 totalLength;
+	u32 bufferLength;
+	u8 buffer[256];
+	SimdU8x16 padding[2];
+};
+#endif //MEOW_HASH_AVAILABLE
+
 // +--------------------------------------------------------------+
 // |                 Header Function Declarations                 |
 // +--------------------------------------------------------------+
@@ -44,12 +90,38 @@ union Hash128
 	PIG_CORE_INLINE u32 FnvHashU32(const void* bufferPntr, u64 numBytes);
 	PIG_CORE_INLINE u16 FnvHashU16(const void* bufferPntr, u64 numBytes);
 	PIG_CORE_INLINE u8 FnvHashU8(const void* bufferPntr, u64 numBytes);
+	extern const u64 PigHashSecret[PIG_HASH_SECRET_SIZE/sizeof(u64)];
+	PIG_CORE_INLINE u64 PigHashRead64(const u8* pntr);
+	PIG_CORE_INLINE u64 PigHashRead32(const u8* pntr);
+	PIG_CORE_INLINE u64 PigHashMix(u64 left, u64 right);
+	PIG_CORE_INLINE void PigHashAccumulateStripe(u64* accumulators, const u8* data, const u8* key);
+	PIG_CORE_INLINE void PigHashScramble(u64* accumulators, const u8* key);
+	void PigHashAccumulateStripes(u64* accumulators, uxx* numStripesInBlock, const u8* data, uxx numStripes, const u8* secret);
+	void PigHashInitAccumulators(u64* accumulators);
+	void PigHashDeriveSecret(u64 seed, u8* secretOut);
+	Hash128 PigHashShort(const u8* bytes, u64 numBytes, u64 seed, bool want128);
+	Hash128 PigHashLongEnd(const u64* accumulators, const u8* secret, u64 totalLength, bool want128);
+	Hash128 PigHashEx(const void* bufferPntr, u64 numBytes, u64 seed, bool want128);
+	PIG_CORE_INLINE u64 PigHashU64Ex(const void* bufferPntr, u64 numBytes, u64 seed);
+	PIG_CORE_INLINE u64 PigHashU64(const void* bufferPntr, u64 numBytes);
+	PIG_CORE_INLINE u32 PigHashU32(const void* bufferPntr, u64 numBytes);
+	PIG_CORE_INLINE Hash128 PigHash128Ex(const void* bufferPntr, u64 numBytes, u64 seed);
+	PIG_CORE_INLINE Hash128 PigHash128(const void* bufferPntr, u64 numBytes);
+	void PigHashStreamBegin(PigHashStream* stream, u64 seed);
+	void PigHashStreamAdd(PigHashStream* stream, const void* bufferPntr, u64 numBytes);
+	Hash128 PigHashStreamEndEx(const PigHashStream* stream, bool want128);
+	PIG_CORE_INLINE u64 PigHashStreamEndU64(const PigHashStream* stream);
+	PIG_CORE_INLINE Hash128 PigHashStreamEnd128(const PigHashStream* stream);
 	#if MEOW_HASH_AVAILABLE
 	Hash128 MeowHash128(const void* bufferPntr, u64 numBytes);
 	u64 MeowHashU64(const void* bufferPntr, u64 numBytes);
 	u32 MeowHashU32(const void* bufferPntr, u64 numBytes);
 	u16 MeowHashU16(const void* bufferPntr, u64 numBytes);
 	u8 MeowHashU8(const void* bufferPntr, u64 numBytes);
+	void MeowHashStreamBegin(MeowHashStream* stream);
+	void MeowHashStreamAdd(MeowHashStream* stream, const void* bufferPntr, u64 numBytes);
+	Hash128 MeowHashStreamEnd128(const MeowHashStream* stream);
+	PIG_CORE_INLINE u64 MeowHashStreamEndU64(const MeowHashStream* stream);
 	#endif //MEOW_HASH_AVAILABLE
 #endif //!PIG_CORE_IMPLEMENTATION
 
@@ -81,6 +153,283 @@ PEXPI u32 FnvHashU32(const void* bufferPntr, u64 numBytes) { return (u32)FnvHash
 PEXPI u16 FnvHashU16(const void* bufferPntr, u64 numBytes) { return (u16)FnvHashU64(bufferPntr, numBytes); }
 PEXPI u8 FnvHashU8(const void* bufferPntr, u64 numBytes) { return (u8)FnvHashU64(bufferPntr, numBytes); }
 
+// +--------------------------------------------------------------+
+// |                      PigHash Algorithm                       |
+// +--------------------------------------------------------------+
+//NOTE: Inputs <= PIG_HASH_LONG_THRESHOLD follow wyhash (v4, by Wang Yi) and longer inputs follow the structure of XXH3 (by Yann Collet)
+// but the constants and the final merge are our own so the output does not match either of those hashes
+extern const u64 PigHashSecret[PIG_HASH_SECRET_SIZE/sizeof(u64)]; //defined at the bottom of the file
+
+PEXPI u64 PigHashRead64(const u8* pntr) { u64 result; MyMemCopy(&result, pntr, sizeof(result)); return result; }
+PEXPI u64 PigHashRead32(const u8* pntr) { u32 result; MyMemCopy(&result, pntr, sizeof(result)); return (u64)result; }
+//Multiplies to 128 bits and folds the halves together with xor ("mum" in wyhash)
+PEXPI u64 PigHashMix(u64 left, u64 right)
+{
+	u64 high = 0;
+	u64 low = MultiplyU64Wide(left, right, &high);
+	return low ^ high;
+}
+
+//For each 8 byte lane: acc[lane] += lo32(data^key) * hi32(data^key) and acc[lane^1] += data
+PEXPI void PigHashAccumulateStripe(u64* accumulators, const u8* data, const u8* key)
+{
+	#if TARGET_HAS_SSE2
+	for (uxx pIndex = 0; pIndex < 4; pIndex++)
+	{
+		__m128i* accPntr = (__m128i*)&accumulators[pIndex*2];
+		__m128i dataVec = _mm_loadu_si128((const __m128i*)(data + pIndex*16));
+		__m128i keyVec = _mm_loadu_si128((const __m128i*)(key + pIndex*16));
+		__m128i dataKey = _mm_xor_si128(dataVec, keyVec);
+		__m128i product = _mm_mul_epu32(dataKey, _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1)));
+		__m128i dataSwap = _mm_shuffle_epi32(dataVec, _MM_SHUFFLE(1, 0, 3, 2));
+		_mm_storeu_si128(accPntr, _mm_add_epi64(_mm_loadu_si128(accPntr), _mm_add_epi64(product, dataSwap)));
+	}
+	#elif TARGET_HAS_NEON
+	for (uxx pIndex = 0; pIndex < 4; pIndex++)
+	{
+		uint64x2_t dataVec = vreinterpretq_u64_u8(vld1q_u8(data + pIndex*16));
+		uint64x2_t keyVec = vreinterpretq_u64_u8(vld1q_u8(key + pIndex*16));
+		uint64x2_t dataKey = veorq_u64(dataVec, keyVec);
+		uint64x2_t sum = vaddq_u64(vld1q_u64(&accumulators[pIndex*2]), vextq_u64(dataVec, dataVec, 1));
+		vst1q_u64(&accumulators[pIndex*2], vmlal_u32(sum, vmovn_u64(dataKey), vshrn_n_u64(dataKey, 32)));
+	}
+	#elif TARGET_HAS_WASM_SIMD
+	for (uxx pIndex = 0; pIndex < 4; pIndex++)
+	{
+		v128_t dataVec = wasm_v128_load(data + pIndex*16);
+		v128_t keyVec = wasm_v128_load(key + pIndex*16);
+		v128_t dataKey = wasm_v128_xor(dataVec, keyVec);
+		v128_t product = wasm_u64x2_extmul_low_u32x4(wasm_i32x4_shuffle(dataKey, dataKey, 0, 2, 0, 2), wasm_i32x4_shuffle(dataKey, dataKey, 1, 3, 1, 3));
+		v128_t dataSwap = wasm_i64x2_shuffle(dataVec, dataVec, 1, 0);
+		v128_t accVec = wasm_v128_load(&accumulators[pIndex*2]);
+		wasm_v128_store(&accumulators[pIndex*2], wasm_i64x2_add(accVec, wasm_i64x2_add(product, dataSwap)));
+	}
+	#else
+	for (uxx lIndex = 0; lIndex < 8; lIndex++)
+	{
+		u64 dataWord = PigHashRead64(data + lIndex*8);
+		u64 dataKey = dataWord ^ PigHashRead64(key + lIndex*8);
+		accumulators[lIndex ^ 1] += dataWord;
+		accumulators[lIndex] += (dataKey & 0xFFFFFFFFULL) * (dataKey >> 32);
+	}
+	#endif
+}
+PEXPI void PigHashScramble(u64* accumulators, const u8* key)
+{
+	for (uxx lIndex = 0; lIndex < 8; lIndex++)
+	{
+		u64 value = accumulators[lIndex];
+		value ^= (value >> 47);
+		value ^= PigHashRead64(key + lIndex*8);
+		accumulators[lIndex] = value * 0x9E3779B1ULL;
+	}
+}
+
+//Each stripe in a block uses the secret offset by 8 more bytes, after PIG_HASH_STRIPES_PER_BLOCK stripes the accumulators get scrambled
+PEXP void PigHashAccumulateStripes(u64* accumulators, uxx* numStripesInBlock, const u8* data, uxx numStripes, const u8* secret)
+{
+	for (uxx sIndex = 0; sIndex < numStripes; sIndex++)
+	{
+		PigHashAccumulateStripe(accumulators, data + sIndex*PIG_HASH_STRIPE_SIZE, secret + (*numStripesInBlock) * 8);
+		(*numStripesInBlock)++;
+		if (*numStripesInBlock == PIG_HASH_STRIPES_PER_BLOCK)
+		{
+			PigHashScramble(accumulators, secret + PIG_HASH_SECRET_SIZE - PIG_HASH_STRIPE_SIZE);
+			*numStripesInBlock = 0;
+		}
+	}
+}
+
+PEXP void PigHashInitAccumulators(u64* accumulators)
+{
+	accumulators[0] = 0x00000000C2B2AE3DULL;
+	accumulators[1] = 0x9E3779B185EBCA87ULL;
+	accumulators[2] = 0xC2B2AE3D27D4EB4FULL;
+	accumulators[3] = 0x165667B19E3779F9ULL;
+	accumulators[4] = 0x85EBCA77C2B2AE63ULL;
+	accumulators[5] = 0x0000000085EBCA77ULL;
+	accumulators[6] = 0x27D4EB2F165667C5ULL;
+	accumulators[7] = 0x000000009E3779B1ULL;
+}
+
+PEXP void PigHashDeriveSecret(u64 seed, u8* secretOut)
+{
+	for (uxx wIndex = 0; wIndex < PIG_HASH_SECRET_SIZE/sizeof(u64); wIndex++)
+	{
+		u64 word = ((wIndex % 2) == 0) ? (PigHashSecret[wIndex] + seed) : (PigHashSecret[wIndex] - seed);
+		MyMemCopy(secretOut + wIndex*sizeof(u64), &word, sizeof(word));
+	}
+}
+
+//Handles numBytes <= PIG_HASH_LONG_THRESHOLD (but it works for any length)
+PEXP Hash128 PigHashShort(const u8* bytes, u64 numBytes, u64 seed, bool want128)
+{
+	const u64* secret = &PigHashSecret[0];
+	seed ^= PigHashMix(seed ^ secret[0], secret[1]);
+	u64 left = 0, right = 0;
+	if (numBytes <= 16)
+	{
+		if (numBytes >= 4)
+		{
+			u64 middleOffset = ((numBytes >> 3) << 2);
+			left = (PigHashRead32(bytes) << 32) | PigHashRead32(bytes + middleOffset);
+			right = (PigHashRead32(bytes + numBytes - 4) << 32) | PigHashRead32(bytes + numBytes - 4 - middleOffset);
+		}
+		else if (numBytes > 0)
+		{
+			left = ((u64)bytes[0] << 16) | ((u64)bytes[numBytes >> 1] << 8) | (u64)bytes[numBytes - 1];
+		}
+	}
+	else
+	{
+		u64 bytesLeft = numBytes;
+		if (bytesLeft > 48)
+		{
+			u64 seed1 = seed, seed2 = seed;
+			do
+			{
+				seed = PigHashMix(PigHashRead64(bytes) ^ secret[1], PigHashRead64(bytes + 8) ^ seed);
+				seed1 = PigHashMix(PigHashRead64(bytes + 16) ^ secret[2], PigHashRead64(bytes + 24) ^ seed1);
+				seed2 = PigHashMix(PigHashRead64(bytes + 32) ^ secret[3], PigHashRead64(bytes + 40) ^ seed2);
+				bytes += 48;
+				bytesLeft -= 48;
+			} while (bytesLeft > 48);
+			seed ^= seed1 ^ seed2;
+		}
+		while (bytesLeft > 16)
+		{
+			seed = PigHashMix(PigHashRead64(bytes) ^ secret[1], PigHashRead64(bytes + 8) ^ seed);
+			bytes += 16;
+			bytesLeft -= 16;
+		}
+		//NOTE: This can re-read bytes from the previous loop, we always have at least 16 bytes in total here
+		left = PigHashRead64(bytes + bytesLeft - 16);
+		right = PigHashRead64(bytes + bytesLeft - 8);
+	}
+	left ^= secret[1];
+	right ^= seed;
+	u64 high = 0;
+	left = MultiplyU64Wide(left, right, &high);
+	right = high;
+	Hash128 result;
+	result.lower = PigHashMix(left ^ secret[0] ^ numBytes, right ^ secret[1]);
+	result.upper = want128 ? PigHashMix(left ^ secret[2], right ^ secret[3] ^ numBytes) : 0;
+	return result;
+}
+
+PEXP Hash128 PigHashLongEnd(const u64* accumulators, const u8* secret, u64 totalLength, bool want128)
+{
+	Hash128 result;
+	u64 lower = totalLength * 0x9E3779B185EBCA87ULL;
+	for (uxx pIndex = 0; pIndex < 4; pIndex++)
+	{
+		lower += PigHashMix(accumulators[pIndex*2 + 0] ^ PigHashRead64(secret + 11 + pIndex*16), accumulators[pIndex*2 + 1] ^ PigHashRead64(secret + 19 + pIndex*16));
+	}
+	result.lower = PigHashMix(lower ^ (lower >> 37), 0x165667919E3779F9ULL);
+	result.upper = 0;
+	if (want128)
+	{
+		u64 upper = ~(totalLength * 0xC2B2AE3D27D4EB4FULL);
+		for (uxx pIndex = 0; pIndex < 4; pIndex++)
+		{
+			upper += PigHashMix(accumulators[pIndex*2 + 0] ^ PigHashRead64(secret + 117 - pIndex*16), accumulators[pIndex*2 + 1] ^ PigHashRead64(secret + 125 - pIndex*16));
+		}
+		result.upper = PigHashMix(upper ^ (upper >> 37), 0x165667919E3779F9ULL);
+	}
+	return result;
+}
+
+PEXP Hash128 PigHashEx(const void* bufferPntr, u64 numBytes, u64 seed, bool want128)
+{
+	Assert(numBytes == 0 || bufferPntr != nullptr);
+	const u8* bytes = (const u8*)bufferPntr;
+	if (numBytes <= PIG_HASH_LONG_THRESHOLD) { return PigHashShort(bytes, numBytes, seed, want128); }
+	
+	u8 derivedSecret[PIG_HASH_SECRET_SIZE];
+	const u8* secret = (const u8*)&PigHashSecret[0];
+	if (seed != 0) { PigHashDeriveSecret(seed, &derivedSecret[0]); secret = &derivedSecret[0]; }
+	
+	u64 accumulators[8];
+	PigHashInitAccumulators(&accumulators[0]);
+	uxx numStripesInBlock = 0;
+	//The last 1-64 bytes are always handled by one final stripe that overlaps the data before it (if needed)
+	uxx numStripes = (uxx)((numBytes - 1) / PIG_HASH_STRIPE_SIZE);
+	PigHashAccumulateStripes(&accumulators[0], &numStripesInBlock, bytes, numStripes, secret);
+	PigHashAccumulateStripe(&accumulators[0], bytes + numBytes - PIG_HASH_STRIPE_SIZE, secret + PIG_HASH_SECRET_SIZE - PIG_HASH_STRIPE_SIZE - 7);
+	return PigHashLongEnd(&accumulators[0], secret, numBytes, want128);
+}
+PEXPI u64 PigHashU64Ex(const void* bufferPntr, u64 numBytes, u64 seed) { return PigHashEx(bufferPntr, numBytes, seed, false).lower; }
+PEXPI u64 PigHashU64(const void* bufferPntr, u64 numBytes) { return PigHashEx(bufferPntr, numBytes, 0, false).lower; }
+PEXPI u32 PigHashU32(const void* bufferPntr, u64 numBytes) { return (u32)PigHashEx(bufferPntr, numBytes, 0, false).lower; }
+PEXPI Hash128 PigHash128Ex(const void* bufferPntr, u64 numBytes, u64 seed) { return PigHashEx(bufferPntr, numBytes, seed, true); }
+PEXPI Hash128 PigHash128(const void* bufferPntr, u64 numBytes) { return PigHashEx(bufferPntr, numBytes, 0, true); }
+
+// +==============================+
+// |      PigHash Streaming       |
+// +==============================+
+PEXP void PigHashStreamBegin(PigHashStream* stream, u64 seed)
+{
+	NotNull(stream);
+	ClearPointer(stream);
+	stream->seed = seed;
+	PigHashDeriveSecret(seed, &stream->secret[0]);
+	PigHashInitAccumulators(&stream->accumulators[0]);
+}
+
+PEXP void PigHashStreamAdd(PigHashStream* stream, const void* bufferPntr, u64 numBytes)
+{
+	NotNull(stream);
+	Assert(numBytes == 0 || bufferPntr != nullptr);
+	const u8* bytes = (const u8*)bufferPntr;
+	stream->totalLength += numBytes;
+	u8* pendingBytes = &stream->buffer[PIG_HASH_STRIPE_SIZE];
+	while (numBytes > 0)
+	{
+		//We only consume stripes when we know more data follows them, that way the last stripe is always handled in End
+		//NOTE: Once we get here the total length is > PIG_HASH_LONG_THRESHOLD so we know the long algorithm will be used
+		if (stream->bufferLength == PIG_HASH_LONG_THRESHOLD)
+		{
+			PigHashAccumulateStripes(&stream->accumulators[0], &stream->numStripesInBlock, pendingBytes, PIG_HASH_LONG_THRESHOLD / PIG_HASH_STRIPE_SIZE, &stream->secret[0]);
+			MyMemCopy(&stream->buffer[0], pendingBytes + PIG_HASH_LONG_THRESHOLD - PIG_HASH_STRIPE_SIZE, PIG_HASH_STRIPE_SIZE);
+			stream->bufferLength = 0;
+		}
+		if (stream->bufferLength == 0 && numBytes > PIG_HASH_LONG_THRESHOLD)
+		{
+			//Consume directly from the source when we can, leaving 1-PIG_HASH_LONG_THRESHOLD bytes to go in the buffer
+			uxx numDirectBytes = (uxx)(((numBytes - 1) / PIG_HASH_LONG_THRESHOLD) * PIG_HASH_LONG_THRESHOLD);
+			PigHashAccumulateStripes(&stream->accumulators[0], &stream->numStripesInBlock, bytes, numDirectBytes / PIG_HASH_STRIPE_SIZE, &stream->secret[0]);
+			MyMemCopy(&stream->buffer[0], bytes + numDirectBytes - PIG_HASH_STRIPE_SIZE, PIG_HASH_STRIPE_SIZE);
+			bytes += numDirectBytes;
+			numBytes -= numDirectBytes;
+		}
+		uxx numCopyBytes = PIG_HASH_LONG_THRESHOLD - stream->bufferLength;
+		if (numCopyBytes > numBytes) { numCopyBytes = (uxx)numBytes; }
+		MyMemCopy(pendingBytes + stream->bufferLength, bytes, numCopyBytes);
+		stream->bufferLength += numCopyBytes;
+		bytes += numCopyBytes;
+		numBytes -= numCopyBytes;
+	}
+}
+
+//NOTE: This doesn't modify the stream, so you can keep adding to it afterwards
+PEXP Hash128 PigHashStreamEndEx(const PigHashStream* stream, bool want128)
+{
+	NotNull(stream);
+	const u8* pendingBytes = &stream->buffer[PIG_HASH_STRIPE_SIZE];
+	if (stream->totalLength <= PIG_HASH_LONG_THRESHOLD) { return PigHashShort(pendingBytes, stream->totalLength, stream->seed, want128); }
+	
+	u64 accumulators[8];
+	MyMemCopy(&accumulators[0], &stream->accumulators[0], sizeof(accumulators));
+	uxx numStripesInBlock = stream->numStripesInBlock;
+	uxx numStripes = (stream->bufferLength - 1) / PIG_HASH_STRIPE_SIZE;
+	PigHashAccumulateStripes(&accumulators[0], &numStripesInBlock, pendingBytes, numStripes, &stream->secret[0]);
+	//NOTE: If there are less than PIG_HASH_STRIPE_SIZE bytes pending this reads back into the end of the consumed data at the front of the buffer
+	PigHashAccumulateStripe(&accumulators[0], pendingBytes + stream->bufferLength - PIG_HASH_STRIPE_SIZE, &stream->secret[PIG_HASH_SECRET_SIZE - PIG_HASH_STRIPE_SIZE - 7]);
+	return PigHashLongEnd(&accumulators[0], &stream->secret[0], stream->totalLength, want128);
+}
+PEXPI u64 PigHashStreamEndU64(const PigHashStream* stream) { return PigHashStreamEndEx(stream, false).lower; }
+PEXPI Hash128 PigHashStreamEnd128(const PigHashStream* stream) { return PigHashStreamEndEx(stream, true); }
+
 // +--------------------------------------------------------------+
 // |                     meow_hash Algorithm                      |
 // +--------------------------------------------------------------+
@@ -123,8 +472,47 @@ PEXP u8 MeowHashU8(const void* bufferPntr, u64 numBytes)
 	return (u8)MeowU32From(hash128, 0);
 }
 
+// +==============================+
+// |     meow_hash Streaming      |
+// +==============================+
+StaticAssert(sizeof(MeowHashStream) == sizeof(meow_state));
+
+PEXP void MeowHashStreamBegin(MeowHashStream* stream)
+{
+	NotNull(stream);
+	MeowBegin((meow_state*)stream, MeowDefaultSeed);
+}
+PEXP void MeowHashStreamAdd(MeowHashStream* stream, const void* bufferPntr, u64 numBytes)
+{
+	NotNull(stream);
+	Assert(numBytes == 0 || bufferPntr != nullptr);
+	MeowAbsorb((meow_state*)stream, numBytes, (void*)bufferPntr);
+}
+//NOTE: This doesn't modify the stream, so you can keep adding to it afterwards
+PEXP Hash128 MeowHashStreamEnd128(const MeowHashStream* stream)
+{
+	NotNull(stream);
+	meow_state stateCopy;
+	MyMemCopy(&stateCopy, stream, sizeof(stateCopy));
+	meow_u128 hash128 = MeowEnd(&stateCopy, nullptr);
+	Hash128 result;
+	result.halves[0] = MeowU64From(hash128, 0);
+	result.halves[1] = MeowU64From(hash128, 1);
+	return result;
+}
+PEXPI u64 MeowHashStreamEndU64(const MeowHashStream* stream) { return MeowHashStreamEnd128(stream).halves[0]; }
+
 #endif //MEOW_HASH_AVAILABLE
 
+const u64 PigHashSecret[PIG_HASH_SECRET_SIZE/sizeof(u64)] = {
+	0x3A923E5348AB1CCBULL, 0x9D61AB90CED22C1FULL, 0xE367BB6064E5AA88ULL, 0xCDD8A0AA546F21F6ULL,
+	0x91A3B7FF3791F140ULL, 0x60F8D46DC1BCF681ULL, 0x443FB2E830232AF0ULL, 0xEB7A65CAFBAD5E74ULL,
+	0x0A166B709D6A2F30ULL, 0x71E897E0E13E45E4ULL, 0xA02F82F99970E54CULL, 0x707E953367854B43ULL,
+	0x41261C81D374FCEEULL, 0xB51ED869EF84A838ULL, 0x621962298C8FADB0ULL, 0xE1FD8D2ECACFC197ULL,
+	0xF5011FF3078CC185ULL, 0xCDFD5572D832BCAEULL, 0xB9947CFB430F2A0EULL, 0xD24612A1E7DB2365ULL,
+	0x12B5F86B8D8D8E02ULL, 0x898C40E8562BC3C5ULL, 0xE93A13ADCD6523B5ULL, 0x8DE69B9C02B27F6DULL,
+};
+
 #endif //PIG_CORE_IMPLEMENTATION
 
 #endif //  _MISC_HASH_H
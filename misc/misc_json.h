@@ -0,0 +1,1121 @@
+/*
+File:   misc_json.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Reads and writes JSON (RFC 8259) without any dependencies outside of PigCore.
+	** JsonReader is a pull parser that works directly on a Str8 (ex. the contents from OsReadFile)
+	** and hands back one JsonToken at a time. It never allocates, token strings are slices of the source.
+	** Strings that contain escape sequences are marked with hasEscapes and can be decoded into an Arena
+	** with DecodeJsonTokenStr (strings without escapes are returned as-is, no copy is made).
+	** TryParseJson builds a JsonValue tree in an Arena on top of the JsonReader. The tree refers to
+	** the source for unescaped strings so the source must stay alive as long as the tree is in use.
+	** The hot loops (string bodies, whitespace runs and JsonReaderSkipContainer) scan 16 bytes at
+	** a time using base_simd.h when it's available.
+	** JsonWriter appends JSON text to a buffer in an Arena, optionally pretty-printed with tabs.
+	** NOTE: UTF-8 inside strings is passed through as-is, it is not validated.
+*/
+
+/*
+* Usage Example:
+*	Str8 fileContents = Str8_Empty;
+*	if (OsReadFile(FilePathLit("config.json"), stdHeap, false, &fileContents))
+*	{
+*		JsonValue root; Result error = Result_None; uxx errorIndex = 0;
+*		if (TryParseJson(stdHeap, fileContents, &root, &error, &errorIndex))
+*		{
+*			JsonValue* widthValue = GetJsonMember(&root, StrLit("width"));
+*			if (widthValue != nullptr && widthValue->type == JsonValueType_Number) { PrintLine_D("width = %g", widthValue->number); }
+*		}
+*	}
+*
+*	JsonWriter writer;
+*	InitJsonWriter(&writer, stdHeap, true);
+*	JsonWriteObjectStart(&writer);
+*	JsonWriteKey(&writer, StrLit("name")); JsonWriteStr(&writer, StrLit("Piggy"));
+*	JsonWriteKey(&writer, StrLit("level")); JsonWriteI64(&writer, 12);
+*	JsonWriteObjectEnd(&writer);
+*	Str8 jsonStr = GetJsonWriterStr(&writer);
+*/
+
+#ifndef _MISC_JSON_H
+#define _MISC_JSON_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_char.h"
+#include "base/base_math.h"
+#include "base/base_simd.h"
+#include "base/base_unicode.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+#include "mem/mem_scratch.h"
+#include "struct/struct_string.h"
+#include "misc/misc_result.h"
+#include "misc/misc_parsing.h"
+#include "misc/misc_formatting.h"
+
+#define JSON_MAX_DEPTH            512 //documents with objects\arrays nested deeper than this fail with Result_TooComplex
+#define JSON_WRITER_MIN_ALLOC     256
+#define JSON_MAX_EXACT_INTEGER    9007199254740992LL //2^53, integers with a larger magnitude than this can't be represented exactly in an r64
+
+typedef enum JsonTokenType JsonTokenType;
+enum JsonTokenType
+{
+	JsonTokenType_None = 0, //returned at the end of the document (or after an error)
+	JsonTokenType_ObjectStart,
+	JsonTokenType_ObjectEnd,
+	JsonTokenType_ArrayStart,
+	JsonTokenType_ArrayEnd,
+	JsonTokenType_Key,
+	JsonTokenType_String,
+	JsonTokenType_Number,
+	JsonTokenType_True,
+	JsonTokenType_False,
+	JsonTokenType_Null,
+	JsonTokenType_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetJsonTokenTypeStr(JsonTokenType enumValue);
+#else
+PEXP const char* GetJsonTokenTypeStr(JsonTokenType enumValue)
+{
+	switch (enumValue)
+	{
+		case JsonTokenType_None:        return "None";
+		case JsonTokenType_ObjectStart: return "ObjectStart";
+		case JsonTokenType_ObjectEnd:   return "ObjectEnd";
+		case JsonTokenType_ArrayStart:  return "ArrayStart";
+		case JsonTokenType_ArrayEnd:    return "ArrayEnd";
+		case JsonTokenType_Key:         return "Key";
+		case JsonTokenType_String:      return "String";
+		case JsonTokenType_Number:      return "Number";
+		case JsonTokenType_True:        return "True";
+		case JsonTokenType_False:       return "False";
+		case JsonTokenType_Null:        return "Null";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct JsonToken JsonToken;
+struct JsonToken
+{
+	JsonTokenType type;
+	bool hasEscapes; //only for Key and String, use DecodeJsonTokenStr to get the actual string
+	bool isInteger; //only for Number, true when there is no fraction or exponent
+	uxx index; //where the token starts in the source
+	Str8 str; //for Key and String this is the contents between the quotes, for everything else it's the token text
+};
+
+typedef enum JsonReaderState JsonReaderState;
+enum JsonReaderState
+{
+	JsonReaderState_None = 0,
+	JsonReaderState_Value, //expecting a value (start of the document, after a ':' or after a ',' in an array)
+	JsonReaderState_ValueOrEnd, //after '['
+	JsonReaderState_Key, //after a ',' in an object
+	JsonReaderState_KeyOrEnd, //after '{'
+	JsonReaderState_CommaOrEnd, //after a value inside an object\array
+	JsonReaderState_End, //after the root value, only whitespace is allowed
+	JsonReaderState_Finished,
+	JsonReaderState_Error,
+	JsonReaderState_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetJsonReaderStateStr(JsonReaderState enumValue);
+#else
+PEXP const char* GetJsonReaderStateStr(JsonReaderState enumValue)
+{
+	switch (enumValue)
+	{
+		case JsonReaderState_None:       return "None";
+		case JsonReaderState_Value:      return "Value";
+		case JsonReaderState_ValueOrEnd: return "ValueOrEnd";
+		case JsonReaderState_Key:        return "Key";
+		case JsonReaderState_KeyOrEnd:   return "KeyOrEnd";
+		case JsonReaderState_CommaOrEnd: return "CommaOrEnd";
+		case JsonReaderState_End:        return "End";
+		case JsonReaderState_Finished:   return "Finished";
+		case JsonReaderState_Error:      return "Error";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct JsonReader JsonReader;
+struct JsonReader
+{
+	Str8 source;
+	uxx index;
+	JsonReaderState state;
+	Result error;
+	uxx errorIndex;
+	uxx depth;
+	u64 objectBits[JSON_MAX_DEPTH/64]; //a bit per depth level, set when that level is an object rather than an array
+};
+
+typedef enum JsonValueType JsonValueType;
+enum JsonValueType
+{
+	JsonValueType_None = 0,
+	JsonValueType_Null,
+	JsonValueType_Bool,
+	JsonValueType_Number,
+	JsonValueType_String,
+	JsonValueType_Array,
+	JsonValueType_Object,
+	JsonValueType_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetJsonValueTypeStr(JsonValueType enumValue);
+#else
+PEXP const char* GetJsonValueTypeStr(JsonValueType enumValue)
+{
+	switch (enumValue)
+	{
+		case JsonValueType_None:   return "None";
+		case JsonValueType_Null:   return "Null";
+		case JsonValueType_Bool:   return "Bool";
+		case JsonValueType_Number: return "Number";
+		case JsonValueType_String: return "String";
+		case JsonValueType_Array:  return "Array";
+		case JsonValueType_Object: return "Object";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct JsonMember JsonMember;
+typedef struct JsonValue JsonValue;
+struct JsonValue
+{
+	JsonValueType type;
+	bool isInteger; //only for Number, the number was written without a fraction or exponent and fits in an i64
+	union
+	{
+		bool boolValue;
+		struct { r64 number; i64 integer; }; //integer is only filled when isInteger is true
+		Str8 str;
+		struct { uxx numItems; JsonValue* items; };
+		struct { uxx numMembers; JsonMember* members; };
+	};
+};
+struct JsonMember
+{
+	Str8 key;
+	JsonValue value;
+};
+
+typedef struct JsonWriter JsonWriter;
+struct JsonWriter
+{
+	Arena* arena;
+	bool pretty; //newlines after each item and tabs for indentation
+	bool hasItems; //whether the current object\array has anything in it yet (so the next item needs a comma)
+	bool afterKey;
+	uxx depth;
+	uxx length;
+	uxx allocLength;
+	char* chars;
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE bool IsJsonWhitespace_(u8 character);
+	PIG_CORE_INLINE uxx SkipJsonWhitespace_(Str8 source, uxx index);
+	PIG_CORE_INLINE uxx FindJsonStringSpecial_(const u8* bytes, uxx numBytes);
+	PIG_CORE_INLINE uxx FindJsonStructuralChar_(const u8* bytes, uxx numBytes);
+	void InitJsonReader(JsonReader* reader, Str8 source);
+	PIG_CORE_INLINE bool JsonReaderError_(JsonReader* reader, Result error, uxx errorIndex);
+	PIG_CORE_INLINE bool IsJsonReaderInObject_(const JsonReader* reader);
+	PIG_CORE_INLINE bool JsonReaderPush_(JsonReader* reader, bool isObject, uxx index);
+	bool JsonReaderScanStr_(JsonReader* reader, uxx quoteIndex, JsonToken* tokenOut, uxx* endIndexOut);
+	bool JsonReaderScanNumber_(JsonReader* reader, uxx startIndex, JsonToken* tokenOut, uxx* endIndexOut);
+	bool JsonReaderNext(JsonReader* reader, JsonToken* tokenOut);
+	bool JsonReaderSkipContainer(JsonReader* reader);
+	uxx DecodeJsonStr_(Str8 rawStr, char* bufferOut);
+	Str8 DecodeJsonStr(Arena* arena, Str8 rawStr);
+	PIG_CORE_INLINE Str8 DecodeJsonTokenStr(Arena* arena, const JsonToken* token);
+	bool TryGetJsonTokenNumber(const JsonToken* token, JsonValue* valueOut, Result* errorOut);
+	bool TryParseJson(Arena* arena, Str8 source, JsonValue* rootOut, Result* errorOut, uxx* errorIndexOut);
+	JsonValue* GetJsonMember(const JsonValue* object, Str8 key);
+	PIG_CORE_INLINE JsonValue* GetJsonItem(const JsonValue* array, uxx index);
+	void InitJsonWriter(JsonWriter* writer, Arena* arena, bool pretty);
+	PIG_CORE_INLINE bool IsJsonWriterInit(const JsonWriter* writer);
+	void FreeJsonWriter(JsonWriter* writer);
+	PIG_CORE_INLINE Str8 GetJsonWriterStr(const JsonWriter* writer);
+	char* JsonWriterExtend_(JsonWriter* writer, uxx numChars);
+	PIG_CORE_INLINE void JsonWriterNewLine_(JsonWriter* writer);
+	PIG_CORE_INLINE void JsonWriterBeginItem_(JsonWriter* writer);
+	PIG_CORE_INLINE void JsonWriterEndContainer_(JsonWriter* writer, char endChar);
+	void JsonWriteStr_(JsonWriter* writer, Str8 str);
+	PIG_CORE_INLINE void JsonWriteObjectStart(JsonWriter* writer);
+	PIG_CORE_INLINE void JsonWriteObjectEnd(JsonWriter* writer);
+	PIG_CORE_INLINE void JsonWriteArrayStart(JsonWriter* writer);
+	PIG_CORE_INLINE void JsonWriteArrayEnd(JsonWriter* writer);
+	PIG_CORE_INLINE void JsonWriteKey(JsonWriter* writer, Str8 key);
+	PIG_CORE_INLINE void JsonWriteStr(JsonWriter* writer, Str8 str);
+	PIG_CORE_INLINE void JsonWriteI64(JsonWriter* writer, i64 value);
+	PIG_CORE_INLINE void JsonWriteR64(JsonWriter* writer, r64 value);
+	PIG_CORE_INLINE void JsonWriteBool(JsonWriter* writer, bool value);
+	PIG_CORE_INLINE void JsonWriteNull(JsonWriter* writer);
+	void JsonWriteValue(JsonWriter* writer, const JsonValue* value);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+// +==============================+
+// |           Scanning           |
+// +==============================+
+PEXPI bool IsJsonWhitespace_(u8 character)
+{
+	return (character == ' ' || character == '\n' || character == '\r' || character == '\t');
+}
+
+PEXPI uxx SkipJsonWhitespace_(Str8 source, uxx index)
+{
+	//NOTE: Most whitespace runs are 0 or 1 chars long (ex. ", " or ": ") so we check the first 2 chars before bothering with SIMD
+	if (index >= source.length || !IsJsonWhitespace_(source.bytes[index])) { return index; }
+	index++;
+	if (index >= source.length || !IsJsonWhitespace_(source.bytes[index])) { return index; }
+	
+	#if TARGET_HAS_SIMD128
+	SimdU8x16 spaceVec = SimdSplatU8x16(' ');
+	SimdU8x16 newLineVec = SimdSplatU8x16('\n');
+	SimdU8x16 carriageReturnVec = SimdSplatU8x16('\r');
+	SimdU8x16 tabVec = SimdSplatU8x16('\t');
+	SimdU8x16 allOnesVec = SimdSplatU8x16(0xFF);
+	while (index + 16 <= source.length)
+	{
+		SimdU8x16 input = SimdLoadU8x16(source.bytes + index);
+		SimdU8x16 isWhitespace = SimdOrU8x16(
+			SimdOrU8x16(SimdEqualsU8x16(input, spaceVec), SimdEqualsU8x16(input, newLineVec)),
+			SimdOrU8x16(SimdEqualsU8x16(input, carriageReturnVec), SimdEqualsU8x16(input, tabVec))
+		);
+		u64 mask = SimdHighBitMaskU8x16(SimdXorU8x16(isWhitespace, allOnesVec));
+		if (mask != 0) { return index + (uxx)(CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE); }
+		index += 16;
+	}
+	#endif
+	
+	while (index < source.length && IsJsonWhitespace_(source.bytes[index])) { index++; }
+	return index;
+}
+
+//Returns the index of the first '"', '\\' or control character (< 0x20), or numBytes if there are none
+PEXPI uxx FindJsonStringSpecial_(const u8* bytes, uxx numBytes)
+{
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_SIMD128
+	SimdU8x16 quoteVec = SimdSplatU8x16('"');
+	SimdU8x16 backslashVec = SimdSplatU8x16('\\');
+	SimdU8x16 maxControlVec = SimdSplatU8x16(0x1F);
+	SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+	while (bIndex + 16 <= numBytes)
+	{
+		SimdU8x16 input = SimdLoadU8x16(bytes + bIndex);
+		SimdU8x16 isControl = SimdEqualsU8x16(SimdSubSatU8x16(input, maxControlVec), zeroVec); //input - 0x1F saturates to 0 for anything <= 0x1F
+		SimdU8x16 flagged = SimdOrU8x16(SimdOrU8x16(SimdEqualsU8x16(input, quoteVec), SimdEqualsU8x16(input, backslashVec)), isControl);
+		u64 mask = SimdHighBitMaskU8x16(flagged);
+		if (mask != 0) { return bIndex + (uxx)(CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE); }
+		bIndex += 16;
+	}
+	#endif
+	
+	for (; bIndex < numBytes; bIndex++)
+	{
+		u8 character = bytes[bIndex];
+		if (character == '"' || character == '\\' || character < 0x20) { break; }
+	}
+	return bIndex;
+}
+
+//Returns the index of the first '{', '}', '[', ']' or '"', or numBytes if there are none
+PEXPI uxx FindJsonStructuralChar_(const u8* bytes, uxx numBytes)
+{
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_SIMD128
+	//NOTE: '[' and ']' are 0x5B and 0x5D, '{' and '}' are 0x7B and 0x7D. Setting bit 0x20 folds the square brackets onto the curly ones
+	SimdU8x16 foldVec = SimdSplatU8x16(0x20);
+	SimdU8x16 openVec = SimdSplatU8x16('{');
+	SimdU8x16 closeVec = SimdSplatU8x16('}');
+	SimdU8x16 quoteVec = SimdSplatU8x16('"');
+	while (bIndex + 16 <= numBytes)
+	{
+		SimdU8x16 input = SimdLoadU8x16(bytes + bIndex);
+		SimdU8x16 folded = SimdOrU8x16(input, foldVec);
+		SimdU8x16 flagged = SimdOrU8x16(SimdOrU8x16(SimdEqualsU8x16(folded, openVec), SimdEqualsU8x16(folded, closeVec)), SimdEqualsU8x16(input, quoteVec));
+		u64 mask = SimdHighBitMaskU8x16(flagged);
+		if (mask != 0) { return bIndex + (uxx)(CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE); }
+		bIndex += 16;
+	}
+	#endif
+	
+	for (; bIndex < numBytes; bIndex++)
+	{
+		u8 folded = (bytes[bIndex] | 0x20);
+		if (folded == '{' || folded == '}' || bytes[bIndex] == '"') { break; }
+	}
+	return bIndex;
+}
+
+// +==============================+
+// |          JsonReader          |
+// +==============================+
+PEXP void InitJsonReader(JsonReader* reader, Str8 source)
+{
+	NotNull(reader);
+	NotNullStr(source);
+	ClearPointer(reader);
+	reader->source = source;
+	reader->state = JsonReaderState_Value;
+	//Skip the UTF-8 byte order mark if there is one
+	if (source.length >= 3 && source.bytes[0] == 0xEF && source.bytes[1] == 0xBB && source.bytes[2] == 0xBF) { reader->index = 3; }
+}
+
+PEXPI bool JsonReaderError_(JsonReader* reader, Result error, uxx errorIndex)
+{
+	reader->state = JsonReaderState_Error;
+	reader->error = error;
+	reader->errorIndex = errorIndex;
+	return false;
+}
+
+PEXPI bool IsJsonReaderInObject_(const JsonReader* reader)
+{
+	DebugAssert(reader->depth > 0);
+	uxx level = reader->depth-1;
+	return IsFlagSet(reader->objectBits[level/64], (1ULL << (level%64)));
+}
+
+PEXPI bool JsonReaderPush_(JsonReader* reader, bool isObject, uxx index)
+{
+	if (reader->depth >= JSON_MAX_DEPTH) { return JsonReaderError_(reader, Result_TooComplex, index); }
+	uxx level = reader->depth;
+	if (isObject) { reader->objectBits[level/64] |= (1ULL << (level%64)); }
+	else { reader->objectBits[level/64] &= ~(1ULL << (level%64)); }
+	reader->depth++;
+	return true;
+}
+
+//Validates the string starting at quoteIndex and fills tokenOut->str and tokenOut->hasEscapes. endIndexOut is the index after the closing quote
+PEXP bool JsonReaderScanStr_(JsonReader* reader, uxx quoteIndex, JsonToken* tokenOut, uxx* endIndexOut)
+{
+	Str8 source = reader->source;
+	DebugAssert(quoteIndex < source.length && source.chars[quoteIndex] == '"');
+	bool hasEscapes = false;
+	uxx index = quoteIndex+1;
+	while (true)
+	{
+		index += FindJsonStringSpecial_(source.bytes + index, source.length - index);
+		if (index >= source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, quoteIndex); }
+		char character = source.chars[index];
+		if (character == '"') { break; }
+		else if (character == '\\')
+		{
+			hasEscapes = true;
+			if (index+1 >= source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, quoteIndex); }
+			char escapeChar = source.chars[index+1];
+			if (escapeChar == 'u')
+			{
+				if (index+6 > source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, quoteIndex); }
+				for (uxx hIndex = index+2; hIndex < index+6; hIndex++)
+				{
+					if (!IsCharHexadecimal(CharToU32(source.chars[hIndex]))) { return JsonReaderError_(reader, Result_InvalidCharacter, hIndex); }
+				}
+				index += 6;
+			}
+			else if (escapeChar == '"' || escapeChar == '\\' || escapeChar == '/' || escapeChar == 'b' ||
+				escapeChar == 'f' || escapeChar == 'n' || escapeChar == 'r' || escapeChar == 't')
+			{
+				index += 2;
+			}
+			else { return JsonReaderError_(reader, Result_InvalidCharacter, index+1); }
+		}
+		else { return JsonReaderError_(reader, Result_InvalidCharacter, index); } //control characters must be escaped
+	}
+	tokenOut->str = StrSlice(source, quoteIndex+1, index);
+	tokenOut->hasEscapes = hasEscapes;
+	*endIndexOut = index+1;
+	return true;
+}
+
+//Number grammar: -? (0 | [1-9][0-9]*) (\.[0-9]+)? ([eE][+-]?[0-9]+)?
+PEXP bool JsonReaderScanNumber_(JsonReader* reader, uxx startIndex, JsonToken* tokenOut, uxx* endIndexOut)
+{
+	Str8 source = reader->source;
+	uxx index = startIndex;
+	bool isInteger = true;
+	if (index < source.length && source.chars[index] == '-') { index++; }
+	if (index >= source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, startIndex); }
+	if (source.chars[index] == '0') { index++; }
+	else if (source.chars[index] >= '1' && source.chars[index] <= '9')
+	{
+		while (index < source.length && IsCharNumeric(CharToU32(source.chars[index]))) { index++; }
+	}
+	else { return JsonReaderError_(reader, Result_InvalidCharacter, index); }
+	
+	if (index < source.length && source.chars[index] == '.')
+	{
+		isInteger = false;
+		index++;
+		if (index >= source.length || !IsCharNumeric(CharToU32(source.chars[index]))) { return JsonReaderError_(reader, Result_InvalidCharacter, index); }
+		while (index < source.length && IsCharNumeric(CharToU32(source.chars[index]))) { index++; }
+	}
+	if (index < source.length && (source.chars[index] == 'e' || source.chars[index] == 'E'))
+	{
+		isInteger = false;
+		index++;
+		if (index < source.length && (source.chars[index] == '+' || source.chars[index] == '-')) { index++; }
+		if (index >= source.length || !IsCharNumeric(CharToU32(source.chars[index]))) { return JsonReaderError_(reader, Result_InvalidCharacter, index); }
+		while (index < source.length && IsCharNumeric(CharToU32(source.chars[index]))) { index++; }
+	}
+	
+	tokenOut->str = StrSlice(source, startIndex, index);
+	tokenOut->isInteger = isInteger;
+	*endIndexOut = index;
+	return true;
+}
+
+//Returns false at the end of the document or when an error is found (reader->error is Result_None in the former case)
+PEXP bool JsonReaderNext(JsonReader* reader, JsonToken* tokenOut)
+{
+	NotNull(reader);
+	NotNull(tokenOut);
+	ClearPointer(tokenOut);
+	if (reader->state == JsonReaderState_Finished || reader->state == JsonReaderState_Error) { return false; }
+	
+	Str8 source = reader->source;
+	uxx index = SkipJsonWhitespace_(source, reader->index);
+	if (reader->state == JsonReaderState_End)
+	{
+		if (index < source.length) { return JsonReaderError_(reader, Result_UnexpectedToken, index); }
+		reader->index = index;
+		reader->state = JsonReaderState_Finished;
+		return false;
+	}
+	if (index >= source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, index); }
+	char character = source.chars[index];
+	JsonReaderState state = reader->state;
+	
+	// Commas and closing brackets
+	bool isClosing = false;
+	if (state == JsonReaderState_CommaOrEnd)
+	{
+		bool inObject = IsJsonReaderInObject_(reader);
+		if (character == ',')
+		{
+			index = SkipJsonWhitespace_(source, index+1);
+			if (index >= source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, index); }
+			character = source.chars[index];
+			state = inObject ? JsonReaderState_Key : JsonReaderState_Value;
+		}
+		else if (character == (inObject ? '}' : ']')) { isClosing = true; }
+		else { return JsonReaderError_(reader, Result_UnexpectedToken, index); }
+	}
+	else if ((state == JsonReaderState_KeyOrEnd && character == '}') || (state == JsonReaderState_ValueOrEnd && character == ']')) { isClosing = true; }
+	
+	tokenOut->index = index;
+	if (isClosing)
+	{
+		tokenOut->type = (character == '}') ? JsonTokenType_ObjectEnd : JsonTokenType_ArrayEnd;
+		tokenOut->str = StrSliceLength(source, index, 1);
+		reader->depth--;
+		reader->index = index+1;
+		reader->state = (reader->depth > 0) ? JsonReaderState_CommaOrEnd : JsonReaderState_End;
+		return true;
+	}
+	
+	// Keys (we consume the ':' after the key here as well)
+	if (state == JsonReaderState_Key || state == JsonReaderState_KeyOrEnd)
+	{
+		if (character != '"') { return JsonReaderError_(reader, Result_UnexpectedToken, index); }
+		uxx endIndex = 0;
+		if (!JsonReaderScanStr_(reader, index, tokenOut, &endIndex)) { return false; }
+		uxx colonIndex = SkipJsonWhitespace_(source, endIndex);
+		if (colonIndex >= source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, colonIndex); }
+		if (source.chars[colonIndex] != ':') { return JsonReaderError_(reader, Result_UnexpectedToken, colonIndex); }
+		tokenOut->type = JsonTokenType_Key;
+		reader->index = colonIndex+1;
+		reader->state = JsonReaderState_Value;
+		return true;
+	}
+	
+	// Values
+	uxx endIndex = index+1;
+	switch (character)
+	{
+		case '{':
+		case '[':
+		{
+			bool isObject = (character == '{');
+			if (!JsonReaderPush_(reader, isObject, index)) { return false; }
+			tokenOut->type = isObject ? JsonTokenType_ObjectStart : JsonTokenType_ArrayStart;
+			tokenOut->str = StrSliceLength(source, index, 1);
+			reader->index = endIndex;
+			reader->state = isObject ? JsonReaderState_KeyOrEnd : JsonReaderState_ValueOrEnd;
+			return true;
+		} break;
+		
+		case '"':
+		{
+			if (!JsonReaderScanStr_(reader, index, tokenOut, &endIndex)) { return false; }
+			tokenOut->type = JsonTokenType_String;
+		} break;
+		
+		case 't':
+		case 'f':
+		case 'n':
+		{
+			Str8 literal = (character == 't') ? StrLit("true") : ((character == 'f') ? StrLit("false") : StrLit("null"));
+			if (index + literal.length > source.length || !MyMemEquals(source.chars + index, literal.chars, literal.length))
+			{
+				return JsonReaderError_(reader, Result_UnexpectedToken, index);
+			}
+			tokenOut->type = (character == 't') ? JsonTokenType_True : ((character == 'f') ? JsonTokenType_False : JsonTokenType_Null);
+			tokenOut->str = StrSliceLength(source, index, literal.length);
+			endIndex = index + literal.length;
+		} break;
+		
+		default:
+		{
+			if (character != '-' && !IsCharNumeric(CharToU32(character))) { return JsonReaderError_(reader, Result_UnexpectedToken, index); }
+			if (!JsonReaderScanNumber_(reader, index, tokenOut, &endIndex)) { return false; }
+			tokenOut->type = JsonTokenType_Number;
+		} break;
+	}
+	
+	reader->index = endIndex;
+	reader->state = (reader->depth > 0) ? JsonReaderState_CommaOrEnd : JsonReaderState_End;
+	return true;
+}
+
+//Call this right after JsonReaderNext returns an ObjectStart or ArrayStart token to skip to the matching end token (which is consumed, not returned)
+//This is much faster than pulling each token since it only looks at brackets and strings. Nesting and strings are validated
+//but everything else (commas, colons, numbers, etc.) inside the skipped container is not checked
+PEXP bool JsonReaderSkipContainer(JsonReader* reader)
+{
+	NotNull(reader);
+	if (reader->state == JsonReaderState_Error) { return false; }
+	AssertMsg(reader->state == JsonReaderState_KeyOrEnd || reader->state == JsonReaderState_ValueOrEnd, "JsonReaderSkipContainer must be called right after an ObjectStart or ArrayStart token");
+	Str8 source = reader->source;
+	uxx targetDepth = reader->depth-1;
+	uxx index = reader->index;
+	JsonToken strToken = ZEROED;
+	while (true)
+	{
+		index += FindJsonStructuralChar_(source.bytes + index, source.length - index);
+		if (index >= source.length) { return JsonReaderError_(reader, Result_UnexpectedEnd, index); }
+		char character = source.chars[index];
+		if (character == '"')
+		{
+			if (!JsonReaderScanStr_(reader, index, &strToken, &index)) { return false; }
+		}
+		else if (character == '{' || character == '[')
+		{
+			if (!JsonReaderPush_(reader, (character == '{'), index)) { return false; }
+			index++;
+		}
+		else
+		{
+			if (IsJsonReaderInObject_(reader) != (character == '}')) { return JsonReaderError_(reader, Result_UnexpectedToken, index); }
+			reader->depth--;
+			index++;
+			if (reader->depth == targetDepth) { break; }
+		}
+	}
+	reader->index = index;
+	reader->state = (reader->depth > 0) ? JsonReaderState_CommaOrEnd : JsonReaderState_End;
+	return true;
+}
+
+// +==============================+
+// |       Decoding Strings       |
+// +==============================+
+//Decodes the escape sequences in rawStr (which must have been validated by JsonReader) and returns the decoded length.
+//Pass nullptr for bufferOut to only measure. The decoded string is never longer than rawStr
+//NOTE: Unpaired surrogates (ex. "\uD800" on its own) are decoded as U+FFFD
+PEXP uxx DecodeJsonStr_(Str8 rawStr, char* bufferOut)
+{
+	uxx result = 0;
+	uxx index = 0;
+	while (index < rawStr.length)
+	{
+		uxx runLength = FindJsonStringSpecial_(rawStr.bytes + index, rawStr.length - index);
+		if (bufferOut != nullptr && runLength > 0) { MyMemCopy(bufferOut + result, rawStr.chars + index, runLength); }
+		result += runLength;
+		index += runLength;
+		if (index >= rawStr.length) { break; }
+		
+		DebugAssert(rawStr.chars[index] == '\\' && index+1 < rawStr.length);
+		char escapeChar = rawStr.chars[index+1];
+		if (escapeChar == 'u')
+		{
+			DebugAssert(index+6 <= rawStr.length);
+			u32 codepoint = 0;
+			for (uxx hIndex = index+2; hIndex < index+6; hIndex++) { codepoint = (codepoint << 4) | GetHexCharValue(rawStr.chars[hIndex]); }
+			index += 6;
+			if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+			{
+				//High surrogate, combine it with the low surrogate that should follow it
+				u32 lowSurrogate = 0;
+				if (index+6 <= rawStr.length && rawStr.chars[index] == '\\' && rawStr.chars[index+1] == 'u' && AreCharsHexidecimal(4, &rawStr.chars[index+2]))
+				{
+					for (uxx hIndex = index+2; hIndex < index+6; hIndex++) { lowSurrogate = (lowSurrogate << 4) | GetHexCharValue(rawStr.chars[hIndex]); }
+				}
+				if (lowSurrogate >= 0xDC00 && lowSurrogate <= 0xDFFF)
+				{
+					codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+					index += 6;
+				}
+				else { codepoint = 0xFFFD; }
+			}
+			else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) { codepoint = 0xFFFD; }
+			result += GetUtf8BytesForCode(codepoint, (bufferOut != nullptr) ? (u8*)(bufferOut + result) : nullptr, false);
+		}
+		else
+		{
+			char decodedChar = escapeChar; //'"', '\\' and '/' decode to themselves
+			switch (escapeChar)
+			{
+				case 'b': decodedChar = '\b'; break;
+				case 'f': decodedChar = '\f'; break;
+				case 'n': decodedChar = '\n'; break;
+				case 'r': decodedChar = '\r'; break;
+				case 't': decodedChar = '\t'; break;
+			}
+			if (bufferOut != nullptr) { bufferOut[result] = decodedChar; }
+			result++;
+			index += 2;
+		}
+	}
+	return result;
+}
+
+PEXP Str8 DecodeJsonStr(Arena* arena, Str8 rawStr)
+{
+	NotNull(arena);
+	uxx decodedLength = DecodeJsonStr_(rawStr, nullptr);
+	if (decodedLength == 0) { return Str8_Empty; }
+	char* decodedChars = AllocArray(char, arena, decodedLength);
+	NotNull(decodedChars);
+	uxx writtenLength = DecodeJsonStr_(rawStr, decodedChars);
+	DebugAssert(writtenLength == decodedLength);
+	UNUSED(writtenLength);
+	return NewStr8(decodedLength, decodedChars);
+}
+
+//Strings without escapes are returned as a slice of the source, only strings with escapes get allocated in the arena
+PEXPI Str8 DecodeJsonTokenStr(Arena* arena, const JsonToken* token)
+{
+	NotNull(token);
+	Assert(token->type == JsonTokenType_Key || token->type == JsonTokenType_String);
+	return token->hasEscapes ? DecodeJsonStr(arena, token->str) : token->str;
+}
+
+//Fills the number, integer and isInteger members of valueOut. Numbers too large for an r64 are stored as +-infinity
+PEXP bool TryGetJsonTokenNumber(const JsonToken* token, JsonValue* valueOut, Result* errorOut)
+{
+	NotNull(token);
+	NotNull(valueOut);
+	Assert(token->type == JsonTokenType_Number);
+	ClearPointer(valueOut);
+	valueOut->type = JsonValueType_Number;
+	bool isNegative = (token->str.length > 0 && token->str.chars[0] == '-');
+	//NOTE: "-0" is left to TryParseR64 (and isInteger stays false) so the sign survives being written back out
+	if (token->isInteger && TryParseI64Ex(token->str, &valueOut->integer, nullptr, false, false) && !(isNegative && valueOut->integer == 0))
+	{
+		valueOut->isInteger = true;
+		//Small integers convert exactly so we don't need to parse the string a second time
+		if (valueOut->integer >= -JSON_MAX_EXACT_INTEGER && valueOut->integer <= JSON_MAX_EXACT_INTEGER)
+		{
+			valueOut->number = (r64)valueOut->integer;
+			return true;
+		}
+	}
+	Result parseError = Result_None;
+	if (TryParseR64(token->str, &valueOut->number, &parseError)) { return true; }
+	//Numbers like 1e400 are valid JSON even though they don't fit in an r64, so we store +-infinity rather than failing the whole document
+	if (parseError == Result_Overflow)
+	{
+		u64 infinityBits = (isNegative ? 0xFFF0000000000000ULL : 0x7FF0000000000000ULL);
+		MyMemCopy(&valueOut->number, &infinityBits, sizeof(r64));
+		return true;
+	}
+	SetOptionalOutPntr(errorOut, parseError);
+	return false;
+}
+
+// +==============================+
+// |         TryParseJson         |
+// +==============================+
+//Builds a tree of JsonValues in the arena. Unescaped strings are slices of source, so source must outlive the tree
+//NOTE: If parsing fails the things that were already allocated in the arena are not freed
+PEXP bool TryParseJson(Arena* arena, Str8 source, JsonValue* rootOut, Result* errorOut, uxx* errorIndexOut)
+{
+	NotNull(arena);
+	NotNullStr(source);
+	NotNull(rootOut);
+	ClearPointer(rootOut);
+	ScratchBegin1(scratch, arena);
+	
+	JsonReader reader;
+	InitJsonReader(&reader, source);
+	
+	//Values are pushed on the pending array as they are parsed. Objects\arrays stay on pending while their children are
+	//pushed after them. When an object\array ends its children are copied into one contiguous array in the arena and popped.
+	//NOTE: pending is always the last allocation in scratch so ReallocMem grows it in place
+	uxx pendingAllocLength = 64;
+	uxx numPending = 0;
+	JsonMember* pending = AllocArray(JsonMember, scratch, pendingAllocLength);
+	NotNull(pending);
+	uxx containerIndices[JSON_MAX_DEPTH];
+	Str8 key = Str8_Empty;
+	
+	JsonToken token;
+	while (JsonReaderNext(&reader, &token))
+	{
+		if (token.type == JsonTokenType_Key) { key = DecodeJsonTokenStr(arena, &token); continue; }
+		
+		if (token.type == JsonTokenType_ObjectEnd || token.type == JsonTokenType_ArrayEnd)
+		{
+			uxx containerIndex = containerIndices[reader.depth];
+			JsonValue* container = &pending[containerIndex].value;
+			JsonMember* children = &pending[containerIndex+1];
+			uxx numChildren = numPending - (containerIndex+1);
+			if (numChildren > 0)
+			{
+				if (container->type == JsonValueType_Object)
+				{
+					container->members = AllocArray(JsonMember, arena, numChildren);
+					NotNull(container->members);
+					MyMemCopy(container->members, children, sizeof(JsonMember) * numChildren);
+					container->numMembers = numChildren;
+				}
+				else
+				{
+					container->items = AllocArray(JsonValue, arena, numChildren);
+					NotNull(container->items);
+					for (uxx cIndex = 0; cIndex < numChildren; cIndex++) { container->items[cIndex] = children[cIndex].value; }
+					container->numItems = numChildren;
+				}
+			}
+			numPending = containerIndex+1;
+			continue;
+		}
+		
+		if (numPending >= pendingAllocLength)
+		{
+			uxx newAllocLength = pendingAllocLength*2;
+			pending = (JsonMember*)ReallocMem(scratch, pending, sizeof(JsonMember) * pendingAllocLength, sizeof(JsonMember) * newAllocLength);
+			NotNull(pending);
+			pendingAllocLength = newAllocLength;
+		}
+		JsonMember* member = &pending[numPending];
+		numPending++;
+		ClearPointer(member);
+		member->key = key;
+		key = Str8_Empty;
+		JsonValue* value = &member->value;
+		switch (token.type)
+		{
+			case JsonTokenType_ObjectStart: value->type = JsonValueType_Object; containerIndices[reader.depth-1] = numPending-1; break;
+			case JsonTokenType_ArrayStart:  value->type = JsonValueType_Array;  containerIndices[reader.depth-1] = numPending-1; break;
+			case JsonTokenType_String:      value->type = JsonValueType_String; value->str = DecodeJsonTokenStr(arena, &token); break;
+			case JsonTokenType_True:        value->type = JsonValueType_Bool; value->boolValue = true; break;
+			case JsonTokenType_False:       value->type = JsonValueType_Bool; value->boolValue = false; break;
+			case JsonTokenType_Null:        value->type = JsonValueType_Null; break;
+			case JsonTokenType_Number:
+			{
+				Result numberError = Result_None;
+				if (!TryGetJsonTokenNumber(&token, value, &numberError)) { JsonReaderError_(&reader, numberError, token.index); }
+			} break;
+			default: Assert(false); break;
+		}
+		if (reader.state == JsonReaderState_Error) { break; }
+	}
+	
+	bool result = (reader.error == Result_None);
+	if (result)
+	{
+		Assert(numPending == 1);
+		MyMemCopy(rootOut, &pending[0].value, sizeof(JsonValue));
+	}
+	else
+	{
+		SetOptionalOutPntr(errorOut, reader.error);
+		SetOptionalOutPntr(errorIndexOut, reader.errorIndex);
+	}
+	ScratchEnd(scratch);
+	return result;
+}
+
+//Returns the first member with a matching key (or nullptr)
+PEXP JsonValue* GetJsonMember(const JsonValue* object, Str8 key)
+{
+	NotNull(object);
+	if (object->type != JsonValueType_Object) { return nullptr; }
+	for (uxx mIndex = 0; mIndex < object->numMembers; mIndex++)
+	{
+		if (StrExactEquals(object->members[mIndex].key, key)) { return &object->members[mIndex].value; }
+	}
+	return nullptr;
+}
+
+PEXPI JsonValue* GetJsonItem(const JsonValue* array, uxx index)
+{
+	NotNull(array);
+	if (array->type != JsonValueType_Array || index >= array->numItems) { return nullptr; }
+	return &array->items[index];
+}
+
+// +==============================+
+// |          JsonWriter          |
+// +==============================+
+PEXP void InitJsonWriter(JsonWriter* writer, Arena* arena, bool pretty)
+{
+	NotNull(writer);
+	NotNull(arena);
+	ClearPointer(writer);
+	writer->arena = arena;
+	writer->pretty = pretty;
+}
+
+PEXPI bool IsJsonWriterInit(const JsonWriter* writer)
+{
+	return (writer->arena != nullptr);
+}
+
+PEXP void FreeJsonWriter(JsonWriter* writer)
+{
+	NotNull(writer);
+	if (writer->arena != nullptr && writer->chars != nullptr && CanArenaFree(writer->arena))
+	{
+		FreeMem(writer->arena, writer->chars, writer->allocLength);
+	}
+	ClearPointer(writer);
+}
+
+//NOTE: The returned string points into the writer's buffer, it's invalidated by the next write
+PEXPI Str8 GetJsonWriterStr(const JsonWriter* writer)
+{
+	NotNull(writer);
+	return NewStr8(writer->length, writer->chars);
+}
+
+//Makes room for numChars at the end of the buffer and returns a pointer to them
+PEXP char* JsonWriterExtend_(JsonWriter* writer, uxx numChars)
+{
+	DebugNotNull(writer);
+	DebugNotNull(writer->arena);
+	if (writer->length + numChars > writer->allocLength)
+	{
+		uxx newAllocLength = (writer->allocLength > 0) ? writer->allocLength : JSON_WRITER_MIN_ALLOC;
+		while (newAllocLength < writer->length + numChars) { newAllocLength *= 2; }
+		//If the buffer is the last thing in the arena we can grow it in place
+		if (writer->chars != nullptr && CanArenaSoftGrow(writer->arena) &&
+			ArenaSoftGrowBegin(writer->arena, writer->chars, writer->allocLength) >= newAllocLength - writer->allocLength)
+		{
+			ArenaSoftGrowEnd(writer->arena, writer->chars, writer->allocLength, newAllocLength - writer->allocLength);
+		}
+		else
+		{
+			char* newChars = AllocArray(char, writer->arena, newAllocLength);
+			NotNull(newChars);
+			if (writer->length > 0) { MyMemCopy(newChars, writer->chars, writer->length); }
+			if (writer->chars != nullptr && CanArenaFree(writer->arena)) { FreeMem(writer->arena, writer->chars, writer->allocLength); }
+			writer->chars = newChars;
+		}
+		writer->allocLength = newAllocLength;
+	}
+	char* result = &writer->chars[writer->length];
+	writer->length += numChars;
+	return result;
+}
+
+PEXPI void JsonWriterNewLine_(JsonWriter* writer)
+{
+	char* newChars = JsonWriterExtend_(writer, 1 + writer->depth);
+	newChars[0] = '\n';
+	if (writer->depth > 0) { MyMemSet(&newChars[1], '\t', writer->depth); }
+}
+
+//Writes the comma and newline that go before an item in an object\array
+PEXPI void JsonWriterBeginItem_(JsonWriter* writer)
+{
+	NotNull(writer);
+	if (writer->afterKey) { writer->afterKey = false; return; }
+	if (writer->hasItems) { *JsonWriterExtend_(writer, 1) = ','; }
+	if (writer->pretty && writer->depth > 0) { JsonWriterNewLine_(writer); }
+	writer->hasItems = true;
+}
+
+PEXPI void JsonWriterEndContainer_(JsonWriter* writer, char endChar)
+{
+	NotNull(writer);
+	Assert(writer->depth > 0);
+	Assert(!writer->afterKey);
+	writer->depth--;
+	if (writer->pretty && writer->hasItems) { JsonWriterNewLine_(writer); }
+	*JsonWriterExtend_(writer, 1) = endChar;
+	writer->hasItems = true;
+}
+
+//Writes str surrounded by quotes, escaping '"', '\\' and control characters
+PEXP void JsonWriteStr_(JsonWriter* writer, Str8 str)
+{
+	NotNullStr(str);
+	*JsonWriterExtend_(writer, 1) = '"';
+	uxx index = 0;
+	while (index < str.length)
+	{
+		uxx runLength = FindJsonStringSpecial_(str.bytes + index, str.length - index);
+		if (runLength > 0)
+		{
+			MyMemCopy(JsonWriterExtend_(writer, runLength), str.chars + index, runLength);
+			index += runLength;
+			if (index >= str.length) { break; }
+		}
+		
+		u8 character = str.bytes[index];
+		char shortEscape = '\0';
+		switch (character)
+		{
+			case '"':  shortEscape = '"'; break;
+			case '\\': shortEscape = '\\'; break;
+			case '\b': shortEscape = 'b'; break;
+			case '\f': shortEscape = 'f'; break;
+			case '\n': shortEscape = 'n'; break;
+			case '\r': shortEscape = 'r'; break;
+			case '\t': shortEscape = 't'; break;
+		}
+		if (shortEscape != '\0')
+		{
+			char* escapeChars = JsonWriterExtend_(writer, 2);
+			escapeChars[0] = '\\';
+			escapeChars[1] = shortEscape;
+		}
+		else
+		{
+			char* escapeChars = JsonWriterExtend_(writer, 6);
+			MyMemCopy(escapeChars, "\\u00", 4);
+			escapeChars[4] = GetHexChar(GetUpperNibble(character), true);
+			escapeChars[5] = GetHexChar(GetLowerNibble(character), true);
+		}
+		index++;
+	}
+	*JsonWriterExtend_(writer, 1) = '"';
+}
+
+PEXPI void JsonWriteObjectStart(JsonWriter* writer)
+{
+	JsonWriterBeginItem_(writer);
+	*JsonWriterExtend_(writer, 1) = '{';
+	writer->depth++;
+	writer->hasItems = false;
+}
+PEXPI void JsonWriteObjectEnd(JsonWriter* writer) { JsonWriterEndContainer_(writer, '}'); }
+PEXPI void JsonWriteArrayStart(JsonWriter* writer)
+{
+	JsonWriterBeginItem_(writer);
+	*JsonWriterExtend_(writer, 1) = '[';
+	writer->depth++;
+	writer->hasItems = false;
+}
+PEXPI void JsonWriteArrayEnd(JsonWriter* writer) { JsonWriterEndContainer_(writer, ']'); }
+
+PEXPI void JsonWriteKey(JsonWriter* writer, Str8 key)
+{
+	Assert(!writer->afterKey);
+	JsonWriterBeginItem_(writer);
+	JsonWriteStr_(writer, key);
+	if (writer->pretty) { MyMemCopy(JsonWriterExtend_(writer, 2), ": ", 2); }
+	else { *JsonWriterExtend_(writer, 1) = ':'; }
+	writer->afterKey = true;
+}
+
+PEXPI void JsonWriteStr(JsonWriter* writer, Str8 str)
+{
+	JsonWriterBeginItem_(writer);
+	JsonWriteStr_(writer, str);
+}
+
+PEXPI void JsonWriteI64(JsonWriter* writer, i64 value)
+{
+	JsonWriterBeginItem_(writer);
+	char numberBuffer[FORMAT_I64_MAX_CHARS];
+	uxx numberLength = FormatI64(value, numberBuffer);
+	MyMemCopy(JsonWriterExtend_(writer, numberLength), numberBuffer, numberLength);
+}
+
+//NOTE: JSON has no way to represent infinity or NaN so those are written as null
+PEXPI void JsonWriteR64(JsonWriter* writer, r64 value)
+{
+	JsonWriterBeginItem_(writer);
+	if (IsInfiniteR64(value)) { MyMemCopy(JsonWriterExtend_(writer, 4), "null", 4); return; }
+	char numberBuffer[FORMAT_R64_MAX_CHARS];
+	uxx numberLength = FormatR64(value, numberBuffer);
+	MyMemCopy(JsonWriterExtend_(writer, numberLength), numberBuffer, numberLength);
+}
+
+PEXPI void JsonWriteBool(JsonWriter* writer, bool value)
+{
+	JsonWriterBeginItem_(writer);
+	if (value) { MyMemCopy(JsonWriterExtend_(writer, 4), "true", 4); }
+	else { MyMemCopy(JsonWriterExtend_(writer, 5), "false", 5); }
+}
+
+PEXPI void JsonWriteNull(JsonWriter* writer)
+{
+	JsonWriterBeginItem_(writer);
+	MyMemCopy(JsonWriterExtend_(writer, 4), "null", 4);
+}
+
+PEXP void JsonWriteValue(JsonWriter* writer, const JsonValue* value)
+{
+	NotNull(writer);
+	NotNull(value);
+	switch (value->type)
+	{
+		case JsonValueType_Null: JsonWriteNull(writer); break;
+		case JsonValueType_Bool: JsonWriteBool(writer, value->boolValue); break;
+		case JsonValueType_Number:
+		{
+			if (value->isInteger) { JsonWriteI64(writer, value->integer); }
+			else { JsonWriteR64(writer, value->number); }
+		} break;
+		case JsonValueType_String: JsonWriteStr(writer, value->str); break;
+		case JsonValueType_Array:
+		{
+			JsonWriteArrayStart(writer);
+			for (uxx iIndex = 0; iIndex < value->numItems; iIndex++) { JsonWriteValue(writer, &value->items[iIndex]); }
+			JsonWriteArrayEnd(writer);
+		} break;
+		case JsonValueType_Object:
+		{
+			JsonWriteObjectStart(writer);
+			for (uxx mIndex = 0; mIndex < value->numMembers; mIndex++)
+			{
+				JsonWriteKey(writer, value->members[mIndex].key);
+				JsonWriteValue(writer, &value->members[mIndex].value);
+			}
+			JsonWriteObjectEnd(writer);
+		} break;
+		default: AssertMsg(false, "Unhandled JsonValueType in JsonWriteValue"); break;
+	}
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_JSON_H
@@ -2,6 +2,21 @@
 File:   misc_noise.h
 Author: Taylor Robbins
 Date:   01\15\2025
+Description:
+	** Holds value, gradient (Perlin) and simplex noise functions in 2D, 3D and 4D, plus fractal (fBm and ridged)
+	** layering and domain warping on top of them through a NoiseGenerator.
+	** All the noise is hash based (no permutation table) so a generator is fully described by its seed
+	** and the batch functions can evaluate 4 points at a time with SimdR32x4 while still matching the scalar results.
+	** The noise functions return values in roughly [-1, 1]
+*/
+
+/*
+* Usage Example:
+	NoiseGenerator terrainNoise;
+	InitNoiseGeneratorFromSeries(&terrainNoise, NoiseType_Simplex, &random);
+	SetNoiseFractal(&terrainNoise, NoiseFractal_Fbm, 6, 2.0f, 0.5f);
+	terrainNoise.frequency = 1/64.0f;
+	FillNoiseGrid2D(&terrainNoise, V2_Zero, V2_One, mapWidth, mapHeight, heightValues);
 */
 
 #ifndef _MISC_NOISE_H
@@ -9,15 +24,143 @@ Date:   01\15\2025
 
 #include "base/base_defines_check.h"
 #include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_simd.h"
 #include "struct/struct_vectors.h"
 #include "std/std_trig.h"
 #include "std/std_basic_math.h"
 #include "misc/misc_random.h"
 
+//Large primes that lattice coordinates are multiplied by before being hashed together
+#define NOISE_PRIME_X 501125321U
+#define NOISE_PRIME_Y 1136930381U
+#define NOISE_PRIME_Z 1720413743U
+#define NOISE_PRIME_W 1066037191U
+#define NOISE_HASH_MULTIPLIER 0x27D4EB2DU
+
+//Skew/unskew factors for simplex noise, F = (sqrt(n+1)-1)/n and G = (1-1/sqrt(n+1))/n
+#define NOISE_SIMPLEX_F2 0.36602540378f
+#define NOISE_SIMPLEX_G2 0.21132486540f
+#define NOISE_SIMPLEX_F3 0.33333333333f
+#define NOISE_SIMPLEX_G3 0.16666666667f
+#define NOISE_SIMPLEX_F4 0.30901699437f
+#define NOISE_SIMPLEX_G4 0.13819660113f
+
+//Each noise function is multiplied by one of these so its output spans roughly [-1, 1]
+#define NOISE_PERLIN2D_SCALE  1.0f
+#define NOISE_PERLIN3D_SCALE  1.0f
+#define NOISE_PERLIN4D_SCALE  0.8f
+#define NOISE_SIMPLEX2D_SCALE 70.0f
+#define NOISE_SIMPLEX3D_SCALE 32.0f
+#define NOISE_SIMPLEX4D_SCALE 27.0f
+
+// +--------------------------------------------------------------+
+// |                  Type/Structure Definitions                  |
+// +--------------------------------------------------------------+
+typedef enum NoiseType NoiseType;
+enum NoiseType
+{
+	NoiseType_None = 0,
+	NoiseType_Value,
+	NoiseType_Perlin,
+	NoiseType_Simplex,
+	NoiseType_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetNoiseTypeStr(NoiseType enumValue);
+#else
+PEXP const char* GetNoiseTypeStr(NoiseType enumValue)
+{
+	switch (enumValue)
+	{
+		case NoiseType_None:    return "None";
+		case NoiseType_Value:   return "Value";
+		case NoiseType_Perlin:  return "Perlin";
+		case NoiseType_Simplex: return "Simplex";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef enum NoiseFractal NoiseFractal;
+enum NoiseFractal
+{
+	NoiseFractal_None = 0,
+	NoiseFractal_Fbm,    //fractional brownian motion, octaves are simply added together
+	NoiseFractal_Ridged, //each octave is folded with 1 - 2*|n| so the zero crossings become sharp ridges
+	NoiseFractal_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetNoiseFractalStr(NoiseFractal enumValue);
+#else
+PEXP const char* GetNoiseFractalStr(NoiseFractal enumValue)
+{
+	switch (enumValue)
+	{
+		case NoiseFractal_None:   return "None";
+		case NoiseFractal_Fbm:    return "Fbm";
+		case NoiseFractal_Ridged: return "Ridged";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct NoiseGenerator NoiseGenerator;
+struct NoiseGenerator
+{
+	NoiseType type;
+	NoiseFractal fractal;
+	u32 seed; //each octave uses seed+octaveIndex
+	r32 frequency; //positions are multiplied by this before sampling
+	u8 numOctaves;
+	r32 lacunarity; //frequency multiplier between octaves
+	r32 gain; //amplitude multiplier between octaves
+};
+
 // +--------------------------------------------------------------+
 // |                 Header Function Declarations                 |
 // +--------------------------------------------------------------+
 #if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE u32 NoiseHash2D(u32 seed, u32 xPrimed, u32 yPrimed);
+	PIG_CORE_INLINE u32 NoiseHash3D(u32 seed, u32 xPrimed, u32 yPrimed, u32 zPrimed);
+	PIG_CORE_INLINE u32 NoiseHash4D(u32 seed, u32 xPrimed, u32 yPrimed, u32 zPrimed, u32 wPrimed);
+	PIG_CORE_INLINE r32 NoiseHashToR32(u32 hash);
+	PIG_CORE_INLINE r32 NoiseFadeR32(r32 t);
+	PIG_CORE_INLINE r32 NoiseGrad2D(u32 hash, r32 x, r32 y);
+	PIG_CORE_INLINE r32 NoiseGrad3D(u32 hash, r32 x, r32 y, r32 z);
+	PIG_CORE_INLINE r32 NoiseGrad4D(u32 hash, r32 x, r32 y, r32 z, r32 w);
+	r32 ValueNoise2D(u32 seed, r32 x, r32 y);
+	r32 ValueNoise3D(u32 seed, r32 x, r32 y, r32 z);
+	r32 ValueNoise4D(u32 seed, r32 x, r32 y, r32 z, r32 w);
+	r32 PerlinNoise2D(u32 seed, r32 x, r32 y);
+	r32 PerlinNoise3D(u32 seed, r32 x, r32 y, r32 z);
+	r32 PerlinNoise4D(u32 seed, r32 x, r32 y, r32 z, r32 w);
+	r32 SimplexNoise2D(u32 seed, r32 x, r32 y);
+	r32 SimplexNoise3D(u32 seed, r32 x, r32 y, r32 z);
+	r32 SimplexNoise4D(u32 seed, r32 x, r32 y, r32 z, r32 w);
+	#if TARGET_HAS_SIMD128
+	SimdR32x4 ValueNoise2Dx4(u32 seed, SimdR32x4 x, SimdR32x4 y);
+	SimdR32x4 PerlinNoise2Dx4(u32 seed, SimdR32x4 x, SimdR32x4 y);
+	SimdR32x4 SimplexNoise2Dx4(u32 seed, SimdR32x4 x, SimdR32x4 y);
+	#endif
+	void InitNoiseGenerator(NoiseGenerator* generator, NoiseType type, u32 seed);
+	PIG_CORE_INLINE void InitNoiseGeneratorFromSeries(NoiseGenerator* generator, NoiseType type, RandomSeries* series);
+	PIG_CORE_INLINE void SetNoiseFractal(NoiseGenerator* generator, NoiseFractal fractal, u8 numOctaves, r32 lacunarity, r32 gain);
+	PIG_CORE_INLINE r32 GetRawNoise2D(NoiseType type, u32 seed, r32 x, r32 y);
+	PIG_CORE_INLINE r32 GetRawNoise3D(NoiseType type, u32 seed, r32 x, r32 y, r32 z);
+	PIG_CORE_INLINE r32 GetRawNoise4D(NoiseType type, u32 seed, r32 x, r32 y, r32 z, r32 w);
+	r32 GetNoise2D(const NoiseGenerator* generator, v2 position);
+	r32 GetNoise3D(const NoiseGenerator* generator, v3 position);
+	r32 GetNoise4D(const NoiseGenerator* generator, v4 position);
+	#if TARGET_HAS_SIMD128
+	SimdR32x4 GetNoise2Dx4(const NoiseGenerator* generator, SimdR32x4 x, SimdR32x4 y);
+	#endif
+	PIG_CORE_INLINE v2 DomainWarp2D(const NoiseGenerator* generator, v2 position, r32 amplitude);
+	PIG_CORE_INLINE v3 DomainWarp3D(const NoiseGenerator* generator, v3 position, r32 amplitude);
+	void FillNoiseGrid2D(const NoiseGenerator* generator, v2 origin, v2 step, uxx width, uxx height, r32* valuesOut);
+	void SampleNoise2D(const NoiseGenerator* generator, const v2* positions, uxx numPositions, r32* valuesOut);
+	void SampleNoise3D(const NoiseGenerator* generator, const v3* positions, uxx numPositions, r32* valuesOut);
 	// v2 GetBlueNoisePosInRec(u64 seed, rec bounds, u64 numOfPositions, u64 index);
 #endif //!PIG_CORE_IMPLEMENTATION
 
@@ -26,6 +169,684 @@ Date:   01\15\2025
 // +--------------------------------------------------------------+
 #if PIG_CORE_IMPLEMENTATION
 
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+PEXPI u32 NoiseHash2D(u32 seed, u32 xPrimed, u32 yPrimed)
+{
+	u32 hash = (seed ^ xPrimed ^ yPrimed) * NOISE_HASH_MULTIPLIER;
+	return hash ^ (hash >> 15);
+}
+PEXPI u32 NoiseHash3D(u32 seed, u32 xPrimed, u32 yPrimed, u32 zPrimed)
+{
+	u32 hash = (seed ^ xPrimed ^ yPrimed ^ zPrimed) * NOISE_HASH_MULTIPLIER;
+	return hash ^ (hash >> 15);
+}
+PEXPI u32 NoiseHash4D(u32 seed, u32 xPrimed, u32 yPrimed, u32 zPrimed, u32 wPrimed)
+{
+	u32 hash = (seed ^ xPrimed ^ yPrimed ^ zPrimed ^ wPrimed) * NOISE_HASH_MULTIPLIER;
+	return hash ^ (hash >> 15);
+}
+//Maps the full u32 range to [-1, 1)
+PEXPI r32 NoiseHashToR32(u32 hash) { return (r32)(i32)hash * (1.0f / 2147483648.0f); }
+//Quintic 6t^5 - 15t^4 + 10t^3, has zero 1st and 2nd derivatives at 0 and 1 so there are no creases at lattice lines
+PEXPI r32 NoiseFadeR32(r32 t) { return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f); }
+
+//2D uses the 4 diagonal gradients, 3D uses the 12 cube edge gradients from Perlin's improved noise
+//and 4D uses the 32 gradients that have one zero component
+PEXPI r32 NoiseGrad2D(u32 hash, r32 x, r32 y)
+{
+	return ((hash & 1) ? -x : x) + ((hash & 2) ? -y : y);
+}
+PEXPI r32 NoiseGrad3D(u32 hash, r32 x, r32 y, r32 z)
+{
+	u32 index = (hash & 15);
+	r32 u = (index < 8) ? x : y;
+	r32 v = (index < 4) ? y : ((index == 12 || index == 14) ? x : z);
+	return ((index & 1) ? -u : u) + ((index & 2) ? -v : v);
+}
+PEXPI r32 NoiseGrad4D(u32 hash, r32 x, r32 y, r32 z, r32 w)
+{
+	u32 index = (hash & 31);
+	r32 a = 0, b = 0, c = 0;
+	switch (index >> 3)
+	{
+		case 0:  a = y; b = z; c = w; break;
+		case 1:  a = x; b = z; c = w; break;
+		case 2:  a = x; b = y; c = w; break;
+		default: a = x; b = y; c = z; break;
+	}
+	return ((index & 1) ? -a : a) + ((index & 2) ? -b : b) + ((index & 4) ? -c : c);
+}
+
+// +--------------------------------------------------------------+
+// |                         Value Noise                          |
+// +--------------------------------------------------------------+
+PEXP r32 ValueNoise2D(u32 seed, r32 x, r32 y)
+{
+	r32 xFloor = FloorR32(x);
+	r32 yFloor = FloorR32(y);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	r32 xFade = NoiseFadeR32(x - xFloor);
+	r32 yFade = NoiseFadeR32(y - yFloor);
+	r32 value00 = NoiseHashToR32(NoiseHash2D(seed, xPrimed, yPrimed));
+	r32 value10 = NoiseHashToR32(NoiseHash2D(seed, xPrimed + NOISE_PRIME_X, yPrimed));
+	r32 value01 = NoiseHashToR32(NoiseHash2D(seed, xPrimed, yPrimed + NOISE_PRIME_Y));
+	r32 value11 = NoiseHashToR32(NoiseHash2D(seed, xPrimed + NOISE_PRIME_X, yPrimed + NOISE_PRIME_Y));
+	r32 value0 = value00 + (value10 - value00) * xFade;
+	r32 value1 = value01 + (value11 - value01) * xFade;
+	return value0 + (value1 - value0) * yFade;
+}
+PEXP r32 ValueNoise3D(u32 seed, r32 x, r32 y, r32 z)
+{
+	r32 xFloor = FloorR32(x);
+	r32 yFloor = FloorR32(y);
+	r32 zFloor = FloorR32(z);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	u32 zPrimed = (u32)(i32)zFloor * NOISE_PRIME_Z;
+	r32 xFade = NoiseFadeR32(x - xFloor);
+	r32 yFade = NoiseFadeR32(y - yFloor);
+	r32 zFade = NoiseFadeR32(z - zFloor);
+	r32 layers[2];
+	for (u8 zOffset = 0; zOffset < 2; zOffset++)
+	{
+		u32 zCorner = zPrimed + (zOffset ? NOISE_PRIME_Z : 0);
+		r32 value00 = NoiseHashToR32(NoiseHash3D(seed, xPrimed, yPrimed, zCorner));
+		r32 value10 = NoiseHashToR32(NoiseHash3D(seed, xPrimed + NOISE_PRIME_X, yPrimed, zCorner));
+		r32 value01 = NoiseHashToR32(NoiseHash3D(seed, xPrimed, yPrimed + NOISE_PRIME_Y, zCorner));
+		r32 value11 = NoiseHashToR32(NoiseHash3D(seed, xPrimed + NOISE_PRIME_X, yPrimed + NOISE_PRIME_Y, zCorner));
+		r32 value0 = value00 + (value10 - value00) * xFade;
+		r32 value1 = value01 + (value11 - value01) * xFade;
+		layers[zOffset] = value0 + (value1 - value0) * yFade;
+	}
+	return layers[0] + (layers[1] - layers[0]) * zFade;
+}
+
+PEXP r32 ValueNoise4D(u32 seed, r32 x, r32 y, r32 z, r32 w)
+{
+	r32 xFloor = FloorR32(x);
+	r32 yFloor = FloorR32(y);
+	r32 zFloor = FloorR32(z);
+	r32 wFloor = FloorR32(w);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	u32 zPrimed = (u32)(i32)zFloor * NOISE_PRIME_Z;
+	u32 wPrimed = (u32)(i32)wFloor * NOISE_PRIME_W;
+	r32 xFade = NoiseFadeR32(x - xFloor);
+	r32 yFade = NoiseFadeR32(y - yFloor);
+	r32 zFade = NoiseFadeR32(z - zFloor);
+	r32 wFade = NoiseFadeR32(w - wFloor);
+	//Corner index bits are (x, y, z, w) from lowest to highest, each pass of lerps halves the number of values
+	r32 values[16];
+	for (u8 cIndex = 0; cIndex < 16; cIndex++)
+	{
+		values[cIndex] = NoiseHashToR32(NoiseHash4D(seed,
+			xPrimed + ((cIndex & 1) ? NOISE_PRIME_X : 0),
+			yPrimed + ((cIndex & 2) ? NOISE_PRIME_Y : 0),
+			zPrimed + ((cIndex & 4) ? NOISE_PRIME_Z : 0),
+			wPrimed + ((cIndex & 8) ? NOISE_PRIME_W : 0)
+		));
+	}
+	for (u8 cIndex = 0; cIndex < 8; cIndex++) { values[cIndex] = values[cIndex*2] + (values[cIndex*2 + 1] - values[cIndex*2]) * xFade; }
+	for (u8 cIndex = 0; cIndex < 4; cIndex++) { values[cIndex] = values[cIndex*2] + (values[cIndex*2 + 1] - values[cIndex*2]) * yFade; }
+	for (u8 cIndex = 0; cIndex < 2; cIndex++) { values[cIndex] = values[cIndex*2] + (values[cIndex*2 + 1] - values[cIndex*2]) * zFade; }
+	return values[0] + (values[1] - values[0]) * wFade;
+}
+
+// +--------------------------------------------------------------+
+// |                    Gradient (Perlin) Noise                   |
+// +--------------------------------------------------------------+
+PEXP r32 PerlinNoise2D(u32 seed, r32 x, r32 y)
+{
+	r32 xFloor = FloorR32(x);
+	r32 yFloor = FloorR32(y);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	r32 x0 = x - xFloor;
+	r32 y0 = y - yFloor;
+	r32 x1 = x0 - 1.0f;
+	r32 y1 = y0 - 1.0f;
+	r32 xFade = NoiseFadeR32(x0);
+	r32 yFade = NoiseFadeR32(y0);
+	r32 value00 = NoiseGrad2D(NoiseHash2D(seed, xPrimed, yPrimed), x0, y0);
+	r32 value10 = NoiseGrad2D(NoiseHash2D(seed, xPrimed + NOISE_PRIME_X, yPrimed), x1, y0);
+	r32 value01 = NoiseGrad2D(NoiseHash2D(seed, xPrimed, yPrimed + NOISE_PRIME_Y), x0, y1);
+	r32 value11 = NoiseGrad2D(NoiseHash2D(seed, xPrimed + NOISE_PRIME_X, yPrimed + NOISE_PRIME_Y), x1, y1);
+	r32 value0 = value00 + (value10 - value00) * xFade;
+	r32 value1 = value01 + (value11 - value01) * xFade;
+	return (value0 + (value1 - value0) * yFade) * NOISE_PERLIN2D_SCALE;
+}
+PEXP r32 PerlinNoise3D(u32 seed, r32 x, r32 y, r32 z)
+{
+	r32 xFloor = FloorR32(x);
+	r32 yFloor = FloorR32(y);
+	r32 zFloor = FloorR32(z);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	u32 zPrimed = (u32)(i32)zFloor * NOISE_PRIME_Z;
+	r32 x0 = x - xFloor;
+	r32 y0 = y - yFloor;
+	r32 z0 = z - zFloor;
+	r32 xFade = NoiseFadeR32(x0);
+	r32 yFade = NoiseFadeR32(y0);
+	r32 zFade = NoiseFadeR32(z0);
+	r32 layers[2];
+	for (u8 zOffset = 0; zOffset < 2; zOffset++)
+	{
+		u32 zCorner = zPrimed + (zOffset ? NOISE_PRIME_Z : 0);
+		r32 zDelta = z0 - (r32)zOffset;
+		r32 value00 = NoiseGrad3D(NoiseHash3D(seed, xPrimed, yPrimed, zCorner), x0, y0, zDelta);
+		r32 value10 = NoiseGrad3D(NoiseHash3D(seed, xPrimed + NOISE_PRIME_X, yPrimed, zCorner), x0 - 1.0f, y0, zDelta);
+		r32 value01 = NoiseGrad3D(NoiseHash3D(seed, xPrimed, yPrimed + NOISE_PRIME_Y, zCorner), x0, y0 - 1.0f, zDelta);
+		r32 value11 = NoiseGrad3D(NoiseHash3D(seed, xPrimed + NOISE_PRIME_X, yPrimed + NOISE_PRIME_Y, zCorner), x0 - 1.0f, y0 - 1.0f, zDelta);
+		r32 value0 = value00 + (value10 - value00) * xFade;
+		r32 value1 = value01 + (value11 - value01) * xFade;
+		layers[zOffset] = value0 + (value1 - value0) * yFade;
+	}
+	return (layers[0] + (layers[1] - layers[0]) * zFade) * NOISE_PERLIN3D_SCALE;
+}
+PEXP r32 PerlinNoise4D(u32 seed, r32 x, r32 y, r32 z, r32 w)
+{
+	r32 xFloor = FloorR32(x);
+	r32 yFloor = FloorR32(y);
+	r32 zFloor = FloorR32(z);
+	r32 wFloor = FloorR32(w);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	u32 zPrimed = (u32)(i32)zFloor * NOISE_PRIME_Z;
+	u32 wPrimed = (u32)(i32)wFloor * NOISE_PRIME_W;
+	r32 x0 = x - xFloor;
+	r32 y0 = y - yFloor;
+	r32 z0 = z - zFloor;
+	r32 w0 = w - wFloor;
+	r32 xFade = NoiseFadeR32(x0);
+	r32 yFade = NoiseFadeR32(y0);
+	r32 zFade = NoiseFadeR32(z0);
+	r32 wFade = NoiseFadeR32(w0);
+	//Corner index bits are (x, y, z, w) from lowest to highest, each pass of lerps halves the number of values
+	r32 values[16];
+	for (u8 cIndex = 0; cIndex < 16; cIndex++)
+	{
+		u32 hash = NoiseHash4D(seed,
+			xPrimed + ((cIndex & 1) ? NOISE_PRIME_X : 0),
+			yPrimed + ((cIndex & 2) ? NOISE_PRIME_Y : 0),
+			zPrimed + ((cIndex & 4) ? NOISE_PRIME_Z : 0),
+			wPrimed + ((cIndex & 8) ? NOISE_PRIME_W : 0)
+		);
+		values[cIndex] = NoiseGrad4D(hash, x0 - (r32)(cIndex & 1), y0 - (r32)((cIndex >> 1) & 1), z0 - (r32)((cIndex >> 2) & 1), w0 - (r32)((cIndex >> 3) & 1));
+	}
+	for (u8 cIndex = 0; cIndex < 8; cIndex++) { values[cIndex] = values[cIndex*2] + (values[cIndex*2 + 1] - values[cIndex*2]) * xFade; }
+	for (u8 cIndex = 0; cIndex < 4; cIndex++) { values[cIndex] = values[cIndex*2] + (values[cIndex*2 + 1] - values[cIndex*2]) * yFade; }
+	for (u8 cIndex = 0; cIndex < 2; cIndex++) { values[cIndex] = values[cIndex*2] + (values[cIndex*2 + 1] - values[cIndex*2]) * zFade; }
+	return (values[0] + (values[1] - values[0]) * wFade) * NOISE_PERLIN4D_SCALE;
+}
+
+// +--------------------------------------------------------------+
+// |                        Simplex Noise                         |
+// +--------------------------------------------------------------+
+//Based on "Simplex noise demystified" (Stefan Gustavson, 2005) with the rank ordering from his 2012 revision for 4D
+PEXP r32 SimplexNoise2D(u32 seed, r32 x, r32 y)
+{
+	r32 skew = (x + y) * NOISE_SIMPLEX_F2;
+	r32 xFloor = FloorR32(x + skew);
+	r32 yFloor = FloorR32(y + skew);
+	r32 unskew = (xFloor + yFloor) * NOISE_SIMPLEX_G2;
+	r32 x0 = x - (xFloor - unskew);
+	r32 y0 = y - (yFloor - unskew);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	//The middle corner is either (1, 0) or (0, 1) depending on which triangle of the skewed square we are in
+	bool xFirst = (x0 > y0);
+	r32 x1 = (x0 - (xFirst ? 1.0f : 0.0f)) + NOISE_SIMPLEX_G2;
+	r32 y1 = (y0 - (xFirst ? 0.0f : 1.0f)) + NOISE_SIMPLEX_G2;
+	r32 x2 = x0 + (2.0f * NOISE_SIMPLEX_G2 - 1.0f);
+	r32 y2 = y0 + (2.0f * NOISE_SIMPLEX_G2 - 1.0f);
+	u32 hash0 = NoiseHash2D(seed, xPrimed, yPrimed);
+	u32 hash1 = NoiseHash2D(seed, xPrimed + (xFirst ? NOISE_PRIME_X : 0), yPrimed + (xFirst ? 0 : NOISE_PRIME_Y));
+	u32 hash2 = NoiseHash2D(seed, xPrimed + NOISE_PRIME_X, yPrimed + NOISE_PRIME_Y);
+	r32 t0 = MaxR32(0.5f - x0*x0 - y0*y0, 0.0f);
+	r32 t1 = MaxR32(0.5f - x1*x1 - y1*y1, 0.0f);
+	r32 t2 = MaxR32(0.5f - x2*x2 - y2*y2, 0.0f);
+	t0 *= t0; t1 *= t1; t2 *= t2;
+	r32 result = (t0 * t0 * NoiseGrad2D(hash0, x0, y0)) + (t1 * t1 * NoiseGrad2D(hash1, x1, y1)) + (t2 * t2 * NoiseGrad2D(hash2, x2, y2));
+	return result * NOISE_SIMPLEX2D_SCALE;
+}
+PEXP r32 SimplexNoise3D(u32 seed, r32 x, r32 y, r32 z)
+{
+	r32 skew = (x + y + z) * NOISE_SIMPLEX_F3;
+	r32 xFloor = FloorR32(x + skew);
+	r32 yFloor = FloorR32(y + skew);
+	r32 zFloor = FloorR32(z + skew);
+	r32 unskew = (xFloor + yFloor + zFloor) * NOISE_SIMPLEX_G3;
+	r32 x0 = x - (xFloor - unskew);
+	r32 y0 = y - (yFloor - unskew);
+	r32 z0 = z - (zFloor - unskew);
+	u32 xPrimed = (u32)(i32)xFloor * NOISE_PRIME_X;
+	u32 yPrimed = (u32)(i32)yFloor * NOISE_PRIME_Y;
+	u32 zPrimed = (u32)(i32)zFloor * NOISE_PRIME_Z;
+	//Find which of the 6 tetrahedra we are in, (i1, j1, k1) and (i2, j2, k2) are the offsets to the middle 2 corners
+	u8 i1, j1, k1, i2, j2, k2;
+	if (x0 >= y0)
+	{
+		if (y0 >= z0)      { i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 1; k2 = 0; }
+		else if (x0 >= z0) { i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 0; k2 = 1; }
+		else               { i1 = 0; j1 = 0; k1 = 1; i2 = 1; j2 = 0; k2 = 1; }
+	}
+	else
+	{
+		if (y0 < z0)       { i1 = 0; j1 = 0; k1 = 1; i2 = 0; j2 = 1; k2 = 1; }
+		else if (x0 < z0)  { i1 = 0; j1 = 1; k1 = 0; i2 = 0; j2 = 1; k2 = 1; }
+		else               { i1 = 0; j1 = 1; k1 = 0; i2 = 1; j2 = 1; k2 = 0; }
+	}
+	r32 corners[4][3] = {
+		{ x0, y0, z0 },
+		{ x0 - (r32)i1 + NOISE_SIMPLEX_G3, y0 - (r32)j1 + NOISE_SIMPLEX_G3, z0 - (r32)k1 + NOISE_SIMPLEX_G3 },
+		{ x0 - (r32)i2 + 2.0f*NOISE_SIMPLEX_G3, y0 - (r32)j2 + 2.0f*NOISE_SIMPLEX_G3, z0 - (r32)k2 + 2.0f*NOISE_SIMPLEX_G3 },
+		{ x0 - 1.0f + 3.0f*NOISE_SIMPLEX_G3, y0 - 1.0f + 3.0f*NOISE_SIMPLEX_G3, z0 - 1.0f + 3.0f*NOISE_SIMPLEX_G3 },
+	};
+	u32 hashes[4] = {
+		NoiseHash3D(seed, xPrimed, yPrimed, zPrimed),
+		NoiseHash3D(seed, xPrimed + (i1 ? NOISE_PRIME_X : 0), yPrimed + (j1 ? NOISE_PRIME_Y : 0), zPrimed + (k1 ? NOISE_PRIME_Z : 0)),
+		NoiseHash3D(seed, xPrimed + (i2 ? NOISE_PRIME_X : 0), yPrimed + (j2 ? NOISE_PRIME_Y : 0), zPrimed + (k2 ? NOISE_PRIME_Z : 0)),
+		NoiseHash3D(seed, xPrimed + NOISE_PRIME_X, yPrimed + NOISE_PRIME_Y, zPrimed + NOISE_PRIME_Z),
+	};
+	r32 result = 0.0f;
+	for (u8 cIndex = 0; cIndex < 4; cIndex++)
+	{
+		r32 t = 0.6f - corners[cIndex][0]*corners[cIndex][0] - corners[cIndex][1]*corners[cIndex][1] - corners[cIndex][2]*corners[cIndex][2];
+		if (t <= 0.0f) { continue; }
+		t *= t;
+		result += t * t * NoiseGrad3D(hashes[cIndex], corners[cIndex][0], corners[cIndex][1], corners[cIndex][2]);
+	}
+	return result * NOISE_SIMPLEX3D_SCALE;
+}
+PEXP r32 SimplexNoise4D(u32 seed, r32 x, r32 y, r32 z, r32 w)
+{
+	r32 skew = (x + y + z + w) * NOISE_SIMPLEX_F4;
+	r32 xFloor = FloorR32(x + skew);
+	r32 yFloor = FloorR32(y + skew);
+	r32 zFloor = FloorR32(z + skew);
+	r32 wFloor = FloorR32(w + skew);
+	r32 unskew = (xFloor + yFloor + zFloor + wFloor) * NOISE_SIMPLEX_G4;
+	r32 offsets[4] = { x - (xFloor - unskew), y - (yFloor - unskew), z - (zFloor - unskew), w - (wFloor - unskew) };
+	u32 primed[4] = {
+		(u32)(i32)xFloor * NOISE_PRIME_X,
+		(u32)(i32)yFloor * NOISE_PRIME_Y,
+		(u32)(i32)zFloor * NOISE_PRIME_Z,
+		(u32)(i32)wFloor * NOISE_PRIME_W,
+	};
+	const u32 primes[4] = { NOISE_PRIME_X, NOISE_PRIME_Y, NOISE_PRIME_Z, NOISE_PRIME_W };
+	//Rank each axis by magnitude, corner N steps along every axis with rank >= 4-N
+	u8 ranks[4] = ZEROED;
+	for (u8 aIndex = 0; aIndex < 4; aIndex++)
+	{
+		for (u8 bIndex = aIndex+1; bIndex < 4; bIndex++)
+		{
+			if (offsets[aIndex] > offsets[bIndex]) { ranks[aIndex]++; } else { ranks[bIndex]++; }
+		}
+	}
+	r32 result = 0.0f;
+	for (u8 cIndex = 0; cIndex < 5; cIndex++)
+	{
+		r32 corner[4];
+		u32 cornerPrimed[4];
+		r32 t = 0.6f;
+		for (u8 aIndex = 0; aIndex < 4; aIndex++)
+		{
+			bool step = (cIndex > 0 && ranks[aIndex] >= 4 - cIndex);
+			corner[aIndex] = offsets[aIndex] - (step ? 1.0f : 0.0f) + (r32)cIndex * NOISE_SIMPLEX_G4;
+			cornerPrimed[aIndex] = primed[aIndex] + (step ? primes[aIndex] : 0);
+			t -= corner[aIndex] * corner[aIndex];
+		}
+		if (t <= 0.0f) { continue; }
+		t *= t;
+		u32 hash = NoiseHash4D(seed, cornerPrimed[0], cornerPrimed[1], cornerPrimed[2], cornerPrimed[3]);
+		result += t * t * NoiseGrad4D(hash, corner[0], corner[1], corner[2], corner[3]);
+	}
+	return result * NOISE_SIMPLEX4D_SCALE;
+}
+
+// +--------------------------------------------------------------+
+// |                       4-Wide Versions                        |
+// +--------------------------------------------------------------+
+//These produce the same results as the scalar 2D functions above (the operations happen in the same order)
+#if TARGET_HAS_SIMD128
+PEXPI SimdU32x4 NoiseHash2Dx4(SimdU32x4 seed, SimdU32x4 xPrimed, SimdU32x4 yPrimed)
+{
+	SimdU32x4 hash = SimdMulU32x4(SimdXorU32x4(seed, SimdXorU32x4(xPrimed, yPrimed)), SimdSplatU32x4(NOISE_HASH_MULTIPLIER));
+	return SimdXorU32x4(hash, SimdShiftRightU32x4(hash, 15));
+}
+PEXPI SimdR32x4 NoiseFadeR32x4(SimdR32x4 t)
+{
+	SimdR32x4 inner = SimdAddR32x4(SimdMulR32x4(t, SimdSubR32x4(SimdMulR32x4(t, SimdSplatR32x4(6.0f)), SimdSplatR32x4(15.0f))), SimdSplatR32x4(10.0f));
+	return SimdMulR32x4(SimdMulR32x4(SimdMulR32x4(t, t), t), inner);
+}
+//Flipping the sign bit with the low hash bits is the same as the ?: negations in NoiseGrad2D
+PEXPI SimdR32x4 NoiseGrad2Dx4(SimdU32x4 hash, SimdR32x4 x, SimdR32x4 y)
+{
+	SimdR32x4 xSigned = SimdCastU32ToR32x4(SimdXorU32x4(SimdCastR32ToU32x4(x), SimdShiftLeftU32x4(hash, 31)));
+	SimdR32x4 ySigned = SimdCastU32ToR32x4(SimdXorU32x4(SimdCastR32ToU32x4(y), SimdShiftLeftU32x4(SimdShiftRightU32x4(hash, 1), 31)));
+	return SimdAddR32x4(xSigned, ySigned);
+}
+PEXPI SimdR32x4 NoiseLerpR32x4(SimdR32x4 start, SimdR32x4 end, SimdR32x4 amount)
+{
+	return SimdAddR32x4(start, SimdMulR32x4(SimdSubR32x4(end, start), amount));
+}
+
+PEXP SimdR32x4 ValueNoise2Dx4(u32 seed, SimdR32x4 x, SimdR32x4 y)
+{
+	SimdU32x4 seeds = SimdSplatU32x4(seed);
+	SimdU32x4 primeX = SimdSplatU32x4(NOISE_PRIME_X);
+	SimdU32x4 primeY = SimdSplatU32x4(NOISE_PRIME_Y);
+	SimdR32x4 hashScale = SimdSplatR32x4(1.0f / 2147483648.0f);
+	SimdR32x4 xFloor = SimdFloorR32x4(x);
+	SimdR32x4 yFloor = SimdFloorR32x4(y);
+	SimdU32x4 xPrimed = SimdMulU32x4(SimdConvertR32ToI32x4(xFloor), primeX);
+	SimdU32x4 yPrimed = SimdMulU32x4(SimdConvertR32ToI32x4(yFloor), primeY);
+	SimdR32x4 xFade = NoiseFadeR32x4(SimdSubR32x4(x, xFloor));
+	SimdR32x4 yFade = NoiseFadeR32x4(SimdSubR32x4(y, yFloor));
+	SimdU32x4 xPrimed1 = SimdAddU32x4(xPrimed, primeX);
+	SimdU32x4 yPrimed1 = SimdAddU32x4(yPrimed, primeY);
+	SimdR32x4 value00 = SimdMulR32x4(SimdConvertI32ToR32x4(NoiseHash2Dx4(seeds, xPrimed, yPrimed)), hashScale);
+	SimdR32x4 value10 = SimdMulR32x4(SimdConvertI32ToR32x4(NoiseHash2Dx4(seeds, xPrimed1, yPrimed)), hashScale);
+	SimdR32x4 value01 = SimdMulR32x4(SimdConvertI32ToR32x4(NoiseHash2Dx4(seeds, xPrimed, yPrimed1)), hashScale);
+	SimdR32x4 value11 = SimdMulR32x4(SimdConvertI32ToR32x4(NoiseHash2Dx4(seeds, xPrimed1, yPrimed1)), hashScale);
+	return NoiseLerpR32x4(NoiseLerpR32x4(value00, value10, xFade), NoiseLerpR32x4(value01, value11, xFade), yFade);
+}
+
+PEXP SimdR32x4 PerlinNoise2Dx4(u32 seed, SimdR32x4 x, SimdR32x4 y)
+{
+	SimdU32x4 seeds = SimdSplatU32x4(seed);
+	SimdU32x4 primeX = SimdSplatU32x4(NOISE_PRIME_X);
+	SimdU32x4 primeY = SimdSplatU32x4(NOISE_PRIME_Y);
+	SimdR32x4 one = SimdSplatR32x4(1.0f);
+	SimdR32x4 xFloor = SimdFloorR32x4(x);
+	SimdR32x4 yFloor = SimdFloorR32x4(y);
+	SimdU32x4 xPrimed = SimdMulU32x4(SimdConvertR32ToI32x4(xFloor), primeX);
+	SimdU32x4 yPrimed = SimdMulU32x4(SimdConvertR32ToI32x4(yFloor), primeY);
+	SimdU32x4 xPrimed1 = SimdAddU32x4(xPrimed, primeX);
+	SimdU32x4 yPrimed1 = SimdAddU32x4(yPrimed, primeY);
+	SimdR32x4 x0 = SimdSubR32x4(x, xFloor);
+	SimdR32x4 y0 = SimdSubR32x4(y, yFloor);
+	SimdR32x4 x1 = SimdSubR32x4(x0, one);
+	SimdR32x4 y1 = SimdSubR32x4(y0, one);
+	SimdR32x4 xFade = NoiseFadeR32x4(x0);
+	SimdR32x4 yFade = NoiseFadeR32x4(y0);
+	SimdR32x4 value00 = NoiseGrad2Dx4(NoiseHash2Dx4(seeds, xPrimed, yPrimed), x0, y0);
+	SimdR32x4 value10 = NoiseGrad2Dx4(NoiseHash2Dx4(seeds, xPrimed1, yPrimed), x1, y0);
+	SimdR32x4 value01 = NoiseGrad2Dx4(NoiseHash2Dx4(seeds, xPrimed, yPrimed1), x0, y1);
+	SimdR32x4 value11 = NoiseGrad2Dx4(NoiseHash2Dx4(seeds, xPrimed1, yPrimed1), x1, y1);
+	SimdR32x4 result = NoiseLerpR32x4(NoiseLerpR32x4(value00, value10, xFade), NoiseLerpR32x4(value01, value11, xFade), yFade);
+	return SimdMulR32x4(result, SimdSplatR32x4(NOISE_PERLIN2D_SCALE));
+}
+
+PEXP SimdR32x4 SimplexNoise2Dx4(u32 seed, SimdR32x4 x, SimdR32x4 y)
+{
+	SimdU32x4 seeds = SimdSplatU32x4(seed);
+	SimdU32x4 primeX = SimdSplatU32x4(NOISE_PRIME_X);
+	SimdU32x4 primeY = SimdSplatU32x4(NOISE_PRIME_Y);
+	SimdR32x4 zero = SimdSplatR32x4(0.0f);
+	SimdR32x4 one = SimdSplatR32x4(1.0f);
+	SimdR32x4 half = SimdSplatR32x4(0.5f);
+	SimdR32x4 g2 = SimdSplatR32x4(NOISE_SIMPLEX_G2);
+	SimdR32x4 skew = SimdMulR32x4(SimdAddR32x4(x, y), SimdSplatR32x4(NOISE_SIMPLEX_F2));
+	SimdR32x4 xFloor = SimdFloorR32x4(SimdAddR32x4(x, skew));
+	SimdR32x4 yFloor = SimdFloorR32x4(SimdAddR32x4(y, skew));
+	SimdR32x4 unskew = SimdMulR32x4(SimdAddR32x4(xFloor, yFloor), g2);
+	SimdR32x4 x0 = SimdSubR32x4(x, SimdSubR32x4(xFloor, unskew));
+	SimdR32x4 y0 = SimdSubR32x4(y, SimdSubR32x4(yFloor, unskew));
+	SimdU32x4 xPrimed = SimdMulU32x4(SimdConvertR32ToI32x4(xFloor), primeX);
+	SimdU32x4 yPrimed = SimdMulU32x4(SimdConvertR32ToI32x4(yFloor), primeY);
+	SimdU32x4 xFirst = SimdGreaterR32x4(x0, y0);
+	SimdR32x4 x1 = SimdAddR32x4(SimdSubR32x4(x0, SimdSelectR32x4(xFirst, one, zero)), g2);
+	SimdR32x4 y1 = SimdAddR32x4(SimdSubR32x4(y0, SimdSelectR32x4(xFirst, zero, one)), g2);
+	SimdR32x4 x2 = SimdAddR32x4(x0, SimdSplatR32x4(2.0f * NOISE_SIMPLEX_G2 - 1.0f));
+	SimdR32x4 y2 = SimdAddR32x4(y0, SimdSplatR32x4(2.0f * NOISE_SIMPLEX_G2 - 1.0f));
+	SimdU32x4 hash0 = NoiseHash2Dx4(seeds, xPrimed, yPrimed);
+	SimdU32x4 hash1 = NoiseHash2Dx4(seeds, SimdAddU32x4(xPrimed, SimdAndU32x4(xFirst, primeX)), SimdAddU32x4(yPrimed, SimdAndNotU32x4(xFirst, primeY)));
+	SimdU32x4 hash2 = NoiseHash2Dx4(seeds, SimdAddU32x4(xPrimed, primeX), SimdAddU32x4(yPrimed, primeY));
+	SimdR32x4 t0 = SimdMaxR32x4(SimdSubR32x4(SimdSubR32x4(half, SimdMulR32x4(x0, x0)), SimdMulR32x4(y0, y0)), zero);
+	SimdR32x4 t1 = SimdMaxR32x4(SimdSubR32x4(SimdSubR32x4(half, SimdMulR32x4(x1, x1)), SimdMulR32x4(y1, y1)), zero);
+	SimdR32x4 t2 = SimdMaxR32x4(SimdSubR32x4(SimdSubR32x4(half, SimdMulR32x4(x2, x2)), SimdMulR32x4(y2, y2)), zero);
+	t0 = SimdMulR32x4(t0, t0);
+	t1 = SimdMulR32x4(t1, t1);
+	t2 = SimdMulR32x4(t2, t2);
+	SimdR32x4 n0 = SimdMulR32x4(SimdMulR32x4(t0, t0), NoiseGrad2Dx4(hash0, x0, y0));
+	SimdR32x4 n1 = SimdMulR32x4(SimdMulR32x4(t1, t1), NoiseGrad2Dx4(hash1, x1, y1));
+	SimdR32x4 n2 = SimdMulR32x4(SimdMulR32x4(t2, t2), NoiseGrad2Dx4(hash2, x2, y2));
+	return SimdMulR32x4(SimdAddR32x4(SimdAddR32x4(n0, n1), n2), SimdSplatR32x4(NOISE_SIMPLEX2D_SCALE));
+}
+#endif //TARGET_HAS_SIMD128
+
+// +--------------------------------------------------------------+
+// |                          Generator                           |
+// +--------------------------------------------------------------+
+PEXP void InitNoiseGenerator(NoiseGenerator* generator, NoiseType type, u32 seed)
+{
+	NotNull(generator);
+	ClearPointer(generator);
+	generator->type = type;
+	generator->fractal = NoiseFractal_None;
+	generator->seed = seed;
+	generator->frequency = 1.0f;
+	generator->numOctaves = 1;
+	generator->lacunarity = 2.0f;
+	generator->gain = 0.5f;
+}
+PEXPI void InitNoiseGeneratorFromSeries(NoiseGenerator* generator, NoiseType type, RandomSeries* series)
+{
+	InitNoiseGenerator(generator, type, (u32)(GetRandU64(series) >> 32));
+}
+PEXPI void SetNoiseFractal(NoiseGenerator* generator, NoiseFractal fractal, u8 numOctaves, r32 lacunarity, r32 gain)
+{
+	NotNull(generator);
+	Assert(numOctaves > 0);
+	generator->fractal = fractal;
+	generator->numOctaves = numOctaves;
+	generator->lacunarity = lacunarity;
+	generator->gain = gain;
+}
+
+PEXPI r32 GetRawNoise2D(NoiseType type, u32 seed, r32 x, r32 y)
+{
+	switch (type)
+	{
+		case NoiseType_Value:   return ValueNoise2D(seed, x, y);
+		case NoiseType_Perlin:  return PerlinNoise2D(seed, x, y);
+		case NoiseType_Simplex: return SimplexNoise2D(seed, x, y);
+		default: return 0.0f;
+	}
+}
+PEXPI r32 GetRawNoise3D(NoiseType type, u32 seed, r32 x, r32 y, r32 z)
+{
+	switch (type)
+	{
+		case NoiseType_Value:   return ValueNoise3D(seed, x, y, z);
+		case NoiseType_Perlin:  return PerlinNoise3D(seed, x, y, z);
+		case NoiseType_Simplex: return SimplexNoise3D(seed, x, y, z);
+		default: return 0.0f;
+	}
+}
+PEXPI r32 GetRawNoise4D(NoiseType type, u32 seed, r32 x, r32 y, r32 z, r32 w)
+{
+	switch (type)
+	{
+		case NoiseType_Value:   return ValueNoise4D(seed, x, y, z, w);
+		case NoiseType_Perlin:  return PerlinNoise4D(seed, x, y, z, w);
+		case NoiseType_Simplex: return SimplexNoise4D(seed, x, y, z, w);
+		default: return 0.0f;
+	}
+}
+
+//The result of all the octaves is divided by the sum of the amplitudes so it stays in [-1, 1]
+#define NoiseFractalLoop(generator, sampleExpression, scalePositionStatement) do                   \
+{                                                                                                 \
+	r32 amplitude = 1.0f;                                                                         \
+	r32 amplitudeSum = 0.0f;                                                                      \
+	for (u8 octave = 0; octave < (generator)->numOctaves; octave++)                               \
+	{                                                                                             \
+		u32 octaveSeed = (generator)->seed + octave;                                              \
+		r32 value = (sampleExpression);                                                           \
+		if ((generator)->fractal == NoiseFractal_Ridged) { value = 1.0f - 2.0f * AbsR32(value); } \
+		result += value * amplitude;                                                              \
+		amplitudeSum += amplitude;                                                                \
+		amplitude *= (generator)->gain;                                                           \
+		scalePositionStatement;                                                                   \
+	}                                                                                             \
+	result *= (1.0f / amplitudeSum);                                                              \
+} while(0)
+
+PEXP r32 GetNoise2D(const NoiseGenerator* generator, v2 position)
+{
+	NotNull(generator);
+	r32 x = position.X * generator->frequency;
+	r32 y = position.Y * generator->frequency;
+	if (generator->fractal == NoiseFractal_None) { return GetRawNoise2D(generator->type, generator->seed, x, y); }
+	r32 result = 0.0f;
+	NoiseFractalLoop(generator, GetRawNoise2D(generator->type, octaveSeed, x, y), x *= generator->lacunarity; y *= generator->lacunarity);
+	return result;
+}
+PEXP r32 GetNoise3D(const NoiseGenerator* generator, v3 position)
+{
+	NotNull(generator);
+	r32 x = position.X * generator->frequency;
+	r32 y = position.Y * generator->frequency;
+	r32 z = position.Z * generator->frequency;
+	if (generator->fractal == NoiseFractal_None) { return GetRawNoise3D(generator->type, generator->seed, x, y, z); }
+	r32 result = 0.0f;
+	NoiseFractalLoop(generator, GetRawNoise3D(generator->type, octaveSeed, x, y, z), x *= generator->lacunarity; y *= generator->lacunarity; z *= generator->lacunarity);
+	return result;
+}
+PEXP r32 GetNoise4D(const NoiseGenerator* generator, v4 position)
+{
+	NotNull(generator);
+	r32 x = position.X * generator->frequency;
+	r32 y = position.Y * generator->frequency;
+	r32 z = position.Z * generator->frequency;
+	r32 w = position.W * generator->frequency;
+	if (generator->fractal == NoiseFractal_None) { return GetRawNoise4D(generator->type, generator->seed, x, y, z, w); }
+	r32 result = 0.0f;
+	NoiseFractalLoop(generator, GetRawNoise4D(generator->type, octaveSeed, x, y, z, w), x *= generator->lacunarity; y *= generator->lacunarity; z *= generator->lacunarity; w *= generator->lacunarity);
+	return result;
+}
+
+#if TARGET_HAS_SIMD128
+PEXPI SimdR32x4 GetRawNoise2Dx4(NoiseType type, u32 seed, SimdR32x4 x, SimdR32x4 y)
+{
+	switch (type)
+	{
+		case NoiseType_Value:   return ValueNoise2Dx4(seed, x, y);
+		case NoiseType_Perlin:  return PerlinNoise2Dx4(seed, x, y);
+		case NoiseType_Simplex: return SimplexNoise2Dx4(seed, x, y);
+		default: return SimdSplatR32x4(0.0f);
+	}
+}
+//Same as GetNoise2D for 4 positions at once
+PEXP SimdR32x4 GetNoise2Dx4(const NoiseGenerator* generator, SimdR32x4 x, SimdR32x4 y)
+{
+	NotNull(generator);
+	SimdR32x4 frequency = SimdSplatR32x4(generator->frequency);
+	x = SimdMulR32x4(x, frequency);
+	y = SimdMulR32x4(y, frequency);
+	if (generator->fractal == NoiseFractal_None) { return GetRawNoise2Dx4(generator->type, generator->seed, x, y); }
+	SimdR32x4 lacunarity = SimdSplatR32x4(generator->lacunarity);
+	SimdU32x4 absMask = SimdSplatU32x4(0x7FFFFFFFU);
+	SimdR32x4 result = SimdSplatR32x4(0.0f);
+	r32 amplitude = 1.0f;
+	r32 amplitudeSum = 0.0f;
+	for (u8 octave = 0; octave < generator->numOctaves; octave++)
+	{
+		SimdR32x4 value = GetRawNoise2Dx4(generator->type, generator->seed + octave, x, y);
+		if (generator->fractal == NoiseFractal_Ridged)
+		{
+			SimdR32x4 absValue = SimdCastU32ToR32x4(SimdAndU32x4(SimdCastR32ToU32x4(value), absMask));
+			value = SimdSubR32x4(SimdSplatR32x4(1.0f), SimdMulR32x4(SimdSplatR32x4(2.0f), absValue));
+		}
+		result = SimdAddR32x4(result, SimdMulR32x4(value, SimdSplatR32x4(amplitude)));
+		amplitudeSum += amplitude;
+		amplitude *= generator->gain;
+		x = SimdMulR32x4(x, lacunarity);
+		y = SimdMulR32x4(y, lacunarity);
+	}
+	return SimdMulR32x4(result, SimdSplatR32x4(1.0f / amplitudeSum));
+}
+#endif //TARGET_HAS_SIMD128
+
+// +--------------------------------------------------------------+
+// |                         Domain Warp                          |
+// +--------------------------------------------------------------+
+//Offsets position by the noise itself (sampled at a few arbitrary offsets so each axis is uncorrelated)
+//Feed the result back into GetNoise2D for the swirly look from https://iquilezles.org/articles/warp/
+PEXPI v2 DomainWarp2D(const NoiseGenerator* generator, v2 position, r32 amplitude)
+{
+	r32 offsetX = GetNoise2D(generator, position);
+	r32 offsetY = GetNoise2D(generator, NewV2(position.X + 5.2f, position.Y + 1.3f));
+	return NewV2(position.X + offsetX * amplitude, position.Y + offsetY * amplitude);
+}
+PEXPI v3 DomainWarp3D(const NoiseGenerator* generator, v3 position, r32 amplitude)
+{
+	r32 offsetX = GetNoise3D(generator, position);
+	r32 offsetY = GetNoise3D(generator, NewV3(position.X + 5.2f, position.Y + 1.3f, position.Z + 2.8f));
+	r32 offsetZ = GetNoise3D(generator, NewV3(position.X + 9.7f, position.Y + 4.1f, position.Z + 7.4f));
+	return NewV3(position.X + offsetX * amplitude, position.Y + offsetY * amplitude, position.Z + offsetZ * amplitude);
+}
+
+// +--------------------------------------------------------------+
+// |                           Batches                            |
+// +--------------------------------------------------------------+
+//valuesOut[yIndex*width + xIndex] = GetNoise2D(generator, origin + (xIndex*step.X, yIndex*step.Y))
+PEXP void FillNoiseGrid2D(const NoiseGenerator* generator, v2 origin, v2 step, uxx width, uxx height, r32* valuesOut)
+{
+	NotNull(generator);
+	Assert(width*height == 0 || valuesOut != nullptr);
+	for (uxx yIndex = 0; yIndex < height; yIndex++)
+	{
+		r32 y = origin.Y + step.Y * (r32)yIndex;
+		r32* rowOut = &valuesOut[yIndex * width];
+		uxx xIndex = 0;
+		#if TARGET_HAS_SIMD128
+		{
+			SimdR32x4 yValues = SimdSplatR32x4(y);
+			SimdR32x4 laneOffsets = SimdSetR32x4(0.0f, 1.0f, 2.0f, 3.0f);
+			SimdR32x4 originX = SimdSplatR32x4(origin.X);
+			SimdR32x4 stepX = SimdSplatR32x4(step.X);
+			for (; xIndex + 4 <= width; xIndex += 4)
+			{
+				SimdR32x4 xValues = SimdAddR32x4(originX, SimdMulR32x4(stepX, SimdAddR32x4(SimdSplatR32x4((r32)xIndex), laneOffsets)));
+				SimdStoreR32x4(&rowOut[xIndex], GetNoise2Dx4(generator, xValues, yValues));
+			}
+		}
+		#endif
+		for (; xIndex < width; xIndex++) { rowOut[xIndex] = GetNoise2D(generator, NewV2(origin.X + step.X * (r32)xIndex, y)); }
+	}
+}
+
+PEXP void SampleNoise2D(const NoiseGenerator* generator, const v2* positions, uxx numPositions, r32* valuesOut)
+{
+	NotNull(generator);
+	Assert(numPositions == 0 || (positions != nullptr && valuesOut != nullptr));
+	uxx pIndex = 0;
+	#if TARGET_HAS_SIMD128
+	for (; pIndex + 4 <= numPositions; pIndex += 4)
+	{
+		const v2* batch = &positions[pIndex];
+		SimdR32x4 xValues = SimdSetR32x4(batch[0].X, batch[1].X, batch[2].X, batch[3].X);
+		SimdR32x4 yValues = SimdSetR32x4(batch[0].Y, batch[1].Y, batch[2].Y, batch[3].Y);
+		SimdStoreR32x4(&valuesOut[pIndex], GetNoise2Dx4(generator, xValues, yValues));
+	}
+	#endif
+	for (; pIndex < numPositions; pIndex++) { valuesOut[pIndex] = GetNoise2D(generator, positions[pIndex]); }
+}
+
+PEXP void SampleNoise3D(const NoiseGenerator* generator, const v3* positions, uxx numPositions, r32* valuesOut)
+{
+	NotNull(generator);
+	Assert(numPositions == 0 || (positions != nullptr && valuesOut != nullptr));
+	for (uxx pIndex = 0; pIndex < numPositions; pIndex++) { valuesOut[pIndex] = GetNoise3D(generator, positions[pIndex]); }
+}
+
 //TODO: Enable me and fix me up once we have the rec type!
 #if 0
 PEXP v2 GetBlueNoisePosInRec(u64 seed, rec bounds, u64 numOfPositions, u64 index)
@@ -0,0 +1,238 @@
+/*
+File:   misc_poisson_disk.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Holds functions that generate Poisson-disk (blue noise) point sets, where no two points are closer
+	** than some minimum distance but the points otherwise fill the space randomly. Useful for placing
+	** trees, rocks, enemies, etc. in a way that looks natural without things overlapping.
+	** Based on "Fast Poisson Disk Sampling in Arbitrary Dimensions" (Robert Bridson, 2007) which runs in O(n)
+	** by keeping a background grid where each cell can hold at most one point, so each candidate only
+	** has to be checked against the points in a few neighboring cells.
+	** Supports an optional mask function (to only place points in certain areas) and an optional
+	** radius function (to vary the density of points across the area).
+*/
+
+/*
+* Usage Example:
+	VarArray treePositions;
+	GeneratePoissonDiskPoints(arena, &random, NewV2(0, 0), NewV2(mapWidth, mapHeight), 4.0f, &treePositions);
+	VarArrayLoop(&treePositions, pIndex) { VarArrayLoopGetValue(v2, position, &treePositions, pIndex); SpawnTree(position); }
+	FreeVarArray(&treePositions);
+*/
+
+#ifndef _MISC_POISSON_DISK_H
+#define _MISC_POISSON_DISK_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_math.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+#include "mem/mem_scratch.h"
+#include "struct/struct_vectors.h"
+#include "struct/struct_var_array.h"
+#include "misc/misc_random.h"
+
+#define POISSON_DISK_DEFAULT_NUM_ATTEMPTS      30 //Bridson's k
+#define POISSON_DISK_DEFAULT_NUM_SEED_ATTEMPTS 64
+#define POISSON_DISK_MAX_ANNULUS_TRIES         16
+#define POISSON_DISK_SENTINEL_POS              1e30f //squared distance to this overflows to +inf, which is never "too close"
+
+#define POISSON_DISK_MASK_FUNC_DEF(functionName) bool functionName(void* contextPntr, v2 position)
+typedef POISSON_DISK_MASK_FUNC_DEF(PoissonDiskMaskFunc_f);
+#define POISSON_DISK_RADIUS_FUNC_DEF(functionName) r32 functionName(void* contextPntr, v2 position)
+typedef POISSON_DISK_RADIUS_FUNC_DEF(PoissonDiskRadiusFunc_f);
+
+typedef struct PoissonDiskOptions PoissonDiskOptions;
+struct PoissonDiskOptions
+{
+	v2 topLeft;
+	v2 size;
+	r32 minRadius; //minimum distance between any two points (the only radius used when radiusFunc is nullptr)
+	r32 maxRadius; //radiusFunc results are clamped to [minRadius, maxRadius], larger values make the grid checks more expensive
+	u32 numAttempts; //candidates tried around each active point before it is retired
+	u32 numSeedAttempts; //random positions tried whenever the active list runs dry, this lets disjoint areas of a mask get filled
+	uxx maxNumPoints; //0 for no limit
+	PoissonDiskMaskFunc_f* maskFunc; //return false for positions that shouldn't get a point, nullptr allows the whole rectangle
+	PoissonDiskRadiusFunc_f* radiusFunc; //returns the minimum distance from a point at this position to any other point
+	void* contextPntr; //passed to maskFunc and radiusFunc
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE PoissonDiskOptions NewPoissonDiskOptions(v2 topLeft, v2 size, r32 radius);
+	uxx GeneratePoissonDiskPointsEx(Arena* arena, RandomSeries* series, const PoissonDiskOptions* options, VarArray* pointsOut);
+	PIG_CORE_INLINE uxx GeneratePoissonDiskPoints(Arena* arena, RandomSeries* series, v2 topLeft, v2 size, r32 radius, VarArray* pointsOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+PEXPI PoissonDiskOptions NewPoissonDiskOptions(v2 topLeft, v2 size, r32 radius)
+{
+	PoissonDiskOptions result = ZEROED;
+	result.topLeft = topLeft;
+	result.size = size;
+	result.minRadius = radius;
+	result.maxRadius = radius;
+	result.numAttempts = POISSON_DISK_DEFAULT_NUM_ATTEMPTS;
+	result.numSeedAttempts = POISSON_DISK_DEFAULT_NUM_SEED_ATTEMPTS;
+	return result;
+}
+
+//Initializes pointsOut as a VarArray of v2 in arena and fills it with the points, returns the number of points
+//With a radiusFunc two points are only allowed if they are at least max(radiusA, radiusB) apart
+//NOTE: The background grid and active list live in a scratch arena and are released before returning
+PEXP uxx GeneratePoissonDiskPointsEx(Arena* arena, RandomSeries* series, const PoissonDiskOptions* options, VarArray* pointsOut)
+{
+	NotNull(arena);
+	NotNull(series);
+	NotNull(options);
+	NotNull(pointsOut);
+	Assert(options->minRadius > 0.0f);
+	Assert(options->radiusFunc == nullptr || options->maxRadius >= options->minRadius);
+	InitVarArray(v2, pointsOut, arena);
+	if (options->size.X <= 0.0f || options->size.Y <= 0.0f) { return 0; }
+	
+	r32 minRadius = options->minRadius;
+	r32 maxRadius = (options->radiusFunc != nullptr) ? options->maxRadius : minRadius;
+	//With a cell diagonal of minRadius no cell can ever hold more than one point
+	r32 cellSize = minRadius / Sqrt2_32;
+	uxx gridWidth = (uxx)CeilR32i(options->size.X / cellSize);
+	uxx gridHeight = (uxx)CeilR32i(options->size.Y / cellSize);
+	if (gridWidth == 0) { gridWidth = 1; }
+	if (gridHeight == 0) { gridHeight = 1; }
+	uxx maxNumPoints = (options->maxNumPoints > 0 && options->maxNumPoints < gridWidth * gridHeight) ? options->maxNumPoints : gridWidth * gridHeight;
+	i32 searchDistance = CeilR32i(maxRadius / cellSize);
+	//The grid has an empty border of searchDistance cells on every side so the neighbor search never needs bounds checks
+	uxx gridStride = gridWidth + 2*(uxx)searchDistance;
+	uxx numCells = gridStride * (gridHeight + 2*(uxx)searchDistance);
+	
+	ScratchBegin1(scratch, arena);
+	u32* cells = AllocArray(u32, scratch, numCells); //point index + 1, 0 means empty
+	u32* activeList = AllocArray(u32, scratch, maxNumPoints);
+	//These mirror pointsOut but are indexed by cell value, slot 0 is a sentinel that is far away from everything so the
+	//neighbor search can check empty cells without a branch (a branch that is mispredicted ~50% of the time in dense areas)
+	v2* positions = AllocArray(v2, scratch, maxNumPoints+1);
+	r32* pointRadii = AllocArray(r32, scratch, maxNumPoints+1);
+	NotNull(cells);
+	NotNull(activeList);
+	NotNull(positions);
+	NotNull(pointRadii);
+	MyMemSet(cells, 0x00, sizeof(u32) * numCells);
+	positions[0] = FillV2(POISSON_DISK_SENTINEL_POS);
+	pointRadii[0] = 0.0f;
+	uxx numActive = 0;
+	
+	//Evaluates to the radius to use at a position (or a negative number if the position is outside the bounds or mask)
+	#define PoissonDiskGetCandidateRadius(position) (                                                              \
+		((position).X < options->topLeft.X || (position).Y < options->topLeft.Y ||                                 \
+		(position).X >= options->topLeft.X + options->size.X || (position).Y >= options->topLeft.Y + options->size.Y || \
+		(options->maskFunc != nullptr && !options->maskFunc(options->contextPntr, (position)))) ? -1.0f :          \
+		((options->radiusFunc != nullptr) ? ClampR32(options->radiusFunc(options->contextPntr, (position)), minRadius, maxRadius) : minRadius) \
+	)
+	
+	while (pointsOut->length < maxNumPoints)
+	{
+		//When the active list runs dry we try some random positions in the whole area, otherwise we try positions around a random active point
+		bool isSeeding = (numActive == 0);
+		u32 numAttempts = isSeeding ? options->numSeedAttempts : options->numAttempts;
+		uxx parentActiveIndex = 0;
+		v2 parent = V2_Zero;
+		r32 parentRadius = 0.0f;
+		if (!isSeeding)
+		{
+			parentActiveIndex = (uxx)GetRandU64Range(series, 0, (u64)numActive);
+			parent = positions[activeList[parentActiveIndex]+1];
+			parentRadius = pointRadii[activeList[parentActiveIndex]+1];
+		}
+		
+		v2 candidate = V2_Zero;
+		r32 candidateRadius = 0.0f;
+		uxx candidateCellIndex = 0;
+		bool foundCandidate = false;
+		for (u32 aIndex = 0; aIndex < numAttempts && !foundCandidate; aIndex++)
+		{
+			if (isSeeding)
+			{
+				candidate = NewV2(options->topLeft.X + GetRandR32(series) * options->size.X, options->topLeft.Y + GetRandR32(series) * options->size.Y);
+			}
+			else
+			{
+				//Uniform by area in the annulus [radius, 2*radius] around the parent. Rejection sampling from the bounding
+				//square accepts ~59% of the time and is quite a bit cheaper than sqrt + sin + cos. Each try splits a single
+				//u64 into two 24-bit coordinates. The tries are capped so counter style series (like Fixed) can't loop forever
+				r32 offsetX = 1.5f, offsetY = 0.0f;
+				for (u32 tIndex = 0; tIndex < POISSON_DISK_MAX_ANNULUS_TRIES; tIndex++)
+				{
+					u64 randomBits = GetRandU64(series);
+					r32 tryX = (r32)(randomBits >> 40) * (4.0f / 16777216.0f) - 2.0f;
+					r32 tryY = (r32)((randomBits >> 16) & 0xFFFFFF) * (4.0f / 16777216.0f) - 2.0f;
+					r32 lengthSquared = tryX*tryX + tryY*tryY;
+					if (lengthSquared >= 1.0f && lengthSquared <= 4.0f) { offsetX = tryX; offsetY = tryY; break; }
+				}
+				candidate = NewV2(parent.X + offsetX * parentRadius, parent.Y + offsetY * parentRadius);
+			}
+			candidateRadius = PoissonDiskGetCandidateRadius(candidate);
+			if (candidateRadius < 0.0f) { continue; }
+			
+			uxx cellX = (uxx)MinI32((i32)((candidate.X - options->topLeft.X) / cellSize), (i32)gridWidth-1) + (uxx)searchDistance;
+			uxx cellY = (uxx)MinI32((i32)((candidate.Y - options->topLeft.Y) / cellSize), (i32)gridHeight-1) + (uxx)searchDistance;
+			candidateCellIndex = cellY * gridStride + cellX;
+			if (cells[candidateCellIndex] != 0) { continue; }
+			bool isTooClose = false;
+			for (i32 yOffset = -searchDistance; yOffset <= searchDistance && !isTooClose; yOffset++)
+			{
+				const u32* cellRow = &cells[(uxx)((i32)cellY + yOffset) * gridStride + cellX];
+				for (i32 xOffset = -searchDistance; xOffset <= searchDistance; xOffset++)
+				{
+					u32 neighborValue = cellRow[xOffset];
+					r32 requiredDistance = MaxR32(candidateRadius, pointRadii[neighborValue]);
+					r32 deltaX = positions[neighborValue].X - candidate.X;
+					r32 deltaY = positions[neighborValue].Y - candidate.Y;
+					isTooClose |= (deltaX*deltaX + deltaY*deltaY < requiredDistance*requiredDistance);
+				}
+			}
+			if (!isTooClose) { foundCandidate = true; }
+		}
+		
+		if (!foundCandidate)
+		{
+			if (isSeeding) { break; } //nothing left to fill (as far as we can tell)
+			//Retire the parent (swap remove, order of the active list doesn't matter)
+			activeList[parentActiveIndex] = activeList[numActive-1];
+			numActive--;
+			continue;
+		}
+		
+		u32 newIndex = (u32)pointsOut->length;
+		VarArrayAddValue(v2, pointsOut, candidate);
+		positions[newIndex+1] = candidate;
+		pointRadii[newIndex+1] = candidateRadius;
+		cells[candidateCellIndex] = newIndex+1;
+		activeList[numActive] = newIndex;
+		numActive++;
+	}
+	
+	#undef PoissonDiskGetCandidateRadius
+	ScratchEnd(scratch);
+	return pointsOut->length;
+}
+
+PEXPI uxx GeneratePoissonDiskPoints(Arena* arena, RandomSeries* series, v2 topLeft, v2 size, r32 radius, VarArray* pointsOut)
+{
+	PoissonDiskOptions options = NewPoissonDiskOptions(topLeft, size, radius);
+	return GeneratePoissonDiskPointsEx(arena, series, &options, pointsOut);
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_POISSON_DISK_H
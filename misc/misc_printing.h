@@ -25,6 +25,7 @@ Description:
 // |                 Header Function Declarations                 |
 // +--------------------------------------------------------------+
 #if !PIG_CORE_IMPLEMENTATION
+	Str8 PrintInArenaVaList(Arena* arena, const char* formatString, va_list args);
 	char* PrintInArena(Arena* arena, const char* formatString, ...);
 	Str8 PrintInArenaStr(Arena* arena, const char* formatString, ...);
 	int PrintVa_Measure(const char* formatString, va_list args);
@@ -61,55 +62,76 @@ while(0)
 // +--------------------------------------------------------------+
 #if PIG_CORE_IMPLEMENTATION
 
-//NOTE: This returns a null-terminated string
-PEXP char* PrintInArena(Arena* arena, const char* formatString, ...)
+//NOTE: This returns a null-terminated string (the length does not include the null-terminator)
+//When the arena can soft grow we print straight into the free space at the end of the arena and only
+//fall back to printing a second time (with an exactly sized allocation) when the result didn't fit
+PEXP Str8 PrintInArenaVaList(Arena* arena, const char* formatString, va_list args)
 {
 	NotNull(arena);
 	NotNull(formatString);
 	
-	char* result = nullptr;
-	va_list args;
+	if (CanArenaSoftGrow(arena))
+	{
+		bool canResetToMark = CanArenaResetToMark(arena);
+		uxx mark = canResetToMark ? ArenaGetMark(arena) : 0;
+		char* result = AllocArray(char, arena, 1);
+		if (result != nullptr)
+		{
+			uxx spaceAvailable = 1 + ArenaSoftGrowBegin(arena, result, 1);
+			va_list argsCopy;
+			va_copy(argsCopy, args);
+			int length = MyVaListPrintf(result, (size_t)spaceAvailable, formatString, argsCopy);
+			va_end(argsCopy);
+			Assert(length >= 0);
+			if ((uxx)length < spaceAvailable)
+			{
+				ArenaSoftGrowEnd(arena, result, 1, (uxx)length);
+				result[length] = '\0';
+				return NewStr8((uxx)length, result);
+			}
+			
+			if (canResetToMark) { ArenaResetToMark(arena, mark); }
+			else if (CanArenaFree(arena)) { FreeMem(arena, result, 1); }
+			result = AllocArray(char, arena, (uxx)length+1);
+			if (result == nullptr) { return Str8_Empty; }
+			MyVaListPrintf(result, (size_t)(length+1), formatString, args);
+			result[length] = '\0';
+			return NewStr8((uxx)length, result);
+		}
+	}
 	
-	va_start(args, formatString);
-	int length = MyVaListPrintf(result, 0, formatString, args); //Measure first
+	va_list argsCopy;
+	va_copy(argsCopy, args);
+	int length = MyVaListPrintf(nullptr, 0, formatString, argsCopy); //Measure first
+	va_end(argsCopy);
 	Assert(length >= 0);
-	va_end(args);
 	
-	result = AllocArray(char, arena, length+1); //Allocate
-	if (result == nullptr) { return result; }
+	char* result = AllocArray(char, arena, (uxx)length+1); //Allocate
+	if (result == nullptr) { return Str8_Empty; }
 	
-	va_start(args, formatString);
 	MyVaListPrintf(result, (size_t)(length+1), formatString, args); //Real printf
-	va_end(args);
-	
 	result[length] = '\0';
 	
-	return result;
+	return NewStr8((uxx)length, result);
 }
+
 //NOTE: This returns a null-terminated string
-PEXP Str8 PrintInArenaStr(Arena* arena, const char* formatString, ...)
+PEXP char* PrintInArena(Arena* arena, const char* formatString, ...)
 {
-	NotNull(arena);
-	NotNull(formatString);
-	
-	char* result = nullptr;
 	va_list args;
-	
 	va_start(args, formatString);
-	int length = MyVaListPrintf(result, 0, formatString, args); //Measure first
-	Assert(length >= 0);
+	Str8 result = PrintInArenaVaList(arena, formatString, args);
 	va_end(args);
-	
-	result = AllocArray(char, arena, length+1); //Allocate
-	if (result == nullptr) { return Str8_Empty; }
-	
+	return result.chars;
+}
+//NOTE: This returns a null-terminated string
+PEXP Str8 PrintInArenaStr(Arena* arena, const char* formatString, ...)
+{
+	va_list args;
 	va_start(args, formatString);
-	MyVaListPrintf(result, (size_t)(length+1), formatString, args); //Real printf
+	Str8 result = PrintInArenaVaList(arena, formatString, args);
 	va_end(args);
-	
-	result[length] = '\0';
-	
-	return NewStr8((uxx)length, result);
+	return result;
 }
 
 PEXP int PrintVa_Measure(const char* formatString, va_list args)
@@ -15,6 +15,8 @@ Other Page: https://peteroupc.github.io/random.html#Existing_RNG_APIs_in_Program
 #include "base/base_typedefs.h"
 #include "base/base_macros.h"
 #include "base/base_assert.h"
+#include "base/base_math.h"
+#include "std/std_basic_math.h"
 
 #ifndef DEFAULT_RANDOM_SERIES_TYPE
 #define DEFAULT_RANDOM_SERIES_TYPE RandomSeriesType_LinearCongruential64
@@ -23,6 +25,19 @@ Other Page: https://peteroupc.github.io/random.html#Existing_RNG_APIs_in_Program
 #define RAND_FLOAT_PRECISION_R32 8000000UL //8 million
 #define RAND_FLOAT_PRECISION_R64 400000000000000ULL //400 trillion
 
+//NOTE: LCG32 is only masked to 64 bits (not 32) so both LCG types are affine functions modulo 2^64
+#define RAND_LCG32_MULTIPLIER 1103515245ULL
+#define RAND_LCG32_INCREMENT  12345ULL
+#define RAND_LCG64_MULTIPLIER 2862933555777941757ULL
+#define RAND_LCG64_INCREMENT  3037000493ULL
+
+//Each stream made by GetRandomSeriesStream starts 2^48 steps after the previous one (2^64 steps for XoroShiro128)
+#define RANDOM_STREAM_STRIDE_LOG2 48
+#define RANDOM_MAX_NUM_STREAMS    (1ULL << (64 - RANDOM_STREAM_STRIDE_LOG2))
+
+//The FillRand functions that need to post-process values generate them into a stack buffer of this many values at a time
+#define RANDOM_FILL_CHUNK_SIZE 64
+
 // +--------------------------------------------------------------+
 // |                  Type/Structure Definitions                  |
 // +--------------------------------------------------------------+
@@ -94,7 +109,13 @@ struct RandomSeries
 	PIG_CORE_INLINE void SeedRandomSeriesU64(RandomSeries* series, u64 seed);
 	PIG_CORE_INLINE void SeedRandomSeriesU128(RandomSeries* series, u64 seed1, u64 seed2);
 	PIG_CORE_INLINE u64 XS128_rotl(const u64 x, int k);
+	u64 SkipLinearCongruential64(u64 state, u64 multiplier, u64 increment, u64 numberOfSteps);
+	void JumpXoroShiro128(u64* state128, bool longJump);
 	void StepRandomSeries(RandomSeries* series, u64 numberOfSteps);
+	void GetRandomSeriesStream(const RandomSeries* series, u64 streamIndex, RandomSeries* streamOut);
+	void SplitRandomSeries(const RandomSeries* series, uxx numStreams, RandomSeries* streamsOut);
+	PIG_CORE_INLINE u32 GetRandBoundedU32(RandomSeries* series, u32 range);
+	PIG_CORE_INLINE u64 GetRandBoundedU64(RandomSeries* series, u64 range);
 	PIG_CORE_INLINE u8 GetRandU8(RandomSeries* series);
 	PIG_CORE_INLINE u8 GetRandU8Range(RandomSeries* series, u8 min, u8 max);
 	PIG_CORE_INLINE u16 GetRandU16(RandomSeries* series);
@@ -114,6 +135,15 @@ struct RandomSeries
 	PIG_CORE_INLINE r32 GetRandR32Range(RandomSeries* series, r32 min, r32 max);
 	PIG_CORE_INLINE r64 GetRandR64(RandomSeries* series);
 	PIG_CORE_INLINE r64 GetRandR64Range(RandomSeries* series, r64 min, r64 max);
+	void FillRandU64(RandomSeries* series, u64* valuesOut, uxx numValues);
+	void FillRandU32(RandomSeries* series, u32* valuesOut, uxx numValues);
+	void FillRandR32(RandomSeries* series, r32* valuesOut, uxx numValues);
+	void FillRandR64(RandomSeries* series, r64* valuesOut, uxx numValues);
+	void FillRandU32Range(RandomSeries* series, u32* valuesOut, uxx numValues, u32 min, u32 max);
+	void FillRandU64Range(RandomSeries* series, u64* valuesOut, uxx numValues, u64 min, u64 max);
+	void FillRandI32Range(RandomSeries* series, i32* valuesOut, uxx numValues, i32 min, i32 max);
+	PIG_CORE_INLINE void FillRandR32Range(RandomSeries* series, r32* valuesOut, uxx numValues, r32 min, r32 max);
+	PIG_CORE_INLINE void FillRandR64Range(RandomSeries* series, r64* valuesOut, uxx numValues, r64 min, r64 max);
 #endif //!PIG_CORE_IMPLEMENTATION
 
 // +--------------------------------------------------------------+
@@ -177,6 +207,52 @@ PEXPI u64 XS128_rotl(const u64 x, int k)
 	return (x << k) | (x >> (64 - k));
 }
 
+//Advances state = state*multiplier + increment (mod 2^64) by numberOfSteps in O(log n) time
+//by repeatedly squaring the affine map (Brown, "Random Number Generation with Arbitrary Strides")
+PEXP u64 SkipLinearCongruential64(u64 state, u64 multiplier, u64 increment, u64 numberOfSteps)
+{
+	u64 totalMultiplier = 1;
+	u64 totalIncrement = 0;
+	while (numberOfSteps > 0)
+	{
+		if (numberOfSteps & 1)
+		{
+			totalMultiplier = totalMultiplier * multiplier;
+			totalIncrement = totalIncrement * multiplier + increment;
+		}
+		increment = (multiplier + 1) * increment;
+		multiplier = multiplier * multiplier;
+		numberOfSteps >>= 1;
+	}
+	return totalMultiplier * state + totalIncrement;
+}
+
+//Equivalent to 2^64 steps (or 2^96 steps for longJump) of XoroShiro128++
+//The polynomials come from https://xoroshiro.di.unimi.it/xoroshiro128plusplus.c
+PEXP void JumpXoroShiro128(u64* state128, bool longJump)
+{
+	NotNull(state128);
+	const u64 jumpPolynomial[2]     = { 0x2BD7A6A6E99C2DDCULL, 0x0992CCAF6A6FCA05ULL };
+	const u64 longJumpPolynomial[2] = { 0x360FD5F2CF8D5D99ULL, 0x9C6E6877736C46E3ULL };
+	const u64* polynomial = longJump ? &longJumpPolynomial[0] : &jumpPolynomial[0];
+	u64 s0 = state128[0];
+	u64 s1 = state128[1];
+	u64 result0 = 0;
+	u64 result1 = 0;
+	for (uxx wIndex = 0; wIndex < 2; wIndex++)
+	{
+		for (u8 bIndex = 0; bIndex < 64; bIndex++)
+		{
+			if (polynomial[wIndex] & (1ULL << bIndex)) { result0 ^= s0; result1 ^= s1; }
+			s1 ^= s0;
+			s0 = XS128_rotl(s0, 49) ^ s1 ^ (s1 << 21);
+			s1 = XS128_rotl(s1, 28);
+		}
+	}
+	state128[0] = result0;
+	state128[1] = result1;
+}
+
 // +--------------------------------------------------------------+
 // |                             Step                             |
 // +--------------------------------------------------------------+
@@ -201,27 +277,23 @@ PEXP void StepRandomSeries(RandomSeries* series, u64 numberOfSteps)
 		case RandomSeriesType_LinearCongruential32:
 		{
 			//n(x+1) = n(x) * A + C modulo M
-			for (u64 sIndex = 0; sIndex < numberOfSteps; sIndex++)
-			{
-				u64 newState = (series->state * 1103515245ULL + 12345ULL) & 0xFFFFFFFFFFFFFFFFULL;
-				series->state = newState;
-			}
+			if (numberOfSteps == 1) { series->state = (series->state * RAND_LCG32_MULTIPLIER + RAND_LCG32_INCREMENT); }
+			else { series->state = SkipLinearCongruential64(series->state, RAND_LCG32_MULTIPLIER, RAND_LCG32_INCREMENT, numberOfSteps); }
 			series->generationCount += numberOfSteps;
 		} break;
 		case RandomSeriesType_LinearCongruential64:
 		{
 			//n(x+1) = n(x) * A + C modulo M
 			//Values taken from https://nuclear.llnl.gov/CNP/rng/rngman/node4.html
-			for (u64 sIndex = 0; sIndex < numberOfSteps; sIndex++)
-			{
-				u64 newState = (series->state * 2862933555777941757ULL + 3037000493ULL) & 0xFFFFFFFFFFFFFFFFULL;
-				series->state = newState;
-			}
+			if (numberOfSteps == 1) { series->state = (series->state * RAND_LCG64_MULTIPLIER + RAND_LCG64_INCREMENT); }
+			else { series->state = SkipLinearCongruential64(series->state, RAND_LCG64_MULTIPLIER, RAND_LCG64_INCREMENT, numberOfSteps); }
 			series->generationCount += numberOfSteps;
 		} break;
 		case RandomSeriesType_PermutedCongruential64:
 		{
 			//This code comes from BYP on Handmade Network
+			//NOTE: The state is replaced by the permuted output each step so this isn't an affine function
+			//      and we can't use SkipLinearCongruential64 to skip ahead, it stays O(n)
 			for (u64 sIndex = 0; sIndex < numberOfSteps; sIndex++)
 			{
 				#define PCG_INC 1
@@ -234,18 +306,81 @@ PEXP void StepRandomSeries(RandomSeries* series, u64 numberOfSteps)
 		case RandomSeriesType_XoroShiro128:
 		{
 			// https://xoroshiro.di.unimi.it/xoroshiro128plusplus.c
-			//TODO: There are jump() and long_jump() functions we could use
-			u64 s0 = series->state128[0];
-			u64 s1 = series->state128[1];
-			series->state = XS128_rotl(s0 + s1, 17) + s0;
-			s1 ^= s0;
-			series->state128[0] = XS128_rotl(s0, 49) ^ s1 ^ (s1 << 21); // a, b
-			series->state128[1] = XS128_rotl(s1, 28); // c
+			//NOTE: Skipping an arbitrary number of steps would require a jump polynomial per count,
+			//      use JumpXoroShiro128 (or GetRandomSeriesStream) to skip 2^64 or 2^96 steps at a time
+			for (u64 sIndex = 0; sIndex < numberOfSteps; sIndex++)
+			{
+				u64 s0 = series->state128[0];
+				u64 s1 = series->state128[1];
+				series->state = XS128_rotl(s0 + s1, 17) + s0;
+				s1 ^= s0;
+				series->state128[0] = XS128_rotl(s0, 49) ^ s1 ^ (s1 << 21); // a, b
+				series->state128[1] = XS128_rotl(s1, 28); // c
+			}
+			series->generationCount += numberOfSteps;
 		} break;
 		default: Assert(false); break; //TODO: Change to Assert_?
 	}
 }
 
+// +--------------------------------------------------------------+
+// |                           Streams                            |
+// +--------------------------------------------------------------+
+//Makes a copy of series that is streamIndex*2^48 steps ahead (streamIndex*2^64 for XoroShiro128) so each worker
+//thread (or chunk of work) can have its own deterministic series without overlapping any of the others.
+//NOTE: PermutedCongruential64 can't skip ahead so its streams are seeded from a hash of the state and streamIndex,
+//      they are deterministic but not guaranteed to never overlap
+PEXP void GetRandomSeriesStream(const RandomSeries* series, u64 streamIndex, RandomSeries* streamOut)
+{
+	NotNull(series);
+	NotNull(streamOut);
+	Assert(series->seeded);
+	*streamOut = *series;
+	if (streamIndex == 0) { return; }
+	switch (series->type)
+	{
+		case RandomSeriesType_Fixed: break;
+		case RandomSeriesType_Incremental:
+		case RandomSeriesType_LinearCongruential32:
+		case RandomSeriesType_LinearCongruential64:
+		{
+			Assert(streamIndex < RANDOM_MAX_NUM_STREAMS);
+			StepRandomSeries(streamOut, (streamIndex << RANDOM_STREAM_STRIDE_LOG2));
+			streamOut->generationCount = series->generationCount;
+		} break;
+		case RandomSeriesType_PermutedCongruential64:
+		{
+			//SplitMix64 finalizer
+			u64 mixed = series->state + (streamIndex * 0x9E3779B97F4A7C15ULL);
+			mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+			streamOut->state = (mixed ^ (mixed >> 31));
+		} break;
+		case RandomSeriesType_XoroShiro128:
+		{
+			for (u64 sIndex = 0; sIndex < streamIndex; sIndex++) { JumpXoroShiro128(&streamOut->state128[0], false); }
+		} break;
+		default: Assert(false); break;
+	}
+}
+
+//Fills streamsOut with numStreams series where streamsOut[i] is the same as GetRandomSeriesStream(series, i)
+PEXP void SplitRandomSeries(const RandomSeries* series, uxx numStreams, RandomSeries* streamsOut)
+{
+	NotNull(series);
+	Assert(numStreams == 0 || streamsOut != nullptr);
+	for (uxx sIndex = 0; sIndex < numStreams; sIndex++)
+	{
+		if (series->type == RandomSeriesType_XoroShiro128 && sIndex > 0)
+		{
+			//Jump from the previous stream rather than starting over from series each time
+			streamsOut[sIndex] = streamsOut[sIndex-1];
+			JumpXoroShiro128(&streamsOut[sIndex].state128[0], false);
+		}
+		else { GetRandomSeriesStream(series, (u64)sIndex, &streamsOut[sIndex]); }
+	}
+}
+
 // +--------------------------------------------------------------+
 // |                             Get                              |
 // +--------------------------------------------------------------+
@@ -253,6 +388,44 @@ PEXPI u64 GetRandU64(RandomSeries* series);
 
 //NOTE: Max values are not inclusive in all these functions (except float, but that generally doesn't matter)
 
+//Returns a value in [0, range) without modulo bias using Lemire's nearly divisionless method
+//(https://arxiv.org/abs/1805.10941). The division only happens when the first value lands in the
+//small biased region and extra values are only consumed in that case (probability range/2^32)
+//NOTE: The top 32 bits of each value are used since the low bits of the LCG types are weak
+//NOTE: Series that don't actually change (Fixed, Incremental or a defaultIncrement of 0) could reject forever
+//      so they use a plain modulo, which also keeps Incremental series counting through the range
+#define IsRandomSeriesCounter(seriesPntr) ((seriesPntr)->type == RandomSeriesType_Fixed || (seriesPntr)->type == RandomSeriesType_Incremental || (seriesPntr)->defaultIncrement == 0)
+PEXPI u32 GetRandBoundedU32(RandomSeries* series, u32 range)
+{
+	if (range == 0) { return 0; }
+	if (IsRandomSeriesCounter(series)) { return (u32)(GetRandU64(series) % range); }
+	u64 product = (GetRandU64(series) >> 32) * (u64)range;
+	u32 lowBits = (u32)product;
+	if (lowBits < range)
+	{
+		u32 threshold = (0U - range) % range;
+		while (lowBits < threshold)
+		{
+			product = (GetRandU64(series) >> 32) * (u64)range;
+			lowBits = (u32)product;
+		}
+	}
+	return (u32)(product >> 32);
+}
+PEXPI u64 GetRandBoundedU64(RandomSeries* series, u64 range)
+{
+	if (range == 0) { return 0; }
+	if (IsRandomSeriesCounter(series)) { return GetRandU64(series) % range; }
+	u64 result = 0;
+	u64 lowBits = MultiplyU64Wide(GetRandU64(series), range, &result);
+	if (lowBits < range)
+	{
+		u64 threshold = (0ULL - range) % range;
+		while (lowBits < threshold) { lowBits = MultiplyU64Wide(GetRandU64(series), range, &result); }
+	}
+	return result;
+}
+
 //TODO: Are the modulo operators here going to effect the distribution of the random series?
 //      Also do the floating point ideas of "precision" actually work like I want? Can we perform floating point
 //      math up in those ranges? Maybe we should modulo into a conservative estimate of r32/r64 precision
@@ -266,8 +439,7 @@ PEXPI u8 GetRandU8Range(RandomSeries* series, u8 min, u8 max)
 {
 	if (max < min) { SwapVariables(u8, min, max); }
 	if (min == max) { return min; }
-	u64 randU64 = GetRandU64(series);
-	return (u8)((randU64 % (max-min)) + min);
+	return (u8)(GetRandBoundedU32(series, (u32)(max - min)) + min);
 }
 
 PEXPI u16 GetRandU16(RandomSeries* series)
@@ -279,8 +451,7 @@ PEXPI u16 GetRandU16Range(RandomSeries* series, u16 min, u16 max)
 {
 	if (max < min) { SwapVariables(u16, min, max); }
 	if (min == max) { return min; }
-	u64 randU64 = GetRandU64(series);
-	return (u16)((randU64 % (max-min)) + min);
+	return (u16)(GetRandBoundedU32(series, (u32)(max - min)) + min);
 }
 
 PEXPI u32 GetRandU32(RandomSeries* series)
@@ -294,9 +465,7 @@ PEXPI u32 GetRandU32Range(RandomSeries* series, u32 min, u32 max)
 	NotNull(series); //TODO: Convert to NotNull_?
 	if (max < min) { SwapVariables(u32, min, max); }
 	if (min == max) { return min; }
-	u32 result = GetRandU32(series);
-	result = (result % (max - min)) + min;
-	return result;
+	return GetRandBoundedU32(series, max - min) + min;
 }
 
 //TODO: For some reason we are getting these unreachable code warnings in this code??
@@ -316,9 +485,7 @@ PEXPI u64 GetRandU64Range(RandomSeries* series, u64 min, u64 max)
 	NotNull(series); //TODO: Convert to NotNull_?
 	if (max < min) { SwapVariables(u64, min, max); }
 	if (min == max) { return min; }
-	u64 result = GetRandU64(series);
-	result = (result % (max - min)) + min;
-	return result;
+	return GetRandBoundedU64(series, max - min) + min;
 }
 
 PEXPI i8 GetRandI8(RandomSeries* series)
@@ -331,8 +498,7 @@ PEXPI i8 GetRandI8Range(RandomSeries* series, i8 min, i8 max)
 {
 	if (max < min) { SwapVariables(i8, min, max); }
 	if (min == max) { return min; }
-	u64 randU64 = GetRandU64(series);
-	return (i8)((i32)(randU64 % (u64)(max-min)) + min);
+	return (i8)((i32)GetRandBoundedU32(series, (u32)((i32)max - (i32)min)) + min);
 }
 
 PEXPI i16 GetRandI16(RandomSeries* series)
@@ -345,8 +511,7 @@ PEXPI i16 GetRandI16Range(RandomSeries* series, i16 min, i16 max)
 {
 	if (max < min) { SwapVariables(i16, min, max); }
 	if (min == max) { return min; }
-	u64 randU64 = GetRandU64(series);
-	return (i16)((i32)(randU64 % (u64)(max-min)) + min);
+	return (i16)((i32)GetRandBoundedU32(series, (u32)((i32)max - (i32)min)) + min);
 }
 
 #if COMPILER_IS_MSVC
@@ -361,8 +526,7 @@ PEXPI i32 GetRandI32Range(RandomSeries* series, i32 min, i32 max)
 {
 	if (max < min) { SwapVariables(i32, min, max); }
 	if (min == max) { return min; }
-	u64 randU64 = GetRandU64(series);
-	return (i32)((i64)(randU64 % (u64)(max-min)) + min);
+	return (i32)((i64)GetRandBoundedU32(series, (u32)((i64)max - (i64)min)) + min);
 }
 
 PEXPI i64 GetRandI64(RandomSeries* series)
@@ -399,6 +563,198 @@ PEXPI r64 GetRandR64Range(RandomSeries* series, r64 min, r64 max)
 	return (GetRandR64(series) * (max - min)) + min;
 }
 
+// +--------------------------------------------------------------+
+// |                             Fill                             |
+// +--------------------------------------------------------------+
+//NOTE: All the FillRand functions produce exactly the same values (and leave the series in the same state)
+//      as calling the matching GetRand function numValues times, they just do it with less overhead
+
+//The type switch happens once per call and the LCG types run 4 independent multiply chains. Each lane skips
+//4 values at a time so the output order still matches the serial series.
+PEXP void FillRandU64(RandomSeries* series, u64* valuesOut, uxx numValues)
+{
+	NotNull(series);
+	Assert(series->seeded);
+	Assert(numValues == 0 || valuesOut != nullptr);
+	if (numValues == 0) { return; }
+	u64 stepSize = series->defaultIncrement;
+	
+	if (series->type == RandomSeriesType_LinearCongruential32 || series->type == RandomSeriesType_LinearCongruential64)
+	{
+		bool is32 = (series->type == RandomSeriesType_LinearCongruential32);
+		u64 multiplier = is32 ? RAND_LCG32_MULTIPLIER : RAND_LCG64_MULTIPLIER;
+		u64 increment = is32 ? RAND_LCG32_INCREMENT : RAND_LCG64_INCREMENT;
+		//Composing the affine map with itself gives the multiplier/increment for skipping n steps at once
+		u64 stepIncrement = SkipLinearCongruential64(0, multiplier, increment, stepSize);
+		u64 stepMultiplier = SkipLinearCongruential64(1, multiplier, increment, stepSize) - stepIncrement;
+		u64 laneIncrement = SkipLinearCongruential64(0, multiplier, increment, stepSize*4);
+		u64 laneMultiplier = SkipLinearCongruential64(1, multiplier, increment, stepSize*4) - laneIncrement;
+		u64 state = series->state;
+		uxx vIndex = 0;
+		if (numValues >= 4)
+		{
+			u64 lane0 = state * stepMultiplier + stepIncrement;
+			u64 lane1 = lane0 * stepMultiplier + stepIncrement;
+			u64 lane2 = lane1 * stepMultiplier + stepIncrement;
+			u64 lane3 = lane2 * stepMultiplier + stepIncrement;
+			while (true)
+			{
+				valuesOut[vIndex+0] = lane0;
+				valuesOut[vIndex+1] = lane1;
+				valuesOut[vIndex+2] = lane2;
+				valuesOut[vIndex+3] = lane3;
+				vIndex += 4;
+				if (vIndex + 4 > numValues) { break; }
+				lane0 = lane0 * laneMultiplier + laneIncrement;
+				lane1 = lane1 * laneMultiplier + laneIncrement;
+				lane2 = lane2 * laneMultiplier + laneIncrement;
+				lane3 = lane3 * laneMultiplier + laneIncrement;
+			}
+			state = lane3;
+		}
+		for (; vIndex < numValues; vIndex++)
+		{
+			state = state * stepMultiplier + stepIncrement;
+			valuesOut[vIndex] = state;
+		}
+		series->state = state;
+		series->generationCount += stepSize * numValues;
+	}
+	else if (series->type == RandomSeriesType_XoroShiro128 && stepSize == 1)
+	{
+		u64 s0 = series->state128[0];
+		u64 s1 = series->state128[1];
+		for (uxx vIndex = 0; vIndex < numValues; vIndex++)
+		{
+			valuesOut[vIndex] = XS128_rotl(s0 + s1, 17) + s0;
+			s1 ^= s0;
+			s0 = XS128_rotl(s0, 49) ^ s1 ^ (s1 << 21);
+			s1 = XS128_rotl(s1, 28);
+		}
+		series->state = valuesOut[numValues-1];
+		series->state128[0] = s0;
+		series->state128[1] = s1;
+		series->generationCount += numValues;
+	}
+	else
+	{
+		//PCG64 (and the trivial types) have a serial dependency on the previous output so there's nothing to hoist
+		for (uxx vIndex = 0; vIndex < numValues; vIndex++)
+		{
+			StepRandomSeries(series, stepSize);
+			valuesOut[vIndex] = series->state;
+		}
+	}
+}
+
+PEXP void FillRandU32(RandomSeries* series, u32* valuesOut, uxx numValues)
+{
+	u64 buffer[RANDOM_FILL_CHUNK_SIZE];
+	for (uxx vIndex = 0; vIndex < numValues; vIndex += RANDOM_FILL_CHUNK_SIZE)
+	{
+		uxx chunkSize = MinUXX(numValues - vIndex, RANDOM_FILL_CHUNK_SIZE);
+		FillRandU64(series, &buffer[0], chunkSize);
+		for (uxx bIndex = 0; bIndex < chunkSize; bIndex++) { valuesOut[vIndex + bIndex] = (u32)(buffer[bIndex] % UINT32_MAX); }
+	}
+}
+PEXP void FillRandR32(RandomSeries* series, r32* valuesOut, uxx numValues)
+{
+	u64 buffer[RANDOM_FILL_CHUNK_SIZE];
+	for (uxx vIndex = 0; vIndex < numValues; vIndex += RANDOM_FILL_CHUNK_SIZE)
+	{
+		uxx chunkSize = MinUXX(numValues - vIndex, RANDOM_FILL_CHUNK_SIZE);
+		FillRandU64(series, &buffer[0], chunkSize);
+		for (uxx bIndex = 0; bIndex < chunkSize; bIndex++) { valuesOut[vIndex + bIndex] = (r32)(buffer[bIndex] % RAND_FLOAT_PRECISION_R32) / (r32)RAND_FLOAT_PRECISION_R32; }
+	}
+}
+PEXP void FillRandR64(RandomSeries* series, r64* valuesOut, uxx numValues)
+{
+	u64 buffer[RANDOM_FILL_CHUNK_SIZE];
+	for (uxx vIndex = 0; vIndex < numValues; vIndex += RANDOM_FILL_CHUNK_SIZE)
+	{
+		uxx chunkSize = MinUXX(numValues - vIndex, RANDOM_FILL_CHUNK_SIZE);
+		FillRandU64(series, &buffer[0], chunkSize);
+		for (uxx bIndex = 0; bIndex < chunkSize; bIndex++) { valuesOut[vIndex + bIndex] = (r64)(buffer[bIndex] % RAND_FLOAT_PRECISION_R64) / (r64)RAND_FLOAT_PRECISION_R64; }
+	}
+}
+
+//NOTE: Each output consumes one or more values from the series (see GetRandBoundedU32) so we only ever
+//      generate as many values as there are outputs left to fill, that way we never step the series
+//      further than the equivalent GetRand calls would have. Rejected values just don't produce an output.
+PEXP void FillRandU32Range(RandomSeries* series, u32* valuesOut, uxx numValues, u32 min, u32 max)
+{
+	if (max < min) { SwapVariables(u32, min, max); }
+	u32 range = max - min;
+	if (range == 0) { for (uxx vIndex = 0; vIndex < numValues; vIndex++) { valuesOut[vIndex] = min; } return; }
+	bool isCounter = IsRandomSeriesCounter(series);
+	u32 threshold = (0U - range) % range;
+	u64 buffer[RANDOM_FILL_CHUNK_SIZE];
+	uxx vIndex = 0;
+	while (vIndex < numValues)
+	{
+		uxx chunkSize = MinUXX(numValues - vIndex, RANDOM_FILL_CHUNK_SIZE);
+		FillRandU64(series, &buffer[0], chunkSize);
+		if (isCounter)
+		{
+			for (uxx bIndex = 0; bIndex < chunkSize; bIndex++) { valuesOut[vIndex++] = (u32)(buffer[bIndex] % range) + min; }
+		}
+		else
+		{
+			for (uxx bIndex = 0; bIndex < chunkSize; bIndex++)
+			{
+				u64 product = (buffer[bIndex] >> 32) * (u64)range;
+				if ((u32)product >= threshold) { valuesOut[vIndex++] = (u32)(product >> 32) + min; }
+			}
+		}
+	}
+}
+PEXP void FillRandU64Range(RandomSeries* series, u64* valuesOut, uxx numValues, u64 min, u64 max)
+{
+	if (max < min) { SwapVariables(u64, min, max); }
+	u64 range = max - min;
+	if (range == 0) { for (uxx vIndex = 0; vIndex < numValues; vIndex++) { valuesOut[vIndex] = min; } return; }
+	bool isCounter = IsRandomSeriesCounter(series);
+	u64 threshold = (0ULL - range) % range;
+	u64 buffer[RANDOM_FILL_CHUNK_SIZE];
+	uxx vIndex = 0;
+	while (vIndex < numValues)
+	{
+		uxx chunkSize = MinUXX(numValues - vIndex, RANDOM_FILL_CHUNK_SIZE);
+		FillRandU64(series, &buffer[0], chunkSize);
+		if (isCounter)
+		{
+			for (uxx bIndex = 0; bIndex < chunkSize; bIndex++) { valuesOut[vIndex++] = (buffer[bIndex] % range) + min; }
+		}
+		else
+		{
+			for (uxx bIndex = 0; bIndex < chunkSize; bIndex++)
+			{
+				u64 result = 0;
+				u64 lowBits = MultiplyU64Wide(buffer[bIndex], range, &result);
+				if (lowBits >= threshold) { valuesOut[vIndex++] = result + min; }
+			}
+		}
+	}
+}
+PEXP void FillRandI32Range(RandomSeries* series, i32* valuesOut, uxx numValues, i32 min, i32 max)
+{
+	if (max < min) { SwapVariables(i32, min, max); }
+	FillRandU32Range(series, (u32*)valuesOut, numValues, 0, (u32)((i64)max - (i64)min));
+	for (uxx vIndex = 0; vIndex < numValues; vIndex++) { valuesOut[vIndex] = (i32)((i64)((u32*)valuesOut)[vIndex] + min); }
+}
+PEXPI void FillRandR32Range(RandomSeries* series, r32* valuesOut, uxx numValues, r32 min, r32 max)
+{
+	if (max < min) { SwapVariables(r32, min, max); }
+	FillRandR32(series, valuesOut, numValues);
+	for (uxx vIndex = 0; vIndex < numValues; vIndex++) { valuesOut[vIndex] = (valuesOut[vIndex] * (max - min)) + min; }
+}
+PEXPI void FillRandR64Range(RandomSeries* series, r64* valuesOut, uxx numValues, r64 min, r64 max)
+{
+	if (max < min) { SwapVariables(r64, min, max); }
+	FillRandR64(series, valuesOut, numValues);
+	for (uxx vIndex = 0; vIndex < numValues; vIndex++) { valuesOut[vIndex] = (valuesOut[vIndex] * (max - min)) + min; }
+}
+
 #endif //PIG_CORE_IMPLEMENTATION
 
 #endif //  _MISC_RANDOM_H
@@ -41,6 +41,18 @@ enum Result
 	Result_FailedToReadFile,
 	Result_SokolError,
 	
+	Result_EmptyString,
+	Result_NoNumbers,
+	Result_InvalidCharacter,
+	Result_Overflow,
+	
+	Result_UnexpectedToken,
+	Result_UnknownIdentifier,
+	Result_WrongNumArguments,
+	Result_TooComplex,
+	Result_UnexpectedEnd,
+	Result_MissingField,
+	
 	Result_Count,
 };
 
@@ -63,6 +75,16 @@ PEXP const char* GetResultStr(Result result)
 		case Result_ParsingFailure: return "ParsingFailure";
 		case Result_FailedToReadFile: return "FailedToReadFile";
 		case Result_SokolError: return "SokolError";
+		case Result_EmptyString: return "EmptyString";
+		case Result_NoNumbers: return "NoNumbers";
+		case Result_InvalidCharacter: return "InvalidCharacter";
+		case Result_Overflow: return "Overflow";
+		case Result_UnexpectedToken: return "UnexpectedToken";
+		case Result_UnknownIdentifier: return "UnknownIdentifier";
+		case Result_WrongNumArguments: return "WrongNumArguments";
+		case Result_TooComplex: return "TooComplex";
+		case Result_UnexpectedEnd: return "UnexpectedEnd";
+		case Result_MissingField: return "MissingField";
 		default: return UNKNOWN_STR;
 	}
 }
@@ -0,0 +1,571 @@
+/*
+File:   misc_tokenizer.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A general purpose tokenizer for C-like languages and custom text formats (config files, piggen input, etc.)
+	** The Tokenizer is a pull iterator over a Str8 that hands back one Token at a time. It never allocates,
+	** each Token is a slice of the source along with the 1-based line and column it starts on.
+	** TokenizerRules controls what counts as a comment, which quote chars start strings, whether
+	** newlines are emitted as tokens (for line-based formats) and which multi-char operators
+	** are recognized. GetCTokenizerRules and GetConfigTokenizerRules return common presets.
+	** Numbers follow the C "pp-number" rule (ex. "0x1F", "1.5e-3f" and "10ULL" are each one token)
+	** and are left for the caller to parse with TryParseI64\TryParseR64 from misc_parsing.h.
+	** String and char tokens include their quotes, TryDecodeTokenStr removes them and resolves escapes.
+	** Whitespace runs, comments and string bodies are scanned 16 bytes at a time using base_simd.h when it's available.
+*/
+
+/*
+* Usage Example:
+*	TokenizerRules rules = GetCTokenizerRules();
+*	Tokenizer tokenizer;
+*	InitTokenizer(&tokenizer, fileContents, &rules);
+*	Token token;
+*	while (TokenizerNext(&tokenizer, &token))
+*	{
+*		if (IsToken(&token, TokenType_Identifier, StrLit("struct"))) { ... }
+*	}
+*	if (tokenizer.error != Result_None) { PrintLine_E("Error on line %llu: %s", token.line, GetResultStr(tokenizer.error)); }
+*/
+
+#ifndef _MISC_TOKENIZER_H
+#define _MISC_TOKENIZER_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_char.h"
+#include "base/base_simd.h"
+#include "base/base_unicode.h"
+#include "std/std_memset.h"
+#include "std/std_mem_search.h"
+#include "mem/mem_arena.h"
+#include "struct/struct_string.h"
+#include "misc/misc_result.h"
+
+#define C_TOKENIZER_NUM_OPERATORS 24
+
+//Bits in Tokenizer.charFlags
+#define TOKENIZER_CHAR_IDENTIFIER_START 0x01 //letters, '_' and (optionally) UTF-8 bytes
+#define TOKENIZER_CHAR_IDENTIFIER       0x02 //all of the above plus digits and TokenizerRules.extraIdentifierChars
+#define TOKENIZER_CHAR_DIGIT            0x04
+#define TOKENIZER_CHAR_WHITESPACE       0x08
+#define TOKENIZER_CHAR_OPERATOR_START   0x10 //first char of at least one entry in TokenizerRules.operators
+#define TOKENIZER_CHAR_SPECIAL          0x20 //first char of a comment, a quote or a newline that needs to be emitted
+#define TOKENIZER_CHAR_OPERATOR_NEXT    0x40 //any char after the first in at least one entry in TokenizerRules.operators
+
+typedef enum TokenType TokenType;
+enum TokenType
+{
+	TokenType_None = 0, //returned at the end of the source (or after an error)
+	TokenType_Identifier,
+	TokenType_Number,
+	TokenType_String,
+	TokenType_Char,
+	TokenType_Punctuation,
+	TokenType_Comment,
+	TokenType_Newline,
+	TokenType_Unknown, //a byte that doesn't fit any of the rules (ex. a control character)
+	TokenType_Count,
+};
+#if !PIG_CORE_IMPLEMENTATION
+const char* GetTokenTypeStr(TokenType enumValue);
+#else
+PEXP const char* GetTokenTypeStr(TokenType enumValue)
+{
+	switch (enumValue)
+	{
+		case TokenType_None:        return "None";
+		case TokenType_Identifier:  return "Identifier";
+		case TokenType_Number:      return "Number";
+		case TokenType_String:      return "String";
+		case TokenType_Char:        return "Char";
+		case TokenType_Punctuation: return "Punctuation";
+		case TokenType_Comment:     return "Comment";
+		case TokenType_Newline:     return "Newline";
+		case TokenType_Unknown:     return "Unknown";
+		default: return UNKNOWN_STR;
+	}
+}
+#endif
+
+typedef struct Token Token;
+struct Token
+{
+	TokenType type;
+	bool hasEscapes; //only set for String and Char tokens
+	uxx index;
+	uxx line; //1-based
+	uxx column; //1-based, counted in bytes
+	Str8 str; //slice of the source, includes the quotes for strings and the markers for comments
+};
+
+typedef struct TokenizerRules TokenizerRules;
+struct TokenizerRules
+{
+	bool emitComments; //comments are skipped like whitespace unless this is set
+	bool emitNewlines; //each '\n' becomes a Newline token (a '\r' before it is skipped as whitespace)
+	Str8 lineComment; //ex. "//" or "#", empty to disable
+	Str8 blockCommentStart; //ex. "/*", empty to disable
+	Str8 blockCommentEnd; //ex. "*/"
+	bool nestBlockComments;
+	bool doubleQuoteStrings;
+	bool singleQuoteStrings; //'abc' is a String token (can't be combined with singleQuoteChars)
+	bool singleQuoteChars; //'a' is a Char token
+	bool multilineStrings; //otherwise a newline inside a string is an error
+	char escapeChar; //ex. '\\', the char after this never ends a string. Use '\0' to disable escapes
+	bool utf8Identifiers; //bytes >= 0x80 are allowed in identifiers
+	Str8 extraIdentifierChars; //ex. "$" or "-", these are allowed in identifiers but can't start one
+	uxx numOperators;
+	const char* const* operators; //multi-char punctuation (ex. "==" or "<<="), the longest match wins. Any other punctuation is returned as a single char
+};
+
+typedef struct Tokenizer Tokenizer;
+struct Tokenizer
+{
+	Str8 source;
+	TokenizerRules rules;
+	uxx index;
+	uxx line; //line number at index (1-based)
+	uxx lineStart; //index of the first char on the current line
+	Result error;
+	uxx errorIndex;
+	u8 charFlags[256];
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	extern const char* const CTokenizerOperators[C_TOKENIZER_NUM_OPERATORS];
+	TokenizerRules GetCTokenizerRules();
+	TokenizerRules GetConfigTokenizerRules();
+	void InitTokenizer(Tokenizer* tokenizer, Str8 source, const TokenizerRules* rules);
+	PIG_CORE_INLINE bool IsToken(const Token* token, TokenType type, Str8 str);
+	PIG_CORE_INLINE uxx FindTokenizerChars_(const u8* bytes, uxx numBytes, u8 char1, u8 char2, u8 char3);
+	void TokenizerCountNewlines_(Tokenizer* tokenizer, uxx startIndex, uxx endIndex);
+	uxx SkipTokenizerWhitespace_(Tokenizer* tokenizer, uxx index);
+	PIG_CORE_INLINE bool IsTokenizerMatch_(Str8 source, uxx index, Str8 str);
+	PIG_CORE_INLINE bool TokenizerError_(Tokenizer* tokenizer, Result error, uxx errorIndex);
+	bool TokenizerScanStr_(Tokenizer* tokenizer, uxx startIndex, uxx* endIndexOut, bool* hasEscapesOut);
+	bool TokenizerScanBlockComment_(Tokenizer* tokenizer, uxx startIndex, uxx* endIndexOut);
+	bool TokenizerNext(Tokenizer* tokenizer, Token* tokenOut);
+	PIG_CORE_INLINE bool TokenizerPeek(const Tokenizer* tokenizer, Token* tokenOut);
+	bool TryDecodeTokenStr(Arena* arena, const Token* token, char escapeChar, Str8* strOut, Result* errorOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+const char* const CTokenizerOperators[C_TOKENIZER_NUM_OPERATORS] = {
+	"->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||", "::",
+	"*=", "/=", "%=", "+=", "-=", "&=", "^=", "|=", "<<=", ">>=", "...", "##",
+};
+
+PEXP TokenizerRules GetCTokenizerRules()
+{
+	TokenizerRules result = ZEROED;
+	result.lineComment = StrLit("//");
+	result.blockCommentStart = StrLit("/*");
+	result.blockCommentEnd = StrLit("*/");
+	result.doubleQuoteStrings = true;
+	result.singleQuoteChars = true;
+	result.escapeChar = '\\';
+	result.numOperators = C_TOKENIZER_NUM_OPERATORS;
+	result.operators = &CTokenizerOperators[0];
+	return result;
+}
+//Line-based "key = value" style files with '#' comments
+PEXP TokenizerRules GetConfigTokenizerRules()
+{
+	TokenizerRules result = ZEROED;
+	result.emitNewlines = true;
+	result.lineComment = StrLit("#");
+	result.doubleQuoteStrings = true;
+	result.escapeChar = '\\';
+	result.utf8Identifiers = true;
+	return result;
+}
+
+//NOTE: rules is copied, but the strings and operators it points to must stay alive as long as the tokenizer is in use
+PEXP void InitTokenizer(Tokenizer* tokenizer, Str8 source, const TokenizerRules* rules)
+{
+	NotNull(tokenizer);
+	NotNullStr(source);
+	NotNull(rules);
+	Assert(!rules->singleQuoteStrings || !rules->singleQuoteChars);
+	Assert(rules->blockCommentStart.length == 0 || rules->blockCommentEnd.length > 0);
+	Assert(rules->operators != nullptr || rules->numOperators == 0);
+	ClearPointer(tokenizer);
+	tokenizer->source = source;
+	MyMemCopy(&tokenizer->rules, rules, sizeof(TokenizerRules));
+	tokenizer->line = 1;
+	
+	u8* flags = &tokenizer->charFlags[0];
+	for (uxx cIndex = 0; cIndex < 256; cIndex++)
+	{
+		if (IsCharAlphabetic((u32)cIndex) || cIndex == '_' || (cIndex >= 0x80 && rules->utf8Identifiers)) { flags[cIndex] |= TOKENIZER_CHAR_IDENTIFIER_START|TOKENIZER_CHAR_IDENTIFIER; }
+		if (IsCharNumeric((u32)cIndex)) { flags[cIndex] |= TOKENIZER_CHAR_DIGIT|TOKENIZER_CHAR_IDENTIFIER; }
+		if (cIndex == ' ' || (cIndex >= '\t' && cIndex <= '\r')) { flags[cIndex] |= TOKENIZER_CHAR_WHITESPACE; }
+	}
+	for (uxx cIndex = 0; cIndex < rules->extraIdentifierChars.length; cIndex++) { flags[rules->extraIdentifierChars.bytes[cIndex]] |= TOKENIZER_CHAR_IDENTIFIER; }
+	for (uxx oIndex = 0; oIndex < rules->numOperators; oIndex++)
+	{
+		NotNull(rules->operators[oIndex]);
+		Assert(rules->operators[oIndex][0] != '\0');
+		flags[(u8)rules->operators[oIndex][0]] |= TOKENIZER_CHAR_OPERATOR_START;
+		for (uxx cIndex = 1; rules->operators[oIndex][cIndex] != '\0'; cIndex++) { flags[(u8)rules->operators[oIndex][cIndex]] |= TOKENIZER_CHAR_OPERATOR_NEXT; }
+	}
+	if (rules->lineComment.length > 0) { flags[rules->lineComment.bytes[0]] |= TOKENIZER_CHAR_SPECIAL; }
+	if (rules->blockCommentStart.length > 0) { flags[rules->blockCommentStart.bytes[0]] |= TOKENIZER_CHAR_SPECIAL; }
+	if (rules->doubleQuoteStrings) { flags['"'] |= TOKENIZER_CHAR_SPECIAL; }
+	if (rules->singleQuoteStrings || rules->singleQuoteChars) { flags['\''] |= TOKENIZER_CHAR_SPECIAL; }
+	if (rules->emitNewlines)
+	{
+		flags['\n'] &= ~TOKENIZER_CHAR_WHITESPACE;
+		flags['\n'] |= TOKENIZER_CHAR_SPECIAL;
+	}
+}
+
+PEXPI bool IsToken(const Token* token, TokenType type, Str8 str)
+{
+	return (token->type == type && StrExactEquals(token->str, str));
+}
+
+//Returns the index of the first byte that matches any of the 3 chars (pass the same char more than once when searching for fewer), or numBytes if none are found
+PEXPI uxx FindTokenizerChars_(const u8* bytes, uxx numBytes, u8 char1, u8 char2, u8 char3)
+{
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_SIMD128
+	SimdU8x16 char1Vec = SimdSplatU8x16(char1);
+	SimdU8x16 char2Vec = SimdSplatU8x16(char2);
+	SimdU8x16 char3Vec = SimdSplatU8x16(char3);
+	while (bIndex + 16 <= numBytes)
+	{
+		SimdU8x16 input = SimdLoadU8x16(bytes + bIndex);
+		SimdU8x16 flagged = SimdOrU8x16(SimdOrU8x16(SimdEqualsU8x16(input, char1Vec), SimdEqualsU8x16(input, char2Vec)), SimdEqualsU8x16(input, char3Vec));
+		u64 mask = SimdHighBitMaskU8x16(flagged);
+		if (mask != 0) { return bIndex + (uxx)(CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE); }
+		bIndex += 16;
+	}
+	#endif
+	
+	for (; bIndex < numBytes; bIndex++)
+	{
+		u8 character = bytes[bIndex];
+		if (character == char1 || character == char2 || character == char3) { break; }
+	}
+	return bIndex;
+}
+
+//Updates line and lineStart for any '\n' chars in [startIndex, endIndex)
+PEXP void TokenizerCountNewlines_(Tokenizer* tokenizer, uxx startIndex, uxx endIndex)
+{
+	const u8* bytes = tokenizer->source.bytes;
+	uxx index = startIndex;
+	
+	#if TARGET_HAS_SIMD128
+	SimdU8x16 newLineVec = SimdSplatU8x16('\n');
+	while (index + 16 <= endIndex)
+	{
+		u64 mask = SimdHighBitMaskU8x16(SimdEqualsU8x16(SimdLoadU8x16(bytes + index), newLineVec));
+		if (mask != 0)
+		{
+			tokenizer->line += (uxx)(CountBitsSetU64(mask) / SIMD_MASK_BITS_PER_BYTE);
+			tokenizer->lineStart = index + (uxx)((63 - CountLeadingZerosU64(mask)) / SIMD_MASK_BITS_PER_BYTE) + 1;
+		}
+		index += 16;
+	}
+	#endif
+	
+	for (; index < endIndex; index++)
+	{
+		if (bytes[index] == '\n') { tokenizer->line++; tokenizer->lineStart = index + 1; }
+	}
+}
+
+PEXP uxx SkipTokenizerWhitespace_(Tokenizer* tokenizer, uxx index)
+{
+	Str8 source = tokenizer->source;
+	const u8* flags = &tokenizer->charFlags[0];
+	//NOTE: Most whitespace runs are a single space so we check the first 2 chars before bothering with SIMD
+	if (index >= source.length || !IsFlagSet(flags[source.bytes[index]], TOKENIZER_CHAR_WHITESPACE)) { return index; }
+	if (source.bytes[index] == '\n') { tokenizer->line++; tokenizer->lineStart = index + 1; }
+	index++;
+	if (index >= source.length || !IsFlagSet(flags[source.bytes[index]], TOKENIZER_CHAR_WHITESPACE)) { return index; }
+	
+	#if TARGET_HAS_SIMD128
+	SimdU8x16 spaceVec = SimdSplatU8x16(' ');
+	SimdU8x16 newLineVec = SimdSplatU8x16('\n');
+	SimdU8x16 controlMinVec = SimdSplatU8x16('\t');
+	SimdU8x16 controlMaxVec = SimdSplatU8x16('\r');
+	SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+	SimdU8x16 allOnesVec = SimdSplatU8x16(0xFF);
+	//When newlines are emitted they end the whitespace run
+	SimdU8x16 newLineFilterVec = tokenizer->rules.emitNewlines ? allOnesVec : zeroVec;
+	while (index + 16 <= source.length)
+	{
+		SimdU8x16 input = SimdLoadU8x16(source.bytes + index);
+		SimdU8x16 isNewLine = SimdEqualsU8x16(input, newLineVec);
+		SimdU8x16 isControl = SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(input, controlMaxVec), zeroVec), SimdEqualsU8x16(SimdSubSatU8x16(controlMinVec, input), zeroVec));
+		SimdU8x16 isWhitespace = SimdXorU8x16(SimdOrU8x16(isControl, SimdEqualsU8x16(input, spaceVec)), SimdAndU8x16(isNewLine, newLineFilterVec));
+		u64 endMask = SimdHighBitMaskU8x16(SimdXorU8x16(isWhitespace, allOnesVec));
+		u64 newLineMask = SimdHighBitMaskU8x16(isNewLine);
+		uxx runLength = 16;
+		if (endMask != 0)
+		{
+			runLength = (uxx)(CountTrailingZerosU64(endMask) / SIMD_MASK_BITS_PER_BYTE);
+			newLineMask &= (((u64)1 << (runLength * SIMD_MASK_BITS_PER_BYTE)) - 1);
+		}
+		if (newLineMask != 0)
+		{
+			tokenizer->line += (uxx)(CountBitsSetU64(newLineMask) / SIMD_MASK_BITS_PER_BYTE);
+			tokenizer->lineStart = index + (uxx)((63 - CountLeadingZerosU64(newLineMask)) / SIMD_MASK_BITS_PER_BYTE) + 1;
+		}
+		index += runLength;
+		if (endMask != 0) { return index; }
+	}
+	#endif
+	
+	while (index < source.length && IsFlagSet(flags[source.bytes[index]], TOKENIZER_CHAR_WHITESPACE))
+	{
+		if (source.bytes[index] == '\n') { tokenizer->line++; tokenizer->lineStart = index + 1; }
+		index++;
+	}
+	return index;
+}
+
+PEXPI bool IsTokenizerMatch_(Str8 source, uxx index, Str8 str)
+{
+	return (str.length > 0 && index + str.length <= source.length && MyMemCompare(source.bytes + index, str.bytes, str.length) == 0);
+}
+
+PEXPI bool TokenizerError_(Tokenizer* tokenizer, Result error, uxx errorIndex)
+{
+	tokenizer->error = error;
+	tokenizer->errorIndex = errorIndex;
+	tokenizer->index = tokenizer->source.length;
+	return false;
+}
+
+//startIndex is the index of the opening quote, endIndexOut is set to the index after the closing quote
+PEXP bool TokenizerScanStr_(Tokenizer* tokenizer, uxx startIndex, uxx* endIndexOut, bool* hasEscapesOut)
+{
+	Str8 source = tokenizer->source;
+	u8 quoteChar = source.bytes[startIndex];
+	u8 escapeChar = (tokenizer->rules.escapeChar != '\0') ? (u8)tokenizer->rules.escapeChar : quoteChar;
+	u8 newLineChar = tokenizer->rules.multilineStrings ? quoteChar : (u8)'\n';
+	bool hasEscapes = false;
+	uxx index = startIndex + 1;
+	while (true)
+	{
+		index += FindTokenizerChars_(source.bytes + index, source.length - index, quoteChar, escapeChar, newLineChar);
+		if (index >= source.length) { return TokenizerError_(tokenizer, Result_UnexpectedEnd, source.length); }
+		u8 character = source.bytes[index];
+		if (character == quoteChar) { break; }
+		else if (character == escapeChar)
+		{
+			hasEscapes = true;
+			index += 2;
+			if (index > source.length) { return TokenizerError_(tokenizer, Result_UnexpectedEnd, source.length); }
+			if (source.bytes[index-1] == '\r' && index < source.length && source.bytes[index] == '\n') { index++; } //"\r\n" after the escapeChar is one line continuation
+			if (source.bytes[index-1] == '\n' && !tokenizer->rules.multilineStrings) { tokenizer->line++; tokenizer->lineStart = index; } //escaped newlines continue the string on the next line
+		}
+		else { return TokenizerError_(tokenizer, Result_UnexpectedEnd, index); } //newline in a single line string
+	}
+	if (tokenizer->rules.multilineStrings) { TokenizerCountNewlines_(tokenizer, startIndex + 1, index); }
+	*endIndexOut = index + 1;
+	*hasEscapesOut = hasEscapes;
+	return true;
+}
+
+//startIndex is the index of the blockCommentStart, endIndexOut is set to the index after the blockCommentEnd
+PEXP bool TokenizerScanBlockComment_(Tokenizer* tokenizer, uxx startIndex, uxx* endIndexOut)
+{
+	Str8 source = tokenizer->source;
+	Str8 startStr = tokenizer->rules.blockCommentStart;
+	Str8 endStr = tokenizer->rules.blockCommentEnd;
+	u8 nestChar = tokenizer->rules.nestBlockComments ? startStr.bytes[0] : endStr.bytes[0];
+	uxx depth = 1;
+	uxx index = startIndex + startStr.length;
+	while (depth > 0)
+	{
+		index += FindTokenizerChars_(source.bytes + index, source.length - index, endStr.bytes[0], nestChar, nestChar);
+		if (index >= source.length) { return TokenizerError_(tokenizer, Result_UnexpectedEnd, source.length); }
+		if (IsTokenizerMatch_(source, index, endStr)) { depth--; index += endStr.length; }
+		else if (tokenizer->rules.nestBlockComments && IsTokenizerMatch_(source, index, startStr)) { depth++; index += startStr.length; }
+		else { index++; }
+	}
+	TokenizerCountNewlines_(tokenizer, startIndex, index);
+	*endIndexOut = index;
+	return true;
+}
+
+//Returns false at the end of the source or when an error is found (tokenizer->error is Result_None in the former case)
+//When an error is found tokenOut holds the start of the token that caused it
+PEXP bool TokenizerNext(Tokenizer* tokenizer, Token* tokenOut)
+{
+	NotNull(tokenizer);
+	NotNull(tokenOut);
+	Str8 source = tokenizer->source;
+	const u8* flags = &tokenizer->charFlags[0];
+	const TokenizerRules* rules = &tokenizer->rules;
+	
+	while (true)
+	{
+		uxx index = SkipTokenizerWhitespace_(tokenizer, tokenizer->index);
+		tokenOut->type = TokenType_None;
+		tokenOut->hasEscapes = false;
+		tokenOut->index = index;
+		tokenOut->line = tokenizer->line;
+		tokenOut->column = index - tokenizer->lineStart + 1;
+		tokenOut->str = NewStr8(0, source.bytes + index);
+		if (index >= source.length) { tokenizer->index = index; return false; }
+		
+		u8 character = source.bytes[index];
+		u8 charFlags = flags[character];
+		uxx endIndex = index + 1;
+		if (IsFlagSet(charFlags, TOKENIZER_CHAR_IDENTIFIER_START))
+		{
+			tokenOut->type = TokenType_Identifier;
+			while (endIndex < source.length && IsFlagSet(flags[source.bytes[endIndex]], TOKENIZER_CHAR_IDENTIFIER)) { endIndex++; }
+		}
+		else if (IsFlagSet(charFlags, TOKENIZER_CHAR_DIGIT) || (character == '.' && endIndex < source.length && IsFlagSet(flags[source.bytes[endIndex]], TOKENIZER_CHAR_DIGIT)))
+		{
+			//pp-number: digits, letters, '_', '.' and a sign directly after an exponent char
+			tokenOut->type = TokenType_Number;
+			while (endIndex < source.length)
+			{
+				u8 nextChar = source.bytes[endIndex];
+				bool isNumberChar = ((nextChar < 0x80 && (flags[nextChar] & (TOKENIZER_CHAR_IDENTIFIER_START|TOKENIZER_CHAR_DIGIT)) != 0) || nextChar == '.');
+				if (!isNumberChar)
+				{
+					u8 prevChar = source.bytes[endIndex-1];
+					bool isExponentSign = ((nextChar == '+' || nextChar == '-') && (prevChar == 'e' || prevChar == 'E' || prevChar == 'p' || prevChar == 'P'));
+					if (!isExponentSign) { break; }
+				}
+				endIndex++;
+			}
+		}
+		else if (IsFlagSet(charFlags, TOKENIZER_CHAR_SPECIAL) && IsTokenizerMatch_(source, index, rules->lineComment))
+		{
+			tokenOut->type = TokenType_Comment;
+			endIndex = index + rules->lineComment.length;
+			endIndex += MemFindByte(source.bytes + endIndex, source.length - endIndex, '\n');
+			if (endIndex > index + rules->lineComment.length && source.bytes[endIndex-1] == '\r') { endIndex--; } //the '\r' of a "\r\n" is skipped as whitespace
+		}
+		else if (IsFlagSet(charFlags, TOKENIZER_CHAR_SPECIAL) && IsTokenizerMatch_(source, index, rules->blockCommentStart))
+		{
+			tokenOut->type = TokenType_Comment;
+			if (!TokenizerScanBlockComment_(tokenizer, index, &endIndex)) { return false; }
+		}
+		else if ((character == '"' && rules->doubleQuoteStrings) || (character == '\'' && (rules->singleQuoteStrings || rules->singleQuoteChars)))
+		{
+			tokenOut->type = (character == '\'' && rules->singleQuoteChars) ? TokenType_Char : TokenType_String;
+			if (!TokenizerScanStr_(tokenizer, index, &endIndex, &tokenOut->hasEscapes)) { return false; }
+		}
+		else if (character == '\n')
+		{
+			DebugAssert(rules->emitNewlines);
+			tokenOut->type = TokenType_Newline;
+			tokenizer->line++;
+			tokenizer->lineStart = endIndex;
+		}
+		else if (character > ' ' && character < 0x7F)
+		{
+			tokenOut->type = TokenType_Punctuation;
+			//NOTE: Most punctuation is a single char so we only search the operators when the next char could continue one
+			if (IsFlagSet(charFlags, TOKENIZER_CHAR_OPERATOR_START) && endIndex < source.length && IsFlagSet(flags[source.bytes[endIndex]], TOKENIZER_CHAR_OPERATOR_NEXT))
+			{
+				uxx longestLength = 1;
+				for (uxx oIndex = 0; oIndex < rules->numOperators; oIndex++)
+				{
+					const char* operatorStr = rules->operators[oIndex];
+					uxx oLength = 0;
+					while (operatorStr[oLength] != '\0' && index + oLength < source.length && source.chars[index + oLength] == operatorStr[oLength]) { oLength++; }
+					if (operatorStr[oLength] == '\0' && oLength > longestLength) { longestLength = oLength; }
+				}
+				endIndex = index + longestLength;
+			}
+		}
+		else { tokenOut->type = TokenType_Unknown; }
+		
+		tokenOut->str = NewStr8(endIndex - index, source.chars + index);
+		tokenizer->index = endIndex;
+		if (tokenOut->type != TokenType_Comment || rules->emitComments) { return true; }
+	}
+}
+
+PEXPI bool TokenizerPeek(const Tokenizer* tokenizer, Token* tokenOut)
+{
+	Tokenizer tokenizerCopy = *tokenizer;
+	return TokenizerNext(&tokenizerCopy, tokenOut);
+}
+
+//Removes the quotes from a String or Char token and resolves escape sequences: \n \r \t \0 \a \b \f \v \xHH \uHHHH \UHHHHHHHH
+//and the escapeChar followed by any other char (ex. \\ or \" or \') becomes that char. An escaped newline is removed (line continuation)
+//If the token has no escapes the result is a slice of the source, otherwise it's allocated from arena
+PEXP bool TryDecodeTokenStr(Arena* arena, const Token* token, char escapeChar, Str8* strOut, Result* errorOut)
+{
+	NotNull(token);
+	NotNull(strOut);
+	Assert(token->type == TokenType_String || token->type == TokenType_Char);
+	Assert(token->str.length >= 2);
+	Str8 rawStr = StrSlice(token->str, 1, token->str.length - 1);
+	if (!token->hasEscapes || escapeChar == '\0') { *strOut = rawStr; return true; }
+	NotNull(arena);
+	
+	//NOTE: Every escape sequence decodes to fewer bytes than it takes up, so rawStr.length is always enough room
+	char* chars = AllocArray(char, arena, rawStr.length);
+	if (chars == nullptr) { SetOptionalOutPntr(errorOut, Result_FailedToAllocateMemory); return false; }
+	uxx outLength = 0;
+	for (uxx cIndex = 0; cIndex < rawStr.length; cIndex++)
+	{
+		char character = rawStr.chars[cIndex];
+		if (character != escapeChar) { chars[outLength++] = character; continue; }
+		if (cIndex + 1 >= rawStr.length) { SetOptionalOutPntr(errorOut, Result_UnexpectedEnd); return false; }
+		cIndex++;
+		char escapedChar = rawStr.chars[cIndex];
+		uxx numHexChars = 0;
+		switch (escapedChar)
+		{
+			case 'n': chars[outLength++] = '\n'; break;
+			case 'r': chars[outLength++] = '\r'; break;
+			case 't': chars[outLength++] = '\t'; break;
+			case '0': chars[outLength++] = '\0'; break;
+			case 'a': chars[outLength++] = '\a'; break;
+			case 'b': chars[outLength++] = '\b'; break;
+			case 'f': chars[outLength++] = '\f'; break;
+			case 'v': chars[outLength++] = '\v'; break;
+			case 'x': numHexChars = 2; break;
+			case 'u': numHexChars = 4; break;
+			case 'U': numHexChars = 8; break;
+			case '\r': if (cIndex + 1 < rawStr.length && rawStr.chars[cIndex+1] == '\n') { cIndex++; } break;
+			case '\n': break;
+			default: chars[outLength++] = escapedChar; break;
+		}
+		if (numHexChars > 0)
+		{
+			if (cIndex + numHexChars >= rawStr.length || !AreCharsHexidecimal(numHexChars, &rawStr.chars[cIndex+1])) { SetOptionalOutPntr(errorOut, Result_InvalidCharacter); return false; }
+			u32 value = 0;
+			for (uxx hIndex = 1; hIndex <= numHexChars; hIndex++) { value = (value << 4) | GetHexCharValue(rawStr.chars[cIndex + hIndex]); }
+			cIndex += numHexChars;
+			if (escapedChar == 'x') { chars[outLength++] = (char)value; }
+			else
+			{
+				if (value > UTF8_MAX_CODEPOINT || (value >= 0xD800 && value <= 0xDFFF)) { SetOptionalOutPntr(errorOut, Result_InvalidCharacter); return false; }
+				outLength += GetUtf8BytesForCode(value, (u8*)&chars[outLength], false);
+			}
+		}
+	}
+	*strOut = NewStr8(outLength, chars);
+	return true;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_TOKENIZER_H
@@ -0,0 +1,630 @@
+/*
+File:   misc_tween.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** A TweenManager owns any number of active tweens, each one animating an r32 from a start value
+	** to an end value over some duration with an EasingStyle (or along an AnimCurve of keyframes).
+	** Tweens are stored as a structure-of-arrays, grouped by EasingStyle, so UpdateTweens can run
+	** each step (advance time, EaseArray, Lerp, write targets) as a tight loop over contiguous memory
+	** rather than visiting thousands of scattered structs one at a time.
+	** Tweens are referred to by TweenHandles (index + generation) so the dense arrays can be
+	** reordered freely and stale handles from finished tweens are detected rather than aliasing.
+	** Finished tweens are not reported inline, they are collected in manager->finished during
+	** UpdateTweens and the caller can walk that list (or call DispatchFinishedTweens) whenever it's safe.
+	** Time is unitless, use the same units (ms or seconds) for durations, delays, keyframe times and deltaTime.
+*/
+
+/*
+* Usage Example:
+*	TweenManager tweens;
+*	InitTweenManager(&tweens, stdHeap);
+*	AddTween(&tweens, &button->alpha, 0.0f, 1.0f, 250.0f, EasingStyle_CubicOut);
+*	//Once per frame:
+*	UpdateTweens(&tweens, deltaMs);
+*	DispatchFinishedTweens(&tweens);
+*/
+
+#ifndef _MISC_TWEEN_H
+#define _MISC_TWEEN_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_math.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+#include "struct/struct_var_array.h"
+#include "misc/misc_easing.h"
+
+#define TWEEN_MANAGER_MIN_CAPACITY 64
+#define TWEEN_INVALID_INDEX        UINT32_MAX
+#define ANIM_CURVE_MIN_CAPACITY    8
+
+typedef struct TweenHandle TweenHandle;
+struct TweenHandle
+{
+	u32 index; //index into slots, not the dense arrays
+	u32 generation; //0 is never a valid generation so a ZEROED handle is always invalid
+};
+
+#define TWEEN_FINISHED_CALLBACK_DEF(functionName) void functionName(TweenHandle handle, r32 finalValue, void* contextPntr)
+typedef TWEEN_FINISHED_CALLBACK_DEF(TweenFinishedCallback_f);
+
+typedef struct TweenFinished TweenFinished;
+struct TweenFinished
+{
+	TweenHandle handle; //already invalid by the time you see this, useful for comparing against handles you stored
+	r32 finalValue;
+	TweenFinishedCallback_f* callback; //may be nullptr
+	void* contextPntr;
+};
+
+typedef struct TweenSlot TweenSlot;
+struct TweenSlot
+{
+	u32 denseIndex; //TWEEN_INVALID_INDEX when the slot is free
+	u32 generation;
+	u32 nextFreeIndex; //only meaningful when the slot is free
+};
+
+//A keyframe's style is used for the segment between it and the next keyframe (EasingStyle_None is treated as Linear), the last keyframe's style is unused
+typedef struct AnimKeyframe AnimKeyframe;
+struct AnimKeyframe
+{
+	r32 value;
+	EasingStyle style;
+};
+
+typedef struct AnimCurve AnimCurve;
+struct AnimCurve
+{
+	Arena* arena; //doubles as IsInit check
+	uxx numKeyframes;
+	uxx allocKeyframes;
+	r32* times; //kept separate from keyframes (and always sorted) so the binary search only touches the times
+	AnimKeyframe* keyframes;
+};
+
+typedef struct TweenManager TweenManager;
+struct TweenManager
+{
+	Arena* arena; //doubles as IsInit check
+	
+	//Dense structure-of-arrays, [0, numTweens) are live. Sorted by style so each style is one contiguous run:
+	//style s lives in [styleStarts[s], styleStarts[s+1]). EasingStyle_None holds the tweens that follow an AnimCurve
+	uxx numTweens;
+	uxx capacity;
+	u32 styleStarts[EasingStyle_NumStyles+1];
+	r32* startValues;
+	r32* endValues;
+	r32* durations;
+	r32* invDurations;
+	r32* elapsed; //starts at -delay
+	r32* progress; //written every UpdateTweens, the eased [0, 1] amount (unused for curve tweens)
+	r32* values; //the most recent value, also written to targets[i] when that isn't nullptr
+	r32** targets;
+	const AnimCurve** curves;
+	TweenFinishedCallback_f** callbacks;
+	void** contextPntrs;
+	u32* slotIndices;
+	
+	u32 numSlots;
+	u32 allocSlots;
+	u32 firstFreeSlot; //TWEEN_INVALID_INDEX if there are no free slots
+	TweenSlot* slots;
+	
+	VarArray finished; //TweenFinished, cleared at the start of every UpdateTweens
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	void InitAnimCurve(AnimCurve* curve, Arena* arena);
+	PIG_CORE_INLINE bool IsAnimCurveInit(const AnimCurve* curve);
+	void FreeAnimCurve(AnimCurve* curve);
+	void AddAnimCurveKeyframe(AnimCurve* curve, r32 time, r32 value, EasingStyle styleToNext);
+	PIG_CORE_INLINE r32 GetAnimCurveDuration(const AnimCurve* curve);
+	PIG_CORE_INLINE uxx FindAnimCurveSegment(const AnimCurve* curve, r32 time);
+	PIG_CORE_INLINE r32 EvaluateAnimCurve(const AnimCurve* curve, r32 time);
+	void InitTweenManager(TweenManager* manager, Arena* arena);
+	PIG_CORE_INLINE bool IsTweenManagerInit(const TweenManager* manager);
+	void FreeTweenManager(TweenManager* manager);
+	void TweenManagerGrow(TweenManager* manager, uxx minCapacity);
+	PIG_CORE_INLINE void TweenManagerMoveDense_(TweenManager* manager, u32 fromIndex, u32 toIndex);
+	PIG_CORE_INLINE u32 TweenManagerOpenDenseHole_(TweenManager* manager, EasingStyle style);
+	PIG_CORE_INLINE void TweenManagerCloseDenseHole_(TweenManager* manager, u32 denseIndex, EasingStyle style);
+	PIG_CORE_INLINE EasingStyle GetTweenDenseStyle_(const TweenManager* manager, u32 denseIndex);
+	PIG_CORE_INLINE void TweenManagerRemove_(TweenManager* manager, u32 denseIndex, bool addToFinished);
+	PIG_CORE_INLINE bool IsTweenHandleValid(const TweenManager* manager, TweenHandle handle);
+	PIG_CORE_INLINE bool IsTweenActive(const TweenManager* manager, TweenHandle handle);
+	PIG_CORE_INLINE r32 GetTweenValue(const TweenManager* manager, TweenHandle handle, r32 defaultValue);
+	TweenHandle AddTweenEx(TweenManager* manager, r32* target, r32 startValue, r32 endValue, r32 duration, r32 delay, EasingStyle style, const AnimCurve* curve, TweenFinishedCallback_f* callback, void* contextPntr);
+	PIG_CORE_INLINE TweenHandle AddTween(TweenManager* manager, r32* target, r32 startValue, r32 endValue, r32 duration, EasingStyle style);
+	PIG_CORE_INLINE TweenHandle AddCurveTween(TweenManager* manager, r32* target, const AnimCurve* curve, r32 delay);
+	bool StopTween(TweenManager* manager, TweenHandle handle, bool snapToEnd);
+	void StopAllTweens(TweenManager* manager);
+	void UpdateTweens(TweenManager* manager, r32 deltaTime);
+	void DispatchFinishedTweens(TweenManager* manager);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+// +==============================+
+// |          AnimCurve           |
+// +==============================+
+PEXP void InitAnimCurve(AnimCurve* curve, Arena* arena)
+{
+	NotNull(curve);
+	NotNull(arena);
+	ClearPointer(curve);
+	curve->arena = arena;
+}
+
+PEXPI bool IsAnimCurveInit(const AnimCurve* curve)
+{
+	return (curve->arena != nullptr);
+}
+
+PEXP void FreeAnimCurve(AnimCurve* curve)
+{
+	NotNull(curve);
+	if (curve->arena != nullptr && curve->allocKeyframes > 0 && CanArenaFree(curve->arena))
+	{
+		FreeMem(curve->arena, curve->times, sizeof(r32) * curve->allocKeyframes);
+		FreeMem(curve->arena, curve->keyframes, sizeof(AnimKeyframe) * curve->allocKeyframes);
+	}
+	ClearPointer(curve);
+}
+
+//Keyframes can be added in any order, a keyframe at the same time as an existing one is inserted after it (making a step)
+PEXP void AddAnimCurveKeyframe(AnimCurve* curve, r32 time, r32 value, EasingStyle styleToNext)
+{
+	NotNull(curve);
+	Assert(IsAnimCurveInit(curve));
+	if (curve->numKeyframes >= curve->allocKeyframes)
+	{
+		uxx newAllocKeyframes = (curve->allocKeyframes > 0) ? curve->allocKeyframes * 2 : ANIM_CURVE_MIN_CAPACITY;
+		r32* newTimes = AllocArray(r32, curve->arena, newAllocKeyframes);
+		AnimKeyframe* newKeyframes = AllocArray(AnimKeyframe, curve->arena, newAllocKeyframes);
+		NotNull(newTimes);
+		NotNull(newKeyframes);
+		if (curve->allocKeyframes > 0)
+		{
+			MyMemCopy(newTimes, curve->times, sizeof(r32) * curve->numKeyframes);
+			MyMemCopy(newKeyframes, curve->keyframes, sizeof(AnimKeyframe) * curve->numKeyframes);
+			if (CanArenaFree(curve->arena))
+			{
+				FreeMem(curve->arena, curve->times, sizeof(r32) * curve->allocKeyframes);
+				FreeMem(curve->arena, curve->keyframes, sizeof(AnimKeyframe) * curve->allocKeyframes);
+			}
+		}
+		curve->times = newTimes;
+		curve->keyframes = newKeyframes;
+		curve->allocKeyframes = newAllocKeyframes;
+	}
+	
+	uxx insertIndex = curve->numKeyframes;
+	while (insertIndex > 0 && curve->times[insertIndex-1] > time) { insertIndex--; }
+	if (insertIndex < curve->numKeyframes)
+	{
+		MyMemMove(&curve->times[insertIndex+1], &curve->times[insertIndex], sizeof(r32) * (curve->numKeyframes - insertIndex));
+		MyMemMove(&curve->keyframes[insertIndex+1], &curve->keyframes[insertIndex], sizeof(AnimKeyframe) * (curve->numKeyframes - insertIndex));
+	}
+	curve->times[insertIndex] = time;
+	curve->keyframes[insertIndex].value = value;
+	curve->keyframes[insertIndex].style = styleToNext;
+	curve->numKeyframes++;
+}
+
+PEXPI r32 GetAnimCurveDuration(const AnimCurve* curve)
+{
+	return (curve->numKeyframes > 0) ? curve->times[curve->numKeyframes-1] : 0.0f;
+}
+
+//Returns the index of the keyframe that starts the segment containing time (the last keyframe with times[i] <= time)
+//Times before the first keyframe return 0. Requires at least one keyframe
+PEXPI uxx FindAnimCurveSegment(const AnimCurve* curve, r32 time)
+{
+	DebugAssert(curve->numKeyframes > 0);
+	uxx low = 0;
+	uxx high = curve->numKeyframes; //search for the first keyframe with times[i] > time in [low, high)
+	while (low < high)
+	{
+		uxx middle = low + (high - low) / 2;
+		if (curve->times[middle] <= time) { low = middle + 1; }
+		else { high = middle; }
+	}
+	return (low > 0) ? low - 1 : 0;
+}
+
+//Times outside the keyframes hold the first/last value
+PEXPI r32 EvaluateAnimCurve(const AnimCurve* curve, r32 time)
+{
+	DebugNotNull(curve);
+	if (curve->numKeyframes == 0) { return 0.0f; }
+	if (time <= curve->times[0]) { return curve->keyframes[0].value; }
+	if (time >= curve->times[curve->numKeyframes-1]) { return curve->keyframes[curve->numKeyframes-1].value; }
+	uxx segmentIndex = FindAnimCurveSegment(curve, time);
+	const AnimKeyframe* startKey = &curve->keyframes[segmentIndex];
+	const AnimKeyframe* endKey = &curve->keyframes[segmentIndex+1];
+	r32 segmentLength = curve->times[segmentIndex+1] - curve->times[segmentIndex];
+	r32 amount = (segmentLength > 0.0f) ? (time - curve->times[segmentIndex]) / segmentLength : 1.0f;
+	if (startKey->style != EasingStyle_None) { amount = Ease(startKey->style, amount); }
+	return LerpR32(startKey->value, endKey->value, amount);
+}
+
+// +==============================+
+// |     TweenManager Helpers     |
+// +==============================+
+PEXP void InitTweenManager(TweenManager* manager, Arena* arena)
+{
+	NotNull(manager);
+	NotNull(arena);
+	ClearPointer(manager);
+	manager->arena = arena;
+	manager->firstFreeSlot = TWEEN_INVALID_INDEX;
+	InitVarArray(TweenFinished, &manager->finished, arena);
+}
+
+PEXPI bool IsTweenManagerInit(const TweenManager* manager)
+{
+	return (manager->arena != nullptr);
+}
+
+#define TweenManagerDenseArrays_(action)                               \
+	action(r32, startValues)                                           \
+	action(r32, endValues)                                             \
+	action(r32, durations)                                             \
+	action(r32, invDurations)                                          \
+	action(r32, elapsed)                                               \
+	action(r32, progress)                                              \
+	action(r32, values)                                                \
+	action(r32*, targets)                                              \
+	action(const AnimCurve*, curves)                                   \
+	action(TweenFinishedCallback_f*, callbacks)                        \
+	action(void*, contextPntrs)                                        \
+	action(u32, slotIndices)
+
+PEXP void FreeTweenManager(TweenManager* manager)
+{
+	NotNull(manager);
+	if (manager->arena != nullptr)
+	{
+		if (CanArenaFree(manager->arena))
+		{
+			if (manager->capacity > 0)
+			{
+				#define TweenManagerFreeArray_(type, name) FreeMem(manager->arena, (void*)manager->name, sizeof(type) * manager->capacity);
+				TweenManagerDenseArrays_(TweenManagerFreeArray_)
+				#undef TweenManagerFreeArray_
+			}
+			if (manager->slots != nullptr) { FreeMem(manager->arena, manager->slots, sizeof(TweenSlot) * manager->allocSlots); }
+		}
+		FreeVarArray(&manager->finished);
+	}
+	ClearPointer(manager);
+}
+
+PEXP void TweenManagerGrow(TweenManager* manager, uxx minCapacity)
+{
+	NotNull(manager);
+	Assert(IsTweenManagerInit(manager));
+	if (manager->capacity >= minCapacity) { return; }
+	uxx newCapacity = MaxUXX(manager->capacity, TWEEN_MANAGER_MIN_CAPACITY);
+	while (newCapacity < minCapacity) { newCapacity *= 2; }
+	Assert(newCapacity < TWEEN_INVALID_INDEX);
+	
+	#define TweenManagerGrowArray_(type, name) do                                                       \
+	{                                                                                                   \
+		type* newArray = AllocArray(type, manager->arena, newCapacity);                                 \
+		NotNull(newArray);                                                                              \
+		if (manager->capacity > 0)                                                                      \
+		{                                                                                               \
+			MyMemCopy((void*)newArray, (void*)manager->name, sizeof(type) * manager->numTweens);        \
+			if (CanArenaFree(manager->arena)) { FreeMem(manager->arena, (void*)manager->name, sizeof(type) * manager->capacity); } \
+		}                                                                                               \
+		manager->name = newArray;                                                                       \
+	} while(0);
+	TweenManagerDenseArrays_(TweenManagerGrowArray_)
+	#undef TweenManagerGrowArray_
+	manager->capacity = newCapacity;
+}
+
+//Copies every dense array entry at fromIndex to toIndex and points the owning slot at its new home
+PEXPI void TweenManagerMoveDense_(TweenManager* manager, u32 fromIndex, u32 toIndex)
+{
+	if (fromIndex == toIndex) { return; }
+	#define TweenManagerMoveEntry_(type, name) manager->name[toIndex] = manager->name[fromIndex];
+	TweenManagerDenseArrays_(TweenManagerMoveEntry_)
+	#undef TweenManagerMoveEntry_
+	manager->slots[manager->slotIndices[toIndex]].denseIndex = toIndex;
+}
+
+//Opens a hole at the end of style's run by moving the first entry of every later run to the end of that run. Returns the index of the hole
+PEXPI u32 TweenManagerOpenDenseHole_(TweenManager* manager, EasingStyle style)
+{
+	u32 holeIndex = manager->styleStarts[EasingStyle_NumStyles];
+	for (uxx sIndex = EasingStyle_NumStyles-1; sIndex > (uxx)style; sIndex--)
+	{
+		if (manager->styleStarts[sIndex] != manager->styleStarts[sIndex+1])
+		{
+			TweenManagerMoveDense_(manager, manager->styleStarts[sIndex], holeIndex);
+		}
+		holeIndex = manager->styleStarts[sIndex];
+		manager->styleStarts[sIndex+1]++;
+	}
+	manager->styleStarts[style+1]++;
+	manager->numTweens++;
+	return holeIndex;
+}
+
+//The reverse of TweenManagerOpenDenseHole_, fills denseIndex with the last entry of its run and then shuffles each later run down by one
+PEXPI void TweenManagerCloseDenseHole_(TweenManager* manager, u32 denseIndex, EasingStyle style)
+{
+	u32 lastInRun = manager->styleStarts[style+1] - 1;
+	TweenManagerMoveDense_(manager, lastInRun, denseIndex);
+	u32 holeIndex = lastInRun;
+	for (uxx sIndex = (uxx)style+1; sIndex < EasingStyle_NumStyles; sIndex++)
+	{
+		if (manager->styleStarts[sIndex] != manager->styleStarts[sIndex+1])
+		{
+			u32 lastIndex = manager->styleStarts[sIndex+1] - 1;
+			TweenManagerMoveDense_(manager, lastIndex, holeIndex);
+			holeIndex = lastIndex;
+		}
+		manager->styleStarts[sIndex]--;
+	}
+	manager->styleStarts[EasingStyle_NumStyles]--;
+	manager->numTweens--;
+}
+
+PEXPI EasingStyle GetTweenDenseStyle_(const TweenManager* manager, u32 denseIndex)
+{
+	//Binary search would work too but there are only EasingStyle_NumStyles runs
+	uxx sIndex = 0;
+	while (manager->styleStarts[sIndex+1] <= denseIndex) { sIndex++; }
+	return (EasingStyle)sIndex;
+}
+
+//Releases the slot and removes the dense entry, appending a TweenFinished if wanted
+PEXPI void TweenManagerRemove_(TweenManager* manager, u32 denseIndex, bool addToFinished)
+{
+	u32 slotIndex = manager->slotIndices[denseIndex];
+	TweenSlot* slot = &manager->slots[slotIndex];
+	if (addToFinished)
+	{
+		TweenFinished* finished = VarArrayAdd(TweenFinished, &manager->finished);
+		NotNull(finished);
+		finished->handle.index = slotIndex;
+		finished->handle.generation = slot->generation;
+		finished->finalValue = manager->values[denseIndex];
+		finished->callback = manager->callbacks[denseIndex];
+		finished->contextPntr = manager->contextPntrs[denseIndex];
+	}
+	slot->denseIndex = TWEEN_INVALID_INDEX;
+	slot->nextFreeIndex = manager->firstFreeSlot;
+	manager->firstFreeSlot = slotIndex;
+	TweenManagerCloseDenseHole_(manager, denseIndex, GetTweenDenseStyle_(manager, denseIndex));
+}
+
+// +==============================+
+// |         TweenManager         |
+// +==============================+
+PEXPI bool IsTweenHandleValid(const TweenManager* manager, TweenHandle handle)
+{
+	if (handle.generation == 0 || handle.index >= manager->numSlots) { return false; }
+	const TweenSlot* slot = &manager->slots[handle.index];
+	return (slot->generation == handle.generation && slot->denseIndex != TWEEN_INVALID_INDEX);
+}
+PEXPI bool IsTweenActive(const TweenManager* manager, TweenHandle handle) { return IsTweenHandleValid(manager, handle); }
+
+PEXPI r32 GetTweenValue(const TweenManager* manager, TweenHandle handle, r32 defaultValue)
+{
+	if (!IsTweenHandleValid(manager, handle)) { return defaultValue; }
+	return manager->values[manager->slots[handle.index].denseIndex];
+}
+
+//curve is only used when style is EasingStyle_None, in which case startValue, endValue and duration are ignored and the
+//tween runs for the curve's duration. The AnimCurve must stay alive (and unchanged) until the tween is finished
+PEXP TweenHandle AddTweenEx(TweenManager* manager, r32* target, r32 startValue, r32 endValue, r32 duration, r32 delay, EasingStyle style, const AnimCurve* curve, TweenFinishedCallback_f* callback, void* contextPntr)
+{
+	NotNull(manager);
+	Assert(IsTweenManagerInit(manager));
+	Assert(style >= EasingStyle_None && style < EasingStyle_NumStyles);
+	Assert(style != EasingStyle_None || (curve != nullptr && curve->numKeyframes > 0));
+	if (style == EasingStyle_None)
+	{
+		startValue = curve->keyframes[0].value;
+		endValue = curve->keyframes[curve->numKeyframes-1].value;
+		duration = GetAnimCurveDuration(curve);
+	}
+	else { curve = nullptr; }
+	
+	u32 slotIndex = manager->firstFreeSlot;
+	if (slotIndex != TWEEN_INVALID_INDEX)
+	{
+		manager->firstFreeSlot = manager->slots[slotIndex].nextFreeIndex;
+	}
+	else
+	{
+		if (manager->numSlots >= manager->allocSlots)
+		{
+			u32 newAllocSlots = (manager->allocSlots > 0) ? manager->allocSlots * 2 : TWEEN_MANAGER_MIN_CAPACITY;
+			TweenSlot* newSlots = AllocArray(TweenSlot, manager->arena, newAllocSlots);
+			NotNull(newSlots);
+			if (manager->slots != nullptr)
+			{
+				MyMemCopy(newSlots, manager->slots, sizeof(TweenSlot) * manager->numSlots);
+				if (CanArenaFree(manager->arena)) { FreeMem(manager->arena, manager->slots, sizeof(TweenSlot) * manager->allocSlots); }
+			}
+			manager->slots = newSlots;
+			manager->allocSlots = newAllocSlots;
+		}
+		slotIndex = manager->numSlots;
+		manager->numSlots++;
+		manager->slots[slotIndex].generation = 0;
+	}
+	
+	TweenManagerGrow(manager, manager->numTweens+1);
+	u32 denseIndex = TweenManagerOpenDenseHole_(manager, style);
+	TweenSlot* slot = &manager->slots[slotIndex];
+	slot->generation++;
+	if (slot->generation == 0) { slot->generation = 1; }
+	slot->denseIndex = denseIndex;
+	slot->nextFreeIndex = TWEEN_INVALID_INDEX;
+	
+	manager->startValues[denseIndex] = startValue;
+	manager->endValues[denseIndex] = endValue;
+	manager->durations[denseIndex] = MaxR32(duration, 0.0f);
+	manager->invDurations[denseIndex] = (duration > 0.0f) ? (1.0f / duration) : 0.0f;
+	manager->elapsed[denseIndex] = -MaxR32(delay, 0.0f);
+	manager->progress[denseIndex] = 0.0f;
+	manager->values[denseIndex] = startValue;
+	manager->targets[denseIndex] = target;
+	manager->curves[denseIndex] = curve;
+	manager->callbacks[denseIndex] = callback;
+	manager->contextPntrs[denseIndex] = contextPntr;
+	manager->slotIndices[denseIndex] = slotIndex;
+	if (target != nullptr) { *target = startValue; }
+	
+	TweenHandle result = ZEROED;
+	result.index = slotIndex;
+	result.generation = slot->generation;
+	return result;
+}
+
+PEXPI TweenHandle AddTween(TweenManager* manager, r32* target, r32 startValue, r32 endValue, r32 duration, EasingStyle style)
+{
+	Assert(style != EasingStyle_None);
+	return AddTweenEx(manager, target, startValue, endValue, duration, 0.0f, style, nullptr, nullptr, nullptr);
+}
+PEXPI TweenHandle AddCurveTween(TweenManager* manager, r32* target, const AnimCurve* curve, r32 delay)
+{
+	return AddTweenEx(manager, target, 0.0f, 0.0f, 0.0f, delay, EasingStyle_None, curve, nullptr, nullptr);
+}
+
+//Stopped tweens don't end up in the finished list. Returns false if the handle was already invalid
+PEXP bool StopTween(TweenManager* manager, TweenHandle handle, bool snapToEnd)
+{
+	NotNull(manager);
+	if (!IsTweenHandleValid(manager, handle)) { return false; }
+	u32 denseIndex = manager->slots[handle.index].denseIndex;
+	if (snapToEnd && manager->targets[denseIndex] != nullptr) { *manager->targets[denseIndex] = manager->endValues[denseIndex]; }
+	TweenManagerRemove_(manager, denseIndex, false);
+	return true;
+}
+
+PEXP void StopAllTweens(TweenManager* manager)
+{
+	NotNull(manager);
+	for (u32 dIndex = 0; dIndex < (u32)manager->numTweens; dIndex++)
+	{
+		u32 slotIndex = manager->slotIndices[dIndex];
+		manager->slots[slotIndex].denseIndex = TWEEN_INVALID_INDEX;
+		manager->slots[slotIndex].nextFreeIndex = manager->firstFreeSlot;
+		manager->firstFreeSlot = slotIndex;
+	}
+	manager->numTweens = 0;
+	MyMemSet(&manager->styleStarts[0], 0x00, sizeof(manager->styleStarts));
+}
+
+PEXP void UpdateTweens(TweenManager* manager, r32 deltaTime)
+{
+	NotNull(manager);
+	Assert(IsTweenManagerInit(manager));
+	VarArrayClear(&manager->finished);
+	uxx numTweens = manager->numTweens;
+	if (numTweens == 0) { return; }
+	
+	//Advance time and find the linear [0, 1] progress of every tween (delayed tweens sit at 0)
+	r32* elapsed = manager->elapsed;
+	r32* progress = manager->progress;
+	const r32* durations = manager->durations;
+	const r32* invDurations = manager->invDurations;
+	uxx tIndex = 0;
+	#if TARGET_HAS_SIMD128
+	SimdR32x4 deltaTimeVec = SimdSplatR32x4(deltaTime);
+	SimdR32x4 zeroVec = SimdSplatR32x4(0.0f);
+	SimdR32x4 oneVec = SimdSplatR32x4(1.0f);
+	for (; tIndex + 4 <= numTweens; tIndex += 4)
+	{
+		SimdR32x4 newElapsed = SimdAddR32x4(SimdLoadR32x4(&elapsed[tIndex]), deltaTimeVec);
+		SimdStoreR32x4(&elapsed[tIndex], newElapsed);
+		SimdU32x4 isRunning = SimdGreaterR32x4(SimdLoadR32x4(&durations[tIndex]), newElapsed);
+		SimdR32x4 linearProgress = SimdMulR32x4(SimdMaxR32x4(newElapsed, zeroVec), SimdLoadR32x4(&invDurations[tIndex]));
+		SimdStoreR32x4(&progress[tIndex], SimdSelectR32x4(isRunning, linearProgress, oneVec));
+	}
+	#endif
+	for (; tIndex < numTweens; tIndex++)
+	{
+		r32 newElapsed = elapsed[tIndex] + deltaTime;
+		elapsed[tIndex] = newElapsed;
+		progress[tIndex] = (durations[tIndex] > newElapsed) ? MaxR32(newElapsed, 0.0f) * invDurations[tIndex] : 1.0f;
+	}
+	
+	//Ease each style's run in place
+	for (uxx sIndex = EasingStyle_None+1; sIndex < EasingStyle_NumStyles; sIndex++)
+	{
+		uxx runStart = manager->styleStarts[sIndex];
+		uxx runEnd = manager->styleStarts[sIndex+1];
+		if (runStart < runEnd) { EaseArray((EasingStyle)sIndex, &progress[runStart], &progress[runStart], runEnd - runStart); }
+	}
+	
+	//Find the values and write them out to the targets (the targets are scattered so this part has to be scalar)
+	r32* values = manager->values;
+	r32** targets = manager->targets;
+	const r32* startValues = manager->startValues;
+	const r32* endValues = manager->endValues;
+	uxx numCurveTweens = manager->styleStarts[EasingStyle_None+1];
+	uxx numFinished = 0;
+	for (tIndex = 0; tIndex < numCurveTweens; tIndex++)
+	{
+		r32 value = EvaluateAnimCurve(manager->curves[tIndex], elapsed[tIndex]);
+		values[tIndex] = value;
+		if (targets[tIndex] != nullptr) { *targets[tIndex] = value; }
+		if (elapsed[tIndex] >= durations[tIndex]) { numFinished++; }
+	}
+	for (; tIndex < numTweens; tIndex++)
+	{
+		r32 value = LerpR32(startValues[tIndex], endValues[tIndex], progress[tIndex]);
+		values[tIndex] = value;
+		if (targets[tIndex] != nullptr) { *targets[tIndex] = value; }
+		if (elapsed[tIndex] >= durations[tIndex]) { numFinished++; }
+	}
+	
+	//Walking backwards means every entry that gets moved into tIndex by a removal has already been visited
+	for (tIndex = numTweens; tIndex > 0 && numFinished > 0; tIndex--)
+	{
+		if (elapsed[tIndex-1] >= durations[tIndex-1])
+		{
+			TweenManagerRemove_(manager, (u32)(tIndex-1), true);
+			numFinished--;
+		}
+	}
+}
+
+//Calls the callback of every entry in the finished list (in the order they were collected) and then clears it.
+//It's safe for callbacks to add new tweens, but they won't be dispatched until the next UpdateTweens
+PEXP void DispatchFinishedTweens(TweenManager* manager)
+{
+	NotNull(manager);
+	for (uxx fIndex = 0; fIndex < manager->finished.length; fIndex++)
+	{
+		TweenFinished finished = *VarArrayGet(TweenFinished, &manager->finished, fIndex);
+		if (finished.callback != nullptr) { finished.callback(finished.handle, finished.finalValue, finished.contextPntr); }
+	}
+	VarArrayClear(&manager->finished);
+}
+
+#undef TweenManagerDenseArrays_
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _MISC_TWEEN_H
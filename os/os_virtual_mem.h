@@ -31,6 +31,7 @@ Description:
 	uxx OsGetMemoryPageSize();
 	void* OsReserveMemory(uxx numBytes);
 	void OsCommitReservedMemory(void* memoryPntr, uxx numBytes);
+	void OsProtectMemory(void* memoryPntr, uxx numBytes, bool readOnly);
 	void OsFreeReservedMemory(void* memoryPntr, uxx reservedSize);
 #endif //!PIG_CORE_IMPLEMENTATION
 
@@ -151,6 +152,41 @@ PEXP void OsCommitReservedMemory(void* memoryPntr, uxx numBytes)
 	#endif
 }
 
+//NOTE: numBytes must be a multiple of memory page size, memoryPntr must be aligned to the beginning of a page, and the memory must already be committed
+PEXP void OsProtectMemory(void* memoryPntr, uxx numBytes, bool readOnly)
+{
+	if (numBytes == 0) { return; }
+	uxx pageSize = OsGetMemoryPageSize();
+	NotNull(memoryPntr);
+	Assert((uxx)memoryPntr % pageSize == 0);
+	Assert(numBytes % pageSize == 0);
+	
+	#if TARGET_IS_WINDOWS
+	{
+		DWORD oldProtection = 0;
+		BOOL protectResult = VirtualProtect(
+			memoryPntr, //lpAddress
+			numBytes, //dwSize
+			readOnly ? PAGE_READONLY : PAGE_READWRITE, //flNewProtect
+			&oldProtection //lpflOldProtect
+		);
+		Assert(protectResult != 0); //TODO: Handle errors, call GetLastError and return an OsError_t
+	}
+	#elif (TARGET_IS_LINUX || TARGET_IS_OSX)
+	{
+		int protectResult = mprotect(
+			memoryPntr,
+			numBytes,
+			readOnly ? PROT_READ : (PROT_READ|PROT_WRITE)
+		);
+		Assert(protectResult == 0); //TODO: Handle errors, check errno and return an OsError_t
+	}
+	#else
+	UNUSED(readOnly);
+	AssertMsg(false, "OsProtectMemory is not supported on the current TARGET!");
+	#endif
+}
+
 PEXP void OsFreeReservedMemory(void* memoryPntr, uxx reservedSize)
 {
 	Assert((memoryPntr == nullptr) == (reservedSize == 0));
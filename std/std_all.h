@@ -25,6 +25,9 @@ Description:
 
 #include "std/std_malloc.h"
 #include "std/std_memset.h"
+#include "base/base_assert.h" //required by std_mem_search.h
+#include "base/base_simd.h" //required by std_mem_search.h
+#include "std/std_mem_search.h"
 #include "std/std_printf.h"
 #include "std/std_basic_math.h"
 #include "std/std_angles.h"
@@ -60,6 +60,8 @@ Date:   01\05\2025
 	PIG_CORE_INLINE i64 CeilR64i(r64 value);
 	PIG_CORE_INLINE r32 PowR32(r32 value, r32 power);
 	PIG_CORE_INLINE r64 PowR64(r64 value, r64 power);
+	PIG_CORE_INLINE r32 ExpR32(r32 value);
+	PIG_CORE_INLINE r64 ExpR64(r64 value);
 	PIG_CORE_INLINE r32 LnR32(r32 value);
 	PIG_CORE_INLINE r64 LnR64(r64 value);
 	PIG_CORE_INLINE r32 Log2R32(r32 value);
@@ -200,6 +202,8 @@ PEXPI i64 CeilR64i(r64 value) { return (i64)ceil(value); }
 
 PEXPI r32 PowR32(r32 value, r32 power) { return powf(value, power); }
 PEXPI r64 PowR64(r64 value, r64 power) { return pow(value, power); }
+PEXPI r32 ExpR32(r32 value) { return expf(value); }
+PEXPI r64 ExpR64(r64 value) { return exp(value); }
 
 PEXPI r32 LnR32(r32 value) { return logf(value); }
 PEXPI r64 LnR64(r64 value) { return log(value); }
@@ -0,0 +1,217 @@
+/*
+File:   std_mem_search.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Contains memchr\memmem-like search routines that use SIMD instructions (SSE2\AVX2, NEON, or WASM SIMD128)
+	** when they are available, with a scalar fallback otherwise. These are the kernels that
+	** StrExactContains, StrAnyCaseContains, FindNextCharInStr, etc. are routed through.
+	** Substring search compares the first and last byte of the needle against 16 (or 32)
+	** positions at once and only does a full comparison for positions where both match,
+	** which rejects almost every position in real text without looking at the rest of the needle.
+	** NOTE: All of these return haystackLength when nothing is found
+	** NOTE: "AnyCase" here only folds ASCII letters, bytes >= 0x80 are compared exactly
+*/
+
+#ifndef _STD_MEM_SEARCH_H
+#define _STD_MEM_SEARCH_H
+
+#include "base/base_compiler_check.h"
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_simd.h"
+#include "std/std_includes.h"
+#include "std/std_memset.h"
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE u8 MemSearchOtherCase(u8 value);
+	bool MemEqualsAnyCase(const void* left, const void* right, uxx length);
+	uxx MemFindByte(const void* haystack, uxx haystackLength, u8 value);
+	uxx MemFindBytesEx(const void* haystack, uxx haystackLength, const void* needle, uxx needleLength, bool anyCase);
+	PIG_CORE_INLINE uxx MemFindBytes(const void* haystack, uxx haystackLength, const void* needle, uxx needleLength);
+	PIG_CORE_INLINE uxx MemFindBytesAnyCase(const void* haystack, uxx haystackLength, const void* needle, uxx needleLength);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+//Returns the other case for ASCII letters, or the same value for everything else
+PEXPI u8 MemSearchOtherCase(u8 value)
+{
+	if (value >= 'a' && value <= 'z') { return value - ('a' - 'A'); }
+	if (value >= 'A' && value <= 'Z') { return value + ('a' - 'A'); }
+	return value;
+}
+
+// +==============================+
+// |           Searches           |
+// +==============================+
+PEXP bool MemEqualsAnyCase(const void* left, const void* right, uxx length)
+{
+	const u8* leftBytes = (const u8*)left;
+	const u8* rightBytes = (const u8*)right;
+	uxx bIndex = 0;
+	#if TARGET_HAS_SIMD128
+	{
+		//Two bytes are equal (ignoring case) if they are identical, or they differ only in bit 0x20 and (left | 0x20) is in 'a'-'z'
+		SimdU8x16 caseBitVec = SimdSplatU8x16(0x20);
+		SimdU8x16 lowerAVec = SimdSplatU8x16('a');
+		SimdU8x16 lowerZVec = SimdSplatU8x16('z');
+		SimdU8x16 zeroVec = SimdSplatU8x16(0x00);
+		SimdU8x16 allOnesVec = SimdSplatU8x16(0xFF);
+		for (; bIndex + 16 <= length; bIndex += 16)
+		{
+			SimdU8x16 leftBlock = SimdLoadU8x16(leftBytes + bIndex);
+			SimdU8x16 difference = SimdXorU8x16(leftBlock, SimdLoadU8x16(rightBytes + bIndex));
+			SimdU8x16 leftLower = SimdOrU8x16(leftBlock, caseBitVec);
+			SimdU8x16 isLetter = SimdAndU8x16(SimdEqualsU8x16(SimdSubSatU8x16(leftLower, lowerZVec), zeroVec), SimdEqualsU8x16(SimdSubSatU8x16(lowerAVec, leftLower), zeroVec));
+			SimdU8x16 isEqual = SimdOrU8x16(SimdEqualsU8x16(difference, zeroVec), SimdAndU8x16(SimdEqualsU8x16(difference, caseBitVec), isLetter));
+			if (SimdAnyHighBitU8x16(SimdXorU8x16(isEqual, allOnesVec))) { return false; }
+		}
+	}
+	#endif
+	for (; bIndex < length; bIndex++)
+	{
+		u8 leftByte = leftBytes[bIndex];
+		u8 rightByte = rightBytes[bIndex];
+		if (leftByte != rightByte && MemSearchOtherCase(leftByte) != rightByte) { return false; }
+	}
+	return true;
+}
+
+PEXP uxx MemFindByte(const void* haystack, uxx haystackLength, u8 value)
+{
+	const u8* bytes = (const u8*)haystack;
+	uxx bIndex = 0;
+	#if TARGET_HAS_AVX2
+	{
+		__m256i valueVec = _mm256_set1_epi8((char)value);
+		for (; bIndex + 32 <= haystackLength; bIndex += 32)
+		{
+			u32 mask = (u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(bytes + bIndex)), valueVec));
+			if (mask != 0) { return bIndex + CountTrailingZerosU32(mask); }
+		}
+	}
+	#endif
+	#if TARGET_HAS_SIMD128
+	{
+		SimdU8x16 valueVec = SimdSplatU8x16(value);
+		for (; bIndex + 16 <= haystackLength; bIndex += 16)
+		{
+			u64 mask = SimdHighBitMaskU8x16(SimdEqualsU8x16(SimdLoadU8x16(bytes + bIndex), valueVec));
+			if (mask != 0) { return bIndex + (CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE); }
+		}
+	}
+	#else
+	{
+		//SWAR: check 8 bytes at a time for a zero byte after XORing with the value
+		u64 valueRepeated = 0x0101010101010101ULL * value;
+		for (; bIndex + 8 <= haystackLength; bIndex += 8)
+		{
+			u64 word = 0;
+			MyMemCopy(&word, bytes + bIndex, sizeof(u64));
+			word ^= valueRepeated;
+			if (((word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL) != 0) { break; }
+		}
+	}
+	#endif
+	for (; bIndex < haystackLength; bIndex++)
+	{
+		if (bytes[bIndex] == value) { return bIndex; }
+	}
+	return haystackLength;
+}
+
+PEXP uxx MemFindBytesEx(const void* haystack, uxx haystackLength, const void* needle, uxx needleLength, bool anyCase)
+{
+	Assert(needleLength == 0 || needle != nullptr);
+	if (needleLength == 0) { return 0; }
+	if (needleLength > haystackLength) { return haystackLength; }
+	const u8* bytes = (const u8*)haystack;
+	const u8* needleBytes = (const u8*)needle;
+	if (needleLength == 1 && (!anyCase || MemSearchOtherCase(needleBytes[0]) == needleBytes[0]))
+	{
+		return MemFindByte(haystack, haystackLength, needleBytes[0]);
+	}
+	
+	u8 firstValue = needleBytes[0];
+	u8 firstValueAlt = anyCase ? MemSearchOtherCase(firstValue) : firstValue;
+	u8 lastValue = needleBytes[needleLength-1];
+	u8 lastValueAlt = anyCase ? MemSearchOtherCase(lastValue) : lastValue;
+	uxx lastOffset = needleLength-1;
+	uxx numPositions = haystackLength - lastOffset; //number of valid starting positions
+	uxx bIndex = 0;
+	
+	#if TARGET_HAS_AVX2
+	{
+		__m256i firstVec = _mm256_set1_epi8((char)firstValue);
+		__m256i firstAltVec = _mm256_set1_epi8((char)firstValueAlt);
+		__m256i lastVec = _mm256_set1_epi8((char)lastValue);
+		__m256i lastAltVec = _mm256_set1_epi8((char)lastValueAlt);
+		for (; bIndex + 32 <= numPositions; bIndex += 32)
+		{
+			__m256i firstBlock = _mm256_loadu_si256((const __m256i*)(bytes + bIndex));
+			__m256i lastBlock = _mm256_loadu_si256((const __m256i*)(bytes + bIndex + lastOffset));
+			__m256i firstEqual = _mm256_or_si256(_mm256_cmpeq_epi8(firstBlock, firstVec), _mm256_cmpeq_epi8(firstBlock, firstAltVec));
+			__m256i lastEqual = _mm256_or_si256(_mm256_cmpeq_epi8(lastBlock, lastVec), _mm256_cmpeq_epi8(lastBlock, lastAltVec));
+			u32 mask = (u32)_mm256_movemask_epi8(_mm256_and_si256(firstEqual, lastEqual));
+			while (mask != 0)
+			{
+				uxx candidateIndex = bIndex + CountTrailingZerosU32(mask);
+				if (needleLength <= 2) { return candidateIndex; }
+				if (anyCase ? MemEqualsAnyCase(bytes + candidateIndex + 1, needleBytes + 1, needleLength - 2) : MyMemEquals(bytes + candidateIndex + 1, needleBytes + 1, needleLength - 2)) { return candidateIndex; }
+				mask &= (mask - 1);
+			}
+		}
+	}
+	#endif
+	#if TARGET_HAS_SIMD128
+	{
+		SimdU8x16 firstVec = SimdSplatU8x16(firstValue);
+		SimdU8x16 firstAltVec = SimdSplatU8x16(firstValueAlt);
+		SimdU8x16 lastVec = SimdSplatU8x16(lastValue);
+		SimdU8x16 lastAltVec = SimdSplatU8x16(lastValueAlt);
+		for (; bIndex + 16 <= numPositions; bIndex += 16)
+		{
+			//Bits are set for positions where the first AND last byte of the needle match
+			SimdU8x16 firstBlock = SimdLoadU8x16(bytes + bIndex);
+			SimdU8x16 lastBlock = SimdLoadU8x16(bytes + bIndex + lastOffset);
+			SimdU8x16 firstEqual = SimdOrU8x16(SimdEqualsU8x16(firstBlock, firstVec), SimdEqualsU8x16(firstBlock, firstAltVec));
+			SimdU8x16 lastEqual = SimdOrU8x16(SimdEqualsU8x16(lastBlock, lastVec), SimdEqualsU8x16(lastBlock, lastAltVec));
+			u64 mask = SimdHighBitMaskU8x16(SimdAndU8x16(firstEqual, lastEqual));
+			while (mask != 0)
+			{
+				uxx byteOffset = CountTrailingZerosU64(mask) / SIMD_MASK_BITS_PER_BYTE;
+				uxx candidateIndex = bIndex + byteOffset;
+				if (needleLength <= 2) { return candidateIndex; }
+				if (anyCase ? MemEqualsAnyCase(bytes + candidateIndex + 1, needleBytes + 1, needleLength - 2) : MyMemEquals(bytes + candidateIndex + 1, needleBytes + 1, needleLength - 2)) { return candidateIndex; }
+				mask &= ~(SIMD_MASK_BYTE_BITS << (byteOffset * SIMD_MASK_BITS_PER_BYTE));
+			}
+		}
+	}
+	#endif
+	for (; bIndex < numPositions; bIndex++)
+	{
+		u8 firstByte = bytes[bIndex];
+		u8 lastByte = bytes[bIndex + lastOffset];
+		if ((firstByte == firstValue || firstByte == firstValueAlt) && (lastByte == lastValue || lastByte == lastValueAlt))
+		{
+			if (needleLength <= 2) { return bIndex; }
+			if (anyCase ? MemEqualsAnyCase(bytes + bIndex + 1, needleBytes + 1, needleLength - 2) : MyMemEquals(bytes + bIndex + 1, needleBytes + 1, needleLength - 2)) { return bIndex; }
+		}
+	}
+	return haystackLength;
+}
+PEXPI uxx MemFindBytes(const void* haystack, uxx haystackLength, const void* needle, uxx needleLength) { return MemFindBytesEx(haystack, haystackLength, needle, needleLength, false); }
+PEXPI uxx MemFindBytesAnyCase(const void* haystack, uxx haystackLength, const void* needle, uxx needleLength) { return MemFindBytesEx(haystack, haystackLength, needle, needleLength, true); }
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _STD_MEM_SEARCH_H
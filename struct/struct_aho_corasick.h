@@ -0,0 +1,482 @@
+/*
+File:   struct_aho_corasick.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Defines AhoCorasick, a compiled multi-pattern matcher that finds all occurrences
+	** of any number of byte patterns in a single pass over the haystack.
+	** Patterns are added first and then compiled into a dense DFA: bytes that appear in
+	** the patterns are each given a "class" (every other byte shares class 0) and every
+	** state gets one transition per class with the failure links already folded in, so
+	** matching is a single table lookup per haystack byte no matter how many patterns.
+	** Each pattern can have a replacement string, AhoCorasickReplace does a single-pass
+	** search and replace of all patterns at once (leftmost-longest, non-overlapping).
+	** NOTE: ignoreCase only folds ASCII letters, same as StrAnyCaseEquals
+	** NOTE: The transition table is numStates*numClasses u32s. numStates is at most the
+	** total length of all patterns + 1, so dozens of short tokens stay small, but large
+	** dictionaries with a wide alphabet will use a lot of memory.
+*/
+
+/*
+* Usage Example:
+*	AhoCorasick matcher;
+*	InitAhoCorasick(&matcher, arena, false);
+*	AhoCorasickAddPattern(&matcher, StrLit("{name}"), StrLit("Taylor"));
+*	AhoCorasickAddPattern(&matcher, StrLit("{game}"), StrLit("Pigglen"));
+*	AhoCorasickCompile(&matcher);
+*	Str8 result = AhoCorasickReplace(&matcher, arena, StrLit("{name} is making {game}"), false);
+*	//result = "Taylor is making Pigglen"
+*/
+
+#ifndef _STRUCT_AHO_CORASICK_H
+#define _STRUCT_AHO_CORASICK_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "std/std_memset.h"
+#include "mem/mem_arena.h"
+#include "mem/mem_scratch.h"
+#include "struct/struct_string.h"
+#include "struct/struct_var_array.h"
+
+// +--------------------------------------------------------------+
+// |                        Data Structure                        |
+// +--------------------------------------------------------------+
+typedef struct AhoCorasickPattern AhoCorasickPattern;
+struct AhoCorasickPattern
+{
+	Str8 pattern;
+	Str8 replacement;
+	u64 value; //opaque user value
+};
+
+typedef struct AhoCorasickMatch AhoCorasickMatch;
+struct AhoCorasickMatch
+{
+	uxx index; //byte index of the start of the match in the haystack
+	uxx length;
+	uxx patternIndex;
+};
+
+typedef struct AhoCorasick AhoCorasick;
+struct AhoCorasick
+{
+	Arena* arena; //doubles as IsInit check
+	bool ignoreCase;
+	bool isCompiled; //adding a pattern clears this, AhoCorasickCompile must be called again before matching
+	VarArray patterns; //AhoCorasickPattern
+	uxx maxPatternLength;
+	
+	u8 byteClasses[256]; //0 is used for all bytes that don't show up in any pattern
+	uxx numClasses;
+	uxx numStates;
+	u32* transitions; //[numStates * numClasses], state 0 is the root
+	u32* outputs; //[numStates] patternIndex+1 of the pattern that ends exactly at this state, 0 for none
+	u32* outputLinks; //[numStates] next state along the failure chain that has an output, 0 for none
+	u32* failLinks; //[numStates] longest proper suffix of this state that is also a state
+	u32* depths; //[numStates] length of the prefix this state represents
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	void InitAhoCorasick(AhoCorasick* matcher, Arena* arena, bool ignoreCase);
+	PIG_CORE_INLINE bool IsAhoCorasickInit(const AhoCorasick* matcher);
+	void FreeAhoCorasickTables(AhoCorasick* matcher);
+	void FreeAhoCorasick(AhoCorasick* matcher);
+	uxx AhoCorasickAddPatternEx(AhoCorasick* matcher, Str8 pattern, Str8 replacement, u64 value, bool copyStrs);
+	PIG_CORE_INLINE uxx AhoCorasickAddPattern(AhoCorasick* matcher, Str8 pattern, Str8 replacement);
+	PIG_CORE_INLINE AhoCorasickPattern* AhoCorasickGetPattern(const AhoCorasick* matcher, uxx patternIndex);
+	void AhoCorasickCompile(AhoCorasick* matcher);
+	PIG_CORE_INLINE u32 AhoCorasickStep(const AhoCorasick* matcher, u32 state, u8 byte);
+	bool AhoCorasickFindFirst(const AhoCorasick* matcher, Str8 haystack, uxx startIndex, AhoCorasickMatch* matchOut);
+	uxx AhoCorasickFindAll(const AhoCorasick* matcher, Str8 haystack, VarArray* matchesOut);
+	Str8 AhoCorasickReplace(const AhoCorasick* matcher, Arena* arena, Str8 str, bool addNullTerm);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Initialize AhoCorasick                     |
+// +--------------------------------------------------------------+
+PEXP void InitAhoCorasick(AhoCorasick* matcher, Arena* arena, bool ignoreCase)
+{
+	NotNull(matcher);
+	NotNull(arena);
+	ClearPointer(matcher);
+	matcher->arena = arena;
+	matcher->ignoreCase = ignoreCase;
+	InitVarArray(AhoCorasickPattern, &matcher->patterns, arena);
+}
+
+PEXPI bool IsAhoCorasickInit(const AhoCorasick* matcher)
+{
+	return (matcher->arena != nullptr);
+}
+
+//Frees the compiled tables but keeps the patterns
+PEXP void FreeAhoCorasickTables(AhoCorasick* matcher)
+{
+	NotNull(matcher);
+	Assert(IsAhoCorasickInit(matcher));
+	if (matcher->transitions != nullptr && CanArenaFree(matcher->arena))
+	{
+		FreeMem(matcher->arena, matcher->transitions, sizeof(u32) * matcher->numStates * matcher->numClasses);
+		FreeMem(matcher->arena, matcher->outputs, sizeof(u32) * matcher->numStates);
+		FreeMem(matcher->arena, matcher->outputLinks, sizeof(u32) * matcher->numStates);
+		FreeMem(matcher->arena, matcher->failLinks, sizeof(u32) * matcher->numStates);
+		FreeMem(matcher->arena, matcher->depths, sizeof(u32) * matcher->numStates);
+	}
+	matcher->transitions = nullptr;
+	matcher->outputs = nullptr;
+	matcher->outputLinks = nullptr;
+	matcher->failLinks = nullptr;
+	matcher->depths = nullptr;
+	matcher->numStates = 0;
+	matcher->numClasses = 0;
+	matcher->isCompiled = false;
+}
+
+//NOTE: Patterns that were copied into the arena are not freed, the expectation is the matcher's arena is reset or thrown away as a whole
+PEXP void FreeAhoCorasick(AhoCorasick* matcher)
+{
+	NotNull(matcher);
+	Assert(IsAhoCorasickInit(matcher));
+	FreeAhoCorasickTables(matcher);
+	FreeVarArray(&matcher->patterns);
+	ClearPointer(matcher);
+}
+
+// +--------------------------------------------------------------+
+// |                           Patterns                           |
+// +--------------------------------------------------------------+
+//If copyStrs is false the memory pointed to by pattern and replacement must live as long as the matcher does.
+//Returns the patternIndex that will be reported in matches
+PEXP uxx AhoCorasickAddPatternEx(AhoCorasick* matcher, Str8 pattern, Str8 replacement, u64 value, bool copyStrs)
+{
+	NotNull(matcher);
+	Assert(IsAhoCorasickInit(matcher));
+	NotNullStr(pattern);
+	NotNullStr(replacement);
+	Assert(pattern.length > 0);
+	if (matcher->isCompiled) { FreeAhoCorasickTables(matcher); }
+	
+	uxx patternIndex = matcher->patterns.length;
+	AhoCorasickPattern* newPattern = VarArrayAdd(AhoCorasickPattern, &matcher->patterns);
+	NotNull(newPattern);
+	ClearPointer(newPattern);
+	newPattern->pattern = copyStrs ? AllocStr8(matcher->arena, pattern) : pattern;
+	newPattern->replacement = (copyStrs && replacement.length > 0) ? AllocStr8(matcher->arena, replacement) : replacement;
+	newPattern->value = value;
+	if (pattern.length > matcher->maxPatternLength) { matcher->maxPatternLength = pattern.length; }
+	return patternIndex;
+}
+PEXPI uxx AhoCorasickAddPattern(AhoCorasick* matcher, Str8 pattern, Str8 replacement) { return AhoCorasickAddPatternEx(matcher, pattern, replacement, 0, true); }
+
+PEXPI AhoCorasickPattern* AhoCorasickGetPattern(const AhoCorasick* matcher, uxx patternIndex)
+{
+	DebugNotNull(matcher);
+	return VarArrayGetHard(AhoCorasickPattern, &matcher->patterns, patternIndex);
+}
+
+// +--------------------------------------------------------------+
+// |                           Compile                            |
+// +--------------------------------------------------------------+
+PEXP void AhoCorasickCompile(AhoCorasick* matcher)
+{
+	NotNull(matcher);
+	Assert(IsAhoCorasickInit(matcher));
+	if (matcher->isCompiled) { return; }
+	FreeAhoCorasickTables(matcher);
+	
+	//Assign a class to every byte that shows up in a pattern (both cases share a class when ignoreCase)
+	MyMemSet(&matcher->byteClasses[0], 0x00, sizeof(matcher->byteClasses));
+	matcher->numClasses = 1;
+	uxx maxStates = 1;
+	VarArrayLoop(&matcher->patterns, pIndex)
+	{
+		VarArrayLoopGet(AhoCorasickPattern, pattern, &matcher->patterns, pIndex);
+		maxStates += pattern->pattern.length;
+		for (uxx bIndex = 0; bIndex < pattern->pattern.length; bIndex++)
+		{
+			u8 byte = pattern->pattern.bytes[bIndex];
+			if (matcher->byteClasses[byte] != 0) { continue; }
+			Assert(matcher->numClasses < 256);
+			matcher->byteClasses[byte] = (u8)matcher->numClasses;
+			if (matcher->ignoreCase && byte >= 'a' && byte <= 'z') { matcher->byteClasses[byte - 'a' + 'A'] = (u8)matcher->numClasses; }
+			if (matcher->ignoreCase && byte >= 'A' && byte <= 'Z') { matcher->byteClasses[byte - 'A' + 'a'] = (u8)matcher->numClasses; }
+			matcher->numClasses++;
+		}
+	}
+	
+	//Build the trie. 0 means "no edge" here since nothing ever transitions back to the root in a trie
+	uxx numClasses = matcher->numClasses;
+	u32* transitions = AllocArray(u32, matcher->arena, maxStates * numClasses);
+	u32* outputs = AllocArray(u32, matcher->arena, maxStates);
+	NotNull(transitions);
+	NotNull(outputs);
+	MyMemSet(transitions, 0x00, sizeof(u32) * maxStates * numClasses);
+	MyMemSet(outputs, 0x00, sizeof(u32) * maxStates);
+	uxx numStates = 1;
+	VarArrayLoop(&matcher->patterns, pIndex)
+	{
+		VarArrayLoopGet(AhoCorasickPattern, pattern, &matcher->patterns, pIndex);
+		u32 state = 0;
+		for (uxx bIndex = 0; bIndex < pattern->pattern.length; bIndex++)
+		{
+			u32* edge = &transitions[state * numClasses + matcher->byteClasses[pattern->pattern.bytes[bIndex]]];
+			if (*edge == 0) { *edge = (u32)numStates; numStates++; }
+			state = *edge;
+		}
+		if (outputs[state] == 0) { outputs[state] = (u32)(pIndex + 1); } //duplicate patterns report the first one added
+	}
+	
+	//Breadth first walk to fill in failure links. Missing edges are resolved to the failure state's edge
+	//so the final table is a complete DFA. Failure links and depths are kept so AhoCorasickReplace can
+	//trim a state back to the bytes after a replaced match without rescanning
+	u32* failLinks = AllocArray(u32, matcher->arena, numStates);
+	u32* depths = AllocArray(u32, matcher->arena, numStates);
+	u32* outputLinks = AllocArray(u32, matcher->arena, numStates);
+	u32* queue = AllocArray(u32, matcher->arena, numStates);
+	NotNull(failLinks);
+	NotNull(depths);
+	NotNull(outputLinks);
+	NotNull(queue);
+	MyMemSet(failLinks, 0x00, sizeof(u32) * numStates);
+	MyMemSet(depths, 0x00, sizeof(u32) * numStates);
+	MyMemSet(outputLinks, 0x00, sizeof(u32) * numStates);
+	uxx queueStart = 0, queueEnd = 0;
+	queue[queueEnd++] = 0;
+	while (queueStart < queueEnd)
+	{
+		u32 state = queue[queueStart++];
+		u32 failState = failLinks[state];
+		for (uxx cIndex = 0; cIndex < numClasses; cIndex++)
+		{
+			u32* edge = &transitions[state * numClasses + cIndex];
+			if (*edge != 0)
+			{
+				u32 child = *edge;
+				u32 childFail = (state == 0) ? 0 : transitions[failState * numClasses + cIndex];
+				failLinks[child] = childFail;
+				depths[child] = depths[state] + 1;
+				outputLinks[child] = (outputs[childFail] != 0) ? childFail : outputLinks[childFail];
+				queue[queueEnd++] = child;
+			}
+			else if (state != 0) { *edge = transitions[failState * numClasses + cIndex]; }
+		}
+	}
+	
+	if (CanArenaFree(matcher->arena))
+	{
+		FreeMem(matcher->arena, queue, sizeof(u32) * numStates);
+		if (numStates < maxStates)
+		{
+			u32* shrunkTransitions = AllocArray(u32, matcher->arena, numStates * numClasses);
+			u32* shrunkOutputs = AllocArray(u32, matcher->arena, numStates);
+			NotNull(shrunkTransitions);
+			NotNull(shrunkOutputs);
+			MyMemCopy(shrunkTransitions, transitions, sizeof(u32) * numStates * numClasses);
+			MyMemCopy(shrunkOutputs, outputs, sizeof(u32) * numStates);
+			FreeMem(matcher->arena, transitions, sizeof(u32) * maxStates * numClasses);
+			FreeMem(matcher->arena, outputs, sizeof(u32) * maxStates);
+			transitions = shrunkTransitions;
+			outputs = shrunkOutputs;
+		}
+	}
+	
+	matcher->numStates = numStates;
+	matcher->transitions = transitions;
+	matcher->outputs = outputs;
+	matcher->outputLinks = outputLinks;
+	matcher->failLinks = failLinks;
+	matcher->depths = depths;
+	matcher->isCompiled = true;
+}
+
+// +--------------------------------------------------------------+
+// |                           Matching                           |
+// +--------------------------------------------------------------+
+PEXPI u32 AhoCorasickStep(const AhoCorasick* matcher, u32 state, u8 byte)
+{
+	return matcher->transitions[state * matcher->numClasses + matcher->byteClasses[byte]];
+}
+
+//Finds the leftmost match at or after startIndex, preferring the longest pattern when several start at the same index
+PEXP bool AhoCorasickFindFirst(const AhoCorasick* matcher, Str8 haystack, uxx startIndex, AhoCorasickMatch* matchOut)
+{
+	NotNull(matcher);
+	Assert(matcher->isCompiled);
+	NotNullStr(haystack);
+	Assert(startIndex <= haystack.length);
+	
+	bool foundMatch = false;
+	AhoCorasickMatch bestMatch = ZEROED;
+	u32 state = 0;
+	for (uxx bIndex = startIndex; bIndex < haystack.length; bIndex++)
+	{
+		//A match that starts before (or at) bestMatch.index can't end later than this
+		if (foundMatch && bIndex >= bestMatch.index + matcher->maxPatternLength) { break; }
+		state = AhoCorasickStep(matcher, state, haystack.bytes[bIndex]);
+		u32 outputState = (matcher->outputs[state] != 0) ? state : matcher->outputLinks[state];
+		while (outputState != 0)
+		{
+			uxx patternIndex = matcher->outputs[outputState] - 1;
+			uxx patternLength = AhoCorasickGetPattern(matcher, patternIndex)->pattern.length;
+			uxx matchIndex = bIndex + 1 - patternLength;
+			if (!foundMatch || matchIndex < bestMatch.index || (matchIndex == bestMatch.index && patternLength > bestMatch.length))
+			{
+				foundMatch = true;
+				bestMatch.index = matchIndex;
+				bestMatch.length = patternLength;
+				bestMatch.patternIndex = patternIndex;
+			}
+			outputState = matcher->outputLinks[outputState];
+		}
+	}
+	if (foundMatch) { SetOptionalOutPntr(matchOut, bestMatch); }
+	return foundMatch;
+}
+
+//Reports every occurrence of every pattern, including overlapping ones, in order of where they end.
+//matchesOut should be a VarArray of AhoCorasickMatch (or nullptr to just count them)
+PEXP uxx AhoCorasickFindAll(const AhoCorasick* matcher, Str8 haystack, VarArray* matchesOut)
+{
+	NotNull(matcher);
+	Assert(matcher->isCompiled);
+	NotNullStr(haystack);
+	uxx result = 0;
+	u32 state = 0;
+	for (uxx bIndex = 0; bIndex < haystack.length; bIndex++)
+	{
+		state = AhoCorasickStep(matcher, state, haystack.bytes[bIndex]);
+		u32 outputState = (matcher->outputs[state] != 0) ? state : matcher->outputLinks[state];
+		while (outputState != 0)
+		{
+			if (matchesOut != nullptr)
+			{
+				uxx patternIndex = matcher->outputs[outputState] - 1;
+				AhoCorasickMatch* newMatch = VarArrayAdd(AhoCorasickMatch, matchesOut);
+				NotNull(newMatch);
+				newMatch->length = AhoCorasickGetPattern(matcher, patternIndex)->pattern.length;
+				newMatch->index = bIndex + 1 - newMatch->length;
+				newMatch->patternIndex = patternIndex;
+			}
+			result++;
+			outputState = matcher->outputLinks[outputState];
+		}
+	}
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                           Replace                            |
+// +--------------------------------------------------------------+
+//Replaces every leftmost-longest, non-overlapping match with its pattern's replacement in a single pass over str.
+//The automaton state is carried across matches (trimmed back along the failure links) so no byte is scanned twice.
+//If arena is nullptr then only the length of the result is calculated. NOTE: Uses a scratch arena
+PEXP Str8 AhoCorasickReplace(const AhoCorasick* matcher, Arena* arena, Str8 str, bool addNullTerm)
+{
+	NotNull(matcher);
+	Assert(matcher->isCompiled);
+	NotNullStr(str);
+	Str8 result = Str8_Empty;
+	ScratchBegin1(scratch, arena);
+	//The longest match found so far for each start index that could still be replaced, indexed by start % windowSize
+	uxx windowSize = (matcher->maxPatternLength > 0) ? matcher->maxPatternLength : 1;
+	AhoCorasickMatch* window = AllocArray(AhoCorasickMatch, scratch, windowSize);
+	NotNull(window);
+	
+	for (u8 pass = 0; pass < 2; pass++)
+	{
+		uxx numBytesNeeded = 0;
+		uxx copyIndex = 0; //everything before this has been handled
+		uxx bestStart = UINTXX_MAX; //leftmost start index (>= copyIndex) that has a match in the window
+		u32 state = 0;
+		MyMemSet(window, 0x00, sizeof(AhoCorasickMatch) * windowSize);
+		for (uxx bIndex = 0; bIndex <= str.length; bIndex++)
+		{
+			bool isEnd = (bIndex == str.length);
+			if (!isEnd)
+			{
+				state = AhoCorasickStep(matcher, state, str.bytes[bIndex]);
+				u32 outputState = (matcher->outputs[state] != 0) ? state : matcher->outputLinks[state];
+				while (outputState != 0)
+				{
+					uxx patternIndex = matcher->outputs[outputState] - 1;
+					uxx patternLength = AhoCorasickGetPattern(matcher, patternIndex)->pattern.length;
+					uxx matchIndex = bIndex + 1 - patternLength;
+					AhoCorasickMatch* slot = &window[matchIndex % windowSize];
+					if (slot->length == 0 || slot->index != matchIndex || patternLength > slot->length)
+					{
+						slot->index = matchIndex;
+						slot->length = patternLength;
+						slot->patternIndex = patternIndex;
+					}
+					if (matchIndex < bestStart) { bestStart = matchIndex; }
+					outputState = matcher->outputLinks[outputState];
+				}
+			}
+			
+			//The leftmost match is final once no longer match starting at (or before) the same index can still end
+			while (bestStart != UINTXX_MAX && (isEnd || bIndex + 1 >= bestStart + windowSize))
+			{
+				AhoCorasickMatch match = window[bestStart % windowSize];
+				Str8 replacement = AhoCorasickGetPattern(matcher, match.patternIndex)->replacement;
+				uxx numUnchangedBytes = match.index - copyIndex;
+				if (result.chars != nullptr)
+				{
+					Assert(numBytesNeeded + numUnchangedBytes + replacement.length <= result.length);
+					if (numUnchangedBytes > 0) { MyMemCopy(&result.chars[numBytesNeeded], &str.chars[copyIndex], numUnchangedBytes); }
+					if (replacement.length > 0) { MyMemCopy(&result.chars[numBytesNeeded + numUnchangedBytes], replacement.chars, replacement.length); }
+				}
+				numBytesNeeded += numUnchangedBytes + replacement.length;
+				copyIndex = match.index + match.length;
+				
+				//The next match is the leftmost one we've already seen that doesn't overlap this one (at most windowSize start indices to check)
+				uxx scannedEnd = isEnd ? str.length : bIndex + 1;
+				bestStart = UINTXX_MAX;
+				for (uxx startIndex = copyIndex; startIndex < scannedEnd; startIndex++)
+				{
+					const AhoCorasickMatch* slot = &window[startIndex % windowSize];
+					if (slot->length > 0 && slot->index == startIndex) { bestStart = startIndex; break; }
+				}
+				//Trim the state so it only covers bytes after the match, which is the state a fresh scan from copyIndex would reach
+				while (matcher->depths[state] > scannedEnd - copyIndex) { state = matcher->failLinks[state]; }
+			}
+		}
+		if (result.chars != nullptr && copyIndex < str.length)
+		{
+			Assert(numBytesNeeded + (str.length - copyIndex) <= result.length);
+			MyMemCopy(&result.chars[numBytesNeeded], &str.chars[copyIndex], str.length - copyIndex);
+		}
+		numBytesNeeded += str.length - copyIndex;
+		
+		if (pass == 0)
+		{
+			result.length = numBytesNeeded;
+			if (arena == nullptr) { break; }
+			if (result.length == 0 && !addNullTerm) { result = Str8_Empty; break; }
+			result.chars = AllocArray(char, arena, result.length + (addNullTerm ? 1 : 0));
+			NotNull(result.chars);
+		}
+		else
+		{
+			Assert(numBytesNeeded == result.length);
+			if (addNullTerm) { result.chars[result.length] = '\0'; }
+		}
+	}
+	
+	ScratchEnd(scratch);
+	return result;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _STRUCT_AHO_CORASICK_H
@@ -19,6 +19,7 @@ Description:
 #include "base/base_macros.h" //Needed by struct_string.h and struct_var_array.h
 #include "base/base_assert.h" //Needed by struct_string.h and struct_var_array.h
 #include "base/base_char.h" //Needed by struct_string.h
+#include "std/std_mem_search.h" //Needed by struct_string.h
 
 #include "struct/struct_string.h"
 
@@ -27,10 +28,20 @@ Description:
 
 #include "struct/struct_var_array.h"
 
+#include "base/base_unicode.h" //Needed by struct_text_buffer.h
+#include "std/std_basic_math.h" //Needed by struct_text_buffer.h
+
+#include "struct/struct_text_buffer.h"
+#include "struct/struct_radix_tree.h"
+#include "struct/struct_aho_corasick.h"
+
 #include "struct/struct_handmade_math_include.h" //Needed by struct_vectors.h, struct_quaternion.h, and struct_matrices.h
 
 #include "struct/struct_vectors.h"
 #include "struct/struct_quaternion.h"
 #include "struct/struct_matrices.h"
 
+#include "struct/struct_grid.h"
+#include "struct/struct_sparse_grid.h"
+
 #endif //  _STRUCT_ALL_H
@@ -0,0 +1,495 @@
+/*
+File:   struct_grid.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Defines Grid2D and Grid3D which are fixed size, densely packed, grids of items
+	** allocated from an Arena. Rather than laying the items out row-major (where the
+	** cell above you is a whole row away in memory) the items are grouped into small
+	** tiles (8x8 for 2D and 4x4x4 for 3D) that are each contiguous in memory. This means
+	** neighborhood queries and small area updates mostly touch one or two cache lines
+	** worth of tiles instead of one line per row. The grid is padded up to a whole
+	** number of tiles, the padding cells are never visited by the API.
+	** Like VarArray these are not type safe, we store the itemSize and use macros to
+	** tie the pointer cast and sizeof together.
+	** See struct_sparse_grid.h for a chunked variant that is better for very large, mostly empty, worlds
+*/
+
+/*
+* Usage Example:
+*	Grid2D grid;
+*	InitGrid2D(u8, &grid, arena, NewV2i(100, 50));
+*	Grid2DFill(u8, &grid, 1);
+*	*Grid2DGet(u8, &grid, NewV2i(10, 10)) = 5;
+*	Grid2DNeighborLoop(dir, true)
+*	{
+*		u8* neighbor = Grid2DGetNeighbor(u8, &grid, NewV2i(10, 10), dir);
+*		if (neighbor != nullptr) { (*neighbor)++; }
+*	}
+*	FreeGrid2D(&grid);
+*/
+
+#ifndef _STRUCT_GRID_H
+#define _STRUCT_GRID_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+#include "struct/struct_directions.h"
+#include "struct/struct_vectors.h"
+
+#define GRID2D_TILE_SHIFT 3 //8x8 tiles
+#define GRID2D_TILE_SIZE  (1 << GRID2D_TILE_SHIFT)
+#define GRID2D_TILE_MASK  (GRID2D_TILE_SIZE - 1)
+#define GRID2D_TILE_AREA  (GRID2D_TILE_SIZE * GRID2D_TILE_SIZE)
+
+#define GRID3D_TILE_SHIFT  2 //4x4x4 tiles
+#define GRID3D_TILE_SIZE   (1 << GRID3D_TILE_SHIFT)
+#define GRID3D_TILE_MASK   (GRID3D_TILE_SIZE - 1)
+#define GRID3D_TILE_VOLUME (GRID3D_TILE_SIZE * GRID3D_TILE_SIZE * GRID3D_TILE_SIZE)
+
+// +--------------------------------------------------------------+
+// |                       Data Structures                        |
+// +--------------------------------------------------------------+
+typedef struct Grid2D Grid2D;
+struct Grid2D
+{
+	Arena* arena; //doubles as IsInit check
+	uxx itemSize;
+	uxx itemAlignment;
+	v2i size;
+	v2i numTiles;
+	uxx numItems; //includes padding out to a whole number of tiles
+	void* items;
+};
+
+typedef struct Grid3D Grid3D;
+struct Grid3D
+{
+	Arena* arena; //doubles as IsInit check
+	uxx itemSize;
+	uxx itemAlignment;
+	v3i size;
+	v3i numTiles;
+	uxx numItems; //includes padding out to a whole number of tiles
+	void* items;
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE void GridFillByDoubling(void* itemsPntr, uxx itemSize, uxx numItems);
+	void InitGrid2D_(uxx itemSize, uxx itemAlignment, Grid2D* grid, Arena* arena, v2i size);
+	PIG_CORE_INLINE bool IsGrid2DInit(const Grid2D* grid);
+	void FreeGrid2D(Grid2D* grid);
+	PIG_CORE_INLINE bool IsInsideGrid2D(const Grid2D* grid, v2i coord);
+	PIG_CORE_INLINE uxx Grid2DGetIndex(const Grid2D* grid, v2i coord);
+	PIG_CORE_INLINE void* Grid2DGet_(uxx itemSize, uxx itemAlignment, const Grid2D* grid, v2i coord, bool assertOnFailure);
+	PIG_CORE_INLINE void* Grid2DGetNeighbor_(uxx itemSize, uxx itemAlignment, const Grid2D* grid, v2i coord, Dir2Ex dir2ex);
+	void Grid2DFill_(uxx itemSize, uxx itemAlignment, Grid2D* grid, const void* valuePntr);
+	void Grid2DFillRec_(uxx itemSize, uxx itemAlignment, Grid2D* grid, v2i min, v2i size, const void* valuePntr);
+	void Grid2DCopy(Grid2D* destGrid, const Grid2D* sourceGrid, Arena* arena);
+	void Grid2DCopyFromRowMajor(Grid2D* grid, const void* rowMajorItems);
+	void Grid2DCopyToRowMajor(const Grid2D* grid, void* rowMajorItemsOut);
+	void InitGrid3D_(uxx itemSize, uxx itemAlignment, Grid3D* grid, Arena* arena, v3i size);
+	PIG_CORE_INLINE bool IsGrid3DInit(const Grid3D* grid);
+	void FreeGrid3D(Grid3D* grid);
+	PIG_CORE_INLINE bool IsInsideGrid3D(const Grid3D* grid, v3i coord);
+	PIG_CORE_INLINE uxx Grid3DGetIndex(const Grid3D* grid, v3i coord);
+	PIG_CORE_INLINE void* Grid3DGet_(uxx itemSize, uxx itemAlignment, const Grid3D* grid, v3i coord, bool assertOnFailure);
+	PIG_CORE_INLINE void* Grid3DGetNeighbor_(uxx itemSize, uxx itemAlignment, const Grid3D* grid, v3i coord, Dir3 dir3);
+	void Grid3DFill_(uxx itemSize, uxx itemAlignment, Grid3D* grid, const void* valuePntr);
+	void Grid3DFillBox_(uxx itemSize, uxx itemAlignment, Grid3D* grid, v3i min, v3i size, const void* valuePntr);
+	void Grid3DCopy(Grid3D* destGrid, const Grid3D* sourceGrid, Arena* arena);
+	void Grid3DCopyFromRowMajor(Grid3D* grid, const void* rowMajorItems);
+	void Grid3DCopyToRowMajor(const Grid3D* grid, void* rowMajorItemsOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                            Macros                            |
+// +--------------------------------------------------------------+
+#define InitGrid2D(type, gridPntr, arena, size) InitGrid2D_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (arena), (size))
+#define InitGrid3D(type, gridPntr, arena, size) InitGrid3D_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (arena), (size))
+
+//Hard indicates we want to assertOnFailure, opposed to Soft which will return nullptr for coordinates outside the grid
+#define Grid2DGetHard(type, gridPntr, coord) ((type*)Grid2DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), true))
+#define Grid2DGetSoft(type, gridPntr, coord) ((type*)Grid2DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), false))
+#define Grid2DGet(type, gridPntr, coord) Grid2DGetHard(type, (gridPntr), (coord))
+#define Grid3DGetHard(type, gridPntr, coord) ((type*)Grid3DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), true))
+#define Grid3DGetSoft(type, gridPntr, coord) ((type*)Grid3DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), false))
+#define Grid3DGet(type, gridPntr, coord) Grid3DGetHard(type, (gridPntr), (coord))
+
+//Returns nullptr when the neighbor is outside the grid
+#define Grid2DGetNeighbor(type, gridPntr, coord, dir2ex) ((type*)Grid2DGetNeighbor_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), (Dir2Ex)(dir2ex)))
+#define Grid3DGetNeighbor(type, gridPntr, coord, dir3) ((type*)Grid3DGetNeighbor_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), (dir3)))
+
+//Iterates dirVarName over each single Dir2Ex (the 4 cardinal directions first, then the 4 diagonals if includeDiagonals)
+#define Grid2DNeighborLoop(dirVarName, includeDiagonals) for (Dir2Ex dirVarName = Dir2Ex_Right; dirVarName <= ((includeDiagonals) ? Dir2Ex_BottomLeft : Dir2Ex_Up); dirVarName = (Dir2Ex)(dirVarName << 1))
+//Iterates dirVarName over each of the 6 single Dir3 values
+#define Grid3DNeighborLoop(dirVarName) for (Dir3 dirVarName = Dir3_Right; dirVarName <= Dir3_Backward; dirVarName = (Dir3)(dirVarName << 1))
+
+#define Grid2DFill(type, gridPntr, value) do                                                                   \
+{                                                                                                              \
+	type fillValue_NOCONFLICT = (value);                                                                       \
+	Grid2DFill_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), &fillValue_NOCONFLICT);                    \
+} while(0)
+#define Grid2DFillRec(type, gridPntr, min, size, value) do                                                     \
+{                                                                                                              \
+	type fillValue_NOCONFLICT = (value);                                                                       \
+	Grid2DFillRec_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (min), (size), &fillValue_NOCONFLICT);  \
+} while(0)
+#define Grid3DFill(type, gridPntr, value) do                                                                   \
+{                                                                                                              \
+	type fillValue_NOCONFLICT = (value);                                                                       \
+	Grid3DFill_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), &fillValue_NOCONFLICT);                    \
+} while(0)
+#define Grid3DFillBox(type, gridPntr, min, size, value) do                                                     \
+{                                                                                                              \
+	type fillValue_NOCONFLICT = (value);                                                                       \
+	Grid3DFillBox_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (min), (size), &fillValue_NOCONFLICT);  \
+} while(0)
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+//Fills numItems items starting at itemsPntr with copies of the first item, doubling the size of each memcpy
+PEXPI void GridFillByDoubling(void* itemsPntr, uxx itemSize, uxx numItems)
+{
+	uxx numFilled = 1;
+	while (numFilled < numItems)
+	{
+		uxx numToCopy = (numFilled <= numItems - numFilled) ? numFilled : (numItems - numFilled);
+		MyMemCopy((u8*)itemsPntr + (numFilled * itemSize), itemsPntr, numToCopy * itemSize);
+		numFilled += numToCopy;
+	}
+}
+
+// +==============================+
+// |            Grid2D            |
+// +==============================+
+PEXP void InitGrid2D_(uxx itemSize, uxx itemAlignment, Grid2D* grid, Arena* arena, v2i size)
+{
+	NotNull(grid);
+	NotNull(arena);
+	Assert(itemSize > 0);
+	Assert(size.X >= 0 && size.Y >= 0);
+	ClearPointer(grid);
+	grid->arena = arena;
+	grid->itemSize = itemSize;
+	grid->itemAlignment = itemAlignment;
+	grid->size = size;
+	grid->numTiles = NewV2i(
+		(size.X + GRID2D_TILE_MASK) >> GRID2D_TILE_SHIFT,
+		(size.Y + GRID2D_TILE_MASK) >> GRID2D_TILE_SHIFT
+	);
+	grid->numItems = (uxx)grid->numTiles.X * (uxx)grid->numTiles.Y * GRID2D_TILE_AREA;
+	if (grid->numItems > 0)
+	{
+		grid->items = AllocMemAligned(arena, grid->numItems * itemSize, itemAlignment);
+		NotNull(grid->items);
+	}
+}
+
+PEXPI bool IsGrid2DInit(const Grid2D* grid)
+{
+	return (grid->arena != nullptr);
+}
+
+PEXP void FreeGrid2D(Grid2D* grid)
+{
+	NotNull(grid);
+	Assert(IsGrid2DInit(grid));
+	if (grid->items != nullptr && CanArenaFree(grid->arena)) { FreeMem(grid->arena, grid->items, grid->numItems * grid->itemSize); }
+	ClearPointer(grid);
+}
+
+PEXPI bool IsInsideGrid2D(const Grid2D* grid, v2i coord)
+{
+	return (coord.X >= 0 && coord.Y >= 0 && coord.X < grid->size.X && coord.Y < grid->size.Y);
+}
+
+//Tile-major index: which tile (row-major order of tiles) and then the cell inside the tile (row-major inside the tile)
+PEXPI uxx Grid2DGetIndex(const Grid2D* grid, v2i coord)
+{
+	DebugAssert(IsInsideGrid2D(grid, coord));
+	uxx tileIndex = ((uxx)(coord.Y >> GRID2D_TILE_SHIFT) * (uxx)grid->numTiles.X) + (uxx)(coord.X >> GRID2D_TILE_SHIFT);
+	uxx cellIndex = ((uxx)(coord.Y & GRID2D_TILE_MASK) << GRID2D_TILE_SHIFT) | (uxx)(coord.X & GRID2D_TILE_MASK);
+	return (tileIndex * GRID2D_TILE_AREA) + cellIndex;
+}
+
+PEXPI void* Grid2DGet_(uxx itemSize, uxx itemAlignment, const Grid2D* grid, v2i coord, bool assertOnFailure)
+{
+	DebugNotNull(grid);
+	#if DEBUG_BUILD
+	AssertMsg(grid->itemSize == itemSize, "Invalid itemSize passed to Grid2DGet. Make sure you're accessing the Grid2D with the correct type!");
+	AssertMsg(grid->itemAlignment == itemAlignment, "Invalid itemAlignment passed to Grid2DGet. Make sure you're accessing the Grid2D with the correct type!");
+	#else
+	UNUSED(itemSize);
+	UNUSED(itemAlignment);
+	#endif
+	if (!IsInsideGrid2D(grid, coord))
+	{
+		if (assertOnFailure) { AssertMsg(false, "Grid2DGet out of bounds!"); }
+		return nullptr;
+	}
+	return (u8*)grid->items + (Grid2DGetIndex(grid, coord) * grid->itemSize);
+}
+
+PEXPI void* Grid2DGetNeighbor_(uxx itemSize, uxx itemAlignment, const Grid2D* grid, v2i coord, Dir2Ex dir2ex)
+{
+	v2i offset = ToV2iFromDir2Ex(dir2ex);
+	return Grid2DGet_(itemSize, itemAlignment, grid, NewV2i(coord.X + offset.X, coord.Y + offset.Y), false);
+}
+
+//NOTE: This fills the padding cells too, that way the whole thing is a handful of large memcpys
+PEXP void Grid2DFill_(uxx itemSize, uxx itemAlignment, Grid2D* grid, const void* valuePntr)
+{
+	NotNull(grid);
+	NotNull(valuePntr);
+	Assert(grid->itemSize == itemSize);
+	UNUSED(itemAlignment);
+	if (grid->numItems == 0) { return; }
+	MyMemCopy(grid->items, valuePntr, itemSize);
+	GridFillByDoubling(grid->items, itemSize, grid->numItems);
+}
+
+//The rectangle is clipped to the grid. Each row of each tile is contiguous so we fill a run of cells at a time
+PEXP void Grid2DFillRec_(uxx itemSize, uxx itemAlignment, Grid2D* grid, v2i min, v2i size, const void* valuePntr)
+{
+	NotNull(grid);
+	NotNull(valuePntr);
+	Assert(grid->itemSize == itemSize);
+	UNUSED(itemAlignment);
+	i32 minX = MaxI32(min.X, 0);
+	i32 minY = MaxI32(min.Y, 0);
+	i32 maxX = MinI32(min.X + size.X, grid->size.X);
+	i32 maxY = MinI32(min.Y + size.Y, grid->size.Y);
+	for (i32 yPos = minY; yPos < maxY; yPos++)
+	{
+		i32 xPos = minX;
+		while (xPos < maxX)
+		{
+			i32 runLength = MinI32(GRID2D_TILE_SIZE - (xPos & GRID2D_TILE_MASK), maxX - xPos);
+			u8* runPntr = (u8*)grid->items + (Grid2DGetIndex(grid, NewV2i(xPos, yPos)) * itemSize);
+			MyMemCopy(runPntr, valuePntr, itemSize);
+			GridFillByDoubling(runPntr, itemSize, (uxx)runLength);
+			xPos += runLength;
+		}
+	}
+}
+
+//The layout doesn't depend on anything but the size, so a copy is one big memcpy
+PEXP void Grid2DCopy(Grid2D* destGrid, const Grid2D* sourceGrid, Arena* arena)
+{
+	NotNull(destGrid);
+	NotNull(sourceGrid);
+	Assert(IsGrid2DInit(sourceGrid));
+	InitGrid2D_(sourceGrid->itemSize, sourceGrid->itemAlignment, destGrid, arena, sourceGrid->size);
+	if (sourceGrid->numItems > 0) { MyMemCopy(destGrid->items, sourceGrid->items, sourceGrid->numItems * sourceGrid->itemSize); }
+}
+
+//rowMajorItems must hold size.X*size.Y items, these are useful for talking to code that expects a flat array (like uploading a texture)
+PEXP void Grid2DCopyFromRowMajor(Grid2D* grid, const void* rowMajorItems)
+{
+	NotNull(grid);
+	Assert(rowMajorItems != nullptr || grid->numItems == 0);
+	for (i32 yPos = 0; yPos < grid->size.Y; yPos++)
+	{
+		for (i32 xPos = 0; xPos < grid->size.X; xPos += GRID2D_TILE_SIZE)
+		{
+			i32 runLength = MinI32(GRID2D_TILE_SIZE, grid->size.X - xPos);
+			const u8* sourcePntr = (const u8*)rowMajorItems + ((uxx)INDEX_FROM_COORD2D(xPos, yPos, grid->size.X, grid->size.Y) * grid->itemSize);
+			MyMemCopy((u8*)grid->items + (Grid2DGetIndex(grid, NewV2i(xPos, yPos)) * grid->itemSize), sourcePntr, (uxx)runLength * grid->itemSize);
+		}
+	}
+}
+PEXP void Grid2DCopyToRowMajor(const Grid2D* grid, void* rowMajorItemsOut)
+{
+	NotNull(grid);
+	Assert(rowMajorItemsOut != nullptr || grid->numItems == 0);
+	for (i32 yPos = 0; yPos < grid->size.Y; yPos++)
+	{
+		for (i32 xPos = 0; xPos < grid->size.X; xPos += GRID2D_TILE_SIZE)
+		{
+			i32 runLength = MinI32(GRID2D_TILE_SIZE, grid->size.X - xPos);
+			u8* destPntr = (u8*)rowMajorItemsOut + ((uxx)INDEX_FROM_COORD2D(xPos, yPos, grid->size.X, grid->size.Y) * grid->itemSize);
+			MyMemCopy(destPntr, (const u8*)grid->items + (Grid2DGetIndex(grid, NewV2i(xPos, yPos)) * grid->itemSize), (uxx)runLength * grid->itemSize);
+		}
+	}
+}
+
+// +==============================+
+// |            Grid3D            |
+// +==============================+
+PEXP void InitGrid3D_(uxx itemSize, uxx itemAlignment, Grid3D* grid, Arena* arena, v3i size)
+{
+	NotNull(grid);
+	NotNull(arena);
+	Assert(itemSize > 0);
+	Assert(size.X >= 0 && size.Y >= 0 && size.Z >= 0);
+	ClearPointer(grid);
+	grid->arena = arena;
+	grid->itemSize = itemSize;
+	grid->itemAlignment = itemAlignment;
+	grid->size = size;
+	grid->numTiles = NewV3i(
+		(size.X + GRID3D_TILE_MASK) >> GRID3D_TILE_SHIFT,
+		(size.Y + GRID3D_TILE_MASK) >> GRID3D_TILE_SHIFT,
+		(size.Z + GRID3D_TILE_MASK) >> GRID3D_TILE_SHIFT
+	);
+	grid->numItems = (uxx)grid->numTiles.X * (uxx)grid->numTiles.Y * (uxx)grid->numTiles.Z * GRID3D_TILE_VOLUME;
+	if (grid->numItems > 0)
+	{
+		grid->items = AllocMemAligned(arena, grid->numItems * itemSize, itemAlignment);
+		NotNull(grid->items);
+	}
+}
+
+PEXPI bool IsGrid3DInit(const Grid3D* grid)
+{
+	return (grid->arena != nullptr);
+}
+
+PEXP void FreeGrid3D(Grid3D* grid)
+{
+	NotNull(grid);
+	Assert(IsGrid3DInit(grid));
+	if (grid->items != nullptr && CanArenaFree(grid->arena)) { FreeMem(grid->arena, grid->items, grid->numItems * grid->itemSize); }
+	ClearPointer(grid);
+}
+
+PEXPI bool IsInsideGrid3D(const Grid3D* grid, v3i coord)
+{
+	return (coord.X >= 0 && coord.Y >= 0 && coord.Z >= 0 && coord.X < grid->size.X && coord.Y < grid->size.Y && coord.Z < grid->size.Z);
+}
+
+PEXPI uxx Grid3DGetIndex(const Grid3D* grid, v3i coord)
+{
+	DebugAssert(IsInsideGrid3D(grid, coord));
+	uxx tileIndex = (uxx)INDEX_FROM_COORD3D(
+		coord.X >> GRID3D_TILE_SHIFT, coord.Y >> GRID3D_TILE_SHIFT, coord.Z >> GRID3D_TILE_SHIFT,
+		(uxx)grid->numTiles.X, (uxx)grid->numTiles.Y, (uxx)grid->numTiles.Z
+	);
+	uxx cellIndex = ((uxx)(coord.Z & GRID3D_TILE_MASK) << (GRID3D_TILE_SHIFT*2)) | ((uxx)(coord.Y & GRID3D_TILE_MASK) << GRID3D_TILE_SHIFT) | (uxx)(coord.X & GRID3D_TILE_MASK);
+	return (tileIndex * GRID3D_TILE_VOLUME) + cellIndex;
+}
+
+PEXPI void* Grid3DGet_(uxx itemSize, uxx itemAlignment, const Grid3D* grid, v3i coord, bool assertOnFailure)
+{
+	DebugNotNull(grid);
+	#if DEBUG_BUILD
+	AssertMsg(grid->itemSize == itemSize, "Invalid itemSize passed to Grid3DGet. Make sure you're accessing the Grid3D with the correct type!");
+	AssertMsg(grid->itemAlignment == itemAlignment, "Invalid itemAlignment passed to Grid3DGet. Make sure you're accessing the Grid3D with the correct type!");
+	#else
+	UNUSED(itemSize);
+	UNUSED(itemAlignment);
+	#endif
+	if (!IsInsideGrid3D(grid, coord))
+	{
+		if (assertOnFailure) { AssertMsg(false, "Grid3DGet out of bounds!"); }
+		return nullptr;
+	}
+	return (u8*)grid->items + (Grid3DGetIndex(grid, coord) * grid->itemSize);
+}
+
+PEXPI void* Grid3DGetNeighbor_(uxx itemSize, uxx itemAlignment, const Grid3D* grid, v3i coord, Dir3 dir3)
+{
+	v3i offset = ToV3iFromDir3(dir3);
+	return Grid3DGet_(itemSize, itemAlignment, grid, NewV3i(coord.X + offset.X, coord.Y + offset.Y, coord.Z + offset.Z), false);
+}
+
+PEXP void Grid3DFill_(uxx itemSize, uxx itemAlignment, Grid3D* grid, const void* valuePntr)
+{
+	NotNull(grid);
+	NotNull(valuePntr);
+	Assert(grid->itemSize == itemSize);
+	UNUSED(itemAlignment);
+	if (grid->numItems == 0) { return; }
+	MyMemCopy(grid->items, valuePntr, itemSize);
+	GridFillByDoubling(grid->items, itemSize, grid->numItems);
+}
+
+PEXP void Grid3DFillBox_(uxx itemSize, uxx itemAlignment, Grid3D* grid, v3i min, v3i size, const void* valuePntr)
+{
+	NotNull(grid);
+	NotNull(valuePntr);
+	Assert(grid->itemSize == itemSize);
+	UNUSED(itemAlignment);
+	i32 minX = MaxI32(min.X, 0);
+	i32 minY = MaxI32(min.Y, 0);
+	i32 minZ = MaxI32(min.Z, 0);
+	i32 maxX = MinI32(min.X + size.X, grid->size.X);
+	i32 maxY = MinI32(min.Y + size.Y, grid->size.Y);
+	i32 maxZ = MinI32(min.Z + size.Z, grid->size.Z);
+	for (i32 zPos = minZ; zPos < maxZ; zPos++)
+	{
+		for (i32 yPos = minY; yPos < maxY; yPos++)
+		{
+			i32 xPos = minX;
+			while (xPos < maxX)
+			{
+				i32 runLength = MinI32(GRID3D_TILE_SIZE - (xPos & GRID3D_TILE_MASK), maxX - xPos);
+				u8* runPntr = (u8*)grid->items + (Grid3DGetIndex(grid, NewV3i(xPos, yPos, zPos)) * itemSize);
+				MyMemCopy(runPntr, valuePntr, itemSize);
+				GridFillByDoubling(runPntr, itemSize, (uxx)runLength);
+				xPos += runLength;
+			}
+		}
+	}
+}
+
+PEXP void Grid3DCopy(Grid3D* destGrid, const Grid3D* sourceGrid, Arena* arena)
+{
+	NotNull(destGrid);
+	NotNull(sourceGrid);
+	Assert(IsGrid3DInit(sourceGrid));
+	InitGrid3D_(sourceGrid->itemSize, sourceGrid->itemAlignment, destGrid, arena, sourceGrid->size);
+	if (sourceGrid->numItems > 0) { MyMemCopy(destGrid->items, sourceGrid->items, sourceGrid->numItems * sourceGrid->itemSize); }
+}
+
+//rowMajorItems holds size.X*size.Y*size.Z items ordered the same way as INDEX_FROM_COORD3D (x fastest, then z, then y)
+PEXP void Grid3DCopyFromRowMajor(Grid3D* grid, const void* rowMajorItems)
+{
+	NotNull(grid);
+	Assert(rowMajorItems != nullptr || grid->numItems == 0);
+	for (i32 yPos = 0; yPos < grid->size.Y; yPos++)
+	{
+		for (i32 zPos = 0; zPos < grid->size.Z; zPos++)
+		{
+			for (i32 xPos = 0; xPos < grid->size.X; xPos += GRID3D_TILE_SIZE)
+			{
+				i32 runLength = MinI32(GRID3D_TILE_SIZE, grid->size.X - xPos);
+				const u8* sourcePntr = (const u8*)rowMajorItems + ((uxx)INDEX_FROM_COORD3D(xPos, yPos, zPos, grid->size.X, grid->size.Y, grid->size.Z) * grid->itemSize);
+				MyMemCopy((u8*)grid->items + (Grid3DGetIndex(grid, NewV3i(xPos, yPos, zPos)) * grid->itemSize), sourcePntr, (uxx)runLength * grid->itemSize);
+			}
+		}
+	}
+}
+PEXP void Grid3DCopyToRowMajor(const Grid3D* grid, void* rowMajorItemsOut)
+{
+	NotNull(grid);
+	Assert(rowMajorItemsOut != nullptr || grid->numItems == 0);
+	for (i32 yPos = 0; yPos < grid->size.Y; yPos++)
+	{
+		for (i32 zPos = 0; zPos < grid->size.Z; zPos++)
+		{
+			for (i32 xPos = 0; xPos < grid->size.X; xPos += GRID3D_TILE_SIZE)
+			{
+				i32 runLength = MinI32(GRID3D_TILE_SIZE, grid->size.X - xPos);
+				u8* destPntr = (u8*)rowMajorItemsOut + ((uxx)INDEX_FROM_COORD3D(xPos, yPos, zPos, grid->size.X, grid->size.Y, grid->size.Z) * grid->itemSize);
+				MyMemCopy(destPntr, (const u8*)grid->items + (Grid3DGetIndex(grid, NewV3i(xPos, yPos, zPos)) * grid->itemSize), (uxx)runLength * grid->itemSize);
+			}
+		}
+	}
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _STRUCT_GRID_H
@@ -0,0 +1,543 @@
+/*
+File:   struct_radix_tree.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Defines a RadixTree which is a compressed trie keyed on Str8. Each node holds
+	** a label (a slice of one of the keys) and nodes with a single child are merged
+	** into their parent so the depth of the tree is bounded by the number of branching
+	** points in the key set, not by the length of the keys. All nodes live in a VarArray
+	** and refer to each other by index, so the whole tree is a handful of allocations
+	** from the Arena it was initialized with.
+	** Every node also tracks the largest weight in its subtree which lets a top-K
+	** completion query skip entire subtrees that can't beat what it has already found.
+*/
+
+/*
+* Usage Example:
+*	RadixTree tree;
+*	InitRadixTree(&tree, arena);
+*	RadixTreeInsert(&tree, StrLit("apple"), 10.0f, 0);
+*	RadixTreeInsert(&tree, StrLit("application"), 25.0f, 1);
+*	RadixTreeInsert(&tree, StrLit("apply"), 5.0f, 2);
+*	RadixNode* completions[2];
+*	uxx numCompletions = RadixTreeComplete(&tree, StrLit("app"), ArrayCount(completions), &completions[0]);
+*	//completions[0]->key = "application", completions[1]->key = "apple"
+*/
+
+#ifndef _STRUCT_RADIX_TREE_H
+#define _STRUCT_RADIX_TREE_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+#include "mem/mem_scratch.h"
+#include "struct/struct_string.h"
+#include "struct/struct_var_array.h"
+
+// +--------------------------------------------------------------+
+// |                        Data Structure                        |
+// +--------------------------------------------------------------+
+typedef struct RadixNode RadixNode;
+struct RadixNode
+{
+	Str8 label; //slice of some key, empty only for the root
+	uxx firstChild; //0 means no children (the root is never a child), children are sorted by their first byte
+	uxx nextSibling; //0 means last child
+	bool isEntry; //false for nodes that only exist because two keys branch here
+	r32 weight;
+	r32 maxWeight; //largest weight of any entry in this subtree (may overestimate after an entry's weight is lowered)
+	Str8 key; //full key, only filled for entries
+	u64 value; //opaque user value, only meaningful for entries
+};
+
+typedef struct RadixTree RadixTree;
+struct RadixTree
+{
+	Arena* arena; //doubles as IsInit check
+	uxx numEntries;
+	VarArray nodes; //RadixNode, [0] is the root
+};
+
+#define RADIX_TREE_VISIT_FUNC_DEF(functionName) bool functionName(const RadixNode* node, void* contextPntr)
+typedef RADIX_TREE_VISIT_FUNC_DEF(RadixTreeVisitFunc_f);
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	void InitRadixTree(RadixTree* tree, Arena* arena);
+	PIG_CORE_INLINE bool IsRadixTreeInit(const RadixTree* tree);
+	void FreeRadixTree(RadixTree* tree);
+	PIG_CORE_INLINE RadixNode* RadixTreeGetNode(const RadixTree* tree, uxx nodeIndex);
+	PIG_CORE_INLINE uxx RadixTreeCommonPrefixLength(Str8 left, Str8 right);
+	void RadixTreeLinkChild(RadixTree* tree, uxx parentIndex, uxx childIndex);
+	PIG_CORE_INLINE uxx RadixTreeFindChild(const RadixTree* tree, const RadixNode* parent, u8 firstByte);
+	RadixNode* RadixTreeInsertEx(RadixTree* tree, Str8 key, r32 weight, u64 value, bool copyKey);
+	PIG_CORE_INLINE RadixNode* RadixTreeInsert(RadixTree* tree, Str8 key, r32 weight, u64 value);
+	PIG_CORE_INLINE i32 RadixTreeCompareKeys_(Str8 left, Str8 right);
+	r32 RadixTreeBuildRange_(RadixTree* tree, const Str8* keys, const r32* weights, const uxx* sortedIndices, uxx startIndex, uxx endIndex, uxx depth, uxx parentIndex);
+	void RadixTreeBuild(RadixTree* tree, uxx numEntries, const Str8* keys, const r32* weights, bool copyKeys);
+	RadixNode* RadixTreeFind(const RadixTree* tree, Str8 key);
+	PIG_CORE_INLINE bool RadixTreeContains(const RadixTree* tree, Str8 key);
+	uxx RadixTreeFindPrefix(const RadixTree* tree, Str8 prefix);
+	bool RadixTreeVisitSubtree(const RadixTree* tree, uxx nodeIndex, RadixTreeVisitFunc_f* visitFunc, void* contextPntr);
+	bool RadixTreeVisitPrefix(const RadixTree* tree, Str8 prefix, RadixTreeVisitFunc_f* visitFunc, void* contextPntr);
+	void RadixTreeCompleteSubtree(const RadixTree* tree, uxx nodeIndex, uxx maxResults, RadixNode** results, uxx* numResults);
+	uxx RadixTreeComplete(const RadixTree* tree, Str8 prefix, uxx maxResults, RadixNode** resultsOut);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                    Initialize RadixTree                      |
+// +--------------------------------------------------------------+
+PEXP void InitRadixTree(RadixTree* tree, Arena* arena)
+{
+	NotNull(tree);
+	NotNull(arena);
+	ClearPointer(tree);
+	tree->arena = arena;
+	InitVarArray(RadixNode, &tree->nodes, arena);
+	RadixNode* root = VarArrayAdd(RadixNode, &tree->nodes);
+	NotNull(root);
+	ClearPointer(root);
+}
+
+PEXPI bool IsRadixTreeInit(const RadixTree* tree)
+{
+	return (tree->arena != nullptr);
+}
+
+//NOTE: Keys that were copied into the arena are not freed, the expectation is the tree's arena is reset or thrown away as a whole
+PEXP void FreeRadixTree(RadixTree* tree)
+{
+	NotNull(tree);
+	Assert(IsRadixTreeInit(tree));
+	FreeVarArray(&tree->nodes);
+	ClearPointer(tree);
+}
+
+PEXPI RadixNode* RadixTreeGetNode(const RadixTree* tree, uxx nodeIndex)
+{
+	DebugNotNull(tree);
+	return VarArrayGetHard(RadixNode, &tree->nodes, nodeIndex);
+}
+
+// +--------------------------------------------------------------+
+// |                           Helpers                            |
+// +--------------------------------------------------------------+
+//Returns the number of bytes at the start of left and right that match
+PEXPI uxx RadixTreeCommonPrefixLength(Str8 left, Str8 right)
+{
+	uxx maxLength = (left.length < right.length) ? left.length : right.length;
+	uxx result = 0;
+	while (result < maxLength && left.bytes[result] == right.bytes[result]) { result++; }
+	return result;
+}
+
+//Links childIndex into parentIndex's list of children, keeping them sorted by first byte
+PEXP void RadixTreeLinkChild(RadixTree* tree, uxx parentIndex, uxx childIndex)
+{
+	RadixNode* parent = RadixTreeGetNode(tree, parentIndex);
+	RadixNode* child = RadixTreeGetNode(tree, childIndex);
+	DebugAssert(child->label.length > 0);
+	u8 firstByte = child->label.bytes[0];
+	uxx* linkPntr = &parent->firstChild;
+	while (*linkPntr != 0 && RadixTreeGetNode(tree, *linkPntr)->label.bytes[0] < firstByte)
+	{
+		linkPntr = &RadixTreeGetNode(tree, *linkPntr)->nextSibling;
+	}
+	child->nextSibling = *linkPntr;
+	*linkPntr = childIndex;
+}
+
+//Finds the child whose label starts with firstByte, returns 0 if there isn't one
+PEXPI uxx RadixTreeFindChild(const RadixTree* tree, const RadixNode* parent, u8 firstByte)
+{
+	uxx childIndex = parent->firstChild;
+	while (childIndex != 0)
+	{
+		const RadixNode* child = RadixTreeGetNode(tree, childIndex);
+		u8 childByte = child->label.bytes[0];
+		if (childByte == firstByte) { return childIndex; }
+		if (childByte > firstByte) { break; }
+		childIndex = child->nextSibling;
+	}
+	return 0;
+}
+
+// +--------------------------------------------------------------+
+// |                            Insert                            |
+// +--------------------------------------------------------------+
+//If the key is already in the tree its weight and value are overwritten.
+//If copyKey is false the memory pointed to by key must live as long as the tree does.
+//NOTE: The returned pointer is only valid until the next insert (the node VarArray may reallocate)
+PEXP RadixNode* RadixTreeInsertEx(RadixTree* tree, Str8 key, r32 weight, u64 value, bool copyKey)
+{
+	NotNull(tree);
+	Assert(IsRadixTreeInit(tree));
+	NotNullStr(key);
+	
+	//Make sure we won't reallocate halfway through a split (an insert adds at most 2 nodes)
+	VarArrayExpand(&tree->nodes, tree->nodes.length + 2);
+	
+	uxx nodeIndex = 0;
+	Str8 remaining = key;
+	while (true)
+	{
+		RadixNode* node = RadixTreeGetNode(tree, nodeIndex);
+		node->maxWeight = MaxR32(node->maxWeight, weight);
+		if (remaining.length == 0) { break; }
+		
+		uxx childIndex = RadixTreeFindChild(tree, node, remaining.bytes[0]);
+		if (childIndex == 0)
+		{
+			//No edge starts with this byte, the rest of the key becomes a new leaf
+			if (copyKey)
+			{
+				Str8 keyCopy = NewStr8(key.length, AllocMem(tree->arena, key.length));
+				NotNull(keyCopy.pntr);
+				MyMemCopy(keyCopy.pntr, key.pntr, key.length);
+				remaining = StrSliceFrom(keyCopy, key.length - remaining.length);
+				key = keyCopy;
+				copyKey = false;
+			}
+			uxx leafIndex = tree->nodes.length;
+			RadixNode* leaf = VarArrayAdd(RadixNode, &tree->nodes);
+			ClearPointer(leaf);
+			leaf->label = remaining;
+			leaf->maxWeight = weight;
+			RadixTreeLinkChild(tree, nodeIndex, leafIndex);
+			nodeIndex = leafIndex;
+			break;
+		}
+		
+		RadixNode* child = RadixTreeGetNode(tree, childIndex);
+		uxx matchLength = RadixTreeCommonPrefixLength(child->label, remaining);
+		if (matchLength < child->label.length)
+		{
+			//The key diverges (or ends) partway through this edge, split it
+			uxx splitIndex = tree->nodes.length;
+			RadixNode* split = VarArrayAdd(RadixNode, &tree->nodes);
+			child = RadixTreeGetNode(tree, childIndex);
+			node = RadixTreeGetNode(tree, nodeIndex);
+			ClearPointer(split);
+			split->label = StrSlice(child->label, 0, matchLength);
+			split->maxWeight = child->maxWeight;
+			split->firstChild = childIndex;
+			split->nextSibling = child->nextSibling;
+			child->label = StrSliceFrom(child->label, matchLength);
+			child->nextSibling = 0;
+			//The split node takes the child's place in the sibling list (it has the same first byte so order is preserved)
+			uxx* linkPntr = &node->firstChild;
+			while (*linkPntr != childIndex) { linkPntr = &RadixTreeGetNode(tree, *linkPntr)->nextSibling; }
+			*linkPntr = splitIndex;
+			childIndex = splitIndex;
+		}
+		
+		nodeIndex = childIndex;
+		remaining = StrSliceFrom(remaining, matchLength);
+	}
+	
+	RadixNode* result = RadixTreeGetNode(tree, nodeIndex);
+	if (!result->isEntry)
+	{
+		if (copyKey)
+		{
+			//The key ended on an existing branch point, labels already point at other keys so we only need our own copy for result->key
+			Str8 keyCopy = NewStr8(key.length, AllocMem(tree->arena, key.length));
+			NotNull(keyCopy.pntr);
+			MyMemCopy(keyCopy.pntr, key.pntr, key.length);
+			key = keyCopy;
+		}
+		result->isEntry = true;
+		result->key = key;
+		tree->numEntries++;
+	}
+	result->weight = weight;
+	result->maxWeight = MaxR32(result->maxWeight, weight);
+	result->value = value;
+	return result;
+}
+PEXPI RadixNode* RadixTreeInsert(RadixTree* tree, Str8 key, r32 weight, u64 value) { return RadixTreeInsertEx(tree, key, weight, value, true); }
+
+//Byte-wise comparison, a key sorts before any longer key that it's a prefix of
+PEXPI i32 RadixTreeCompareKeys_(Str8 left, Str8 right)
+{
+	uxx minLength = (left.length < right.length) ? left.length : right.length;
+	i32 compareResult = (minLength > 0) ? MyMemCompare(left.bytes, right.bytes, minLength) : 0;
+	if (compareResult != 0) { return compareResult; }
+	return (left.length < right.length) ? -1 : ((left.length > right.length) ? 1 : 0);
+}
+
+//Builds the children of parentIndex from sortedIndices[startIndex, endIndex), which all share their first depth bytes
+//and are all longer than depth. Returns the largest weight in the range
+PEXP r32 RadixTreeBuildRange_(RadixTree* tree, const Str8* keys, const r32* weights, const uxx* sortedIndices, uxx startIndex, uxx endIndex, uxx depth, uxx parentIndex)
+{
+	r32 result = 0.0f;
+	uxx prevChildIndex = 0;
+	uxx rangeIndex = startIndex;
+	while (rangeIndex < endIndex)
+	{
+		//Keys are sorted so everything with the same byte at depth is contiguous, and the common prefix of the whole group is the common prefix of its first and last keys
+		Str8 firstKey = keys[sortedIndices[rangeIndex]];
+		u8 groupByte = firstKey.bytes[depth];
+		uxx groupEnd = rangeIndex + 1;
+		while (groupEnd < endIndex && keys[sortedIndices[groupEnd]].bytes[depth] == groupByte) { groupEnd++; }
+		Str8 lastKey = keys[sortedIndices[groupEnd-1]];
+		uxx labelEnd = depth + RadixTreeCommonPrefixLength(StrSliceFrom(firstKey, depth), StrSliceFrom(lastKey, depth));
+		
+		//Space for all the nodes was reserved up front so this never reallocates
+		uxx nodeIndex = tree->nodes.length;
+		RadixNode* node = VarArrayAdd(RadixNode, &tree->nodes);
+		ClearPointer(node);
+		node->label = StrSlice(firstKey, depth, labelEnd);
+		if (prevChildIndex == 0) { RadixTreeGetNode(tree, parentIndex)->firstChild = nodeIndex; }
+		else { RadixTreeGetNode(tree, prevChildIndex)->nextSibling = nodeIndex; }
+		prevChildIndex = nodeIndex;
+		
+		uxx childrenStart = rangeIndex;
+		r32 maxWeight = 0.0f;
+		bool hasWeight = false;
+		if (firstKey.length == labelEnd)
+		{
+			//The shortest key in the group ends exactly here (it sorts first)
+			node->isEntry = true;
+			node->key = firstKey;
+			node->value = (u64)sortedIndices[rangeIndex];
+			node->weight = (weights != nullptr) ? weights[sortedIndices[rangeIndex]] : 0.0f;
+			maxWeight = node->weight;
+			hasWeight = true;
+			tree->numEntries++;
+			childrenStart++;
+		}
+		if (childrenStart < groupEnd)
+		{
+			r32 childrenMaxWeight = RadixTreeBuildRange_(tree, keys, weights, sortedIndices, childrenStart, groupEnd, labelEnd, nodeIndex);
+			maxWeight = hasWeight ? MaxR32(maxWeight, childrenMaxWeight) : childrenMaxWeight;
+		}
+		RadixTreeGetNode(tree, nodeIndex)->maxWeight = maxWeight;
+		result = (rangeIndex == startIndex) ? maxWeight : MaxR32(result, maxWeight);
+		rangeIndex = groupEnd;
+	}
+	return result;
+}
+
+//Bulk-build mode for static dictionaries. When the tree is empty the keys are sorted and the whole tree is built
+//in one pass (each node is created once with its final label, no splitting). A tree that already has entries falls
+//back to inserting each key. When copyKeys is true all the keys are packed into a single allocation instead of one per key.
+//The value of each entry is set to its index in the keys array (for duplicate keys the last one wins, like insert).
+//weights can be nullptr (all entries get weight 0). NOTE: The sort uses a scratch arena
+PEXP void RadixTreeBuild(RadixTree* tree, uxx numEntries, const Str8* keys, const r32* weights, bool copyKeys)
+{
+	NotNull(tree);
+	Assert(IsRadixTreeInit(tree));
+	Assert(keys != nullptr || numEntries == 0);
+	if (numEntries == 0) { return; }
+	ScratchBegin1(scratch, tree->arena);
+	
+	//n keys need at most 2n nodes (each key adds a leaf and at most one branch point)
+	VarArrayExpand(&tree->nodes, tree->nodes.length + numEntries*2);
+	
+	Str8* finalKeys = AllocArray(Str8, scratch, numEntries);
+	NotNull(finalKeys);
+	MyMemCopy(finalKeys, keys, sizeof(Str8) * numEntries);
+	if (copyKeys)
+	{
+		uxx totalLength = 0;
+		for (uxx eIndex = 0; eIndex < numEntries; eIndex++) { totalLength += keys[eIndex].length; }
+		u8* keyBytes = (totalLength > 0) ? (u8*)AllocMem(tree->arena, totalLength) : nullptr;
+		Assert(keyBytes != nullptr || totalLength == 0);
+		for (uxx eIndex = 0; eIndex < numEntries; eIndex++)
+		{
+			if (finalKeys[eIndex].length == 0) { continue; }
+			MyMemCopy(keyBytes, finalKeys[eIndex].pntr, finalKeys[eIndex].length);
+			finalKeys[eIndex].bytes = keyBytes;
+			keyBytes += finalKeys[eIndex].length;
+		}
+	}
+	
+	if (tree->numEntries > 0 || tree->nodes.length > 1)
+	{
+		for (uxx eIndex = 0; eIndex < numEntries; eIndex++)
+		{
+			RadixTreeInsertEx(tree, finalKeys[eIndex], (weights != nullptr) ? weights[eIndex] : 0.0f, (u64)eIndex, false);
+		}
+		ScratchEnd(scratch);
+		return;
+	}
+	
+	//Bottom-up merge sort of the key indices (ties are broken by index so duplicates stay in their original order)
+	uxx* sortedIndices = AllocArray(uxx, scratch, numEntries);
+	uxx* tempIndices = AllocArray(uxx, scratch, numEntries);
+	NotNull(sortedIndices);
+	NotNull(tempIndices);
+	for (uxx eIndex = 0; eIndex < numEntries; eIndex++) { sortedIndices[eIndex] = eIndex; }
+	for (uxx runLength = 1; runLength < numEntries; runLength *= 2)
+	{
+		for (uxx runStart = 0; runStart < numEntries; runStart += runLength*2)
+		{
+			uxx middle = MinUXX(runStart + runLength, numEntries);
+			uxx runEnd = MinUXX(runStart + runLength*2, numEntries);
+			uxx leftIndex = runStart;
+			uxx rightIndex = middle;
+			for (uxx outIndex = runStart; outIndex < runEnd; outIndex++)
+			{
+				bool takeLeft = (rightIndex >= runEnd || (leftIndex < middle && RadixTreeCompareKeys_(finalKeys[sortedIndices[leftIndex]], finalKeys[sortedIndices[rightIndex]]) <= 0));
+				tempIndices[outIndex] = takeLeft ? sortedIndices[leftIndex++] : sortedIndices[rightIndex++];
+			}
+		}
+		uxx* swapIndices = sortedIndices;
+		sortedIndices = tempIndices;
+		tempIndices = swapIndices;
+	}
+	
+	//Drop duplicate keys, keeping the last one
+	uxx numUnique = 0;
+	for (uxx sIndex = 0; sIndex < numEntries; sIndex++)
+	{
+		if (sIndex + 1 < numEntries && StrExactEquals(finalKeys[sortedIndices[sIndex]], finalKeys[sortedIndices[sIndex+1]])) { continue; }
+		sortedIndices[numUnique] = sortedIndices[sIndex];
+		numUnique++;
+	}
+	
+	RadixNode* root = RadixTreeGetNode(tree, 0);
+	uxx childrenStart = 0;
+	if (finalKeys[sortedIndices[0]].length == 0)
+	{
+		//The empty key is stored on the root
+		root->isEntry = true;
+		root->key = finalKeys[sortedIndices[0]];
+		root->value = (u64)sortedIndices[0];
+		root->weight = (weights != nullptr) ? weights[sortedIndices[0]] : 0.0f;
+		root->maxWeight = MaxR32(root->maxWeight, root->weight);
+		tree->numEntries++;
+		childrenStart++;
+	}
+	if (childrenStart < numUnique)
+	{
+		r32 childrenMaxWeight = RadixTreeBuildRange_(tree, finalKeys, weights, sortedIndices, childrenStart, numUnique, 0, 0);
+		root = RadixTreeGetNode(tree, 0);
+		root->maxWeight = MaxR32(root->maxWeight, childrenMaxWeight);
+	}
+	ScratchEnd(scratch);
+}
+
+// +--------------------------------------------------------------+
+// |                            Lookup                            |
+// +--------------------------------------------------------------+
+PEXP RadixNode* RadixTreeFind(const RadixTree* tree, Str8 key)
+{
+	NotNull(tree);
+	NotNullStr(key);
+	uxx nodeIndex = 0;
+	Str8 remaining = key;
+	while (remaining.length > 0)
+	{
+		uxx childIndex = RadixTreeFindChild(tree, RadixTreeGetNode(tree, nodeIndex), remaining.bytes[0]);
+		if (childIndex == 0) { return nullptr; }
+		RadixNode* child = RadixTreeGetNode(tree, childIndex);
+		if (!StrExactStartsWith(remaining, child->label)) { return nullptr; }
+		remaining = StrSliceFrom(remaining, child->label.length);
+		nodeIndex = childIndex;
+	}
+	RadixNode* result = RadixTreeGetNode(tree, nodeIndex);
+	return result->isEntry ? result : nullptr;
+}
+PEXPI bool RadixTreeContains(const RadixTree* tree, Str8 key) { return (RadixTreeFind(tree, key) != nullptr); }
+
+//Returns the index of the highest node whose subtree holds exactly the entries that start with prefix.
+//Returns UINTXX_MAX if no entries start with prefix (0 is a valid result, it's the root, for an empty prefix)
+PEXP uxx RadixTreeFindPrefix(const RadixTree* tree, Str8 prefix)
+{
+	NotNull(tree);
+	NotNullStr(prefix);
+	uxx nodeIndex = 0;
+	Str8 remaining = prefix;
+	while (remaining.length > 0)
+	{
+		uxx childIndex = RadixTreeFindChild(tree, RadixTreeGetNode(tree, nodeIndex), remaining.bytes[0]);
+		if (childIndex == 0) { return UINTXX_MAX; }
+		RadixNode* child = RadixTreeGetNode(tree, childIndex);
+		uxx matchLength = RadixTreeCommonPrefixLength(child->label, remaining);
+		if (matchLength == remaining.length) { return childIndex; } //prefix ends on or inside this edge
+		if (matchLength < child->label.length) { return UINTXX_MAX; }
+		remaining = StrSliceFrom(remaining, matchLength);
+		nodeIndex = childIndex;
+	}
+	return nodeIndex;
+}
+
+//Depth-first, returns false if visitFunc asked us to stop
+PEXP bool RadixTreeVisitSubtree(const RadixTree* tree, uxx nodeIndex, RadixTreeVisitFunc_f* visitFunc, void* contextPntr)
+{
+	const RadixNode* node = RadixTreeGetNode(tree, nodeIndex);
+	if (node->isEntry && !visitFunc(node, contextPntr)) { return false; }
+	for (uxx childIndex = node->firstChild; childIndex != 0; childIndex = RadixTreeGetNode(tree, childIndex)->nextSibling)
+	{
+		if (!RadixTreeVisitSubtree(tree, childIndex, visitFunc, contextPntr)) { return false; }
+	}
+	return true;
+}
+
+//Visits every entry that starts with prefix in sorted (byte-wise) order. visitFunc returns false to stop early
+PEXP bool RadixTreeVisitPrefix(const RadixTree* tree, Str8 prefix, RadixTreeVisitFunc_f* visitFunc, void* contextPntr)
+{
+	NotNull(visitFunc);
+	uxx nodeIndex = RadixTreeFindPrefix(tree, prefix);
+	if (nodeIndex == UINTXX_MAX) { return true; }
+	return RadixTreeVisitSubtree(tree, nodeIndex, visitFunc, contextPntr);
+}
+
+// +--------------------------------------------------------------+
+// |                     Top-K Completion                         |
+// +--------------------------------------------------------------+
+PEXP void RadixTreeCompleteSubtree(const RadixTree* tree, uxx nodeIndex, uxx maxResults, RadixNode** results, uxx* numResults)
+{
+	RadixNode* node = RadixTreeGetNode(tree, nodeIndex);
+	//Nothing down here can beat the worst result we already have
+	if (*numResults == maxResults && node->maxWeight <= results[maxResults-1]->weight) { return; }
+	
+	if (node->isEntry && (*numResults < maxResults || node->weight > results[maxResults-1]->weight))
+	{
+		//Insertion sort into the results, which are kept sorted highest weight first
+		uxx insertIndex = (*numResults < maxResults) ? *numResults : maxResults-1;
+		while (insertIndex > 0 && results[insertIndex-1]->weight < node->weight)
+		{
+			results[insertIndex] = results[insertIndex-1];
+			insertIndex--;
+		}
+		results[insertIndex] = node;
+		if (*numResults < maxResults) { (*numResults)++; }
+	}
+	
+	for (uxx childIndex = node->firstChild; childIndex != 0; childIndex = RadixTreeGetNode(tree, childIndex)->nextSibling)
+	{
+		RadixTreeCompleteSubtree(tree, childIndex, maxResults, results, numResults);
+	}
+}
+
+//Fills resultsOut with up to maxResults entries that start with prefix, highest weight first. Returns the number of results
+PEXP uxx RadixTreeComplete(const RadixTree* tree, Str8 prefix, uxx maxResults, RadixNode** resultsOut)
+{
+	NotNull(tree);
+	Assert(resultsOut != nullptr || maxResults == 0);
+	if (maxResults == 0) { return 0; }
+	uxx nodeIndex = RadixTreeFindPrefix(tree, prefix);
+	if (nodeIndex == UINTXX_MAX) { return 0; }
+	uxx result = 0;
+	RadixTreeCompleteSubtree(tree, nodeIndex, maxResults, resultsOut, &result);
+	return result;
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _STRUCT_RADIX_TREE_H
@@ -0,0 +1,421 @@
+/*
+File:   struct_sparse_grid.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Defines SparseGrid2D and SparseGrid3D which are unbounded grids of items that are
+	** split into fixed size chunks (16x16 for 2D and 16x16x16 for 3D). Chunks are only
+	** allocated (from the Arena the grid was initialized with) the first time something
+	** asks for write access to one of their cells, and a freshly allocated chunk is
+	** zeroed. Chunks are found through a small open-addressed hash map keyed on the
+	** chunk coordinate so lookups are O(1) regardless of how spread out the world is.
+	** Coordinates can be negative.
+	** Inside each chunk items are stored row-major (x, then y, then z), chunks are
+	** small enough that the whole chunk is a handful of cache lines anyway.
+	** NOTE: We rely on >> of a negative i32 being an arithmetic shift (true for MSVC, Clang, and GCC)
+*/
+
+/*
+* Usage Example:
+*	SparseGrid2D world;
+*	InitSparseGrid2D(u16, &world, arena);
+*	*SparseGrid2DGet(u16, &world, NewV2i(-1000, 50000)) = 7; //allocates the chunk
+*	u16* tile = SparseGrid2DPeek(u16, &world, NewV2i(12, 12)); //nullptr, that chunk was never touched
+*	FreeSparseGrid2D(&world);
+*/
+
+#ifndef _STRUCT_SPARSE_GRID_H
+#define _STRUCT_SPARSE_GRID_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+#include "struct/struct_directions.h"
+#include "struct/struct_vectors.h"
+#include "struct/struct_grid.h"
+
+#define SPARSE_GRID2D_CHUNK_SHIFT 4 //16x16 chunks
+#define SPARSE_GRID2D_CHUNK_SIZE  (1 << SPARSE_GRID2D_CHUNK_SHIFT)
+#define SPARSE_GRID2D_CHUNK_MASK  (SPARSE_GRID2D_CHUNK_SIZE - 1)
+#define SPARSE_GRID2D_CHUNK_AREA  (SPARSE_GRID2D_CHUNK_SIZE * SPARSE_GRID2D_CHUNK_SIZE)
+
+#define SPARSE_GRID3D_CHUNK_SHIFT  4 //16x16x16 chunks
+#define SPARSE_GRID3D_CHUNK_SIZE   (1 << SPARSE_GRID3D_CHUNK_SHIFT)
+#define SPARSE_GRID3D_CHUNK_MASK   (SPARSE_GRID3D_CHUNK_SIZE - 1)
+#define SPARSE_GRID3D_CHUNK_VOLUME (SPARSE_GRID3D_CHUNK_SIZE * SPARSE_GRID3D_CHUNK_SIZE * SPARSE_GRID3D_CHUNK_SIZE)
+
+#define SPARSE_GRID_MIN_NUM_SLOTS 16 //must be a power of 2
+
+// +--------------------------------------------------------------+
+// |                       Data Structures                        |
+// +--------------------------------------------------------------+
+typedef struct SparseGridSlot SparseGridSlot;
+struct SparseGridSlot
+{
+	v3i chunkCoord; //z is always 0 for SparseGrid2D
+	void* items; //nullptr means the slot is empty
+};
+
+//Open-addressed (linear probing) hash map from chunk coordinate to chunk allocation, kept at or below 50% load
+typedef struct SparseGridChunkMap SparseGridChunkMap;
+struct SparseGridChunkMap
+{
+	uxx numChunks;
+	uxx numSlots; //always 0 or a power of 2
+	SparseGridSlot* slots;
+};
+
+typedef struct SparseGrid2D SparseGrid2D;
+struct SparseGrid2D
+{
+	Arena* arena; //doubles as IsInit check
+	uxx itemSize;
+	uxx itemAlignment;
+	SparseGridChunkMap chunks;
+};
+
+typedef struct SparseGrid3D SparseGrid3D;
+struct SparseGrid3D
+{
+	Arena* arena; //doubles as IsInit check
+	uxx itemSize;
+	uxx itemAlignment;
+	SparseGridChunkMap chunks;
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	PIG_CORE_INLINE u64 SparseGridHashChunkCoord(v3i chunkCoord);
+	PIG_CORE_INLINE uxx SparseGridFindSlot(const SparseGridChunkMap* map, v3i chunkCoord);
+	void SparseGridGrowChunkMap(Arena* arena, SparseGridChunkMap* map, uxx numSlots);
+	void* SparseGridGetChunk(Arena* arena, SparseGridChunkMap* map, v3i chunkCoord, uxx chunkSize, uxx itemAlignment, bool allocate);
+	void SparseGridFreeChunkMap(Arena* arena, SparseGridChunkMap* map, uxx chunkSize);
+	void SparseGridCopyChunkMap(Arena* arena, SparseGridChunkMap* destMap, const SparseGridChunkMap* sourceMap, uxx chunkSize, uxx itemAlignment);
+	void InitSparseGrid2D_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, Arena* arena);
+	PIG_CORE_INLINE bool IsSparseGrid2DInit(const SparseGrid2D* grid);
+	void FreeSparseGrid2D(SparseGrid2D* grid);
+	PIG_CORE_INLINE void* SparseGrid2DGet_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, v2i coord, bool allocate);
+	PIG_CORE_INLINE void* SparseGrid2DGetNeighbor_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, v2i coord, Dir2Ex dir2ex, bool allocate);
+	void SparseGrid2DFillRec_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, v2i min, v2i size, const void* valuePntr);
+	void SparseGrid2DCopy(SparseGrid2D* destGrid, const SparseGrid2D* sourceGrid, Arena* arena);
+	void InitSparseGrid3D_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, Arena* arena);
+	PIG_CORE_INLINE bool IsSparseGrid3DInit(const SparseGrid3D* grid);
+	void FreeSparseGrid3D(SparseGrid3D* grid);
+	PIG_CORE_INLINE void* SparseGrid3DGet_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, v3i coord, bool allocate);
+	PIG_CORE_INLINE void* SparseGrid3DGetNeighbor_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, v3i coord, Dir3 dir3, bool allocate);
+	void SparseGrid3DFillBox_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, v3i min, v3i size, const void* valuePntr);
+	void SparseGrid3DCopy(SparseGrid3D* destGrid, const SparseGrid3D* sourceGrid, Arena* arena);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                            Macros                            |
+// +--------------------------------------------------------------+
+#define InitSparseGrid2D(type, gridPntr, arena) InitSparseGrid2D_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (arena))
+#define InitSparseGrid3D(type, gridPntr, arena) InitSparseGrid3D_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (arena))
+
+//Get allocates the chunk if needed (use this when writing), Peek returns nullptr if the chunk has never been allocated
+#define SparseGrid2DGet(type, gridPntr, coord)  ((type*)SparseGrid2DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), true))
+#define SparseGrid2DPeek(type, gridPntr, coord) ((type*)SparseGrid2DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), false))
+#define SparseGrid3DGet(type, gridPntr, coord)  ((type*)SparseGrid3DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), true))
+#define SparseGrid3DPeek(type, gridPntr, coord) ((type*)SparseGrid3DGet_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), false))
+
+#define SparseGrid2DGetNeighbor(type, gridPntr, coord, dir2ex)  ((type*)SparseGrid2DGetNeighbor_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), (Dir2Ex)(dir2ex), true))
+#define SparseGrid2DPeekNeighbor(type, gridPntr, coord, dir2ex) ((type*)SparseGrid2DGetNeighbor_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), (Dir2Ex)(dir2ex), false))
+#define SparseGrid3DGetNeighbor(type, gridPntr, coord, dir3)    ((type*)SparseGrid3DGetNeighbor_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), (dir3), true))
+#define SparseGrid3DPeekNeighbor(type, gridPntr, coord, dir3)   ((type*)SparseGrid3DGetNeighbor_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (coord), (dir3), false))
+
+#define SparseGrid2DFillRec(type, gridPntr, min, size, value) do                                                     \
+{                                                                                                                    \
+	type fillValue_NOCONFLICT = (value);                                                                             \
+	SparseGrid2DFillRec_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (min), (size), &fillValue_NOCONFLICT);  \
+} while(0)
+#define SparseGrid3DFillBox(type, gridPntr, min, size, value) do                                                     \
+{                                                                                                                    \
+	type fillValue_NOCONFLICT = (value);                                                                             \
+	SparseGrid3DFillBox_((uxx)sizeof(type), (uxx)_Alignof(type), (gridPntr), (min), (size), &fillValue_NOCONFLICT);  \
+} while(0)
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+// +==============================+
+// |          Chunk Map           |
+// +==============================+
+PEXPI u64 SparseGridHashChunkCoord(v3i chunkCoord)
+{
+	u64 result = ((u64)(u32)chunkCoord.X * 0x9E3779B97F4A7C15ULL);
+	result ^= ((u64)(u32)chunkCoord.Y * 0xC2B2AE3D27D4EB4FULL);
+	result ^= ((u64)(u32)chunkCoord.Z * 0x165667B19E3779F9ULL);
+	result ^= (result >> 29);
+	return result;
+}
+
+//Returns the slot that holds chunkCoord, or the empty slot where it would be inserted
+PEXPI uxx SparseGridFindSlot(const SparseGridChunkMap* map, v3i chunkCoord)
+{
+	DebugAssert(map->numSlots > 0);
+	uxx slotMask = map->numSlots - 1;
+	uxx slotIndex = (uxx)SparseGridHashChunkCoord(chunkCoord) & slotMask;
+	while (true)
+	{
+		const SparseGridSlot* slot = &map->slots[slotIndex];
+		if (slot->items == nullptr) { return slotIndex; }
+		if (slot->chunkCoord.X == chunkCoord.X && slot->chunkCoord.Y == chunkCoord.Y && slot->chunkCoord.Z == chunkCoord.Z) { return slotIndex; }
+		slotIndex = (slotIndex + 1) & slotMask;
+	}
+}
+
+PEXP void SparseGridGrowChunkMap(Arena* arena, SparseGridChunkMap* map, uxx numSlots)
+{
+	Assert(numSlots > 0 && (numSlots & (numSlots-1)) == 0);
+	Assert(numSlots > map->numChunks);
+	SparseGridChunkMap newMap = ZEROED;
+	newMap.numSlots = numSlots;
+	newMap.slots = AllocArray(SparseGridSlot, arena, numSlots);
+	NotNull(newMap.slots);
+	MyMemSet(newMap.slots, 0x00, sizeof(SparseGridSlot) * numSlots);
+	for (uxx sIndex = 0; sIndex < map->numSlots; sIndex++)
+	{
+		SparseGridSlot* oldSlot = &map->slots[sIndex];
+		if (oldSlot->items != nullptr)
+		{
+			newMap.slots[SparseGridFindSlot(&newMap, oldSlot->chunkCoord)] = *oldSlot;
+			newMap.numChunks++;
+		}
+	}
+	if (map->slots != nullptr && CanArenaFree(arena)) { FreeMem(arena, map->slots, sizeof(SparseGridSlot) * map->numSlots); }
+	*map = newMap;
+}
+
+//chunkSize is in bytes. Returns nullptr if allocate is false and the chunk doesn't exist yet
+PEXP void* SparseGridGetChunk(Arena* arena, SparseGridChunkMap* map, v3i chunkCoord, uxx chunkSize, uxx itemAlignment, bool allocate)
+{
+	if (map->numSlots > 0)
+	{
+		SparseGridSlot* slot = &map->slots[SparseGridFindSlot(map, chunkCoord)];
+		if (slot->items != nullptr) { return slot->items; }
+	}
+	if (!allocate) { return nullptr; }
+	
+	if ((map->numChunks+1) * 2 > map->numSlots)
+	{
+		SparseGridGrowChunkMap(arena, map, (map->numSlots > 0) ? map->numSlots*2 : SPARSE_GRID_MIN_NUM_SLOTS);
+	}
+	SparseGridSlot* slot = &map->slots[SparseGridFindSlot(map, chunkCoord)];
+	DebugAssert(slot->items == nullptr);
+	slot->chunkCoord = chunkCoord;
+	slot->items = AllocMemAligned(arena, chunkSize, itemAlignment);
+	NotNull(slot->items);
+	MyMemSet(slot->items, 0x00, chunkSize);
+	map->numChunks++;
+	return slot->items;
+}
+
+PEXP void SparseGridFreeChunkMap(Arena* arena, SparseGridChunkMap* map, uxx chunkSize)
+{
+	if (CanArenaFree(arena))
+	{
+		for (uxx sIndex = 0; sIndex < map->numSlots; sIndex++)
+		{
+			if (map->slots[sIndex].items != nullptr) { FreeMem(arena, map->slots[sIndex].items, chunkSize); }
+		}
+		if (map->slots != nullptr) { FreeMem(arena, map->slots, sizeof(SparseGridSlot) * map->numSlots); }
+	}
+	ClearPointer(map);
+}
+
+//NOTE: destMap is expected to be empty
+PEXP void SparseGridCopyChunkMap(Arena* arena, SparseGridChunkMap* destMap, const SparseGridChunkMap* sourceMap, uxx chunkSize, uxx itemAlignment)
+{
+	Assert(destMap->numChunks == 0 && destMap->numSlots == 0);
+	if (sourceMap->numChunks == 0) { return; }
+	destMap->numSlots = sourceMap->numSlots;
+	destMap->numChunks = sourceMap->numChunks;
+	destMap->slots = AllocArray(SparseGridSlot, arena, sourceMap->numSlots);
+	NotNull(destMap->slots);
+	for (uxx sIndex = 0; sIndex < sourceMap->numSlots; sIndex++)
+	{
+		const SparseGridSlot* sourceSlot = &sourceMap->slots[sIndex];
+		SparseGridSlot* destSlot = &destMap->slots[sIndex];
+		destSlot->chunkCoord = sourceSlot->chunkCoord;
+		destSlot->items = nullptr;
+		if (sourceSlot->items != nullptr)
+		{
+			destSlot->items = AllocMemAligned(arena, chunkSize, itemAlignment);
+			NotNull(destSlot->items);
+			MyMemCopy(destSlot->items, sourceSlot->items, chunkSize);
+		}
+	}
+}
+
+// +==============================+
+// |         SparseGrid2D         |
+// +==============================+
+PEXP void InitSparseGrid2D_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, Arena* arena)
+{
+	NotNull(grid);
+	NotNull(arena);
+	Assert(itemSize > 0);
+	ClearPointer(grid);
+	grid->arena = arena;
+	grid->itemSize = itemSize;
+	grid->itemAlignment = itemAlignment;
+}
+
+PEXPI bool IsSparseGrid2DInit(const SparseGrid2D* grid)
+{
+	return (grid->arena != nullptr);
+}
+
+PEXP void FreeSparseGrid2D(SparseGrid2D* grid)
+{
+	NotNull(grid);
+	Assert(IsSparseGrid2DInit(grid));
+	SparseGridFreeChunkMap(grid->arena, &grid->chunks, grid->itemSize * SPARSE_GRID2D_CHUNK_AREA);
+	ClearPointer(grid);
+}
+
+PEXPI void* SparseGrid2DGet_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, v2i coord, bool allocate)
+{
+	DebugNotNull(grid);
+	#if DEBUG_BUILD
+	AssertMsg(grid->itemSize == itemSize, "Invalid itemSize passed to SparseGrid2DGet. Make sure you're accessing the SparseGrid2D with the correct type!");
+	AssertMsg(grid->itemAlignment == itemAlignment, "Invalid itemAlignment passed to SparseGrid2DGet. Make sure you're accessing the SparseGrid2D with the correct type!");
+	#else
+	UNUSED(itemSize);
+	UNUSED(itemAlignment);
+	#endif
+	v3i chunkCoord = NewV3i(coord.X >> SPARSE_GRID2D_CHUNK_SHIFT, coord.Y >> SPARSE_GRID2D_CHUNK_SHIFT, 0);
+	u8* chunkItems = (u8*)SparseGridGetChunk(grid->arena, &grid->chunks, chunkCoord, grid->itemSize * SPARSE_GRID2D_CHUNK_AREA, grid->itemAlignment, allocate);
+	if (chunkItems == nullptr) { return nullptr; }
+	uxx cellIndex = ((uxx)(coord.Y & SPARSE_GRID2D_CHUNK_MASK) << SPARSE_GRID2D_CHUNK_SHIFT) | (uxx)(coord.X & SPARSE_GRID2D_CHUNK_MASK);
+	return chunkItems + (cellIndex * grid->itemSize);
+}
+
+PEXPI void* SparseGrid2DGetNeighbor_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, v2i coord, Dir2Ex dir2ex, bool allocate)
+{
+	v2i offset = ToV2iFromDir2Ex(dir2ex);
+	return SparseGrid2DGet_(itemSize, itemAlignment, grid, NewV2i(coord.X + offset.X, coord.Y + offset.Y), allocate);
+}
+
+//Allocates any chunks the rectangle touches. Each row inside a chunk is contiguous so we fill a run of cells at a time
+PEXP void SparseGrid2DFillRec_(uxx itemSize, uxx itemAlignment, SparseGrid2D* grid, v2i min, v2i size, const void* valuePntr)
+{
+	NotNull(grid);
+	NotNull(valuePntr);
+	Assert(grid->itemSize == itemSize);
+	for (i32 yPos = min.Y; yPos < min.Y + size.Y; yPos++)
+	{
+		i32 xPos = min.X;
+		while (xPos < min.X + size.X)
+		{
+			i32 runLength = MinI32(SPARSE_GRID2D_CHUNK_SIZE - (xPos & SPARSE_GRID2D_CHUNK_MASK), (min.X + size.X) - xPos);
+			u8* runPntr = (u8*)SparseGrid2DGet_(itemSize, itemAlignment, grid, NewV2i(xPos, yPos), true);
+			MyMemCopy(runPntr, valuePntr, itemSize);
+			GridFillByDoubling(runPntr, itemSize, (uxx)runLength);
+			xPos += runLength;
+		}
+	}
+}
+
+PEXP void SparseGrid2DCopy(SparseGrid2D* destGrid, const SparseGrid2D* sourceGrid, Arena* arena)
+{
+	NotNull(destGrid);
+	NotNull(sourceGrid);
+	Assert(IsSparseGrid2DInit(sourceGrid));
+	InitSparseGrid2D_(sourceGrid->itemSize, sourceGrid->itemAlignment, destGrid, arena);
+	SparseGridCopyChunkMap(arena, &destGrid->chunks, &sourceGrid->chunks, sourceGrid->itemSize * SPARSE_GRID2D_CHUNK_AREA, sourceGrid->itemAlignment);
+}
+
+// +==============================+
+// |         SparseGrid3D         |
+// +==============================+
+PEXP void InitSparseGrid3D_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, Arena* arena)
+{
+	NotNull(grid);
+	NotNull(arena);
+	Assert(itemSize > 0);
+	ClearPointer(grid);
+	grid->arena = arena;
+	grid->itemSize = itemSize;
+	grid->itemAlignment = itemAlignment;
+}
+
+PEXPI bool IsSparseGrid3DInit(const SparseGrid3D* grid)
+{
+	return (grid->arena != nullptr);
+}
+
+PEXP void FreeSparseGrid3D(SparseGrid3D* grid)
+{
+	NotNull(grid);
+	Assert(IsSparseGrid3DInit(grid));
+	SparseGridFreeChunkMap(grid->arena, &grid->chunks, grid->itemSize * SPARSE_GRID3D_CHUNK_VOLUME);
+	ClearPointer(grid);
+}
+
+PEXPI void* SparseGrid3DGet_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, v3i coord, bool allocate)
+{
+	DebugNotNull(grid);
+	#if DEBUG_BUILD
+	AssertMsg(grid->itemSize == itemSize, "Invalid itemSize passed to SparseGrid3DGet. Make sure you're accessing the SparseGrid3D with the correct type!");
+	AssertMsg(grid->itemAlignment == itemAlignment, "Invalid itemAlignment passed to SparseGrid3DGet. Make sure you're accessing the SparseGrid3D with the correct type!");
+	#else
+	UNUSED(itemSize);
+	UNUSED(itemAlignment);
+	#endif
+	v3i chunkCoord = NewV3i(coord.X >> SPARSE_GRID3D_CHUNK_SHIFT, coord.Y >> SPARSE_GRID3D_CHUNK_SHIFT, coord.Z >> SPARSE_GRID3D_CHUNK_SHIFT);
+	u8* chunkItems = (u8*)SparseGridGetChunk(grid->arena, &grid->chunks, chunkCoord, grid->itemSize * SPARSE_GRID3D_CHUNK_VOLUME, grid->itemAlignment, allocate);
+	if (chunkItems == nullptr) { return nullptr; }
+	uxx cellIndex = ((uxx)(coord.Z & SPARSE_GRID3D_CHUNK_MASK) << (SPARSE_GRID3D_CHUNK_SHIFT*2)) | ((uxx)(coord.Y & SPARSE_GRID3D_CHUNK_MASK) << SPARSE_GRID3D_CHUNK_SHIFT) | (uxx)(coord.X & SPARSE_GRID3D_CHUNK_MASK);
+	return chunkItems + (cellIndex * grid->itemSize);
+}
+
+PEXPI void* SparseGrid3DGetNeighbor_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, v3i coord, Dir3 dir3, bool allocate)
+{
+	v3i offset = ToV3iFromDir3(dir3);
+	return SparseGrid3DGet_(itemSize, itemAlignment, grid, NewV3i(coord.X + offset.X, coord.Y + offset.Y, coord.Z + offset.Z), allocate);
+}
+
+PEXP void SparseGrid3DFillBox_(uxx itemSize, uxx itemAlignment, SparseGrid3D* grid, v3i min, v3i size, const void* valuePntr)
+{
+	NotNull(grid);
+	NotNull(valuePntr);
+	Assert(grid->itemSize == itemSize);
+	for (i32 zPos = min.Z; zPos < min.Z + size.Z; zPos++)
+	{
+		for (i32 yPos = min.Y; yPos < min.Y + size.Y; yPos++)
+		{
+			i32 xPos = min.X;
+			while (xPos < min.X + size.X)
+			{
+				i32 runLength = MinI32(SPARSE_GRID3D_CHUNK_SIZE - (xPos & SPARSE_GRID3D_CHUNK_MASK), (min.X + size.X) - xPos);
+				u8* runPntr = (u8*)SparseGrid3DGet_(itemSize, itemAlignment, grid, NewV3i(xPos, yPos, zPos), true);
+				MyMemCopy(runPntr, valuePntr, itemSize);
+				GridFillByDoubling(runPntr, itemSize, (uxx)runLength);
+				xPos += runLength;
+			}
+		}
+	}
+}
+
+PEXP void SparseGrid3DCopy(SparseGrid3D* destGrid, const SparseGrid3D* sourceGrid, Arena* arena)
+{
+	NotNull(destGrid);
+	NotNull(sourceGrid);
+	Assert(IsSparseGrid3DInit(sourceGrid));
+	InitSparseGrid3D_(sourceGrid->itemSize, sourceGrid->itemAlignment, destGrid, arena);
+	SparseGridCopyChunkMap(arena, &destGrid->chunks, &sourceGrid->chunks, sourceGrid->itemSize * SPARSE_GRID3D_CHUNK_VOLUME, sourceGrid->itemAlignment);
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _STRUCT_SPARSE_GRID_H
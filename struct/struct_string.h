@@ -18,6 +18,7 @@ Description:
 #include "base/base_macros.h"
 #include "base/base_assert.h"
 #include "base/base_char.h"
+#include "std/std_mem_search.h"
 
 // +--------------------------------------------------------------+
 // |                       String Structure                       |
@@ -270,18 +271,15 @@ PEXP bool StrExactContains(Str8 haystack, Str8 needle)
 {
 	Assert(needle.length > 0);
 	if (haystack.length < needle.length) { return false; }
-	for (uxx bIndex = 0; bIndex <= haystack.length - needle.length; bIndex++)
-	{
-		if (StrExactEquals(StrSliceLength(haystack, bIndex, needle.length), needle)) { return true; }
-	}
-	return false;
+	return (MemFindBytes(haystack.bytes, haystack.length, needle.bytes, needle.length) < haystack.length);
 }
 
+//NOTE: The AnyCase functions only fold ASCII letters, see StrUnicodeAnyCaseEquals in cross_string_and_unicode.h for full Unicode folding
 PEXPI bool StrAnyCaseEquals(Str8 left, Str8 right)
 {
-	if (StrExactEquals(left, right)) { return true; }
-	//TODO: Implement me!
-	return false;
+	if (left.length != right.length) { return false; }
+	if (left.length == 0) { return true; }
+	return MemEqualsAnyCase(left.bytes, right.bytes, left.length);
 }
 PEXPI bool StrAnyCaseEqualsAt(Str8 left, Str8 right, uxx leftIndex)
 {
@@ -289,21 +287,19 @@ PEXPI bool StrAnyCaseEqualsAt(Str8 left, Str8 right, uxx leftIndex)
 }
 PEXPI bool StrAnyCaseStartsWith(Str8 target, Str8 prefix)
 {
-	if (StrExactStartsWith(target, prefix)) { return true; }
-	//TODO: Implement me!
-	return false;
+	if (target.length < prefix.length) { return false; }
+	return StrAnyCaseEquals(StrSlice(target, 0, prefix.length), prefix);
 }
 PEXPI bool StrAnyCaseEndsWith(Str8 target, Str8 suffix)
 {
-	if (StrExactEndsWith(target, suffix)) { return true; }
-	//TODO: Implement me!
-	return false;
+	if (target.length < suffix.length) { return false; }
+	return StrAnyCaseEquals(StrSlice(target, target.length - suffix.length, target.length), suffix);
 }
 PEXPI bool StrAnyCaseContains(Str8 haystack, Str8 needle)
 {
-	if (StrExactContains(haystack, needle)) { return true; }
-	//TODO: Implement me!
-	return false;
+	Assert(needle.length > 0);
+	if (haystack.length < needle.length) { return false; }
+	return (MemFindBytesAnyCase(haystack.bytes, haystack.length, needle.bytes, needle.length) < haystack.length);
 }
 
 PEXPI bool StrEquals(Str8 left, Str8 right, bool caseSensitive)
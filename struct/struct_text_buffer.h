@@ -0,0 +1,514 @@
+/*
+File:   struct_text_buffer.h
+Author: Taylor Robbins
+Date:   10\19\2026
+Description:
+	** Defines a TextBuffer which is a gap buffer of UTF-8 bytes allocated from an Arena.
+	** The "gap" is an unused region in the middle of the allocation that sits at the
+	** edit location (usually the cursor). Inserting or deleting at the gap is O(1)
+	** amortized, only moving the gap to a different location costs anything, and that
+	** cost is proportional to the distance moved, not the size of the document.
+	** We also keep an index of where each line starts so that line lookups are O(log n)
+	** and the index is kept up-to-date with the same gap trick: Line starts before
+	** the gap are stored as offsets from the beginning of the text and line starts
+	** after the gap are stored as offsets from the end of the text so an edit at the
+	** gap never has to touch any entries other than the ones it adds or removes.
+	** NOTE: All indices in the TextBuffer API are byte indices into the logical text (the gap is invisible to the caller)
+*/
+
+/*
+* stb_textedit Usage Example:
+*	//stb_textedit.h v1.14 deals in single STB_TEXTEDIT_CHARTYPE units so we give it bytes.
+*	//LAYOUTROW should give 0 width to UTF-8 continuation bytes and after K_LEFT/K_RIGHT
+*	//you can snap state->cursor with TextBufferPrevCharIndex/TextBufferNextCharIndex
+*	#define STB_TEXTEDIT_STRING           TextBuffer
+*	#define STB_TEXTEDIT_CHARTYPE         char
+*	#define STB_TEXTEDIT_NEWLINE          '\n'
+*	#define STB_TEXTEDIT_STRINGLEN(obj)   TextBufferStbStringLen(obj)
+*	#define STB_TEXTEDIT_GETCHAR(obj, i)  TextBufferStbGetChar((obj), (i))
+*	#define STB_TEXTEDIT_INSERTCHARS(obj, i, chars, n) TextBufferStbInsertChars((obj), (i), (chars), (n))
+*	#define STB_TEXTEDIT_DELETECHARS(obj, i, n) TextBufferStbDeleteChars((obj), (i), (n))
+*	#define STB_TEXTEDIT_LAYOUTROW(row, obj, i) do { (row)->num_chars = TextBufferStbRowLength((obj), (i)); ... } while(0)
+*	#define STB_TEXTEDIT_IMPLEMENTATION
+*	#include "third_party/stb/stb_textedit.h"
+*/
+
+#ifndef _STRUCT_TEXT_BUFFER_H
+#define _STRUCT_TEXT_BUFFER_H
+
+#include "base/base_defines_check.h"
+#include "base/base_typedefs.h"
+#include "base/base_macros.h"
+#include "base/base_assert.h"
+#include "base/base_unicode.h"
+#include "std/std_memset.h"
+#include "std/std_basic_math.h"
+#include "mem/mem_arena.h"
+#include "struct/struct_string.h"
+
+#define TEXT_BUFFER_MIN_SIZE       64 //bytes
+#define TEXT_BUFFER_MIN_LINE_COUNT 16 //lines
+
+// +--------------------------------------------------------------+
+// |                        Data Structure                        |
+// +--------------------------------------------------------------+
+typedef struct TextBuffer TextBuffer;
+struct TextBuffer
+{
+	Arena* arena; //doubles as IsInit check
+	
+	uxx allocLength;
+	u8* chars;
+	uxx gapStart; //this is also the logical index of the gap
+	uxx gapEnd;
+	
+	//lineStarts is a gap array too: [0, numLinesBefore) are offsets from the start of the text
+	//and [lineAllocCount-numLinesAfter, lineAllocCount) are offsets from the end of the text
+	uxx lineAllocCount;
+	uxx* lineStarts;
+	uxx numLinesBefore;
+	uxx numLinesAfter;
+};
+
+// +--------------------------------------------------------------+
+// |                 Header Function Declarations                 |
+// +--------------------------------------------------------------+
+#if !PIG_CORE_IMPLEMENTATION
+	void InitTextBuffer(TextBuffer* buffer, Arena* arena, uxx initialCapacity);
+	void InitTextBufferWithStr(TextBuffer* buffer, Arena* arena, Str8 initialText);
+	PIG_CORE_INLINE bool IsTextBufferInit(const TextBuffer* buffer);
+	void FreeTextBuffer(TextBuffer* buffer);
+	void TextBufferClear(TextBuffer* buffer);
+	PIG_CORE_INLINE uxx TextBufferGetLength(const TextBuffer* buffer);
+	PIG_CORE_INLINE uxx TextBufferGetGapSize(const TextBuffer* buffer);
+	PIG_CORE_INLINE u8 TextBufferGetByte(const TextBuffer* buffer, uxx index);
+	bool TextBufferExpandLines(TextBuffer* buffer, uxx numNewLines);
+	bool TextBufferExpand(TextBuffer* buffer, uxx gapSizeRequired);
+	void TextBufferMoveGap(TextBuffer* buffer, uxx index);
+	bool TextBufferInsert(TextBuffer* buffer, uxx index, Str8 text);
+	PIG_CORE_INLINE bool TextBufferInsertAtGap(TextBuffer* buffer, Str8 text);
+	void TextBufferDelete(TextBuffer* buffer, uxx index, uxx numBytes);
+	PIG_CORE_INLINE void TextBufferGetSlices(const TextBuffer* buffer, Str8* beforeGapOut, Str8* afterGapOut);
+	Str8 TextBufferGetContiguousStr(TextBuffer* buffer);
+	void TextBufferCopyRange(const TextBuffer* buffer, uxx startIndex, uxx numBytes, void* bufferOut);
+	PIG_CORE_INLINE uxx TextBufferGetNumLines(const TextBuffer* buffer);
+	PIG_CORE_INLINE uxx TextBufferGetLineStart(const TextBuffer* buffer, uxx lineIndex);
+	uxx TextBufferGetLineEnd(const TextBuffer* buffer, uxx lineIndex, bool includeNewLine);
+	uxx TextBufferGetLineIndex(const TextBuffer* buffer, uxx index);
+	u8 TextBufferGetCodepointAt(const TextBuffer* buffer, uxx index, u32* codepointOut);
+	uxx TextBufferNextCharIndex(const TextBuffer* buffer, uxx index);
+	uxx TextBufferPrevCharIndex(const TextBuffer* buffer, uxx index);
+	PIG_CORE_INLINE int TextBufferStbStringLen(const TextBuffer* buffer);
+	PIG_CORE_INLINE char TextBufferStbGetChar(const TextBuffer* buffer, int index);
+	PIG_CORE_INLINE int TextBufferStbInsertChars(TextBuffer* buffer, int index, const char* chars, int numChars);
+	PIG_CORE_INLINE void TextBufferStbDeleteChars(TextBuffer* buffer, int index, int numChars);
+	PIG_CORE_INLINE int TextBufferStbRowLength(const TextBuffer* buffer, int startIndex);
+#endif //!PIG_CORE_IMPLEMENTATION
+
+// +--------------------------------------------------------------+
+// |                   Function Implementations                   |
+// +--------------------------------------------------------------+
+#if PIG_CORE_IMPLEMENTATION
+
+PEXP bool TextBufferExpand(TextBuffer* buffer, uxx gapSizeRequired);
+PEXP bool TextBufferInsert(TextBuffer* buffer, uxx index, Str8 text);
+
+// +--------------------------------------------------------------+
+// |                    Initialize TextBuffer                     |
+// +--------------------------------------------------------------+
+PEXP void InitTextBuffer(TextBuffer* buffer, Arena* arena, uxx initialCapacity)
+{
+	NotNull(buffer);
+	NotNull(arena);
+	ClearPointer(buffer);
+	buffer->arena = arena;
+	
+	buffer->lineAllocCount = TEXT_BUFFER_MIN_LINE_COUNT;
+	buffer->lineStarts = AllocArray(uxx, arena, buffer->lineAllocCount);
+	NotNull(buffer->lineStarts);
+	buffer->lineStarts[0] = 0; //line 0 always starts at 0 and always lives in the "before" half
+	buffer->numLinesBefore = 1;
+	
+	TextBufferExpand(buffer, initialCapacity);
+}
+PEXP void InitTextBufferWithStr(TextBuffer* buffer, Arena* arena, Str8 initialText)
+{
+	NotNullStr(initialText);
+	InitTextBuffer(buffer, arena, initialText.length);
+	TextBufferInsert(buffer, 0, initialText);
+}
+
+PEXPI bool IsTextBufferInit(const TextBuffer* buffer)
+{
+	return (buffer->arena != nullptr);
+}
+
+PEXP void FreeTextBuffer(TextBuffer* buffer)
+{
+	NotNull(buffer);
+	Assert(IsTextBufferInit(buffer));
+	if (CanArenaFree(buffer->arena))
+	{
+		if (buffer->chars != nullptr) { FreeMem(buffer->arena, buffer->chars, buffer->allocLength); }
+		if (buffer->lineStarts != nullptr) { FreeMem(buffer->arena, buffer->lineStarts, sizeof(uxx) * buffer->lineAllocCount); }
+	}
+	ClearPointer(buffer);
+}
+
+//NOTE: Keeps the allocations around, the whole allocation becomes gap
+PEXP void TextBufferClear(TextBuffer* buffer)
+{
+	NotNull(buffer);
+	Assert(IsTextBufferInit(buffer));
+	buffer->gapStart = 0;
+	buffer->gapEnd = buffer->allocLength;
+	buffer->numLinesBefore = 1;
+	buffer->numLinesAfter = 0;
+}
+
+// +--------------------------------------------------------------+
+// |                      Basic Information                       |
+// +--------------------------------------------------------------+
+PEXPI uxx TextBufferGetLength(const TextBuffer* buffer)
+{
+	DebugNotNull(buffer);
+	return buffer->allocLength - (buffer->gapEnd - buffer->gapStart);
+}
+PEXPI uxx TextBufferGetGapSize(const TextBuffer* buffer)
+{
+	DebugNotNull(buffer);
+	return (buffer->gapEnd - buffer->gapStart);
+}
+
+PEXPI u8 TextBufferGetByte(const TextBuffer* buffer, uxx index)
+{
+	DebugNotNull(buffer);
+	DebugAssert(index < TextBufferGetLength(buffer));
+	return (index < buffer->gapStart) ? buffer->chars[index] : buffer->chars[index + (buffer->gapEnd - buffer->gapStart)];
+}
+
+// +--------------------------------------------------------------+
+// |                       Gap Management                         |
+// +--------------------------------------------------------------+
+//Makes sure there's room in the lineStarts array for at least numNewLines more entries
+PEXP bool TextBufferExpandLines(TextBuffer* buffer, uxx numNewLines)
+{
+	uxx numLines = buffer->numLinesBefore + buffer->numLinesAfter;
+	if (numLines + numNewLines <= buffer->lineAllocCount) { return true; }
+	
+	uxx newCount = buffer->lineAllocCount;
+	while (newCount < numLines + numNewLines)
+	{
+		//double in size, but don't overflow uxx type
+		newCount = (newCount <= UINTXX_MAX/2) ? (newCount*2) : UINTXX_MAX;
+	}
+	uxx* newLineStarts = AllocArray(uxx, buffer->arena, newCount);
+	if (newLineStarts == nullptr) { AssertMsg(false, "Failed to expand TextBuffer line index!"); return false; }
+	
+	MyMemCopy(&newLineStarts[0], &buffer->lineStarts[0], sizeof(uxx) * buffer->numLinesBefore);
+	MyMemCopy(&newLineStarts[newCount - buffer->numLinesAfter], &buffer->lineStarts[buffer->lineAllocCount - buffer->numLinesAfter], sizeof(uxx) * buffer->numLinesAfter);
+	if (CanArenaFree(buffer->arena)) { FreeMem(buffer->arena, buffer->lineStarts, sizeof(uxx) * buffer->lineAllocCount); }
+	
+	buffer->lineStarts = newLineStarts;
+	buffer->lineAllocCount = newCount;
+	return true;
+}
+
+//Grows the allocation (if needed) so the gap is at least gapSizeRequired bytes. Returns true if a reallocation happened
+PEXP bool TextBufferExpand(TextBuffer* buffer, uxx gapSizeRequired) //pre-declared at top of file
+{
+	NotNull(buffer);
+	NotNull(buffer->arena);
+	uxx gapSize = TextBufferGetGapSize(buffer);
+	if (gapSize >= gapSizeRequired) { return false; }
+	
+	uxx textLength = TextBufferGetLength(buffer);
+	uxx newLength = (buffer->allocLength > 0) ? buffer->allocLength : TEXT_BUFFER_MIN_SIZE;
+	while (newLength < textLength + gapSizeRequired)
+	{
+		//double in size, but don't overflow uxx type
+		newLength = (newLength <= UINTXX_MAX/2) ? (newLength*2) : UINTXX_MAX;
+	}
+	
+	u8* newChars = (u8*)AllocMem(buffer->arena, newLength);
+	if (newChars == nullptr) { AssertMsg(false, "Failed to expand TextBuffer!"); return false; }
+	
+	uxx numCharsAfter = buffer->allocLength - buffer->gapEnd;
+	if (buffer->gapStart > 0) { MyMemCopy(&newChars[0], &buffer->chars[0], buffer->gapStart); }
+	if (numCharsAfter > 0) { MyMemCopy(&newChars[newLength - numCharsAfter], &buffer->chars[buffer->gapEnd], numCharsAfter); }
+	if (buffer->chars != nullptr && CanArenaFree(buffer->arena)) { FreeMem(buffer->arena, buffer->chars, buffer->allocLength); }
+	
+	buffer->chars = newChars;
+	buffer->allocLength = newLength;
+	buffer->gapEnd = newLength - numCharsAfter;
+	return true;
+}
+
+//Moves the gap so it starts at the logical index given. This costs O(distance) and
+//subsequent edits at that index become O(1) (amortized when they need to expand)
+PEXP void TextBufferMoveGap(TextBuffer* buffer, uxx index)
+{
+	NotNull(buffer);
+	uxx textLength = TextBufferGetLength(buffer);
+	Assert(index <= textLength);
+	if (index == buffer->gapStart) { return; }
+	
+	if (index < buffer->gapStart)
+	{
+		uxx numBytes = buffer->gapStart - index;
+		MyMemMove(&buffer->chars[buffer->gapEnd - numBytes], &buffer->chars[index], numBytes);
+		buffer->gapStart -= numBytes;
+		buffer->gapEnd -= numBytes;
+		//Any line starts that are now after the gap move over to the after half
+		while (buffer->numLinesBefore > 1 && buffer->lineStarts[buffer->numLinesBefore-1] > index)
+		{
+			uxx lineStart = buffer->lineStarts[buffer->numLinesBefore-1];
+			buffer->numLinesBefore--;
+			buffer->numLinesAfter++;
+			buffer->lineStarts[buffer->lineAllocCount - buffer->numLinesAfter] = textLength - lineStart;
+		}
+	}
+	else
+	{
+		uxx numBytes = index - buffer->gapStart;
+		MyMemMove(&buffer->chars[buffer->gapStart], &buffer->chars[buffer->gapEnd], numBytes);
+		buffer->gapStart += numBytes;
+		buffer->gapEnd += numBytes;
+		//Any line starts that are now before (or at) the gap move over to the before half
+		while (buffer->numLinesAfter > 0 && textLength - buffer->lineStarts[buffer->lineAllocCount - buffer->numLinesAfter] <= index)
+		{
+			uxx lineStart = textLength - buffer->lineStarts[buffer->lineAllocCount - buffer->numLinesAfter];
+			buffer->numLinesAfter--;
+			buffer->lineStarts[buffer->numLinesBefore] = lineStart;
+			buffer->numLinesBefore++;
+		}
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                       Insert and Delete                      |
+// +--------------------------------------------------------------+
+PEXP bool TextBufferInsert(TextBuffer* buffer, uxx index, Str8 text) //pre-declared at top of file
+{
+	NotNull(buffer);
+	NotNullStr(text);
+	if (text.length == 0) { return true; }
+	
+	uxx numNewLines = 0;
+	for (uxx bIndex = 0; bIndex < text.length; bIndex++) { if (text.chars[bIndex] == '\n') { numNewLines++; } }
+	if (!TextBufferExpandLines(buffer, numNewLines)) { return false; }
+	
+	TextBufferMoveGap(buffer, index);
+	TextBufferExpand(buffer, text.length);
+	if (TextBufferGetGapSize(buffer) < text.length) { return false; }
+	
+	MyMemCopy(&buffer->chars[buffer->gapStart], text.bytes, text.length);
+	if (numNewLines > 0)
+	{
+		for (uxx bIndex = 0; bIndex < text.length; bIndex++)
+		{
+			if (text.chars[bIndex] == '\n')
+			{
+				buffer->lineStarts[buffer->numLinesBefore] = buffer->gapStart + bIndex + 1;
+				buffer->numLinesBefore++;
+			}
+		}
+	}
+	buffer->gapStart += text.length;
+	return true;
+}
+PEXPI bool TextBufferInsertAtGap(TextBuffer* buffer, Str8 text) { return TextBufferInsert(buffer, buffer->gapStart, text); }
+
+//NOTE: If index is at the gap this works like pressing Delete, if index+numBytes is at the gap it works like Backspace, both are O(1)
+PEXP void TextBufferDelete(TextBuffer* buffer, uxx index, uxx numBytes)
+{
+	NotNull(buffer);
+	uxx textLength = TextBufferGetLength(buffer);
+	Assert(index + numBytes <= textLength);
+	if (numBytes == 0) { return; }
+	
+	if (index + numBytes == buffer->gapStart)
+	{
+		buffer->gapStart = index;
+		//Line starts s where byte s-1 was deleted are now in (index, index+numBytes]
+		while (buffer->numLinesBefore > 1 && buffer->lineStarts[buffer->numLinesBefore-1] > index) { buffer->numLinesBefore--; }
+	}
+	else
+	{
+		TextBufferMoveGap(buffer, index);
+		buffer->gapEnd += numBytes;
+		//Line starts in (index, index+numBytes] are at the beginning of the after half (stored as offsets from the end of the old text)
+		while (buffer->numLinesAfter > 0 && textLength - buffer->lineStarts[buffer->lineAllocCount - buffer->numLinesAfter] <= index + numBytes)
+		{
+			buffer->numLinesAfter--;
+		}
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                       Getting Contents                       |
+// +--------------------------------------------------------------+
+//Zero-copy access to the two halves of the text, these are invalidated by the next edit
+PEXPI void TextBufferGetSlices(const TextBuffer* buffer, Str8* beforeGapOut, Str8* afterGapOut)
+{
+	DebugNotNull(buffer);
+	SetOptionalOutPntr(beforeGapOut, NewStr8(buffer->gapStart, buffer->chars));
+	SetOptionalOutPntr(afterGapOut, NewStr8(buffer->allocLength - buffer->gapEnd, (buffer->chars != nullptr) ? &buffer->chars[buffer->gapEnd] : nullptr));
+}
+
+//Moves the gap to the end of the text so the whole text is contiguous. The result is invalidated by the next edit
+PEXP Str8 TextBufferGetContiguousStr(TextBuffer* buffer)
+{
+	NotNull(buffer);
+	uxx textLength = TextBufferGetLength(buffer);
+	TextBufferMoveGap(buffer, textLength);
+	return NewStr8(textLength, buffer->chars);
+}
+
+PEXP void TextBufferCopyRange(const TextBuffer* buffer, uxx startIndex, uxx numBytes, void* bufferOut)
+{
+	NotNull(buffer);
+	Assert(startIndex + numBytes <= TextBufferGetLength(buffer));
+	Assert(bufferOut != nullptr || numBytes == 0);
+	u8* outPntr = (u8*)bufferOut;
+	uxx gapSize = TextBufferGetGapSize(buffer);
+	if (startIndex < buffer->gapStart)
+	{
+		uxx numBytesBefore = MinUXX(numBytes, buffer->gapStart - startIndex);
+		MyMemCopy(outPntr, &buffer->chars[startIndex], numBytesBefore);
+		outPntr += numBytesBefore;
+		startIndex += numBytesBefore;
+		numBytes -= numBytesBefore;
+	}
+	if (numBytes > 0) { MyMemCopy(outPntr, &buffer->chars[startIndex + gapSize], numBytes); }
+}
+
+// +--------------------------------------------------------------+
+// |                          Line Index                          |
+// +--------------------------------------------------------------+
+PEXPI uxx TextBufferGetNumLines(const TextBuffer* buffer)
+{
+	DebugNotNull(buffer);
+	return buffer->numLinesBefore + buffer->numLinesAfter;
+}
+
+PEXPI uxx TextBufferGetLineStart(const TextBuffer* buffer, uxx lineIndex)
+{
+	DebugNotNull(buffer);
+	DebugAssert(lineIndex < TextBufferGetNumLines(buffer));
+	if (lineIndex < buffer->numLinesBefore) { return buffer->lineStarts[lineIndex]; }
+	return TextBufferGetLength(buffer) - buffer->lineStarts[buffer->lineAllocCount - buffer->numLinesAfter + (lineIndex - buffer->numLinesBefore)];
+}
+
+PEXP uxx TextBufferGetLineEnd(const TextBuffer* buffer, uxx lineIndex, bool includeNewLine)
+{
+	NotNull(buffer);
+	uxx numLines = TextBufferGetNumLines(buffer);
+	Assert(lineIndex < numLines);
+	if (lineIndex+1 >= numLines) { return TextBufferGetLength(buffer); }
+	uxx nextLineStart = TextBufferGetLineStart(buffer, lineIndex+1);
+	//NOTE: We treat \r\n as a single line ending when includeNewLine is false
+	if (includeNewLine) { return nextLineStart; }
+	if (nextLineStart >= 2 && TextBufferGetByte(buffer, nextLineStart-2) == '\r') { return nextLineStart-2; }
+	return nextLineStart-1;
+}
+
+//Binary search for the line that contains the byte at index (index == length is allowed and returns the last line)
+PEXP uxx TextBufferGetLineIndex(const TextBuffer* buffer, uxx index)
+{
+	NotNull(buffer);
+	Assert(index <= TextBufferGetLength(buffer));
+	uxx low = 0;
+	uxx high = TextBufferGetNumLines(buffer);
+	while (high - low > 1)
+	{
+		uxx middle = low + (high - low)/2;
+		if (TextBufferGetLineStart(buffer, middle) <= index) { low = middle; }
+		else { high = middle; }
+	}
+	return low;
+}
+
+// +--------------------------------------------------------------+
+// |                    UTF-8 Cursor Movement                     |
+// +--------------------------------------------------------------+
+//Returns the number of bytes the UTF-8 encoded character at index takes up, or 0 if the encoding is invalid (or index is at the end)
+PEXP u8 TextBufferGetCodepointAt(const TextBuffer* buffer, uxx index, u32* codepointOut)
+{
+	NotNull(buffer);
+	uxx textLength = TextBufferGetLength(buffer);
+	Assert(index <= textLength);
+	u8 encodedBytes[UTF8_MAX_CHAR_SIZE];
+	uxx numBytes = MinUXX(UTF8_MAX_CHAR_SIZE, textLength - index);
+	if (index + numBytes <= buffer->gapStart || index >= buffer->gapStart)
+	{
+		//Fast path: The character doesn't straddle the gap so we can decode in place
+		uxx physicalIndex = (index < buffer->gapStart) ? index : index + TextBufferGetGapSize(buffer);
+		return GetCodepointForUtf8(numBytes, (const char*)&buffer->chars[physicalIndex], codepointOut);
+	}
+	TextBufferCopyRange(buffer, index, numBytes, &encodedBytes[0]);
+	return GetCodepointForUtf8(numBytes, (const char*)&encodedBytes[0], codepointOut);
+}
+
+//Invalid bytes are stepped over one at a time so the cursor can never get stuck
+PEXP uxx TextBufferNextCharIndex(const TextBuffer* buffer, uxx index)
+{
+	uxx textLength = TextBufferGetLength(buffer);
+	if (index >= textLength) { return textLength; }
+	u8 charSize = TextBufferGetCodepointAt(buffer, index, nullptr);
+	return index + ((charSize > 0) ? charSize : 1);
+}
+
+PEXP uxx TextBufferPrevCharIndex(const TextBuffer* buffer, uxx index)
+{
+	NotNull(buffer);
+	Assert(index <= TextBufferGetLength(buffer));
+	if (index == 0) { return 0; }
+	//Walk back over continuation bytes (10xx xxxx) to find the leading byte, then make sure it actually encodes up to index
+	for (u8 encodedSize = 1; encodedSize <= UTF8_MAX_CHAR_SIZE && encodedSize <= index; encodedSize++)
+	{
+		u8 byte = TextBufferGetByte(buffer, index - encodedSize);
+		if ((byte & 0xC0) != 0x80)
+		{
+			if (TextBufferGetCodepointAt(buffer, index - encodedSize, nullptr) == encodedSize) { return index - encodedSize; }
+			break;
+		}
+	}
+	return index-1;
+}
+
+// +--------------------------------------------------------------+
+// |                    stb_textedit Callbacks                    |
+// +--------------------------------------------------------------+
+PEXPI int TextBufferStbStringLen(const TextBuffer* buffer)
+{
+	uxx textLength = TextBufferGetLength(buffer);
+	DebugAssert(textLength <= INT32_MAX);
+	return (int)textLength;
+}
+PEXPI char TextBufferStbGetChar(const TextBuffer* buffer, int index)
+{
+	DebugAssert(index >= 0);
+	return (char)TextBufferGetByte(buffer, (uxx)index);
+}
+PEXPI int TextBufferStbInsertChars(TextBuffer* buffer, int index, const char* chars, int numChars)
+{
+	DebugAssert(index >= 0 && numChars >= 0);
+	return TextBufferInsert(buffer, (uxx)index, NewStr8((uxx)numChars, chars)) ? 1 : 0;
+}
+PEXPI void TextBufferStbDeleteChars(TextBuffer* buffer, int index, int numChars)
+{
+	DebugAssert(index >= 0 && numChars >= 0);
+	TextBufferDelete(buffer, (uxx)index, (uxx)numChars);
+}
+//Returns the number of bytes from startIndex up to and including the next \n (this is the num_chars for an unwrapped StbTexteditRow)
+PEXPI int TextBufferStbRowLength(const TextBuffer* buffer, int startIndex)
+{
+	DebugAssert(startIndex >= 0);
+	uxx lineIndex = TextBufferGetLineIndex(buffer, (uxx)startIndex);
+	return (int)(TextBufferGetLineEnd(buffer, lineIndex, true) - (uxx)startIndex);
+}
+
+#endif //PIG_CORE_IMPLEMENTATION
+
+#endif //  _STRUCT_TEXT_BUFFER_H
@@ -407,6 +407,135 @@ int main(int argc, char* argv[])
 	}
 	#endif
 	
+	// +==============================+
+	// |         Easing Tests         |
+	// +==============================+
+	#if 0
+	{
+		r32 easeInputs[37];
+		r32 easeOutputs[37];
+		for (uxx iIndex = 0; iIndex < ArrayCount(easeInputs); iIndex++) { easeInputs[iIndex] = (r32)iIndex / (r32)(ArrayCount(easeInputs)-1); }
+		for (uxx sIndex = EasingStyle_Linear; sIndex < EasingStyle_NumStyles; sIndex++)
+		{
+			EasingStyle style = (EasingStyle)sIndex;
+			EaseArray(style, &easeInputs[0], &easeOutputs[0], ArrayCount(easeInputs));
+			EasingLut lut;
+			InitEasingLut(&lut, stdHeap, style, 0);
+			r32 maxLutError = 0.0f;
+			for (uxx iIndex = 0; iIndex < ArrayCount(easeInputs); iIndex++)
+			{
+				Assert(AbsR32(easeOutputs[iIndex] - Ease(style, easeInputs[iIndex])) <= 0.000001f);
+				maxLutError = MaxR32(maxLutError, AbsR32(EaseWithLut(&lut, easeInputs[iIndex]) - easeOutputs[iIndex]));
+			}
+			PrintLine_D("%s: EaseArray matches, LUT max error %f", GetEasingStyleStr(style), maxLutError);
+			FreeEasingLut(&lut);
+		}
+	}
+	#endif
+	
+	// +==============================+
+	// |      Poisson Disk Tests      |
+	// +==============================+
+	#if 0
+	{
+		RandomSeries poissonRandom;
+		InitRandomSeriesDefault(&poissonRandom);
+		SeedRandomSeriesU64(&poissonRandom, 42);
+		const r32 radius = 3.0f;
+		PoissonDiskOptions options = NewPoissonDiskOptions(NewV2(10.0f, 20.0f), NewV2(100.0f, 50.0f), radius);
+		VarArray points = ZEROED;
+		uxx numPoints = GeneratePoissonDiskPointsEx(stdHeap, &poissonRandom, &options, &points);
+		Assert(numPoints == points.length);
+		Assert(numPoints > 100);
+		VarArrayLoop(&points, pIndex)
+		{
+			VarArrayLoopGetValue(v2, point, &points, pIndex);
+			Assert(point.X >= 10.0f && point.X <= 110.0f);
+			Assert(point.Y >= 20.0f && point.Y <= 70.0f);
+			for (uxx otherIndex = pIndex+1; otherIndex < points.length; otherIndex++)
+			{
+				v2 otherPoint = VarArrayGetValue(v2, &points, otherIndex);
+				Assert(LengthSquaredV2(SubV2(otherPoint, point)) >= radius*radius);
+			}
+		}
+		FreeVarArray(&points);
+		
+		options.maxNumPoints = 25;
+		Assert(GeneratePoissonDiskPointsEx(stdHeap, &poissonRandom, &options, &points) == 25);
+		FreeVarArray(&points);
+		PrintLine_D("Generated %llu poisson disk points", (u64)numPoints);
+	}
+	#endif
+	
+	// +==============================+
+	// |         Tween Tests          |
+	// +==============================+
+	#if 0
+	{
+		AnimCurve curve;
+		InitAnimCurve(&curve, stdHeap);
+		AddAnimCurveKeyframe(&curve, 10.0f, 5.0f, EasingStyle_Linear);
+		AddAnimCurveKeyframe(&curve, 0.0f, 0.0f, EasingStyle_QuadraticIn); //out of order on purpose, keyframes get sorted by time
+		AddAnimCurveKeyframe(&curve, 20.0f, -5.0f, EasingStyle_None);
+		Assert(GetAnimCurveDuration(&curve) == 20.0f);
+		Assert(EvaluateAnimCurve(&curve, -1.0f) == 0.0f);
+		Assert(EvaluateAnimCurve(&curve, 10.0f) == 5.0f);
+		Assert(EvaluateAnimCurve(&curve, 25.0f) == -5.0f);
+		Assert(AbsR32(EvaluateAnimCurve(&curve, 5.0f) - 1.25f) <= 0.00001f);
+		Assert(AbsR32(EvaluateAnimCurve(&curve, 15.0f) - 0.0f) <= 0.00001f);
+		
+		TweenManager tweens;
+		InitTweenManager(&tweens, stdHeap);
+		r32 linearValue = 0.0f;
+		r32 cubicValue = 0.0f;
+		r32 curveValue = 0.0f;
+		int numFinished = 0;
+		TweenHandle linearHandle = AddTween(&tweens, &linearValue, 0.0f, 100.0f, 10.0f, EasingStyle_Linear);
+		TweenHandle cubicHandle = AddTweenEx(&tweens, &cubicValue, 10.0f, 20.0f, 10.0f, 5.0f, EasingStyle_CubicOut, nullptr, nullptr, nullptr);
+		TweenHandle curveHandle = AddCurveTween(&tweens, &curveValue, &curve, 0.0f);
+		TweenHandle stoppedHandle = AddTween(&tweens, nullptr, 0.0f, 1.0f, 100.0f, EasingStyle_SineInOut);
+		Assert(tweens.numTweens == 4);
+		
+		UpdateTweens(&tweens, 5.0f);
+		Assert(AbsR32(linearValue - 50.0f) <= 0.0001f);
+		Assert(cubicValue == 10.0f); //still in its delay
+		Assert(AbsR32(curveValue - 1.25f) <= 0.0001f);
+		Assert(AbsR32(GetTweenValue(&tweens, stoppedHandle, -1.0f) - Ease(EasingStyle_SineInOut, 0.05f)) <= 0.0001f);
+		Assert(StopTween(&tweens, stoppedHandle, false));
+		Assert(!StopTween(&tweens, stoppedHandle, false));
+		Assert(!IsTweenActive(&tweens, stoppedHandle));
+		
+		UpdateTweens(&tweens, 5.0f);
+		Assert(linearValue == 100.0f);
+		Assert(!IsTweenActive(&tweens, linearHandle));
+		Assert(IsTweenActive(&tweens, cubicHandle));
+		Assert(AbsR32(cubicValue - LerpR32(10.0f, 20.0f, Ease(EasingStyle_CubicOut, 0.5f))) <= 0.0001f);
+		Assert(curveValue == 5.0f);
+		Assert(tweens.finished.length == 1);
+		numFinished += (int)tweens.finished.length;
+		DispatchFinishedTweens(&tweens);
+		
+		UpdateTweens(&tweens, 10.0f);
+		Assert(cubicValue == 20.0f);
+		Assert(curveValue == -5.0f);
+		Assert(!IsTweenActive(&tweens, curveHandle));
+		numFinished += (int)tweens.finished.length;
+		DispatchFinishedTweens(&tweens);
+		Assert(numFinished == 3);
+		Assert(tweens.numTweens == 0);
+		
+		//A new tween may reuse a freed slot but the generation keeps old handles from aliasing it
+		TweenHandle reusedHandle = AddTween(&tweens, nullptr, 0.0f, 1.0f, 1.0f, EasingStyle_Linear);
+		Assert(IsTweenActive(&tweens, reusedHandle));
+		Assert(!IsTweenActive(&tweens, linearHandle) && !IsTweenActive(&tweens, cubicHandle) && !IsTweenActive(&tweens, curveHandle));
+		StopAllTweens(&tweens);
+		Assert(!IsTweenActive(&tweens, reusedHandle));
+		
+		FreeTweenManager(&tweens);
+		FreeAnimCurve(&curve);
+	}
+	#endif
+	
 	// +==============================+
 	// |        Printing Tests        |
 	// +==============================+
@@ -432,10 +561,68 @@ int main(int argc, char* argv[])
 		}
 		PrintLine_D("print3 = \"%.*s\"", StrPrint(print3));
 		
+		char numberBuffer[FORMAT_R64_FIXED_MAX_CHARS(4)];
+		r64 testValues[] = { 0.1 + 0.2, 1e21, 5e-324, -1.0/3.0, 123456789.0 };
+		for (uxx vIndex = 0; vIndex < ArrayCount(testValues); vIndex++)
+		{
+			uxx shortestLength = FormatR64(testValues[vIndex], numberBuffer);
+			PrintLine_D("FormatR64(%.17g) = \"%.*s\"", testValues[vIndex], (int)shortestLength, numberBuffer);
+			uxx fixedLength = FormatR64Fixed(testValues[vIndex], 4, numberBuffer);
+			PrintLine_D("FormatR64Fixed(%.17g, 4) = \"%.*s\"", testValues[vIndex], (int)fixedLength, numberBuffer);
+		}
+		uxx hexLength = FormatHexU64(0xBEEF, numberBuffer, true, 8);
+		PrintLine_D("FormatHexU64(0xBEEF) = \"%.*s\"", (int)hexLength, numberBuffer);
+		
 		ScratchEnd(scratch);
 	}
 	#endif
 	
+	// +==============================+
+	// |       Expression Tests       |
+	// +==============================+
+	#if 0
+	{
+		ExprScope scope;
+		InitExprScope(&scope, stdHeap);
+		uxx levelHandle = AddExprVariable(&scope, StrLit("level"));
+		uxx bonusHandle = AddExprVariable(&scope, StrLit("bonus"));
+		AddExprConstant(&scope, StrLit("baseDamage"), 12.0);
+		
+		Expression damageExpr;
+		Result compileError = Result_None;
+		uxx errorIndex = 0;
+		bool compiled = TryCompileExpression(stdHeap, StrLit("baseDamage * pow(1.15, level - 1) + (bonus > 0 ? bonus : 0)"), &scope, &damageExpr, &compileError, &errorIndex);
+		Assert(compiled);
+		PrintLine_D("Compiled to %llu instructions, %llu constants", (u64)damageExpr.numInstructions, (u64)damageExpr.numConstants);
+		
+		r64 levels[100];
+		r64 results[100];
+		for (uxx lIndex = 0; lIndex < ArrayCount(levels); lIndex++) { levels[lIndex] = (r64)(lIndex+1); }
+		const r64* variableArrays[2];
+		r64 uniformValues[2];
+		variableArrays[levelHandle] = &levels[0];
+		variableArrays[bonusHandle] = nullptr;
+		uniformValues[bonusHandle] = 5.0;
+		EvaluateExpressionBatch(&damageExpr, ArrayCount(levels), &variableArrays[0], &uniformValues[0], &results[0]);
+		for (uxx lIndex = 0; lIndex < ArrayCount(levels); lIndex++)
+		{
+			r64 values[2];
+			values[levelHandle] = levels[lIndex];
+			values[bonusHandle] = 5.0;
+			Assert(EvaluateExpression(&damageExpr, &values[0]) == results[lIndex]);
+			Assert(AbsR64(results[lIndex] - (12.0 * PowR64(1.15, levels[lIndex] - 1) + 5.0)) < 0.0001);
+		}
+		PrintLine_D("Damage at level 10: %g", results[9]);
+		
+		compiled = TryCompileExpression(stdHeap, StrLit("level * (2 + "), &scope, &damageExpr, &compileError, &errorIndex);
+		Assert(!compiled);
+		PrintLine_D("Expected error: %s at index %llu", GetResultStr(compileError), (u64)errorIndex);
+		
+		FreeExpression(&damageExpr);
+		FreeExprScope(&scope);
+	}
+	#endif
+	
 	// +==============================+
 	// |        Hashing Tests         |
 	// +==============================+
@@ -462,8 +649,31 @@ int main(int argc, char* argv[])
 		PrintLine_D("MeowHash: %08X-%08X-%08X-%08X", meowHash1.parts[0], meowHash1.parts[1], meowHash1.parts[2], meowHash1.parts[3]);
 		Hash128 meowHash2 = MeowHashStr128(string);
 		PrintLine_D("MeowHash(\"%s\"): %08X-%08X-%08X-%08X", string.chars, meowHash2.parts[0], meowHash2.parts[1], meowHash2.parts[2], meowHash2.parts[3]);
+		MeowHashStream meowStream;
+		MeowHashStreamBegin(&meowStream);
+		MeowHashStreamAdd(&meowStream, &randomBuffer[0], 13);
+		MeowHashStreamAdd(&meowStream, &randomBuffer[13], sizeof(randomBuffer) - 13);
+		Assert(AreEqualHash128(MeowHashStreamEnd128(&meowStream), meowHash1));
 		#endif //MEOW_HASH_AVAILABLE
 		
+		u64 pigHash1 = PigHashU64(&randomBuffer[0], sizeof(randomBuffer));
+		PrintLine_D("pigHash1 = 0x%016llX", pigHash1);
+		Hash128 pigHash2 = PigHashStr128(string);
+		PrintLine_D("PigHashStr128(\"%s\"): %016llX-%016llX", string.chars, pigHash2.lower, pigHash2.upper);
+		PigHashStream pigStream;
+		PigHashStreamBegin(&pigStream, 0);
+		PigHashStreamAdd(&pigStream, &randomBuffer[0], 13);
+		PigHashStreamAdd(&pigStream, &randomBuffer[13], sizeof(randomBuffer) - 13);
+		Assert(PigHashStreamEndU64(&pigStream) == pigHash1);
+		
+		//Standard check values for the 9 ASCII bytes "123456789"
+		Assert(Crc32("123456789", 9) == 0xCBF43926);
+		Assert(Crc32c("123456789", 9) == 0xE3069283);
+		Assert(Crc32Ex(Crc32("12345", 5), "6789", 4) == 0xCBF43926);
+		Assert(CrcUpdateSlicing8(&Crc32cTables[0], 0xFFFFFFFF, (const u8*)"123456789", 9) == ~0xE3069283U); //software fallback, regardless of what hardware we have
+		u32 crc32Value = Crc32(&randomBuffer[0], sizeof(randomBuffer));
+		PrintLine_D("Crc32 = 0x%08X", crc32Value);
+		
 		PrintLine_D("Buffer after:  %02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X,%02X",
 			randomBuffer[0],  randomBuffer[1],  randomBuffer[2],  randomBuffer[3],  randomBuffer[4],  randomBuffer[5],  randomBuffer[6],  randomBuffer[7],
 			randomBuffer[8],  randomBuffer[9],  randomBuffer[10], randomBuffer[11], randomBuffer[12], randomBuffer[13], randomBuffer[14], randomBuffer[15],
@@ -473,6 +683,130 @@ int main(int argc, char* argv[])
 	}
 	#endif
 	
+	// +==============================+
+	// |        Encoding Tests        |
+	// +==============================+
+	#if 0
+	{
+		ScratchBegin(scratch);
+		u8 randomBuffer[45];
+		for (uxx bIndex = 0; bIndex < ArrayCount(randomBuffer); bIndex++) { randomBuffer[bIndex] = (u8)(bIndex * 37 + 11); }
+		Slice randomSlice = NewStr8(ArrayCount(randomBuffer), &randomBuffer[0]);
+		
+		Str8 hexStr = EncodeHexInArena(scratch, randomSlice, true);
+		PrintLine_D("Hex:       \"%.*s\"", StrPrint(hexStr));
+		Slice hexDecoded = Slice_Empty;
+		Assert(TryDecodeHexInArena(scratch, hexStr, &hexDecoded, nullptr, nullptr));
+		Assert(StrExactEquals(hexDecoded, randomSlice));
+		
+		for (uxx vIndex = 0; vIndex < 4; vIndex++)
+		{
+			bool urlSafe = IsFlagSet(vIndex, 0x01);
+			bool addPadding = IsFlagSet(vIndex, 0x02);
+			Slice partialSlice = NewStr8(randomSlice.length - vIndex, randomSlice.bytes);
+			Str8 base64Str = EncodeBase64InArena(scratch, partialSlice, urlSafe, addPadding);
+			PrintLine_D("Base64[%llu]: \"%.*s\"", vIndex, StrPrint(base64Str));
+			Assert(base64Str.length == GetBase64EncodedLength(partialSlice.length, addPadding));
+			Slice base64Decoded = Slice_Empty;
+			Assert(TryDecodeBase64InArena(scratch, base64Str, urlSafe, &base64Decoded, nullptr, nullptr));
+			Assert(StrExactEquals(base64Decoded, partialSlice));
+		}
+		
+		Result decodeError = Result_None;
+		uxx errorIndex = 0;
+		u8 decodeBuffer[8];
+		Assert(!TryDecodeHex(StrLit("0A1"), &decodeBuffer[0], &decodeError, &errorIndex) && decodeError == Result_UnexpectedEnd);
+		Assert(!TryDecodeHex(StrLit("0A1G"), &decodeBuffer[0], &decodeError, &errorIndex) && decodeError == Result_InvalidCharacter && errorIndex == 3);
+		Assert(!TryDecodeBase64(StrLit("Zm9v Yg="), &decodeBuffer[0], false, &decodeError, &errorIndex) && decodeError == Result_InvalidCharacter && errorIndex == 4);
+		Assert(!TryDecodeBase64(StrLit("Zm9vYh=="), &decodeBuffer[0], false, &decodeError, &errorIndex) && decodeError == Result_InvalidCharacter && errorIndex == 5);
+		ScratchEnd(scratch);
+	}
+	#endif
+	
+	// +==============================+
+	// |          JSON Tests          |
+	// +==============================+
+	#if 0
+	{
+		ScratchBegin(scratch);
+		Str8 jsonSource = StrLit("{ \"name\": \"Piggy\\u0021\", \"stats\": [1, -0, 0.5, 1e400, -2.5E-3], \"tags\": { \"emoji\": \"\\ud83d\\ude00\", \"empty\": [] }, \"alive\": true, \"owner\": null }");
+		JsonValue root = ZEROED;
+		Result parseError = Result_None;
+		uxx errorIndex = 0;
+		Assert(TryParseJson(scratch, jsonSource, &root, &parseError, &errorIndex));
+		Assert(root.type == JsonValueType_Object && root.numMembers == 5);
+		
+		JsonValue* nameValue = GetJsonMember(&root, StrLit("name"));
+		Assert(nameValue != nullptr && StrExactEquals(nameValue->str, StrLit("Piggy!")));
+		JsonValue* statsValue = GetJsonMember(&root, StrLit("stats"));
+		Assert(statsValue != nullptr && statsValue->numItems == 5);
+		Assert(GetJsonItem(statsValue, 0)->isInteger && GetJsonItem(statsValue, 0)->integer == 1);
+		Assert(!GetJsonItem(statsValue, 1)->isInteger && GetJsonItem(statsValue, 1)->number == 0.0 && signbit(GetJsonItem(statsValue, 1)->number)); //-0 keeps its sign
+		Assert(IsInfiniteR64(GetJsonItem(statsValue, 3)->number) && GetJsonItem(statsValue, 3)->number > 0); //out of r64 range becomes +infinity
+		JsonValue* emojiValue = GetJsonMember(GetJsonMember(&root, StrLit("tags")), StrLit("emoji"));
+		Assert(emojiValue != nullptr && StrExactEquals(emojiValue->str, StrLit("\xF0\x9F\x98\x80"))); //surrogate pair decodes to U+1F600
+		
+		//Parse -> write round trip (infinity has no JSON representation so it's written as null)
+		JsonWriter writer;
+		InitJsonWriter(&writer, scratch, false);
+		JsonWriteValue(&writer, &root);
+		Str8 jsonOutput = GetJsonWriterStr(&writer);
+		PrintLine_D("JSON: %.*s", StrPrint(jsonOutput));
+		Assert(StrExactEquals(jsonOutput, StrLit("{\"name\":\"Piggy!\",\"stats\":[1,-0,0.5,null,-0.0025],\"tags\":{\"emoji\":\"\xF0\x9F\x98\x80\",\"empty\":[]},\"alive\":true,\"owner\":null}")));
+		JsonValue reparsed = ZEROED;
+		Assert(TryParseJson(scratch, jsonOutput, &reparsed, nullptr, nullptr));
+		
+		Assert(!TryParseJson(scratch, StrLit("[1,]"), &root, &parseError, &errorIndex) && parseError == Result_UnexpectedToken && errorIndex == 3);
+		Assert(!TryParseJson(scratch, StrLit("{\"a\" 1}"), &root, &parseError, &errorIndex) && parseError == Result_UnexpectedToken && errorIndex == 5);
+		Assert(!TryParseJson(scratch, StrLit("[01]"), &root, &parseError, &errorIndex) && parseError == Result_UnexpectedToken && errorIndex == 2);
+		Assert(!TryParseJson(scratch, StrLit("\"a\\qb\""), &root, &parseError, &errorIndex) && parseError == Result_InvalidCharacter && errorIndex == 3);
+		Assert(!TryParseJson(scratch, StrLit("\"abc"), &root, &parseError, &errorIndex) && parseError == Result_UnexpectedEnd && errorIndex == 0);
+		ScratchEnd(scratch);
+	}
+	#endif
+	
+	// +==============================+
+	// |          CSV Tests           |
+	// +==============================+
+	#if 0
+	{
+		Str8 csvSource = StrLit("name,hp,speed,boss\r\nslime,10, 1.5 ,false\r\n\"king \"\"big\"\", slime\",250,0.25,TRUE\r\n\"bat\nswarm\",-3,1e2,0\r\nghost,7,fast,1\r\nzombie,1,1,0\r\n");
+		CsvReader reader;
+		InitCsvReader(&reader, stdHeap, csvSource, ',');
+		CsvRow header;
+		Assert(CsvReaderNextRow(&reader, &header) && header.numFields == 4);
+		Assert(FindCsvColumn(&header, StrLit("missing")) == CSV_INVALID_COLUMN);
+		
+		VarArray names; InitVarArray(Str8, &names, stdHeap);
+		VarArray hitpoints; InitVarArray(i32, &hitpoints, stdHeap);
+		VarArray speeds; InitVarArray(r64, &speeds, stdHeap);
+		VarArray bosses; InitVarArray(bool, &bosses, stdHeap);
+		CsvColumn columns[] = {
+			{ .fieldIndex=FindCsvColumn(&header, StrLit("name")),  .type=CsvColumnType_Str,  .values=&names     },
+			{ .fieldIndex=FindCsvColumn(&header, StrLit("hp")),    .type=CsvColumnType_I32,  .values=&hitpoints },
+			{ .fieldIndex=FindCsvColumn(&header, StrLit("speed")), .type=CsvColumnType_R64,  .values=&speeds    },
+			{ .fieldIndex=FindCsvColumn(&header, StrLit("boss")),  .type=CsvColumnType_Bool, .values=&bosses    },
+		};
+		
+		//The "ghost" row has a speed that isn't a number, reading stops there and none of the columns keep a value from that row
+		Assert(!TryCsvReadColumns(&reader, ArrayCount(columns), columns));
+		PrintLine_D("CSV error: %s at index %llu (row %llu)", GetResultStr(reader.error), (u64)reader.errorIndex, (u64)reader.rowIndex);
+		Assert(reader.error == Result_InvalidCharacter && reader.rowIndex == 4 && StrExactEquals(StrSlice(csvSource, reader.errorIndex, reader.errorIndex + 4), StrLit("fast")));
+		Assert(names.length == 3 && hitpoints.length == 3 && speeds.length == 3 && bosses.length == 3);
+		Assert(StrExactEquals(VarArrayGetValue(Str8, &names, 1), StrLit("king \"big\", slime")));
+		Assert(StrExactEquals(VarArrayGetValue(Str8, &names, 2), StrLit("bat\nswarm")));
+		Assert(VarArrayGetValue(i32, &hitpoints, 2) == -3);
+		Assert(VarArrayGetValue(r64, &speeds, 0) == 1.5 && VarArrayGetValue(r64, &speeds, 2) == 100.0);
+		Assert(!VarArrayGetValue(bool, &bosses, 0) && VarArrayGetValue(bool, &bosses, 1));
+		
+		FreeVarArray(&names);
+		FreeVarArray(&hitpoints);
+		FreeVarArray(&speeds);
+		FreeVarArray(&bosses);
+		FreeCsvReader(&reader);
+	}
+	#endif
+	
 	// +==============================+
 	// |        Unicode Tests         |
 	// +==============================+
@@ -506,6 +840,24 @@ int main(int argc, char* argv[])
 		PrintLine_D("unknownCharIndex = %llu", (u64)unknownCharIndex);
 		uxx firstChar2 = FindNextCharInStrEx(haystack, 0, StrLit("amg"), true);
 		PrintLine_D("firstChar2 = %llu", (u64)firstChar2);
+		CharSet wordCharSet = NewCharSet(StrLit(ALPHA_ALL_CHARS "\\\""));
+		uxx firstNonWordChar = FindNextCharNotInSet(haystack, 0, &wordCharSet); //should find the first space
+		PrintLine_D("firstNonWordChar = %llu", (u64)firstNonWordChar);
+		CharSet spaceCharSet = NewCharSet(StrLit(" "));
+		uxx firstUnquotedSpace = FindNextCharInSetEx(haystack, 5, &spaceCharSet, true); //should skip over the quoted part and find the space before "strang"
+		PrintLine_D("firstUnquotedSpace = %llu", (u64)firstUnquotedSpace);
+		//40 non-adjacent kanji need more ranges than a CharSet holds (CHAR_SET_MAX_RANGES) so the Str8 searches fall back to a per-codepoint scan
+		u8 manyKanjiBuffer[40*3];
+		uxx manyKanjiLength = 0;
+		for (u32 kIndex = 0; kIndex < 40; kIndex++) { manyKanjiLength += GetUtf8BytesForCode(0x4E00 + kIndex*2, &manyKanjiBuffer[manyKanjiLength], true); }
+		Str8 manyKanji = NewStr8(manyKanjiLength, &manyKanjiBuffer[0]);
+		Str8 kanjiHaystack = StrLit(u8"abc \u4E01\u4E4E"); //U+4E01 is not in manyKanji, U+4E4E (the last one) is
+		Assert(FindNextCharInStr(kanjiHaystack, 0, manyKanji) == 7);
+		Assert(FindNextUnknownCharInStr(kanjiHaystack, 4, manyKanji) == 4);
+		Assert(FindNextUnknownCharInStr(kanjiHaystack, 7, manyKanji) == kanjiHaystack.length);
+		bool unicodeAnyCaseEquals = StrUnicodeAnyCaseEquals(StrLit("\u00C9cole Kelvin"), StrLit("\u00E9COLE \u212Aelvin")); //should be true
+		PrintLine_D("unicodeAnyCaseEquals = %s", unicodeAnyCaseEquals ? "true" : "false");
+		PrintLine_D("Category of U+00E9 = %s, width of U+4E00 = %u", GetUnicodeCategoryStr(GetCodepointCategory(0x00E9)), GetCodepointDisplayWidth(0x4E00));
 	}
 	#endif
 	
@@ -620,6 +972,65 @@ int main(int argc, char* argv[])
 	}
 	#endif
 	
+	// +==============================+
+	// |      Aho-Corasick Tests      |
+	// +==============================+
+	#if 0
+	{
+		ScratchBegin(scratch);
+		AhoCorasick matcher;
+		InitAhoCorasick(&matcher, stdHeap, true);
+		AhoCorasickAddPattern(&matcher, StrLit("he"), StrLit("HE"));
+		AhoCorasickAddPattern(&matcher, StrLit("she"), StrLit("SHE"));
+		AhoCorasickAddPattern(&matcher, StrLit("his"), StrLit("HIS"));
+		AhoCorasickAddPattern(&matcher, StrLit("hers"), StrLit("HERS"));
+		AhoCorasickCompile(&matcher);
+		
+		//Overlapping matches are all reported, ordered by where they end
+		VarArray matches;
+		InitVarArray(AhoCorasickMatch, &matches, stdHeap);
+		uxx numMatches = AhoCorasickFindAll(&matcher, StrLit("uSHErs ahishers"), &matches);
+		Assert(numMatches == 7);
+		VarArrayLoop(&matches, mIndex)
+		{
+			VarArrayLoopGet(AhoCorasickMatch, match, &matches, mIndex);
+			PrintLine_D("Match[%llu]: pattern %llu at %llu (length %llu)", mIndex, match->patternIndex, match->index, match->length);
+		}
+		FreeVarArray(&matches);
+		
+		//Replace takes the leftmost-longest match and skips anything that overlaps it
+		Str8 replaced = AhoCorasickReplace(&matcher, scratch, StrLit("uSHErs ahishers"), false);
+		PrintLine_D("Replaced: \"%.*s\"", StrPrint(replaced));
+		Assert(StrExactEquals(replaced, StrLit("uSHErs aHISHERS")));
+		Assert(AhoCorasickReplace(&matcher, nullptr, StrLit("uSHErs ahishers"), false).length == replaced.length);
+		
+		FreeAhoCorasick(&matcher);
+		ScratchEnd(scratch);
+	}
+	#endif
+	
+	// +==============================+
+	// |       TextBuffer Tests       |
+	// +==============================+
+	#if 0
+	{
+		TextBuffer buffer;
+		InitTextBufferWithStr(&buffer, stdHeap, StrLit("Hello\nWorld!"));
+		TextBufferInsert(&buffer, 5, StrLit(",\nthere"));
+		TextBufferDelete(&buffer, 0, 1);
+		TextBufferInsertAtGap(&buffer, StrLit("h"));
+		for (uxx lIndex = 0; lIndex < TextBufferGetNumLines(&buffer); lIndex++)
+		{
+			uxx lineStart = TextBufferGetLineStart(&buffer, lIndex);
+			uxx lineEnd = TextBufferGetLineEnd(&buffer, lIndex, false);
+			PrintLine_D("Line[%llu] %llu-%llu", lIndex, lineStart, lineEnd);
+		}
+		Str8 contents = TextBufferGetContiguousStr(&buffer);
+		PrintLine_D("Contents (%llu bytes): \"%.*s\"", contents.length, StrPrint(contents));
+		FreeTextBuffer(&buffer);
+	}
+	#endif
+	
 	// +==============================+
 	// |          File Tests          |
 	// +==============================+